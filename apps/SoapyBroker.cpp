@@ -0,0 +1,525 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Errors.hpp>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <csignal>
+
+#ifdef _WIN32
+
+int SoapySDRBroker(const std::string &, const std::string &)
+{
+    std::cerr << "The device broker is not supported on this platform" << std::endl;
+    return EXIT_FAILURE;
+}
+
+#else
+
+#include "BrokerProtocol.hpp"
+#include <condition_variable>
+#include <stdexcept>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <map>
+#include <set>
+#include <new>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using SoapyBroker::Message;
+
+static sig_atomic_t loopDone = false;
+static void sigIntHandler(const int)
+{
+    loopDone = true;
+}
+
+//default number of slots in a shared memory ring
+static const size_t DEFAULT_SLOTS = 64;
+
+/***********************************************************************
+ * A receive stream shared by every client with the same channels
+ **********************************************************************/
+struct SharedStream
+{
+    std::string key;
+    SoapySDR::Stream *stream;
+    std::string shmName;
+    SoapyBroker::RingHeader *ring;
+    size_t mapSize;
+    size_t numUsers;
+    size_t numActive;
+    std::thread thread;
+    std::atomic<bool> running;
+};
+
+static void publishLoop(SoapySDR::Device *device, SharedStream *shared)
+{
+    auto ring = shared->ring;
+    std::vector<void *> buffs(ring->numChans);
+    while (shared->running)
+    {
+        //invalidate the slot before the device writes into it
+        const uint64_t seq = ring->writeSeq.load(std::memory_order_relaxed);
+        const size_t index = size_t(seq % ring->numSlots);
+        auto slot = SoapyBroker::ringSlot(ring, index);
+        slot->seq.store(SoapyBroker::INVALID_SEQ, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < buffs.size(); i++) buffs[i] = SoapyBroker::ringBuffer(ring, index, i);
+
+        int flags(0);
+        long long timeNs(0);
+        const int ret = device->readStream(shared->stream, buffs.data(), ring->slotElems, flags, timeNs, 100000);
+        if (ret == SOAPY_SDR_TIMEOUT) continue;
+        if (ret < 0 and ret != SOAPY_SDR_OVERFLOW) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        //publish the slot and wake up the readers
+        slot->ret = ret;
+        slot->flags = flags;
+        slot->timeNs = timeNs;
+        slot->seq.store(seq, std::memory_order_release);
+        SoapyBroker::lockRing(ring);
+        ring->writeSeq.store(seq+1, std::memory_order_release);
+        pthread_cond_broadcast(&ring->cond);
+        pthread_mutex_unlock(&ring->mutex);
+    }
+}
+
+/***********************************************************************
+ * Broker state shared by the client connections
+ **********************************************************************/
+class BrokerServer
+{
+public:
+    BrokerServer(SoapySDR::Device *device):
+        _device(device),
+        _nextId(0)
+    {
+        return;
+    }
+
+    ~BrokerServer(void)
+    {
+        for (auto &it : _streams)
+        {
+            this->stopStream(*it.second);
+            this->destroyStream(*it.second);
+        }
+    }
+
+    void serveClient(const int fd)
+    {
+        //stream ids used by this client and whether they are active
+        std::map<size_t, bool> clientStreams;
+
+        //a client which breaks the message limits is dropped
+        Message request, reply;
+        while (true)
+        {
+            try
+            {
+                if (not SoapyBroker::recvMessage(fd, request)) break;
+            }
+            catch (const std::exception &)
+            {
+                break;
+            }
+            try
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                reply = this->handle(request, clientStreams);
+                reply.insert(reply.begin(), "ok");
+            }
+            catch (const std::exception &ex)
+            {
+                reply = {"error", ex.what()};
+            }
+            if (not SoapyBroker::sendMessage(fd, reply)) break;
+        }
+
+        //release the streams of a client that went away
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto &it : clientStreams)
+        {
+            if (it.second) this->deactivate(it.first);
+            this->release(it.first);
+        }
+    }
+
+private:
+    Message handle(const Message &req, std::map<size_t, bool> &clientStreams);
+
+    SharedStream &getStream(const size_t id)
+    {
+        const auto it = _streams.find(id);
+        if (it == _streams.end()) throw std::runtime_error("unknown stream " + std::to_string(id));
+        return *it->second;
+    }
+
+    size_t setupStream(const std::vector<size_t> &channels, const SoapySDR::Kwargs &args);
+    void activate(const size_t id);
+    void deactivate(const size_t id);
+    void release(const size_t id);
+    void stopStream(SharedStream &shared);
+    void destroyStream(SharedStream &shared);
+
+    SoapySDR::Device *_device;
+    std::mutex _mutex;
+    std::map<size_t, std::unique_ptr<SharedStream>> _streams;
+    size_t _nextId;
+};
+
+/***********************************************************************
+ * Shared streams
+ **********************************************************************/
+size_t BrokerServer::setupStream(const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+{
+    //clients with the same channels share one stream
+    std::string key;
+    for (const auto ch : channels) key += std::to_string(ch) + ",";
+    for (auto &it : _streams)
+    {
+        if (it.second->key != key) continue;
+        it.second->numUsers++;
+        return it.first;
+    }
+
+    //the ring holds the native format of the device
+    double fullScale(0.0);
+    const auto format = _device->getNativeStreamFormat(SOAPY_SDR_RX, channels.empty()?0:channels.front(), fullScale);
+    std::unique_ptr<SharedStream> shared(new SharedStream());
+    shared->key = key;
+    shared->stream = _device->setupStream(SOAPY_SDR_RX, format, channels, args);
+    shared->numUsers = 1;
+    shared->numActive = 0;
+    shared->running = false;
+
+    const size_t numChans = channels.empty()?1:channels.size();
+    const size_t elemSize = SoapySDR::formatToSize(format);
+    const size_t numSlots = (args.count("slots") != 0)?SoapySDR::StringToSetting<size_t>(args.at("slots")):DEFAULT_SLOTS;
+    const size_t slotElems = _device->getStreamMTU(shared->stream);
+    shared->mapSize = SoapyBroker::ringSize(numChans, elemSize, numSlots, slotElems);
+    shared->shmName = "/SoapySDRBroker." + std::to_string(getpid()) + "." + std::to_string(_nextId);
+
+    const int fd = shm_open(shared->shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0 or ftruncate(fd, off_t(shared->mapSize)) != 0)
+    {
+        const std::string error(std::strerror(errno));
+        if (fd >= 0) close(fd);
+        shm_unlink(shared->shmName.c_str());
+        _device->closeStream(shared->stream);
+        throw std::runtime_error("shared memory " + shared->shmName + ": " + error);
+    }
+    void *mem = mmap(nullptr, shared->mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED)
+    {
+        shm_unlink(shared->shmName.c_str());
+        _device->closeStream(shared->stream);
+        throw std::runtime_error("mmap " + shared->shmName + ": " + std::strerror(errno));
+    }
+
+    auto ring = reinterpret_cast<SoapyBroker::RingHeader *>(mem);
+    ring->magic = SoapyBroker::RING_MAGIC;
+    ring->numChans = uint32_t(numChans);
+    ring->elemSize = uint32_t(elemSize);
+    ring->numSlots = uint32_t(numSlots);
+    ring->slotElems = uint32_t(slotElems);
+    std::strncpy(ring->format, format.c_str(), sizeof(ring->format)-1);
+    pthread_mutexattr_t mutexAttr;
+    pthread_mutexattr_init(&mutexAttr);
+    pthread_mutexattr_setpshared(&mutexAttr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&mutexAttr, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&ring->mutex, &mutexAttr);
+    pthread_mutexattr_destroy(&mutexAttr);
+    pthread_condattr_t condAttr;
+    pthread_condattr_init(&condAttr);
+    pthread_condattr_setpshared(&condAttr, PTHREAD_PROCESS_SHARED);
+    pthread_cond_init(&ring->cond, &condAttr);
+    pthread_condattr_destroy(&condAttr);
+    new (&ring->writeSeq) std::atomic<uint64_t>(0);
+    for (size_t i = 0; i < numSlots; i++)
+    {
+        new (&SoapyBroker::ringSlot(ring, i)->seq) std::atomic<uint64_t>(SoapyBroker::INVALID_SEQ);
+    }
+    shared->ring = ring;
+
+    const size_t id = _nextId++;
+    _streams[id] = std::move(shared);
+    return id;
+}
+
+void BrokerServer::activate(const size_t id)
+{
+    auto &shared = this->getStream(id);
+    if (shared.numActive++ != 0) return;
+    const int ret = _device->activateStream(shared.stream);
+    if (ret != 0)
+    {
+        shared.numActive--;
+        throw std::runtime_error("activateStream: " + std::string(SoapySDR::errToStr(ret)));
+    }
+    shared.running = true;
+    shared.thread = std::thread(&publishLoop, _device, &shared);
+}
+
+void BrokerServer::deactivate(const size_t id)
+{
+    auto &shared = this->getStream(id);
+    if (shared.numActive == 0 or --shared.numActive != 0) return;
+    this->stopStream(shared);
+}
+
+void BrokerServer::release(const size_t id)
+{
+    auto &shared = this->getStream(id);
+    if (--shared.numUsers != 0) return;
+    this->stopStream(shared);
+    this->destroyStream(shared);
+    _streams.erase(id);
+}
+
+void BrokerServer::stopStream(SharedStream &shared)
+{
+    if (not shared.running) return;
+    shared.running = false;
+    shared.thread.join();
+    _device->deactivateStream(shared.stream);
+}
+
+void BrokerServer::destroyStream(SharedStream &shared)
+{
+    _device->closeStream(shared.stream);
+    munmap(shared.ring, shared.mapSize);
+    shm_unlink(shared.shmName.c_str());
+}
+
+/***********************************************************************
+ * Control calls
+ **********************************************************************/
+static std::string fromBool(const bool value)
+{
+    return SoapySDR::SettingToString(value);
+}
+
+Message BrokerServer::handle(const Message &req, std::map<size_t, bool> &clientStreams)
+{
+    const std::string &call = req.at(0);
+    const auto arg = [&req](const size_t i) -> const std::string & {return req.at(i);};
+    const auto dir = [&req]{return SoapySDR::StringToSetting<int>(req.at(1));};
+    const auto ch = [&req]{return SoapySDR::StringToSetting<size_t>(req.at(2));};
+    const auto num = [&req](const size_t i){return std::stod(req.at(i));};
+    const auto fromDouble = &SoapyBroker::fromDouble;
+    Message reply;
+
+    //identification and channels
+    if (call == "getDriverKey") reply.push_back(_device->getDriverKey());
+    else if (call == "getHardwareKey") reply.push_back(_device->getHardwareKey());
+    else if (call == "getHardwareInfo") SoapyBroker::appendKwargs(reply, _device->getHardwareInfo());
+    else if (call == "getNumChannels") reply.push_back(std::to_string(_device->getNumChannels(dir())));
+    else if (call == "getChannelInfo") SoapyBroker::appendKwargs(reply, _device->getChannelInfo(dir(), ch()));
+    else if (call == "getFullDuplex") reply.push_back(fromBool(_device->getFullDuplex(dir(), ch())));
+
+    //stream formats
+    else if (call == "getStreamFormats") reply = _device->getStreamFormats(dir(), ch());
+    else if (call == "getNativeStreamFormat")
+    {
+        double fullScale(0.0);
+        reply.push_back(_device->getNativeStreamFormat(dir(), ch(), fullScale));
+        reply.push_back(fromDouble(fullScale));
+    }
+
+    //antennas and corrections
+    else if (call == "listAntennas") reply = _device->listAntennas(dir(), ch());
+    else if (call == "setAntenna") _device->setAntenna(dir(), ch(), arg(3));
+    else if (call == "getAntenna") reply.push_back(_device->getAntenna(dir(), ch()));
+    else if (call == "hasDCOffsetMode") reply.push_back(fromBool(_device->hasDCOffsetMode(dir(), ch())));
+    else if (call == "setDCOffsetMode") _device->setDCOffsetMode(dir(), ch(), arg(3) == SOAPY_SDR_TRUE);
+    else if (call == "getDCOffsetMode") reply.push_back(fromBool(_device->getDCOffsetMode(dir(), ch())));
+
+    //gain
+    else if (call == "listGains") reply = _device->listGains(dir(), ch());
+    else if (call == "hasGainMode") reply.push_back(fromBool(_device->hasGainMode(dir(), ch())));
+    else if (call == "setGainMode") _device->setGainMode(dir(), ch(), arg(3) == SOAPY_SDR_TRUE);
+    else if (call == "getGainMode") reply.push_back(fromBool(_device->getGainMode(dir(), ch())));
+    else if (call == "setGain") _device->setGain(dir(), ch(), num(3));
+    else if (call == "setGainElement") _device->setGain(dir(), ch(), arg(3), num(4));
+    else if (call == "getGain") reply.push_back(fromDouble(_device->getGain(dir(), ch())));
+    else if (call == "getGainElement") reply.push_back(fromDouble(_device->getGain(dir(), ch(), arg(3))));
+    else if (call == "getGainRange") SoapyBroker::appendRanges(reply, {_device->getGainRange(dir(), ch())});
+    else if (call == "getGainElementRange") SoapyBroker::appendRanges(reply, {_device->getGainRange(dir(), ch(), arg(3))});
+
+    //frequency
+    else if (call == "setFrequency") _device->setFrequency(dir(), ch(), num(3), SoapyBroker::toKwargs(req, 4));
+    else if (call == "setFrequencyComponent") _device->setFrequency(dir(), ch(), arg(3), num(4), SoapyBroker::toKwargs(req, 5));
+    else if (call == "getFrequency") reply.push_back(fromDouble(_device->getFrequency(dir(), ch())));
+    else if (call == "getFrequencyComponent") reply.push_back(fromDouble(_device->getFrequency(dir(), ch(), arg(3))));
+    else if (call == "listFrequencies") reply = _device->listFrequencies(dir(), ch());
+    else if (call == "getFrequencyRange") SoapyBroker::appendRanges(reply, _device->getFrequencyRange(dir(), ch()));
+    else if (call == "getFrequencyComponentRange") SoapyBroker::appendRanges(reply, _device->getFrequencyRange(dir(), ch(), arg(3)));
+
+    //sample rate and bandwidth
+    else if (call == "setSampleRate") _device->setSampleRate(dir(), ch(), num(3));
+    else if (call == "getSampleRate") reply.push_back(fromDouble(_device->getSampleRate(dir(), ch())));
+    else if (call == "getSampleRateRange") SoapyBroker::appendRanges(reply, _device->getSampleRateRange(dir(), ch()));
+    else if (call == "setBandwidth") _device->setBandwidth(dir(), ch(), num(3));
+    else if (call == "getBandwidth") reply.push_back(fromDouble(_device->getBandwidth(dir(), ch())));
+    else if (call == "getBandwidthRange") SoapyBroker::appendRanges(reply, _device->getBandwidthRange(dir(), ch()));
+
+    //clocking and time
+    else if (call == "listClockSources") reply = _device->listClockSources();
+    else if (call == "setClockSource") _device->setClockSource(arg(1));
+    else if (call == "getClockSource") reply.push_back(_device->getClockSource());
+    else if (call == "listTimeSources") reply = _device->listTimeSources();
+    else if (call == "setTimeSource") _device->setTimeSource(arg(1));
+    else if (call == "getTimeSource") reply.push_back(_device->getTimeSource());
+    else if (call == "hasHardwareTime") reply.push_back(fromBool(_device->hasHardwareTime(arg(1))));
+    else if (call == "getHardwareTime") reply.push_back(std::to_string(_device->getHardwareTime(arg(1))));
+    else if (call == "setHardwareTime") _device->setHardwareTime(std::stoll(arg(1)), arg(2));
+
+    //sensors and settings
+    else if (call == "listSensors") reply = _device->listSensors();
+    else if (call == "readSensor") reply.push_back(_device->readSensor(arg(1)));
+    else if (call == "listChannelSensors") reply = _device->listSensors(dir(), ch());
+    else if (call == "readChannelSensor") reply.push_back(_device->readSensor(dir(), ch(), arg(3)));
+    else if (call == "writeSetting") _device->writeSetting(arg(1), arg(2));
+    else if (call == "readSetting") reply.push_back(_device->readSetting(arg(1)));
+    else if (call == "writeChannelSetting") _device->writeSetting(dir(), ch(), arg(3), arg(4));
+    else if (call == "readChannelSetting") reply.push_back(_device->readSetting(dir(), ch(), arg(3)));
+
+    //shared receive streams
+    else if (call == "setupStream")
+    {
+        std::vector<size_t> channels;
+        const size_t numChans = std::stoul(arg(1));
+        for (size_t i = 0; i < numChans; i++) channels.push_back(std::stoul(arg(2+i)));
+        const size_t id = this->setupStream(channels, SoapyBroker::toKwargs(req, 2+numChans));
+        clientStreams[id] = false;
+        reply.push_back(std::to_string(id));
+        reply.push_back(_streams.at(id)->shmName);
+    }
+    else if (call == "closeStream" or call == "activateStream" or call == "deactivateStream")
+    {
+        const size_t id = std::stoul(arg(1));
+        const auto it = clientStreams.find(id);
+        if (it == clientStreams.end()) throw std::runtime_error("unknown stream " + arg(1));
+        if (call == "activateStream" and not it->second) this->activate(id);
+        if (call != "activateStream" and it->second) this->deactivate(id);
+        it->second = (call == "activateStream");
+        if (call == "closeStream")
+        {
+            clientStreams.erase(it);
+            this->release(id);
+        }
+    }
+
+    else throw std::runtime_error("unknown call " + call);
+    return reply;
+}
+
+/***********************************************************************
+ * Serve a device on a unix socket
+ **********************************************************************/
+int SoapySDRBroker(const std::string &argStr, const std::string &socketPath)
+{
+    const std::string path = socketPath.empty()?SoapyBroker::DEFAULT_SOCKET:socketPath;
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        std::cerr << "Socket path too long: " << path << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path)-1);
+
+    //a stale socket from a broker that did not exit cleanly is replaced,
+    //but a socket which accepts a connection belongs to a running broker
+    const int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    const bool inUse = probe >= 0 and connect(probe, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0;
+    if (probe >= 0) close(probe);
+    if (inUse)
+    {
+        std::cerr << "Another broker is serving on " << path << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    SoapySDR::Device *device(nullptr);
+    try
+    {
+        device = SoapySDR::Device::make(argStr);
+    }
+    catch (const std::exception &ex)
+    {
+        std::cerr << "Error making device: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    //only the owner may connect, the socket is restricted before it accepts connections
+    const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path.c_str());
+    if (listener < 0 or bind(listener, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 or
+        chmod(path.c_str(), S_IRUSR | S_IWUSR) != 0 or listen(listener, 16) != 0)
+    {
+        std::cerr << "Error listening on " << path << ": " << std::strerror(errno) << std::endl;
+        if (listener >= 0) close(listener);
+        SoapySDR::Device::unmake(device);
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Serving " << device->getHardwareKey() << " on " << path << std::endl;
+    std::cout << "Press Ctrl+C to stop the broker" << std::endl;
+    signal(SIGINT, sigIntHandler);
+    signal(SIGTERM, sigIntHandler);
+
+    std::unique_ptr<BrokerServer> server(new BrokerServer(device));
+    std::set<int> clients;
+    std::mutex clientsMutex;
+    std::condition_variable clientsCond;
+    while (not loopDone)
+    {
+        pollfd pfd;
+        pfd.fd = listener;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if (poll(&pfd, 1, 100) <= 0) continue;
+        const int fd = accept(listener, nullptr, nullptr);
+        if (fd < 0) continue;
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        clients.insert(fd);
+        std::thread([&, fd]{
+            server->serveClient(fd);
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            clients.erase(fd);
+            close(fd);
+            clientsCond.notify_all();
+        }).detach();
+    }
+
+    //disconnect the clients, which releases their streams
+    close(listener);
+    unlink(path.c_str());
+    {
+        std::unique_lock<std::mutex> lock(clientsMutex);
+        for (const int fd : clients) shutdown(fd, SHUT_RDWR);
+        clientsCond.wait(lock, [&clients]{return clients.empty();});
+    }
+    server.reset();
+    SoapySDR::Device::unmake(device);
+    std::cout << "Broker stopped" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+#endif //_WIN32
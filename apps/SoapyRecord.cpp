@@ -0,0 +1,416 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Errors.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <string>
+#include <vector>
+#include <deque>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <csignal>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <cstdio>
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+static sig_atomic_t loopDone = false;
+static void sigIntHandler(const int)
+{
+    loopDone = true;
+}
+
+//block size in elements, a multiple of the direct IO alignment for every element size
+static const size_t BLOCK_ELEMS = 1 << 16;
+static const size_t NUM_BLOCKS = 64;
+static const size_t IO_ALIGNMENT = 4096;
+
+/***********************************************************************
+ * Aligned block of samples, one buffer per channel
+ **********************************************************************/
+struct RecordBlock
+{
+    RecordBlock(const size_t numChans, const size_t numBytes):
+        mem(numChans, std::vector<char>(numBytes+IO_ALIGNMENT)),
+        buffs(numChans),
+        numElems(0),
+        firstElem(0),
+        hasTime(false),
+        timeNs(0)
+    {
+        for (size_t i = 0; i < numChans; i++)
+        {
+            const auto addr = reinterpret_cast<uintptr_t>(mem[i].data());
+            buffs[i] = mem[i].data() + (IO_ALIGNMENT - addr % IO_ALIGNMENT) % IO_ALIGNMENT;
+        }
+    }
+
+    std::vector<std::vector<char>> mem;
+    std::vector<char *> buffs;
+    size_t numElems;
+    unsigned long long firstElem;
+    bool hasTime;
+    long long timeNs;
+};
+
+/***********************************************************************
+ * Blocks exchanged between the capture and writer threads
+ **********************************************************************/
+struct RecordQueue
+{
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<RecordBlock *> free;
+    std::deque<RecordBlock *> full;
+    bool done;
+};
+
+/***********************************************************************
+ * Output file, opened for direct IO when the filesystem allows it
+ **********************************************************************/
+static int openOutput(const std::string &path, bool &direct)
+{
+    direct = false;
+    #ifdef _WIN32
+    return _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, 0644);
+    #else
+    #ifdef O_DIRECT
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+    direct = fd >= 0;
+    if (direct) return fd;
+    #endif
+    return ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    #endif
+}
+
+static void closeOutput(const int fd)
+{
+    #ifdef _WIN32
+    _close(fd);
+    #else
+    ::close(fd);
+    #endif
+}
+
+//the errno of a failed write, or zero when all bytes were written
+static int writeAll(const int fd, const char *buff, size_t numBytes)
+{
+    while (numBytes != 0)
+    {
+        #ifdef _WIN32
+        const auto ret = _write(fd, buff, (unsigned int)(numBytes));
+        #else
+        const auto ret = ::write(fd, buff, numBytes);
+        #endif
+        if (ret < 0 and errno == EINTR) continue;
+        if (ret < 0) return errno;
+        if (ret == 0) return EIO;
+        buff += ret;
+        numBytes -= size_t(ret);
+    }
+    return 0;
+}
+
+//direct IO needs aligned lengths, so the final partial block is written buffered
+static void disableDirect(const int fd)
+{
+    #ifdef O_DIRECT
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_DIRECT);
+    #else
+    (void)fd;
+    #endif
+}
+
+static void writerThread(
+    RecordQueue &queue,
+    const std::vector<int> &fds,
+    const bool direct,
+    const SoapySDR::ConverterRegistry::ConverterFunction convert,
+    const size_t outElemSize,
+    std::ofstream &timeFile,
+    std::atomic<unsigned long long> &totalBytes,
+    std::atomic<int> &writeError)
+{
+    RecordBlock outBlock(fds.size(), BLOCK_ELEMS*outElemSize);
+    while (true)
+    {
+        RecordBlock *block(nullptr);
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.cond.wait(lock, [&queue]{return queue.done or not queue.full.empty();});
+            if (queue.full.empty()) return;
+            block = queue.full.front();
+            queue.full.pop_front();
+        }
+
+        if (timeFile.is_open())
+        {
+            timeFile << block->firstElem << " " << (block->hasTime?block->timeNs:-1) << "\n";
+        }
+
+        const size_t numBytes = block->numElems*outElemSize;
+        const bool aligned = numBytes % IO_ALIGNMENT == 0;
+        for (size_t i = 0; i < fds.size() and not writeError; i++)
+        {
+            const char *out = block->buffs[i];
+            if (convert != nullptr)
+            {
+                convert(block->buffs[i], outBlock.buffs[i], block->numElems, 1.0);
+                out = outBlock.buffs[i];
+            }
+            if (direct and not aligned) disableDirect(fds[i]);
+            writeError = writeAll(fds[i], out, numBytes);
+            if (not writeError) totalBytes += numBytes;
+        }
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.free.push_back(block);
+        queue.cond.notify_all();
+    }
+}
+
+/***********************************************************************
+ * Capture loop, reads whole blocks and hands them to the writer
+ **********************************************************************/
+static void runRecordStreamLoop(
+    SoapySDR::Device *device,
+    SoapySDR::Stream *stream,
+    RecordQueue &queue,
+    const size_t numChans,
+    const size_t elemSize,
+    const double duration,
+    const std::atomic<unsigned long long> &totalBytes,
+    const std::atomic<int> &writeError)
+{
+    RecordBlock discard(numChans, BLOCK_ELEMS*elemSize);
+    std::vector<void *> buffs(numChans);
+
+    unsigned int overflows(0);
+    unsigned long long droppedBlocks(0);
+    unsigned long long totalElems(0);
+
+    //hand a block to the writer, indexed by the elements in the files
+    unsigned long long writtenElems(0);
+    RecordBlock *block(nullptr);
+    const auto closeBlock = [&](void)
+    {
+        if (block != nullptr and block != &discard and block->numElems != 0)
+        {
+            block->firstElem = writtenElems;
+            writtenElems += block->numElems;
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.full.push_back(block);
+            queue.cond.notify_all();
+        }
+        else if (block != nullptr and block != &discard)
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.free.push_front(block);
+        }
+        block = nullptr;
+    };
+
+    //take a free block, or count a dropped block when the writer fell behind
+    const auto openBlock = [&](void)
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (not queue.free.empty())
+        {
+            block = queue.free.front();
+            queue.free.pop_front();
+        }
+        else
+        {
+            droppedBlocks++;
+            block = &discard;
+        }
+        block->numElems = 0;
+    };
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    auto timeLastPrint = startTime;
+
+    std::cout << "Starting record loop, press Ctrl+C to exit..." << std::endl;
+    device->activateStream(stream);
+    signal(SIGINT, sigIntHandler);
+
+    while (not loopDone and not writeError)
+    {
+        const auto now = std::chrono::high_resolution_clock::now();
+        if (duration > 0.0 and std::chrono::duration<double>(now - startTime).count() >= duration) break;
+        if (block == nullptr) openBlock();
+
+        for (size_t i = 0; i < numChans; i++) buffs[i] = block->buffs[i] + block->numElems*elemSize;
+        int flags(0);
+        long long timeNs(0);
+        const int ret = device->readStream(stream, buffs.data(), BLOCK_ELEMS-block->numElems, flags, timeNs);
+        if (ret == SOAPY_SDR_TIMEOUT) continue;
+        if (ret == SOAPY_SDR_OVERFLOW)
+        {
+            //samples were lost, so the next samples start a block with their own time
+            overflows++;
+            closeBlock();
+            continue;
+        }
+        if (ret < 0)
+        {
+            std::cerr << "Unexpected stream error " << SoapySDR::errToStr(ret) << std::endl;
+            break;
+        }
+
+        //a read without a time cannot be checked for continuity with a timed block,
+        //so it starts a new block, which moves the read to the front of that block
+        const bool hasTime = (flags & SOAPY_SDR_HAS_TIME) != 0;
+        if (block->numElems != 0 and block->hasTime and not hasTime)
+        {
+            RecordBlock *last = block;
+            const size_t offset = last->numElems;
+            closeBlock();
+            openBlock();
+            for (size_t i = 0; i < numChans; i++)
+            {
+                std::memmove(block->buffs[i], last->buffs[i] + offset*elemSize, size_t(ret)*elemSize);
+            }
+        }
+
+        if (block->numElems == 0)
+        {
+            block->hasTime = hasTime;
+            block->timeNs = timeNs;
+        }
+        block->numElems += size_t(ret);
+        totalElems += size_t(ret);
+
+        if (block->numElems == BLOCK_ELEMS) closeBlock();
+
+        if (timeLastPrint + std::chrono::seconds(5) < now)
+        {
+            timeLastPrint = now;
+            const auto timePassed = std::chrono::duration<double>(now - startTime).count();
+            printf("%g Msps\t%g MBps to disk", totalElems/timePassed/1e6, totalBytes.load()/timePassed/1e6);
+            if (overflows != 0) printf("\tOverflows %u", overflows);
+            if (droppedBlocks != 0) printf("\tDropped blocks %llu", droppedBlocks);
+            printf("\n");
+        }
+    }
+    device->deactivateStream(stream);
+
+    //flush the partial block and stop the writer
+    closeBlock();
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.done = true;
+    queue.cond.notify_all();
+
+    const auto timePassed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+    std::cout << "Recorded " << totalElems << " elements in " << timePassed << " seconds" << std::endl;
+    std::cout << "Overflows: " << overflows << ", dropped blocks: " << droppedBlocks << std::endl;
+}
+
+int SoapySDRRecord(
+    const std::string &argStr,
+    const double sampleRate,
+    const std::string &formatStr,
+    const std::string &channelStr,
+    const std::string &path,
+    const double duration,
+    const bool timestamps)
+{
+    SoapySDR::Device *device(nullptr);
+    std::vector<int> fds;
+
+    try
+    {
+        device = SoapySDR::Device::make(argStr);
+
+        //build channels list, using KwargsFromString is a easy parsing hack
+        std::vector<size_t> channels;
+        for (const auto &pair : SoapySDR::KwargsFromString(channelStr))
+        {
+            channels.push_back(std::stoi(pair.first));
+        }
+        if (channels.empty()) channels.push_back(0);
+
+        if (sampleRate != 0.0) for (const auto &chan : channels)
+        {
+            device->setSampleRate(SOAPY_SDR_RX, chan, sampleRate);
+        }
+
+        //stream the native format and convert in the writer thread when possible
+        double fullScale(0.0);
+        const auto nativeFormat = device->getNativeStreamFormat(SOAPY_SDR_RX, channels.front(), fullScale);
+        const auto format = formatStr.empty()?nativeFormat:formatStr;
+        SoapySDR::ConverterRegistry::ConverterFunction convert(nullptr);
+        if (format != nativeFormat) convert = SoapySDR::ConverterRegistry::getFunction(nativeFormat, format);
+        const auto streamFormat = (convert == nullptr)?format:nativeFormat;
+        const size_t streamElemSize = SoapySDR::formatToSize(streamFormat);
+        const size_t outElemSize = SoapySDR::formatToSize(format);
+        auto stream = device->setupStream(SOAPY_SDR_RX, streamFormat, channels);
+
+        //one output file per channel
+        bool direct(false);
+        for (size_t i = 0; i < channels.size(); i++)
+        {
+            const auto chanPath = (channels.size() == 1)?path:(path + "." + std::to_string(channels[i]));
+            fds.push_back(openOutput(chanPath, direct));
+            if (fds.back() < 0) throw std::runtime_error("cannot open " + chanPath + ": " + std::strerror(errno));
+        }
+        std::ofstream timeFile;
+        if (timestamps) timeFile.open(path + ".time");
+
+        std::cout << "Stream format: " << streamFormat << std::endl;
+        std::cout << "File format: " << format << std::endl;
+        std::cout << "Num channels: " << channels.size() << std::endl;
+        std::cout << "Direct IO: " << (direct?"yes":"no") << std::endl;
+        std::cout << "Begin recording to " << path << " at " << (device->getSampleRate(SOAPY_SDR_RX, channels.front())/1e6) << " Msps" << std::endl;
+
+        //allocate the block pool and run the capture and writer threads
+        std::vector<std::unique_ptr<RecordBlock>> pool;
+        RecordQueue queue;
+        queue.done = false;
+        for (size_t i = 0; i < NUM_BLOCKS; i++)
+        {
+            pool.emplace_back(new RecordBlock(channels.size(), BLOCK_ELEMS*streamElemSize));
+            queue.free.push_back(pool.back().get());
+        }
+        std::atomic<unsigned long long> totalBytes(0);
+        std::atomic<int> writeError(0);
+        const auto startTime = std::chrono::high_resolution_clock::now();
+        std::thread writer(&writerThread, std::ref(queue), std::cref(fds), direct, convert, outElemSize, std::ref(timeFile), std::ref(totalBytes), std::ref(writeError));
+        runRecordStreamLoop(device, stream, queue, channels.size(), streamElemSize, duration, totalBytes, writeError);
+        writer.join();
+        const auto timePassed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        if (writeError) std::cerr << "Error writing to " << path << ": " << std::strerror(writeError) << std::endl;
+        std::cout << "Wrote " << totalBytes.load() << " bytes, sustained " << (totalBytes.load()/timePassed/1e6) << " MBps to disk" << std::endl;
+
+        //cleanup stream and device
+        for (const auto fd : fds) closeOutput(fd);
+        device->closeStream(stream);
+        SoapySDR::Device::unmake(device);
+        return writeError?EXIT_FAILURE:EXIT_SUCCESS;
+    }
+    catch (const std::exception &ex)
+    {
+        std::cerr << "Error in record: " << ex.what() << std::endl;
+        for (const auto fd : fds) if (fd >= 0) closeOutput(fd);
+        SoapySDR::Device::unmake(device);
+        return EXIT_FAILURE;
+    }
+}
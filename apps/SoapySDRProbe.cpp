@@ -117,6 +117,21 @@ std::string toString(const SoapySDR::ArgInfoList &argInfos)
     return ss.str();
 }
 
+std::string sensorReading(const std::string &key, const SoapySDR::ArgInfo &info, const std::string &reading)
+{
+    std::stringstream ss;
+    ss << "     * " << key;
+    if (not info.name.empty()) ss << " (" << info.name << ")";
+    ss << ":";
+    if (info.range.maximum() > std::numeric_limits<double>::min()) ss << toString(info.range);
+    ss << toString(info.options);
+    ss << " " << reading;
+    if (not info.units.empty()) ss << " " << info.units;
+    ss << std::endl;
+    if (not info.description.empty()) ss << "        " << info.description << std::endl;
+    return ss.str();
+}
+
 std::string sensorReadings(SoapySDR::Device *device)
 {
     std::stringstream ss;
@@ -131,16 +146,7 @@ std::string sensorReadings(SoapySDR::Device *device)
         std::string key = sensors[i];
         SoapySDR::ArgInfo info = device->getSensorInfo(key);
         std::string reading = device->readSensor(key);
-
-        ss << "     * " << sensors[i];
-        if (not info.name.empty()) ss << " (" << info.name << ")";
-        ss << ":";
-        if (info.range.maximum() > std::numeric_limits<double>::min()) ss << toString(info.range);
-        ss << toString(info.options);
-        ss << " " << reading;
-        if (not info.units.empty()) ss << " " << info.units;
-        ss << std::endl;
-        if (not info.description.empty()) ss << "        " << info.description << std::endl;
+        ss << sensorReading(key, info, reading);
     }
 
     return ss.str();
@@ -160,16 +166,7 @@ std::string channelSensorReadings(SoapySDR::Device *device, const int dir, const
         std::string key = sensors[i];
         SoapySDR::ArgInfo info = device->getSensorInfo(dir, chan, key);
         std::string reading = device->readSensor(dir, chan, key);
-
-        ss << "     * " << sensors[i];
-        if (not info.name.empty()) ss << " (" << info.name << ")";
-        ss << ":";
-        if (info.range.maximum() > std::numeric_limits<double>::min()) ss << toString(info.range);
-        ss << toString(info.options);
-        ss << " " << reading;
-        if (not info.units.empty()) ss << " " << info.units;
-        ss << std::endl;
-        if (not info.description.empty()) ss << "        " << info.description << std::endl;
+        ss << sensorReading(key, info, reading);
     }
 
     return ss.str();
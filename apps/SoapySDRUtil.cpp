@@ -5,6 +5,7 @@
 #include <SoapySDR/Modules.hpp>
 #include <SoapySDR/Registry.hpp>
 #include <SoapySDR/Device.hpp>
+#include <SoapySDR/SensorSampler.hpp>
 #include <SoapySDR/ConverterRegistry.hpp>
 #include <algorithm> //sort, min, max
 #include <cstdlib>
@@ -25,13 +26,24 @@ static void sigIntHandler(const int)
 }
 
 std::string SoapySDRDeviceProbe(SoapySDR::Device *);
-std::string sensorReadings(SoapySDR::Device *);
+std::string sensorReading(const std::string &, const SoapySDR::ArgInfo &, const std::string &);
 int SoapySDRRateTest(
     const std::string &argStr,
     const double sampleRate,
     const std::string &formatStr,
     const std::string &channelStr,
     const std::string &directionStr);
+int SoapySDRRecord(
+    const std::string &argStr,
+    const double sampleRate,
+    const std::string &formatStr,
+    const std::string &channelStr,
+    const std::string &path,
+    const double duration,
+    const bool timestamps);
+int SoapySDRBroker(
+    const std::string &argStr,
+    const std::string &socketPath);
 
 /***********************************************************************
  * Print the banner
@@ -72,6 +84,16 @@ static int printHelp(void)
     std::cout << "    --channels[=\"0, 1, 2\"] \t\t List of channels, default 0" << std::endl;
     std::cout << "    --direction[=RX or TX] \t\t Specify the channel direction" << std::endl;
     std::cout << std::endl;
+
+    std::cout << "  Recording options (with --args, --rate, --format, --channels):" << std::endl;
+    std::cout << "    --record=path        \t\t Record RX samples to a file per channel" << std::endl;
+    std::cout << "    --duration[=seconds] \t\t Stop recording after the duration" << std::endl;
+    std::cout << "    --timestamps         \t\t Write block timestamps to path.time" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "  Broker options (with --args):" << std::endl;
+    std::cout << "    --broker[=socket path] \t\t Share the device with driver=broker clients" << std::endl;
+    std::cout << std::endl;
     return EXIT_SUCCESS;
 }
 
@@ -235,10 +257,38 @@ static int watchDevice(const std::string &argStr)
     try
     {
         auto device = SoapySDR::Device::make(argStr);
-        while (not loopDone)
         {
-            std::cout << sensorReadings(device) << std::endl;
-            std::this_thread::sleep_for(std::chrono::seconds(1));
+            //sample every sensor in the background and print the latest readings
+            SoapySDR::SensorSampler sampler(device);
+            std::vector<std::string> labels;
+            for (const auto &key : device->listSensors())
+            {
+                sampler.addSensor(key, 1000000000);
+                labels.push_back(key);
+            }
+            for (const int dir : {SOAPY_SDR_RX, SOAPY_SDR_TX})
+            {
+                for (size_t chan = 0; chan < device->getNumChannels(dir); chan++)
+                {
+                    for (const auto &key : device->listSensors(dir, chan))
+                    {
+                        sampler.addSensor(dir, chan, key, 1000000000);
+                        labels.push_back(std::string((dir == SOAPY_SDR_RX)?"RX":"TX") + std::to_string(chan) + " " + key);
+                    }
+                }
+            }
+            sampler.start();
+
+            while (not loopDone)
+            {
+                for (size_t i = 0; i < sampler.getNumSensors(); i++)
+                {
+                    const auto reading = sampler.read(i);
+                    std::cout << sensorReading(labels[i], sampler.getSensorInfo(i), reading.valid?reading.stringValue:"(no reading)");
+                }
+                std::cout << std::endl;
+                std::this_thread::sleep_for(std::chrono::seconds(1));
+            }
         }
         SoapySDR::Device::unmake(device);
     }
@@ -288,7 +338,12 @@ int main(int argc, char *argv[])
     std::string formatStr;
     std::string chanStr;
     std::string dirStr;
+    std::string recordPath;
     double sampleRate(0.0);
+    double duration(0.0);
+    bool timestampsFlag(false);
+    std::string brokerSocket;
+    bool brokerFlag(false);
     std::string driverName;
     bool findDevicesFlag(false);
     bool sparsePrintFlag(false);
@@ -316,6 +371,12 @@ int main(int argc, char *argv[])
         {"format", optional_argument, nullptr, 't'},
         {"channels", optional_argument, nullptr, 'n'},
         {"direction", optional_argument, nullptr, 'd'},
+
+        {"record", required_argument, nullptr, 'R'},
+        {"duration", optional_argument, nullptr, 'D'},
+        {"timestamps", no_argument, nullptr, 'T'},
+
+        {"broker", optional_argument, nullptr, 'B'},
         {nullptr, no_argument, nullptr, '\0'}
     };
     int long_index = 0;
@@ -370,6 +431,19 @@ int main(int argc, char *argv[])
         case 'd':
             if (optarg != nullptr) dirStr = optarg;
             break;
+        case 'R':
+            recordPath = optarg;
+            break;
+        case 'D':
+            if (optarg != nullptr) duration = std::stod(optarg);
+            break;
+        case 'T':
+            timestampsFlag = true;
+            break;
+        case 'B':
+            brokerFlag = true;
+            if (optarg != nullptr) brokerSocket = optarg;
+            break;
         }
     }
 
@@ -389,6 +463,11 @@ int main(int argc, char *argv[])
     if (watchDeviceFlag) return watchDevice(argStr);
 
     //invoke utilities that rely on multiple arguments
+    if (brokerFlag) return SoapySDRBroker(argStr, brokerSocket);
+    if (not recordPath.empty())
+    {
+        return SoapySDRRecord(argStr, sampleRate, formatStr, chanStr, recordPath, duration, timestampsFlag);
+    }
     if (sampleRate != 0.0)
     {
         return SoapySDRRateTest(argStr, sampleRate, formatStr, chanStr, dirStr);
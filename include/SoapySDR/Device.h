@@ -31,6 +31,15 @@ typedef struct SoapySDRDevice SoapySDRDevice;
 //! Forward declaration of stream handle
 typedef struct SoapySDRStream SoapySDRStream;
 
+//! Forward declaration of stream tap handle
+typedef struct SoapySDRStreamTap SoapySDRStreamTap;
+
+//! Forward declaration of frequency hop table handle
+typedef struct SoapySDRHopTable SoapySDRHopTable;
+
+//! Forward declaration of frequency sweep handle
+typedef struct SoapySDRSweep SoapySDRSweep;
+
 /*!
  * Get the last status code after a Device API call.
  * The status code is cleared on entry to each Device call.
@@ -456,6 +465,51 @@ SOAPY_SDR_API int SoapySDRDevice_readStreamStatus(SoapySDRDevice *device,
     long long *timeNs,
     const long timeoutUs);
 
+/*!
+ * Capture a finite number of samples at a given time into memory.
+ * This is a convenience call that performs a complete timed capture:
+ * setup a stream, activate a burst of numElems at timeNs,
+ * read the samples into the caller's buffers, and close the stream.
+ * A capture has no stream statistics, taps, scheduling, or gap filling.
+ *
+ * \param device a pointer to a device instance
+ * \param direction the channel direction (currently only RX)
+ * \param channels a list of channels or empty for channel 0
+ * \param numChans the number of channels
+ * \param format the desired buffer format (see setupStream())
+ * \param timeNs the hardware time of the first sample in nanoseconds,
+ *               or a negative value to start the capture immediately
+ * \param numElems the number of elements to capture per channel
+ * \param buffs an array of buffers num chans in size
+ * \param timeoutUs the timeout in microseconds for each read,
+ *                  in addition to the wait until timeNs
+ * \return the number of elements captured or error code
+ */
+SOAPY_SDR_API int SoapySDRDevice_captureSamples(SoapySDRDevice *device,
+    const int direction,
+    const size_t *channels,
+    const size_t numChans,
+    const char *format,
+    const long long timeNs,
+    const size_t numElems,
+    void * const *buffs,
+    const long timeoutUs);
+
+/*!
+ * Get runtime statistics for a stream.
+ * The statistics are maintained by the library around the stream calls
+ * of devices made with stream_layer=true, and are cheap enough
+ * to leave enabled at all times. Otherwise the statistics are empty
+ * unless the driver provides them.
+ * \param device a pointer to a device instance
+ * \param stream the opaque pointer to a stream handle
+ * \param [out] stats the statistics accumulated since the stream was setup
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_getStreamStats(const SoapySDRDevice *device,
+    SoapySDRStream *stream,
+    SoapySDRStreamStats *stats);
+
 /*******************************************************************
  * Direct buffer access API
  ******************************************************************/
@@ -577,6 +631,160 @@ SOAPY_SDR_API void SoapySDRDevice_releaseWriteBuffer(SoapySDRDevice *device,
     int *flags,
     const long long timeNs);
 
+/*******************************************************************
+ * Stream tap API
+ ******************************************************************/
+
+/*!
+ * Tap an active receive stream for a secondary consumer.
+ * The tap sees every result of readStream() and acquireReadBuffer()
+ * on the stream without slowing down the primary consumer:
+ * each result is published once into a broadcast ring,
+ * and the ring buffers are shared by all taps without copying.
+ * A tap which falls behind loses buffers instead of blocking the stream.
+ * Any number of taps may be opened on a stream,
+ * and each tap should be used from a single thread.
+ *
+ * \param device a pointer to a device instance
+ * \param stream the opaque pointer to a receive stream handle
+ * \param args reserved for tap arguments
+ * \return an opaque pointer to a stream tap handle or NULL on error
+ */
+SOAPY_SDR_API SoapySDRStreamTap *SoapySDRDevice_setupStreamTap(SoapySDRDevice *device,
+    SoapySDRStream *stream,
+    const SoapySDRKwargs *args);
+
+/*!
+ * Close an open stream tap.
+ * Buffers acquired from the tap are released.
+ * \param device a pointer to a device instance
+ * \param tap the opaque pointer to a stream tap handle
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_closeStreamTap(SoapySDRDevice *device, SoapySDRStreamTap *tap);
+
+/*!
+ * Read elements published to a stream tap.
+ * The buffer formats and channels are those of the tapped stream.
+ * A stream buffer which is larger than numElems is returned
+ * over several calls with the SOAPY_SDR_MORE_FRAGMENTS flag.
+ * SOAPY_SDR_OVERFLOW is returned once when buffers were dropped.
+ *
+ * \param device a pointer to a device instance
+ * \param tap the opaque pointer to a stream tap handle
+ * \param buffs an array of void* buffers num chans in size
+ * \param numElems the number of elements in each buffer
+ * \param flags optional flag indicators about the result
+ * \param timeNs the buffer's timestamp in nanoseconds
+ * \param timeoutUs the timeout in microseconds
+ * \return the number of elements read per buffer or error code
+ */
+SOAPY_SDR_API int SoapySDRDevice_readStreamTap(SoapySDRDevice *device,
+    SoapySDRStreamTap *tap,
+    void * const *buffs,
+    const size_t numElems,
+    int *flags,
+    long long *timeNs,
+    const long timeoutUs);
+
+/*!
+ * Acquire the next buffer published to a stream tap without copying.
+ * The buffer is shared with the other taps and must be released
+ * with SoapySDRDevice_releaseTapBuffer() once the caller is done with it.
+ * SOAPY_SDR_OVERFLOW is returned once when buffers were dropped.
+ *
+ * \param device a pointer to a device instance
+ * \param tap the opaque pointer to a stream tap handle
+ * \param handle an index value used in the release() call
+ * \param buffs an array of void* buffers num chans in size
+ * \param flags optional flag indicators about the result
+ * \param timeNs the buffer's timestamp in nanoseconds
+ * \param timeoutUs the timeout in microseconds
+ * \return the number of elements per buffer or error code
+ */
+SOAPY_SDR_API int SoapySDRDevice_acquireTapBuffer(SoapySDRDevice *device,
+    SoapySDRStreamTap *tap,
+    size_t *handle,
+    const void **buffs,
+    int *flags,
+    long long *timeNs,
+    const long timeoutUs);
+
+/*!
+ * Release a buffer acquired from a stream tap.
+ * \param device a pointer to a device instance
+ * \param tap the opaque pointer to a stream tap handle
+ * \param handle the opaque handle from the acquire() call
+ */
+SOAPY_SDR_API void SoapySDRDevice_releaseTapBuffer(SoapySDRDevice *device,
+    SoapySDRStreamTap *tap,
+    const size_t handle);
+
+/*!
+ * Get the number of stream buffers that a tap has missed
+ * because it did not keep up with the stream.
+ * \param device a pointer to a device instance
+ * \param tap the opaque pointer to a stream tap handle
+ * \return the number of dropped buffers since the tap was setup
+ */
+SOAPY_SDR_API unsigned long long SoapySDRDevice_getStreamTapDrops(const SoapySDRDevice *device, SoapySDRStreamTap *tap);
+
+/*******************************************************************
+ * Sweep API
+ ******************************************************************/
+
+/*!
+ * Setup a frequency sweep over a list of frequencies.
+ * The sweep repeatedly tunes to each frequency in turn,
+ * waits for the settle time, and captures a segment of samples.
+ * \param device a pointer to a device instance
+ * \param direction the channel direction (currently only RX)
+ * \param channel an available channel on the device
+ * \param format the desired buffer format (see setupStream())
+ * \param frequencies an array of center frequencies in Hz
+ * \param length the number of frequencies
+ * \param dwellElems the number of elements per segment
+ * \param settleNs the time to wait after each retune in nanoseconds
+ * \param args optional stream arguments (see setupStream())
+ * \return an opaque pointer to a sweep handle or NULL on error
+ */
+SOAPY_SDR_API SoapySDRSweep *SoapySDRDevice_setupSweep(SoapySDRDevice *device,
+    const int direction,
+    const size_t channel,
+    const char *format,
+    const double *frequencies,
+    const size_t length,
+    const size_t dwellElems,
+    const long long settleNs,
+    const SoapySDRKwargs *args);
+
+/*!
+ * Close a sweep and release its resources.
+ * \param device a pointer to a device instance
+ * \param sweep the opaque pointer to a sweep handle
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_closeSweep(SoapySDRDevice *device, SoapySDRSweep *sweep);
+
+/*!
+ * Read the next segment of a sweep.
+ * \param device a pointer to a device instance
+ * \param sweep the opaque pointer to a sweep handle
+ * \param buff a buffer of dwellElems elements in the sweep format
+ * \param [out] flags the flag indicators of the result
+ * \param [out] frequency the center frequency of the segment in Hz
+ * \param [out] timeNs the timestamp of the first sample in nanoseconds
+ * \param timeoutUs the timeout in microseconds for each stream read
+ * \return the number of elements read (dwellElems) or error code
+ */
+SOAPY_SDR_API int SoapySDRDevice_readSweep(SoapySDRDevice *device,
+    SoapySDRSweep *sweep,
+    void *buff,
+    int *flags,
+    double *frequency,
+    long long *timeNs,
+    const long timeoutUs);
+
 /*******************************************************************
  * Antenna API
  ******************************************************************/
@@ -863,6 +1071,17 @@ SOAPY_SDR_API SoapySDRRange SoapySDRDevice_getGainRange(const SoapySDRDevice *de
  */
 SOAPY_SDR_API SoapySDRRange SoapySDRDevice_getGainElementRange(const SoapySDRDevice *device, const int direction, const size_t channel, const char *name);
 
+/*!
+ * Get a table of precomputed element gains for the overall gain.
+ * The table is empty when the overall gain is distributed instead.
+ * \param device a pointer to a device instance
+ * \param direction the channel direction RX or TX
+ * \param channel an available channel on the device
+ * \param [out] table the gain table, clear with SoapySDRGainTable_clear()
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_getGainTable(const SoapySDRDevice *device, const int direction, const size_t channel, SoapySDRGainTable *table);
+
 /*******************************************************************
  * Frequency API
  ******************************************************************/
@@ -981,6 +1200,45 @@ SOAPY_SDR_API SoapySDRRange *SoapySDRDevice_getFrequencyRangeComponent(const Soa
  */
 SOAPY_SDR_API SoapySDRArgInfo *SoapySDRDevice_getFrequencyArgsInfo(const SoapySDRDevice *device, const int direction, const size_t channel, size_t *length);
 
+/*******************************************************************
+ * Frequency hopping API
+ ******************************************************************/
+
+/*!
+ * Prepare a table of frequencies for fast retuning with applyHop().
+ * \param device a pointer to a device instance
+ * \param direction the channel direction RX or TX
+ * \param channel an available channel on the device
+ * \param frequencies an array of center frequencies in Hz
+ * \param length the number of frequencies
+ * \param args optional tuner arguments, as in setFrequency()
+ * \return an opaque pointer to a hop table handle or NULL on error
+ */
+SOAPY_SDR_API SoapySDRHopTable *SoapySDRDevice_prepareFrequencies(SoapySDRDevice *device,
+    const int direction,
+    const size_t channel,
+    const double *frequencies,
+    const size_t length,
+    const SoapySDRKwargs *args);
+
+/*!
+ * Tune the channel of a hop table to one of its frequencies.
+ * \param device a pointer to a device instance
+ * \param table the opaque pointer to a hop table handle
+ * \param index the index of the frequency in the table
+ * \param timeNs the time to apply the hop or -1 for now
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_applyHop(SoapySDRDevice *device, SoapySDRHopTable *table, const size_t index, const long long timeNs);
+
+/*!
+ * Close a hop table and release its resources.
+ * \param device a pointer to a device instance
+ * \param table the opaque pointer to a hop table handle
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_closeHopTable(SoapySDRDevice *device, SoapySDRHopTable *table);
+
 /*******************************************************************
  * Sample Rate API
  ******************************************************************/
@@ -1208,6 +1466,66 @@ SOAPY_SDR_API int SoapySDRDevice_setHardwareTime(SoapySDRDevice *device, const l
  */
 SOAPY_SDR_API int SoapySDRDevice_setCommandTime(SoapySDRDevice *device, const long long timeNs, const char *what);
 
+/*******************************************************************
+ * Configuration transaction API
+ ******************************************************************/
+
+/*!
+ * Begin a configuration transaction.
+ * Configuration calls made after beginConfig() are queued
+ * and applied together by commitConfig().
+ * A transaction belongs to the calling thread, the calls
+ * made by other threads meanwhile are applied immediately.
+ * \param device a pointer to a device instance
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_beginConfig(SoapySDRDevice *device);
+
+/*!
+ * Apply the configuration calls made since beginConfig().
+ * \param device a pointer to a device instance
+ * \param timeNs the time to apply the configuration or -1 for now
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_commitConfig(SoapySDRDevice *device, const long long timeNs);
+
+/*!
+ * Discard the configuration calls made since beginConfig().
+ * \param device a pointer to a device instance
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_cancelConfig(SoapySDRDevice *device);
+
+/*******************************************************************
+ * Timed command API
+ ******************************************************************/
+
+/*!
+ * Queue configuration commands to apply at future hardware times.
+ * Commands which the driver does not accept into a hardware
+ * command queue are applied by the library shortly before their times.
+ * \param device a pointer to a device instance
+ * \param commands an array of timed commands
+ * \param numCommands the number of commands in the array
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_queueCommands(SoapySDRDevice *device, const SoapySDRTimedCommand *commands, const size_t numCommands);
+
+/*!
+ * Discard the queued commands which have not been applied.
+ * \param device a pointer to a device instance
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_clearCommands(SoapySDRDevice *device);
+
+/*!
+ * Get the statistics of the timed commands.
+ * \param device a pointer to a device instance
+ * \param [out] stats the command counters
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_getCommandQueueStats(const SoapySDRDevice *device, SoapySDRCommandQueueStats *stats);
+
 /*******************************************************************
  * Sensor API
  ******************************************************************/
@@ -1332,6 +1650,20 @@ SOAPY_SDR_API int SoapySDRDevice_writeRegisters(SoapySDRDevice *device, const ch
  */
 SOAPY_SDR_API unsigned *SoapySDRDevice_readRegisters(const SoapySDRDevice *device, const char *name, const unsigned addr, size_t *length);
 
+/*!
+ * Perform a batch of register reads and writes given the interface name.
+ * The operations are made in order, so a driver can submit the whole
+ * batch in one transaction rather than one round trip per access.
+ * The result of each operation is stored in its value field:
+ * the masked value of a read, and the register value after a write.
+ * \param device a pointer to a device instance
+ * \param name the name of a available register interface
+ * \param [in,out] ops the array of register operations
+ * \param numOps the number of operations in the array
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_transactRegisters(SoapySDRDevice *device, const char *name, SoapySDRRegisterOp *ops, const size_t numOps);
+
 /*******************************************************************
  * Settings API
  ******************************************************************/
@@ -1509,6 +1841,19 @@ SOAPY_SDR_API int SoapySDRDevice_writeI2C(SoapySDRDevice *device, const int addr
  */
 SOAPY_SDR_API char *SoapySDRDevice_readI2C(SoapySDRDevice *device, const int addr, size_t *numBytes);
 
+/*!
+ * Perform a combined I2C transaction of several messages.
+ * The messages are separated by repeated starts rather than stops,
+ * so a register address can be written and read back in one transfer.
+ * A read message receives into its data buffer of numBytes bytes,
+ * and numBytes will be set to the number of actual bytes read.
+ * \param device a pointer to a device instance
+ * \param [in,out] messages the array of write and read messages
+ * \param numMessages the number of messages in the array
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_transactI2C(SoapySDRDevice *device, SoapySDRI2CMessage *messages, const size_t numMessages);
+
 /*******************************************************************
  * SPI API
  ******************************************************************/
@@ -1530,6 +1875,20 @@ SOAPY_SDR_API char *SoapySDRDevice_readI2C(SoapySDRDevice *device, const int add
  */
 SOAPY_SDR_API unsigned SoapySDRDevice_transactSPI(SoapySDRDevice *device, const int addr, const unsigned data, const size_t numBits);
 
+/*!
+ * Perform a sequence of SPI transactions to the same slave.
+ * This has the semantics of calling transactSPI() on each word,
+ * but a driver can clock out the whole sequence in one transfer.
+ * \param device a pointer to a device instance
+ * \param addr an address of an available SPI slave
+ * \param data the SPI data words, numBits-1 is first out
+ * \param [out] readback the readback data for each word, numBits-1 is first in
+ * \param length the number of words in data and readback
+ * \param numBits the number of bits to clock out per word
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRDevice_transactSPIBatch(SoapySDRDevice *device, const int addr, const unsigned *data, unsigned *readback, const size_t length, const size_t numBits);
+
 /*******************************************************************
  * UART API
  ******************************************************************/
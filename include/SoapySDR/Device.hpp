@@ -18,6 +18,7 @@
 #include <vector>
 #include <string>
 #include <complex>
+#include <future>
 #include <cstddef> //size_t
 
 namespace SoapySDR
@@ -26,6 +27,15 @@ namespace SoapySDR
 //! Forward declaration of stream handle for type safety
 class Stream;
 
+//! Forward declaration of stream tap handle for type safety
+class StreamTap;
+
+//! Forward declaration of frequency hop table handle for type safety
+class HopTable;
+
+//! Forward declaration of frequency sweep handle for type safety
+class Sweep;
+
 /*!
  * Abstraction for an SDR transceiver device - configuration and streaming.
  */
@@ -256,6 +266,9 @@ public:
      *
      * Recommended keys to use in the args dictionary:
      *  - "WIRE" - format of the samples between device and host
+     *
+     * Devices made with stream_layer=true also accept the library stream args
+     * listed by getStreamArgsInfo(), such as "SCHEDULER", "GAP_FILL", and "TRIGGER".
      * \endparblock
      * \return an opaque pointer to a stream handle.
      * \parblock
@@ -411,6 +424,55 @@ public:
         long long &timeNs,
         const long timeoutUs = 100000);
 
+    /*!
+     * Capture a finite number of samples at a given time into memory.
+     * This is a convenience call that performs a complete timed capture:
+     * setup a stream, activate a burst of numElems at timeNs,
+     * read the samples into the caller's buffers, and close the stream.
+     *
+     * The default implementation uses the direct buffer access API
+     * when available and converts from the native format straight into
+     * the caller's buffers, otherwise it reads directly into the buffers.
+     * Drivers may overload this call to use hardware capture features.
+     * The default implementation only uses state local to the call,
+     * so captures on separate devices may run in parallel.
+     *
+     * The resample and channelizer layers capture through their own
+     * streams, so a capture sees the rates and channels of the device.
+     * The stream layer passes a capture straight to the device below it,
+     * so a capture has no statistics, taps, scheduling, or gap filling.
+     *
+     * \param direction the channel direction (currently only RX)
+     * \param channels a list of channels or empty for channel 0
+     * \param format the desired buffer format (see setupStream())
+     * \param timeNs the hardware time of the first sample in nanoseconds,
+     *               or a negative value to start the capture immediately
+     * \param numElems the number of elements to capture per channel
+     * \param buffs an array of buffers num chans in size
+     * \param timeoutUs the timeout in microseconds for each read,
+     *                  in addition to the wait until timeNs
+     * \return the number of elements captured or error code
+     */
+    virtual int captureSamples(
+        const int direction,
+        const std::vector<size_t> &channels,
+        const std::string &format,
+        const long long timeNs,
+        const size_t numElems,
+        void * const *buffs,
+        const long timeoutUs = 100000);
+
+    /*!
+     * Get runtime statistics for a stream.
+     * The statistics are maintained by the library around the stream calls
+     * of devices made with stream_layer=true, and are cheap enough
+     * to leave enabled at all times. Otherwise the statistics are empty
+     * unless the driver provides them.
+     * \param stream the opaque pointer to a stream handle
+     * \return the statistics accumulated since the stream was setup
+     */
+    virtual StreamStats getStreamStats(Stream *stream) const;
+
     /*******************************************************************
      * Direct buffer access API
      ******************************************************************/
@@ -526,6 +588,165 @@ public:
         int &flags,
         const long long timeNs = 0);
 
+    /*******************************************************************
+     * Stream tap API
+     ******************************************************************/
+
+    /*!
+     * Tap an active receive stream for a secondary consumer.
+     * The tap sees every result of readStream() and acquireReadBuffer()
+     * on the stream without slowing down the primary consumer:
+     * each result is published once into a broadcast ring,
+     * and the ring buffers are shared by all taps without copying.
+     * A tap which falls behind loses buffers instead of blocking the stream.
+     * Any number of taps may be opened on a stream,
+     * and each tap should be used from a single thread.
+     *
+     * Taps are implemented by the library for devices made with stream_layer=true,
+     * the size of the ring is set by the TAP_SLOTS stream argument.
+     * Otherwise a null tap is returned unless the driver implements taps.
+     *
+     * \param stream the opaque pointer to a receive stream handle
+     * \param args reserved for tap arguments
+     * \return an opaque pointer to a stream tap handle
+     */
+    virtual StreamTap *setupStreamTap(Stream *stream, const Kwargs &args = Kwargs());
+
+    /*!
+     * Close an open stream tap.
+     * Buffers acquired from the tap are released.
+     * A tap may outlive its stream, but it will not receive more buffers.
+     * \param tap the opaque pointer to a stream tap handle
+     */
+    virtual void closeStreamTap(StreamTap *tap);
+
+    /*!
+     * Read elements published to a stream tap.
+     * The buffer formats and channels are those of the tapped stream.
+     * A stream buffer which is larger than numElems is returned
+     * over several calls with the SOAPY_SDR_MORE_FRAGMENTS flag.
+     * SOAPY_SDR_OVERFLOW is returned once when buffers were dropped.
+     *
+     * \param tap the opaque pointer to a stream tap handle
+     * \param buffs an array of void* buffers num chans in size
+     * \param numElems the number of elements in each buffer
+     * \param flags optional flag indicators about the result
+     * \param timeNs the buffer's timestamp in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of elements read per buffer or error code
+     */
+    virtual int readStreamTap(
+        StreamTap *tap,
+        void * const *buffs,
+        const size_t numElems,
+        int &flags,
+        long long &timeNs,
+        const long timeoutUs = 100000);
+
+    /*!
+     * Acquire the next buffer published to a stream tap without copying.
+     * The buffer is shared with the other taps and must be released
+     * with releaseTapBuffer() once the caller is done with it.
+     * While a tap holds a buffer the ring cannot reuse it,
+     * so buffers should be held only briefly.
+     * SOAPY_SDR_OVERFLOW is returned once when buffers were dropped.
+     *
+     * \param tap the opaque pointer to a stream tap handle
+     * \param handle an index value used in the release() call
+     * \param buffs an array of void* buffers num chans in size
+     * \param flags optional flag indicators about the result
+     * \param timeNs the buffer's timestamp in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of elements per buffer or error code
+     */
+    virtual int acquireTapBuffer(
+        StreamTap *tap,
+        size_t &handle,
+        const void **buffs,
+        int &flags,
+        long long &timeNs,
+        const long timeoutUs = 100000);
+
+    /*!
+     * Release a buffer acquired from a stream tap.
+     * \param tap the opaque pointer to a stream tap handle
+     * \param handle the opaque handle from the acquire() call
+     */
+    virtual void releaseTapBuffer(StreamTap *tap, const size_t handle);
+
+    /*!
+     * Get the number of stream buffers that a tap has missed
+     * because it did not keep up with the stream.
+     * \param tap the opaque pointer to a stream tap handle
+     * \return the number of dropped buffers since the tap was setup
+     */
+    virtual unsigned long long getStreamTapDrops(StreamTap *tap) const;
+
+    /*******************************************************************
+     * Sweep API
+     ******************************************************************/
+
+    /*!
+     * Setup a frequency sweep over a list of frequencies.
+     * The sweep repeatedly tunes to each frequency in turn,
+     * waits for the settle time, and captures a segment of samples.
+     * The sweep starts at the first frequency and loops over the list
+     * until it is closed.
+     *
+     * Drivers with a hardware sweep mode may overload the sweep calls.
+     * Otherwise the library implements the sweep for devices made with
+     * stream_layer=true which have a receive stream and a hop table (see prepareFrequencies()).
+     * When the device supports command times, hasHardwareTime("CMD"),
+     * each retune is issued as a timed command at the end of the previous segment,
+     * so the retune overlaps the capture, and the samples of
+     * each segment are selected by their timestamps.
+     *
+     * \param direction the channel direction (currently only RX)
+     * \param channel an available channel on the device
+     * \param format the desired buffer format (see setupStream())
+     * \param frequencies the center frequencies in Hz
+     * \param dwellElems the number of elements per segment
+     * \param settleNs the time to wait after each retune in nanoseconds
+     * \param args optional stream arguments (see setupStream())
+     * \return an opaque pointer to a sweep handle
+     */
+    virtual Sweep *setupSweep(
+        const int direction,
+        const size_t channel,
+        const std::string &format,
+        const std::vector<double> &frequencies,
+        const size_t dwellElems,
+        const long long settleNs,
+        const Kwargs &args = Kwargs());
+
+    /*!
+     * Close a sweep and release its resources.
+     * \param sweep the opaque pointer to a sweep handle
+     */
+    virtual void closeSweep(Sweep *sweep);
+
+    /*!
+     * Read the next segment of a sweep.
+     * The flags set by this call are SOAPY_SDR_HAS_TIME when
+     * timeNs is valid, and SOAPY_SDR_END_BURST for the segment
+     * of the last frequency in the list.
+     * \param sweep the opaque pointer to a sweep handle
+     * \param buff a buffer of dwellElems elements in the sweep format
+     * \param [out] flags the flag indicators of the result
+     * \param [out] frequency the center frequency of the segment in Hz
+     * \param [out] timeNs the timestamp of the first sample in nanoseconds
+     * \param timeoutUs the timeout in microseconds for each stream read
+     * \return the number of elements read (dwellElems) or error code,
+     * after an error the same segment is read again by the next call
+     */
+    virtual int readSweep(
+        Sweep *sweep,
+        void *buff,
+        int &flags,
+        double &frequency,
+        long long &timeNs,
+        const long timeoutUs = 100000);
+
     /*******************************************************************
      * Antenna API
      ******************************************************************/
@@ -767,6 +988,21 @@ public:
      */
     virtual Range getGainRange(const int direction, const size_t channel, const std::string &name) const;
 
+    /*!
+     * Get a table of precomputed element gains for the overall gain.
+     * A driver may provide a table so that the overall setGain()
+     * selects the row of the largest overall gain not above the request,
+     * and only writes the elements whose gain differs from the last row.
+     * The library fetches the table again after an antenna,
+     * frequency band, or settings change.
+     * The default implementation returns an empty table,
+     * and the overall gain is distributed across the elements.
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \return the gain table or an empty table
+     */
+    virtual GainTable getGainTable(const int direction, const size_t channel) const;
+
     /*******************************************************************
      * Frequency API
      ******************************************************************/
@@ -871,6 +1107,43 @@ public:
      */
     virtual ArgInfoList getFrequencyArgsInfo(const int direction, const size_t channel) const;
 
+    /*******************************************************************
+     * Frequency hopping API
+     ******************************************************************/
+
+    /*!
+     * Prepare a table of frequencies for fast retuning with applyHop().
+     * Drivers may overload the hopping calls to precompute
+     * the synthesizer and register settings of every frequency.
+     * Otherwise the library implements the table for every device:
+     * the tuning arguments are parsed once, and the component split
+     * of each frequency is remembered after its first untimed hop,
+     * so that later hops only set the components which change.
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param frequencies the center frequencies in Hz
+     * \param args optional tuner arguments, as in setFrequency()
+     * \return an opaque pointer to a hop table handle
+     */
+    virtual HopTable *prepareFrequencies(const int direction, const size_t channel, const std::vector<double> &frequencies, const Kwargs &args = Kwargs());
+
+    /*!
+     * Tune the channel of a hop table to one of its frequencies.
+     * During a configuration transaction, the hop is queued
+     * and applied at the time of commitConfig() instead.
+     * A timed hop of a library table throws unless hasHardwareTime("CMD") is true.
+     * \param table the opaque pointer to a hop table handle
+     * \param index the index of the frequency in the table
+     * \param timeNs the time to apply the hop or -1 for now
+     */
+    virtual void applyHop(HopTable *table, const size_t index, const long long timeNs = -1);
+
+    /*!
+     * Close a hop table and release its resources.
+     * \param table the opaque pointer to a hop table handle
+     */
+    virtual void closeHopTable(HopTable *table);
+
     /*******************************************************************
      * Sample Rate API
      ******************************************************************/
@@ -1058,6 +1331,72 @@ public:
      */
     virtual void setCommandTime(const long long timeNs, const std::string &what = "");
 
+    /*******************************************************************
+     * Configuration transaction API
+     ******************************************************************/
+
+    /*!
+     * Begin a configuration transaction.
+     * Configuration calls made after beginConfig() are queued
+     * and applied together by commitConfig().
+     * A transaction belongs to the calling thread, the calls
+     * made by other threads meanwhile are applied immediately.
+     * Drivers may overload the transaction calls to coalesce
+     * the queued register writes into a single transfer.
+     * The default implementation does nothing; the library queues
+     * the calls and replays them to the driver on commit,
+     * so that every driver supports transactions.
+     */
+    virtual void beginConfig(void);
+
+    /*!
+     * Apply the configuration calls made since beginConfig().
+     * When replaying, the library sets the command time with
+     * setHardwareTime(timeNs, "CMD") before the queued calls,
+     * clears it afterwards, and then calls commitConfig() on the driver.
+     * A commit with a time throws unless hasHardwareTime("CMD") is true.
+     * Errors from the queued calls are thrown by commitConfig().
+     * \param timeNs the time to apply the configuration or -1 for now
+     */
+    virtual void commitConfig(const long long timeNs = -1);
+
+    /*!
+     * Discard the configuration calls made since beginConfig().
+     */
+    virtual void cancelConfig(void);
+
+    /*******************************************************************
+     * Timed command API
+     ******************************************************************/
+
+    /*!
+     * Queue configuration commands to apply at future hardware times.
+     * Many commands can be outstanding, and they need not be sorted.
+     * Drivers with a hardware command FIFO overload this call, push
+     * as many commands as fit, and return how many they accepted,
+     * counted from the front of the list.
+     * The default implementation accepts none; the library applies
+     * the remaining commands from a scheduler thread shortly before
+     * their times, with the command time set by setHardwareTime(timeNs, "CMD")
+     * when hasHardwareTime("CMD") is true,
+     * so that every driver with a hardware clock supports timed commands.
+     * \param commands a list of timed commands
+     * \return the number of commands accepted by the driver
+     */
+    virtual size_t queueCommands(const TimedCommandList &commands);
+
+    /*!
+     * Discard the queued commands which have not been applied.
+     */
+    virtual void clearCommands(void);
+
+    /*!
+     * Get the statistics of the timed commands.
+     * Drivers with a hardware command FIFO can report late commands here.
+     * \return the command counters
+     */
+    virtual CommandQueueStats getCommandQueueStats(void) const;
+
     /*******************************************************************
      * Sensor API
      ******************************************************************/
@@ -1088,6 +1427,8 @@ public:
 
     /*!
      * Readback a global sensor given the name.
+     * Booleans, integers, and floats are read with the typed calls,
+     * such as readSensorInt(), so that drivers can avoid string parsing.
      * \tparam Type the return type for the sensor value
      * \param key the ID name of an available sensor
      * \return the current value of the sensor as the specified type
@@ -1095,6 +1436,30 @@ public:
     template <typename Type>
     Type readSensor(const std::string &key) const;
 
+    /*!
+     * Readback a global boolean sensor given the name.
+     * The default implementation parses readSensor().
+     * \param key the ID name of an available sensor
+     * \return the current value of the sensor
+     */
+    virtual bool readSensorBool(const std::string &key) const;
+
+    /*!
+     * Readback a global integer sensor given the name.
+     * The default implementation parses readSensor().
+     * \param key the ID name of an available sensor
+     * \return the current value of the sensor
+     */
+    virtual long long readSensorInt(const std::string &key) const;
+
+    /*!
+     * Readback a global floating point sensor given the name.
+     * The default implementation parses readSensor().
+     * \param key the ID name of an available sensor
+     * \return the current value of the sensor
+     */
+    virtual double readSensorFloat(const std::string &key) const;
+
     /*!
      * List the available channel readback sensors.
      * A sensor can represent a reference lock, RSSI, temperature.
@@ -1127,6 +1492,8 @@ public:
 
     /*!
      * Readback a channel sensor given the name.
+     * Booleans, integers, and floats are read with the typed calls,
+     * such as readSensorInt(), so that drivers can avoid string parsing.
      * \tparam Type the return type for the sensor value
      * \param direction the channel direction RX or TX
      * \param channel an available channel on the device
@@ -1136,6 +1503,36 @@ public:
     template <typename Type>
     Type readSensor(const int direction, const size_t channel, const std::string &key) const;
 
+    /*!
+     * Readback a channel boolean sensor given the name.
+     * The default implementation parses readSensor().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the ID name of an available sensor
+     * \return the current value of the sensor
+     */
+    virtual bool readSensorBool(const int direction, const size_t channel, const std::string &key) const;
+
+    /*!
+     * Readback a channel integer sensor given the name.
+     * The default implementation parses readSensor().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the ID name of an available sensor
+     * \return the current value of the sensor
+     */
+    virtual long long readSensorInt(const int direction, const size_t channel, const std::string &key) const;
+
+    /*!
+     * Readback a channel floating point sensor given the name.
+     * The default implementation parses readSensor().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the ID name of an available sensor
+     * \return the current value of the sensor
+     */
+    virtual double readSensorFloat(const int direction, const size_t channel, const std::string &key) const;
+
     /*******************************************************************
      * Register API
      ******************************************************************/
@@ -1201,6 +1598,33 @@ public:
      */
     virtual std::vector<unsigned> readRegisters(const std::string &name, const unsigned addr, const size_t length) const;
 
+    /*!
+     * Perform a batch of register reads and writes given the interface name.
+     * The operations are made in order, so a driver can submit the whole
+     * batch in one transaction rather than one round trip per access.
+     * The default implementation makes each operation with
+     * readRegister() and writeRegister(), and a write with a partial
+     * mask reads the register first, unless an earlier operation
+     * in the batch has already read or written that address.
+     * \param name the name of a available register interface
+     * \param ops the list of register operations
+     * \return the results, one per operation: the masked value of a read,
+     * and the register value after a write
+     */
+    virtual std::vector<unsigned> transactRegisters(const std::string &name, const std::vector<RegisterOp> &ops);
+
+    /*!
+     * Start a batch of register reads and writes given the interface name.
+     * The result becomes ready when the batch completes, and the future
+     * reports any exception thrown by the batch.
+     * The default implementation calls transactRegisters() on a new thread,
+     * which runs concurrently with other calls made on the device.
+     * \param name the name of a available register interface
+     * \param ops the list of register operations
+     * \return a future for the results of transactRegisters()
+     */
+    virtual std::future<std::vector<unsigned>> transactRegistersAsync(const std::string &name, const std::vector<RegisterOp> &ops);
+
     /*******************************************************************
      * Settings API
      ******************************************************************/
@@ -1228,6 +1652,8 @@ public:
 
     /*!
      * Write a setting with an arbitrary value type.
+     * Booleans, integers, and floats are written with the typed calls,
+     * such as writeSettingInt(), so that drivers can avoid string formatting.
      * \tparam Type the data type of the value
      * \param key the setting identifier
      * \param value the setting value
@@ -1235,6 +1661,30 @@ public:
     template <typename Type>
     void writeSetting(const std::string &key, const Type &value);
 
+    /*!
+     * Write a boolean setting on the device.
+     * The default implementation formats the value for writeSetting().
+     * \param key the setting identifier
+     * \param value the setting value
+     */
+    virtual void writeSettingBool(const std::string &key, const bool value);
+
+    /*!
+     * Write an integer setting on the device.
+     * The default implementation formats the value for writeSetting().
+     * \param key the setting identifier
+     * \param value the setting value
+     */
+    virtual void writeSettingInt(const std::string &key, const long long value);
+
+    /*!
+     * Write a floating point setting on the device.
+     * The default implementation formats the value for writeSetting().
+     * \param key the setting identifier
+     * \param value the setting value
+     */
+    virtual void writeSettingFloat(const std::string &key, const double value);
+
     /*!
      * Read an arbitrary setting on the device.
      * \param key the setting identifier
@@ -1244,6 +1694,8 @@ public:
 
     /*!
      * Read an arbitrary setting on the device.
+     * Booleans, integers, and floats are read with the typed calls,
+     * such as readSettingInt(), so that drivers can avoid string parsing.
      * \tparam Type the return type for the sensor value
      * \param key the setting identifier
      * \return the setting value
@@ -1251,6 +1703,30 @@ public:
     template <typename Type>
     Type readSetting(const std::string &key) const;
 
+    /*!
+     * Read a boolean setting on the device.
+     * The default implementation parses readSetting().
+     * \param key the setting identifier
+     * \return the setting value
+     */
+    virtual bool readSettingBool(const std::string &key) const;
+
+    /*!
+     * Read an integer setting on the device.
+     * The default implementation parses readSetting().
+     * \param key the setting identifier
+     * \return the setting value
+     */
+    virtual long long readSettingInt(const std::string &key) const;
+
+    /*!
+     * Read a floating point setting on the device.
+     * The default implementation parses readSetting().
+     * \param key the setting identifier
+     * \return the setting value
+     */
+    virtual double readSettingFloat(const std::string &key) const;
+
     /*!
      * Describe the allowed keys and values used for channel settings.
      * \param direction the channel direction RX or TX
@@ -1280,6 +1756,8 @@ public:
 
     /*!
      * Write an arbitrary channel setting on the device.
+     * Booleans, integers, and floats are written with the typed calls,
+     * such as writeSettingInt(), so that drivers can avoid string formatting.
      * \tparam Type the data type of the value
      * \param direction the channel direction RX or TX
      * \param channel an available channel on the device
@@ -1289,6 +1767,36 @@ public:
     template <typename Type>
     void writeSetting(const int direction, const size_t channel, const std::string &key, const Type &value);
 
+    /*!
+     * Write a boolean channel setting on the device.
+     * The default implementation formats the value for writeSetting().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the setting identifier
+     * \param value the setting value
+     */
+    virtual void writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value);
+
+    /*!
+     * Write an integer channel setting on the device.
+     * The default implementation formats the value for writeSetting().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the setting identifier
+     * \param value the setting value
+     */
+    virtual void writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value);
+
+    /*!
+     * Write a floating point channel setting on the device.
+     * The default implementation formats the value for writeSetting().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the setting identifier
+     * \param value the setting value
+     */
+    virtual void writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value);
+
     /*!
      * Read an arbitrary channel setting on the device.
      * \param direction the channel direction RX or TX
@@ -1300,6 +1808,8 @@ public:
 
     /*!
      * Read an arbitrary channel setting on the device.
+     * Booleans, integers, and floats are read with the typed calls,
+     * such as readSettingInt(), so that drivers can avoid string parsing.
      * \tparam Type the return type for the sensor value
      * \param direction the channel direction RX or TX
      * \param channel an available channel on the device
@@ -1309,6 +1819,36 @@ public:
     template <typename Type>
     Type readSetting(const int direction, const size_t channel, const std::string &key) const;
 
+    /*!
+     * Read a boolean channel setting on the device.
+     * The default implementation parses readSetting().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the setting identifier
+     * \return the setting value
+     */
+    virtual bool readSettingBool(const int direction, const size_t channel, const std::string &key) const;
+
+    /*!
+     * Read an integer channel setting on the device.
+     * The default implementation parses readSetting().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the setting identifier
+     * \return the setting value
+     */
+    virtual long long readSettingInt(const int direction, const size_t channel, const std::string &key) const;
+
+    /*!
+     * Read a floating point channel setting on the device.
+     * The default implementation parses readSetting().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the setting identifier
+     * \return the setting value
+     */
+    virtual double readSettingFloat(const int direction, const size_t channel, const std::string &key) const;
+
     /*******************************************************************
      * GPIO API
      ******************************************************************/
@@ -1388,6 +1928,17 @@ public:
      */
     virtual std::string readI2C(const int addr, const size_t numBytes);
 
+    /*!
+     * Perform a combined I2C transaction of several messages.
+     * The messages are separated by repeated starts rather than stops,
+     * so a register address can be written and read back in one transfer.
+     * The default implementation calls writeI2C() and readI2C()
+     * for each message, which separates the messages with stops.
+     * \param messages the list of write and read messages
+     * \return the bytes read, one string per message, empty for writes
+     */
+    virtual std::vector<std::string> transactI2C(const std::vector<I2CMessage> &messages);
+
     /*******************************************************************
      * SPI API
      ******************************************************************/
@@ -1408,6 +1959,18 @@ public:
      */
     virtual unsigned transactSPI(const int addr, const unsigned data, const size_t numBits);
 
+    /*!
+     * Perform a sequence of SPI transactions to the same slave.
+     * This has the semantics of calling transactSPI() on each word,
+     * but a driver can clock out the whole sequence in one transfer.
+     * The default implementation calls transactSPI() for each word.
+     * \param addr an address of an available SPI slave
+     * \param data the SPI data words, numBits-1 is first out
+     * \param numBits the number of bits to clock out per word
+     * \return the readback data for each word, numBits-1 is first in
+     */
+    virtual std::vector<unsigned> transactSPIBatch(const int addr, const std::vector<unsigned> &data, const size_t numBits);
+
     /*******************************************************************
      * UART API
      ******************************************************************/
@@ -1452,38 +2015,202 @@ public:
 
 }
 
+namespace SoapySDR {
+namespace Detail {
+
+//private implementation details for the typed settings and sensors
+
+//other types are converted to and from strings
+template <typename Type, typename Enable = void>
+struct TypedRead
+{
+    static Type readSensor(const Device &device, const std::string &key)
+    {
+        return SoapySDR::StringToSetting<Type>(device.readSensor(key));
+    }
+
+    static Type readSensor(const Device &device, const int direction, const size_t channel, const std::string &key)
+    {
+        return SoapySDR::StringToSetting<Type>(device.readSensor(direction, channel, key));
+    }
+
+    static Type readSetting(const Device &device, const std::string &key)
+    {
+        return SoapySDR::StringToSetting<Type>(device.readSetting(key));
+    }
+
+    static Type readSetting(const Device &device, const int direction, const size_t channel, const std::string &key)
+    {
+        return SoapySDR::StringToSetting<Type>(device.readSetting(direction, channel, key));
+    }
+};
+
+template <typename Type, typename Enable = void>
+struct TypedWrite
+{
+    static void writeSetting(Device &device, const std::string &key, const Type &value)
+    {
+        device.writeSetting(key, SoapySDR::SettingToString(value));
+    }
+
+    static void writeSetting(Device &device, const int direction, const size_t channel, const std::string &key, const Type &value)
+    {
+        device.writeSetting(direction, channel, key, SoapySDR::SettingToString(value));
+    }
+};
+
+//booleans use the typed boolean calls
+template <typename Type>
+struct TypedRead<Type, typename std::enable_if<std::is_same<Type, bool>::value>::type>
+{
+    static Type readSensor(const Device &device, const std::string &key)
+    {
+        return Type(device.readSensorBool(key));
+    }
+
+    static Type readSensor(const Device &device, const int direction, const size_t channel, const std::string &key)
+    {
+        return Type(device.readSensorBool(direction, channel, key));
+    }
+
+    static Type readSetting(const Device &device, const std::string &key)
+    {
+        return Type(device.readSettingBool(key));
+    }
+
+    static Type readSetting(const Device &device, const int direction, const size_t channel, const std::string &key)
+    {
+        return Type(device.readSettingBool(direction, channel, key));
+    }
+};
+
+template <typename Type>
+struct TypedWrite<Type, typename std::enable_if<std::is_same<Type, bool>::value>::type>
+{
+    static void writeSetting(Device &device, const std::string &key, const Type &value)
+    {
+        device.writeSettingBool(key, bool(value));
+    }
+
+    static void writeSetting(Device &device, const int direction, const size_t channel, const std::string &key, const Type &value)
+    {
+        device.writeSettingBool(direction, channel, key, bool(value));
+    }
+};
+
+//integers which fit a long long use the typed integer calls
+template <typename Type>
+struct TypedRead<Type, typename std::enable_if<std::is_integral<Type>::value and not std::is_same<Type, bool>::value and (std::is_signed<Type>::value or sizeof(Type) < sizeof(long long))>::type>
+{
+    static Type readSensor(const Device &device, const std::string &key)
+    {
+        return Type(device.readSensorInt(key));
+    }
+
+    static Type readSensor(const Device &device, const int direction, const size_t channel, const std::string &key)
+    {
+        return Type(device.readSensorInt(direction, channel, key));
+    }
+
+    static Type readSetting(const Device &device, const std::string &key)
+    {
+        return Type(device.readSettingInt(key));
+    }
+
+    static Type readSetting(const Device &device, const int direction, const size_t channel, const std::string &key)
+    {
+        return Type(device.readSettingInt(direction, channel, key));
+    }
+};
+
+template <typename Type>
+struct TypedWrite<Type, typename std::enable_if<std::is_integral<Type>::value and not std::is_same<Type, bool>::value and (std::is_signed<Type>::value or sizeof(Type) < sizeof(long long))>::type>
+{
+    static void writeSetting(Device &device, const std::string &key, const Type &value)
+    {
+        device.writeSettingInt(key, static_cast<long long>(value));
+    }
+
+    static void writeSetting(Device &device, const int direction, const size_t channel, const std::string &key, const Type &value)
+    {
+        device.writeSettingInt(direction, channel, key, static_cast<long long>(value));
+    }
+};
+
+//floats use the typed floating point calls
+template <typename Type>
+struct TypedRead<Type, typename std::enable_if<std::is_floating_point<Type>::value>::type>
+{
+    static Type readSensor(const Device &device, const std::string &key)
+    {
+        return Type(device.readSensorFloat(key));
+    }
+
+    static Type readSensor(const Device &device, const int direction, const size_t channel, const std::string &key)
+    {
+        return Type(device.readSensorFloat(direction, channel, key));
+    }
+
+    static Type readSetting(const Device &device, const std::string &key)
+    {
+        return Type(device.readSettingFloat(key));
+    }
+
+    static Type readSetting(const Device &device, const int direction, const size_t channel, const std::string &key)
+    {
+        return Type(device.readSettingFloat(direction, channel, key));
+    }
+};
+
+template <typename Type>
+struct TypedWrite<Type, typename std::enable_if<std::is_floating_point<Type>::value>::type>
+{
+    static void writeSetting(Device &device, const std::string &key, const Type &value)
+    {
+        device.writeSettingFloat(key, static_cast<double>(value));
+    }
+
+    static void writeSetting(Device &device, const int direction, const size_t channel, const std::string &key, const Type &value)
+    {
+        device.writeSettingFloat(direction, channel, key, static_cast<double>(value));
+    }
+};
+
+}
+}
+
 template <typename Type>
 Type SoapySDR::Device::readSensor(const std::string &key) const
 {
-    return SoapySDR::StringToSetting<Type>(this->readSensor(key));
+    return SoapySDR::Detail::TypedRead<Type>::readSensor(*this, key);
 }
 
 template <typename Type>
 Type SoapySDR::Device::readSensor(const int direction, const size_t channel, const std::string &key) const
 {
-    return SoapySDR::StringToSetting<Type>(this->readSensor(direction, channel, key));
+    return SoapySDR::Detail::TypedRead<Type>::readSensor(*this, direction, channel, key);
 }
 
 template <typename Type>
 void SoapySDR::Device::writeSetting(const std::string &key, const Type &value)
 {
-    this->writeSetting(key, SoapySDR::SettingToString(value));
+    SoapySDR::Detail::TypedWrite<Type>::writeSetting(*this, key, value);
 }
 
 template <typename Type>
 Type SoapySDR::Device::readSetting(const std::string &key) const
 {
-    return SoapySDR::StringToSetting<Type>(this->readSetting(key));
+    return SoapySDR::Detail::TypedRead<Type>::readSetting(*this, key);
 }
 
 template <typename Type>
 void SoapySDR::Device::writeSetting(const int direction, const size_t channel, const std::string &key, const Type &value)
 {
-    this->writeSetting(direction, channel, key, SoapySDR::SettingToString(value));
+    SoapySDR::Detail::TypedWrite<Type>::writeSetting(*this, direction, channel, key, value);
 }
 
 template <typename Type>
 Type SoapySDR::Device::readSetting(const int direction, const size_t channel, const std::string &key) const
 {
-    return SoapySDR::StringToSetting<Type>(this->readSetting(direction, channel, key));
+    return SoapySDR::Detail::TypedRead<Type>::readSetting(*this, direction, channel, key);
 }
@@ -0,0 +1,151 @@
+///
+/// \file SoapySDR/SensorSampler.hpp
+///
+/// Background sampling of device sensors.
+///
+/// \copyright
+/// Copyright (c) 2026-2026 Josh Blum
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Types.hpp>
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace SoapySDR
+{
+
+//! forward declaration of device
+class Device;
+
+/*!
+ * The latest reading of a sampled sensor.
+ * The value is parsed according to the type in the sensor info,
+ * and the value fields which do not match the type are zero.
+ */
+class SOAPY_SDR_API SensorReading
+{
+public:
+
+    //! Default constructor, an invalid reading
+    SensorReading(void);
+
+    //! True when the sensor has been read at least once
+    bool valid;
+
+    //! The type of the sensor value from the sensor info
+    ArgInfo::Type type;
+
+    //! The value of a boolean sensor
+    bool boolValue;
+
+    //! The value of an integer sensor
+    long long intValue;
+
+    //! The value of a floating point sensor
+    double floatValue;
+
+    //! The sensor value as read from the device, for every type
+    std::string stringValue;
+
+    //! The host time of the reading in nanoseconds, from the steady clock
+    long long timeNs;
+
+    //! The number of failed reads since the sampler started
+    unsigned long long numErrors;
+};
+
+/*!
+ * SensorSampler polls a set of device sensors on a background thread,
+ * each sensor at its own interval, and keeps the latest typed reading
+ * of each sensor, so that callers read values without touching the device.
+ *
+ * Add the sensors, then start the sampler. The latest readings are
+ * stored per sensor behind a sequence counter: reading a sensor
+ * is lock-free, and it never waits on the sampler thread or the device.
+ * String values longer than SensorSampler::MAX_STRING_SIZE are truncated.
+ */
+class SOAPY_SDR_API SensorSampler
+{
+public:
+
+    //! The maximum number of bytes kept of a string value
+    static const size_t MAX_STRING_SIZE = 256;
+
+    /*!
+     * Create a sampler for the given device.
+     * The device must outlive the sampler.
+     * \param device a pointer to a device instance
+     */
+    SensorSampler(Device *device);
+
+    //! Stop the sampler thread
+    ~SensorSampler(void);
+
+    /*!
+     * Add a global sensor to the sampler.
+     * Sensors can only be added before start().
+     * \param key the ID name of an available sensor
+     * \param intervalNs the time between readings in nanoseconds
+     * \return the index of the sensor for read()
+     */
+    size_t addSensor(const std::string &key, const long long intervalNs);
+
+    /*!
+     * Add a channel sensor to the sampler.
+     * Sensors can only be added before start().
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the ID name of an available sensor
+     * \param intervalNs the time between readings in nanoseconds
+     * \return the index of the sensor for read()
+     */
+    size_t addSensor(const int direction, const size_t channel, const std::string &key, const long long intervalNs);
+
+    //! Get the number of sensors in the sampler
+    size_t getNumSensors(void) const;
+
+    //! Get the info of a sensor given its index
+    ArgInfo getSensorInfo(const size_t index) const;
+
+    /*!
+     * Start polling the sensors on the background thread.
+     * Every sensor is read once immediately.
+     */
+    void start(void);
+
+    //! Stop polling, the latest readings remain available
+    void stop(void);
+
+    /*!
+     * Get the latest reading of a sensor without accessing the device.
+     * \param index the index returned by addSensor()
+     * \return the latest reading, invalid before the first read
+     */
+    SensorReading read(const size_t index) const;
+
+    /*!
+     * Get the latest reading of a global sensor by its key.
+     * \param key the ID name of a sampled sensor
+     * \return the latest reading, invalid before the first read
+     */
+    SensorReading read(const std::string &key) const;
+
+    /*!
+     * Get the latest reading of a channel sensor by its key.
+     * \param direction the channel direction RX or TX
+     * \param channel an available channel on the device
+     * \param key the ID name of a sampled sensor
+     * \return the latest reading, invalid before the first read
+     */
+    SensorReading read(const int direction, const size_t channel, const std::string &key) const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}
@@ -0,0 +1,153 @@
+///
+/// \file SoapySDR/TimeTracker.hpp
+///
+/// Estimate the device hardware time from the host clock.
+///
+/// \copyright
+/// Copyright (c) 2026-2026 Josh Blum
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <memory>
+#include <string>
+
+namespace SoapySDR
+{
+
+//! forward declaration of device
+class Device;
+
+/*!
+ * An estimate of the hardware time from a TimeTracker.
+ */
+class SOAPY_SDR_API TimeEstimate
+{
+public:
+
+    //! Default constructor, an invalid estimate
+    TimeEstimate(void);
+
+    //! True when the tracker has at least one timestamp
+    bool valid;
+
+    //! The estimated hardware time in nanoseconds
+    long long timeNs;
+
+    //! The bound on the error of the estimate in nanoseconds
+    long long errorNs;
+
+    //! The rate of the hardware clock relative to the host clock in ppm
+    double driftPpm;
+};
+
+/*!
+ * TimeTracker models the hardware time of a device as an offset
+ * and a drift against the host's monotonic clock, so that callers
+ * can estimate the current hardware time without a device round trip.
+ *
+ * The model is fit by least squares to the recent timestamps,
+ * which come from occasional calls to Device::getHardwareTime(),
+ * either made on a background thread or by calling sample(),
+ * and from the stream timestamps passed to addStreamTime().
+ * The error bound follows from the residual and the uncertainty
+ * of each timestamp, and it grows with the time since the last timestamp.
+ *
+ * A timestamp which is far outside of the error bound, such as after
+ * setHardwareTime() or a time source change, restarts the model.
+ */
+class SOAPY_SDR_API TimeTracker
+{
+public:
+
+    //! The number of recent timestamps in the fit
+    static const size_t MAX_POINTS = 32;
+
+    //! Timestamps further than this from the estimate restart the model
+    static const long long JUMP_THRESHOLD_NS = 10000000;
+
+    //! The default transport latency of stream timestamps
+    static const long long STREAM_LATENCY_NS = 1000000;
+
+    /*!
+     * Create a tracker for the given device.
+     * The device must outlive the tracker.
+     * \param device a pointer to a device instance
+     * \param what optional argument for getHardwareTime()
+     */
+    TimeTracker(Device *device, const std::string &what = "");
+
+    //! Stop the sampling thread
+    ~TimeTracker(void);
+
+    //! Get the host time in nanoseconds from the monotonic clock
+    static long long getHostTimeNs(void);
+
+    /*!
+     * Read the hardware time once and add it to the model.
+     * The host time of the reading is the middle of the call,
+     * and its uncertainty is half of the call duration.
+     * Errors from the device are thrown.
+     */
+    void sample(void);
+
+    /*!
+     * Add a hardware timestamp from another source.
+     * \param hardwareTimeNs the hardware time in nanoseconds
+     * \param hostTimeNs the host time of the timestamp from getHostTimeNs()
+     * \param uncertaintyNs the uncertainty of the timestamp in nanoseconds
+     */
+    void addTimestamp(const long long hardwareTimeNs, const long long hostTimeNs, const long long uncertaintyNs = 0);
+
+    /*!
+     * Add the timestamp of a received stream buffer.
+     * Call after Device::readStream() returns with the buffer.
+     * The hardware time at the end of the buffer is paired with the current
+     * host time, so the timestamp lags by the time the buffer spent in transport.
+     * Its uncertainty is the buffer duration plus the given latency,
+     * which keeps the error bound of an estimate from stream times alone
+     * valid while the actual lag is within the latency. Occasional calls
+     * to sample() outweigh the stream times in the fit, and the lag of the
+     * stream times then widens the error bound rather than skewing the estimate.
+     * Buffers without SOAPY_SDR_HAS_TIME in the flags are ignored.
+     * \param flags the flags from readStream()
+     * \param timeNs the buffer timestamp from readStream()
+     * \param numElems the number of elements from readStream()
+     * \param rate the sample rate of the stream
+     * \param latencyNs the bound on the transport latency in nanoseconds
+     */
+    void addStreamTime(const int flags, const long long timeNs, const size_t numElems, const double rate, const long long latencyNs = STREAM_LATENCY_NS);
+
+    //! Discard the timestamps, such as after setting the hardware time
+    void reset(void);
+
+    /*!
+     * Start reading the hardware time on a background thread.
+     * The hardware time is read once immediately.
+     * \param intervalNs the time between readings in nanoseconds
+     */
+    void start(const long long intervalNs);
+
+    //! Stop the background thread, the model remains available
+    void stop(void);
+
+    /*!
+     * Estimate the current hardware time without accessing the device.
+     * \return the estimate, invalid before the first timestamp
+     */
+    TimeEstimate estimateHardwareTime(void) const;
+
+    /*!
+     * Estimate the hardware time at the given host time.
+     * \param hostTimeNs a host time from getHostTimeNs()
+     * \return the estimate, invalid before the first timestamp
+     */
+    TimeEstimate estimateHardwareTime(const long long hostTimeNs) const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}
@@ -109,6 +109,172 @@ typedef struct
 
 } SoapySDRArgInfo;
 
+//! The number of log2 buckets in the stream statistics latency histogram
+#define SOAPY_SDR_STREAM_STATS_HISTOGRAM_SIZE 32
+
+//! Definition for runtime statistics of a stream
+typedef struct
+{
+    //! The total number of elements read or written
+    unsigned long long numElems;
+
+    //! The number of read, write, and acquire calls
+    unsigned long long numCalls;
+
+    //! The number of calls that returned SOAPY_SDR_TIMEOUT
+    unsigned long long numTimeouts;
+
+    //! The number of overflows on a receive stream, including those gap filled
+    unsigned long long numOverflows;
+
+    //! The number of underflows reported on a transmit stream
+    unsigned long long numUnderflows;
+
+    //! The number of late or otherwise rejected timestamps
+    unsigned long long numTimeErrors;
+
+    //! The number of sample gaps filled by the library
+    unsigned long long numGaps;
+
+    //! The total number of elements inserted into gaps
+    unsigned long long numGapElems;
+
+    /*!
+     * Histogram of the latency of each call:
+     * bucket i counts calls which took [2^i, 2^(i+1)) microseconds,
+     * bucket 0 also counts calls under a microsecond.
+     */
+    unsigned long long latencyHistogram[SOAPY_SDR_STREAM_STATS_HISTOGRAM_SIZE];
+
+} SoapySDRStreamStats;
+
+//! Definition for a table of element gains for each overall gain
+typedef struct
+{
+    //! The number of gain elements
+    size_t numElements;
+
+    //! The names of the gain elements, the columns of the table
+    char **elements;
+
+    //! The number of rows in the table
+    size_t numRows;
+
+    //! The overall gain of each row in dB, sorted ascending
+    double *gains;
+
+    //! The element gains in dB, numRows x numElements in row-major order
+    double *values;
+
+} SoapySDRGainTable;
+
+//! Definition for one register access in a batch of register operations
+typedef struct
+{
+    //! The register address
+    unsigned addr;
+
+    //! The value to write, or the masked value after a read
+    unsigned value;
+
+    //! The register bits which are read or written
+    unsigned mask;
+
+    //! True for a read, false for a write
+    bool read;
+
+} SoapySDRRegisterOp;
+
+//! Definition for one message in an I2C transaction
+typedef struct
+{
+    //! The address of the slave
+    int addr;
+
+    //! True for a read, false for a write
+    bool read;
+
+    //! The bytes to write, or the buffer for the bytes read
+    char *data;
+
+    //! The number of bytes to write, or to read and then actually read
+    size_t numBytes;
+
+} SoapySDRI2CMessage;
+
+//! Possible operations of a timed command
+typedef enum
+{
+    SOAPY_SDR_COMMAND_FREQUENCY,
+    SOAPY_SDR_COMMAND_GAIN,
+    SOAPY_SDR_COMMAND_GPIO,
+    SOAPY_SDR_COMMAND_SETTING
+} SoapySDRTimedCommandType;
+
+//! Definition for a configuration command to apply at a hardware time
+typedef struct
+{
+    //! The hardware time to apply the command in nanoseconds
+    long long timeNs;
+
+    //! The operation of the command
+    SoapySDRTimedCommandType type;
+
+    //! The channel direction RX or TX, unused for GPIO
+    int direction;
+
+    //! The channel on the device, unused for GPIO
+    size_t channel;
+
+    /*!
+     * The frequency component or gain element, NULL for the overall value,
+     * the GPIO bank, or the setting key.
+     */
+    const char *name;
+
+    //! The frequency in Hz or the gain in dB
+    double value;
+
+    //! The tune arguments of a frequency command
+    SoapySDRKwargs args;
+
+    //! The GPIO value to write
+    unsigned gpioValue;
+
+    //! The GPIO bits to write
+    unsigned gpioMask;
+
+    //! The value of a setting command
+    const char *settingValue;
+
+} SoapySDRTimedCommand;
+
+//! Definition for statistics of the timed commands of a device
+typedef struct
+{
+    //! The number of commands queued
+    unsigned long long numQueued;
+
+    //! The number of commands accepted by a hardware command queue
+    unsigned long long numOffloaded;
+
+    //! The number of commands applied by the library scheduler
+    unsigned long long numApplied;
+
+    //! The number of commands applied after their time
+    unsigned long long numLate;
+
+    //! The number of commands which failed to apply
+    unsigned long long numFailed;
+
+    //! The number of commands waiting in the library scheduler
+    unsigned long long numPending;
+
+    //! The largest time by which a command was late in nanoseconds
+    long long maxLateNs;
+
+} SoapySDRCommandQueueStats;
+
 /*!
  * Free a pointer allocated by SoapySDR.
  * For most platforms this is a simple call around free()
@@ -162,6 +328,12 @@ SOAPY_SDR_API void SoapySDRArgInfo_clear(SoapySDRArgInfo *info);
  */
 SOAPY_SDR_API void SoapySDRArgInfoList_clear(SoapySDRArgInfo *info, const size_t length);
 
+/*!
+ * Clear the contents of a gain table.
+ * This frees all the underlying memory and clears the members.
+ */
+SOAPY_SDR_API void SoapySDRGainTable_clear(SoapySDRGainTable *table);
+
 #ifdef __cplusplus
 }
 #endif
@@ -150,6 +150,246 @@ public:
  */
 typedef std::vector<ArgInfo> ArgInfoList;
 
+/*!
+ * Runtime statistics of a stream.
+ * The counters are accumulated from stream setup.
+ */
+class SOAPY_SDR_API StreamStats
+{
+public:
+
+    //! Default constructor, all counters zero
+    StreamStats(void);
+
+    //! The total number of elements read or written
+    unsigned long long numElems;
+
+    //! The number of read, write, and acquire calls
+    unsigned long long numCalls;
+
+    //! The number of calls that returned SOAPY_SDR_TIMEOUT
+    unsigned long long numTimeouts;
+
+    //! The number of overflows on a receive stream, including those gap filled
+    unsigned long long numOverflows;
+
+    //! The number of underflows reported on a transmit stream
+    unsigned long long numUnderflows;
+
+    //! The number of late or otherwise rejected timestamps
+    unsigned long long numTimeErrors;
+
+    //! The number of sample gaps filled by the library
+    unsigned long long numGaps;
+
+    //! The total number of elements inserted into gaps
+    unsigned long long numGapElems;
+
+    /*!
+     * Histogram of the latency of each call:
+     * bucket i counts calls which took [2^i, 2^(i+1)) microseconds,
+     * bucket 0 also counts calls under a microsecond.
+     */
+    std::vector<unsigned long long> latencyHistogram;
+};
+
+/*!
+ * A table of element gains for each overall gain of a channel.
+ * The rows are sorted by ascending overall gain,
+ * and each row has one gain value per element.
+ */
+class SOAPY_SDR_API GainTable
+{
+public:
+
+    //! Default constructor, an empty table
+    GainTable(void);
+
+    //! The names of the gain elements, the columns of the table
+    std::vector<std::string> elements;
+
+    //! The overall gain of each row in dB
+    std::vector<double> gains;
+
+    //! The element gains in dB, gains.size() x elements.size() in row-major order
+    std::vector<double> values;
+};
+
+/*!
+ * One register access in a batch of register operations.
+ * A read reports the register value with the mask applied.
+ * A write sets the bits of the register selected by the mask,
+ * and leaves the other bits unchanged.
+ */
+class SOAPY_SDR_API RegisterOp
+{
+public:
+
+    //! Default constructor, a full-width write of zero to address zero
+    RegisterOp(void);
+
+    //! Create an operation given the address, value, mask, and direction
+    RegisterOp(const unsigned addr, const unsigned value, const unsigned mask = ~0u, const bool read = false);
+
+    //! The register address
+    unsigned addr;
+
+    //! The value to write, unused for a read
+    unsigned value;
+
+    //! The register bits which are read or written
+    unsigned mask;
+
+    //! True for a read, false for a write
+    bool read;
+};
+
+//! Typedef for a list of register operations
+typedef std::vector<RegisterOp> RegisterOpList;
+
+/*!
+ * One message in an I2C transaction.
+ * A write message sends the bytes in data,
+ * and a read message receives numBytes bytes.
+ */
+class SOAPY_SDR_API I2CMessage
+{
+public:
+
+    //! Default constructor, an empty write to address zero
+    I2CMessage(void);
+
+    //! Create a write message given the slave address and the bytes to send
+    I2CMessage(const int addr, const std::string &data);
+
+    //! Create a read message given the slave address and the number of bytes
+    I2CMessage(const int addr, const size_t numBytes);
+
+    //! The address of the slave
+    int addr;
+
+    //! True for a read, false for a write
+    bool read;
+
+    //! The bytes to write, unused for a read
+    std::string data;
+
+    //! The number of bytes to read, unused for a write
+    size_t numBytes;
+};
+
+//! Typedef for a list of I2C messages
+typedef std::vector<I2CMessage> I2CMessageList;
+
+/*!
+ * A configuration command to apply at a hardware time.
+ * Use the static calls, such as TimedCommand::frequency(),
+ * to create a command of each type.
+ */
+class SOAPY_SDR_API TimedCommand
+{
+public:
+
+    //! The operation of a command
+    enum Type
+    {
+        FREQUENCY, //!< setFrequency() with the name, value, and args
+        GAIN, //!< setGain() with the name and value
+        GPIO, //!< writeGPIO() with the name, gpioValue, and gpioMask
+        SETTING //!< writeSetting() with the name and settingValue
+    };
+
+    //! Default constructor, an overall frequency command at time zero
+    TimedCommand(void);
+
+    //! Create a command to tune the overall frequency of a channel
+    static TimedCommand frequency(const long long timeNs, const int direction, const size_t channel, const double frequency, const Kwargs &args = Kwargs());
+
+    //! Create a command to tune a frequency component of a channel
+    static TimedCommand frequency(const long long timeNs, const int direction, const size_t channel, const std::string &name, const double frequency, const Kwargs &args = Kwargs());
+
+    //! Create a command to set the overall gain of a channel
+    static TimedCommand gain(const long long timeNs, const int direction, const size_t channel, const double value);
+
+    //! Create a command to set a gain element of a channel
+    static TimedCommand gain(const long long timeNs, const int direction, const size_t channel, const std::string &name, const double value);
+
+    //! Create a command to write the masked bits of a GPIO bank
+    static TimedCommand gpio(const long long timeNs, const std::string &bank, const unsigned value, const unsigned mask = ~0u);
+
+    //! Create a command to write a channel setting
+    static TimedCommand setting(const long long timeNs, const int direction, const size_t channel, const std::string &key, const std::string &value);
+
+    //! The hardware time to apply the command in nanoseconds
+    long long timeNs;
+
+    //! The operation of the command
+    Type type;
+
+    //! The channel direction RX or TX, unused for GPIO
+    int direction;
+
+    //! The channel on the device, unused for GPIO
+    size_t channel;
+
+    /*!
+     * The frequency component or gain element, empty for the overall value,
+     * the GPIO bank, or the setting key.
+     */
+    std::string name;
+
+    //! The frequency in Hz or the gain in dB
+    double value;
+
+    //! The tune arguments of a frequency command
+    Kwargs args;
+
+    //! The GPIO value to write
+    unsigned gpioValue;
+
+    //! The GPIO bits to write
+    unsigned gpioMask;
+
+    //! The value of a setting command
+    std::string settingValue;
+};
+
+//! Typedef for a list of timed commands
+typedef std::vector<TimedCommand> TimedCommandList;
+
+/*!
+ * Statistics of the timed commands of a device.
+ * The counters are accumulated from device creation.
+ */
+class SOAPY_SDR_API CommandQueueStats
+{
+public:
+
+    //! Default constructor, all counters zero
+    CommandQueueStats(void);
+
+    //! The number of commands queued
+    unsigned long long numQueued;
+
+    //! The number of commands accepted by a hardware command queue
+    unsigned long long numOffloaded;
+
+    //! The number of commands applied by the library scheduler
+    unsigned long long numApplied;
+
+    //! The number of commands applied after their time
+    unsigned long long numLate;
+
+    //! The number of commands which failed to apply
+    unsigned long long numFailed;
+
+    //! The number of commands waiting in the library scheduler
+    unsigned long long numPending;
+
+    //! The largest time by which a command was late in nanoseconds
+    long long maxLateNs;
+};
+
 }
 
 inline double SoapySDR::Range::minimum(void) const
@@ -27,7 +27,7 @@
  * #endif
  * \endcode
  */
-#define SOAPY_SDR_API_VERSION 0x00080200
+#define SOAPY_SDR_API_VERSION 0x00080300
 
 /*!
  * ABI Version Information - incremented when the ABI is changed.
@@ -36,7 +36,7 @@
  * And <i>extra</i> is empty for releases but set on development branches.
  * The ABI should remain constant across patch releases of the library.
  */
-#define SOAPY_SDR_ABI_VERSION "0.8-3"
+#define SOAPY_SDR_ABI_VERSION "0.8-4"
 
 /*!
  * Compatibility define for GPIO access API with masks
@@ -173,6 +173,61 @@
  */
 #define SOAPY_SDR_API_HAS_GET_LOG_LEVEL
 
+/*!
+ * Compatibility define for finite sample captures
+ */
+#define SOAPY_SDR_API_HAS_CAPTURE_SAMPLES
+
+/*!
+ * Compatibility define for per-stream runtime statistics
+ */
+#define SOAPY_SDR_API_HAS_STREAM_STATS
+
+/*!
+ * Compatibility define for tapping receive streams
+ */
+#define SOAPY_SDR_API_HAS_STREAM_TAP
+
+/*!
+ * Compatibility define for configuration transactions
+ */
+#define SOAPY_SDR_API_HAS_CONFIG_TRANSACTION
+
+/*!
+ * Compatibility define for frequency hop tables
+ */
+#define SOAPY_SDR_API_HAS_HOP_TABLE
+
+/*!
+ * Compatibility define for frequency sweeps
+ */
+#define SOAPY_SDR_API_HAS_SWEEP
+
+/*!
+ * Compatibility define for gain tables
+ */
+#define SOAPY_SDR_API_HAS_GAIN_TABLE
+
+/*!
+ * Compatibility define for batched register transactions
+ */
+#define SOAPY_SDR_API_HAS_REGISTER_TRANSACTIONS
+
+/*!
+ * Compatibility define for I2C transactions and SPI batches
+ */
+#define SOAPY_SDR_API_HAS_BUS_TRANSACTIONS
+
+/*!
+ * Compatibility define for typed setting and sensor calls
+ */
+#define SOAPY_SDR_API_HAS_TYPED_SETTINGS
+
+/*!
+ * Compatibility define for the timed command queue
+ */
+#define SOAPY_SDR_API_HAS_TIMED_COMMANDS
+
 #ifdef __cplusplus
 extern "C" {
 #endif
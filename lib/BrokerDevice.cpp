@@ -0,0 +1,767 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+
+#ifdef _WIN32
+
+void lateLoadBrokerDevice(void)
+{
+    return;
+}
+
+#else
+
+#include "BrokerProtocol.hpp"
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <stdexcept>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using SoapyBroker::Message;
+
+static int connectBroker(const std::string &path)
+{
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) return -1;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path)-1);
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0) return fd;
+    close(fd);
+    return -1;
+}
+
+static std::string brokerPath(const SoapySDR::Kwargs &args)
+{
+    return (args.count("socket") != 0)?args.at("socket"):SoapyBroker::DEFAULT_SOCKET;
+}
+
+/*******************************************************************
+ * Client side of a shared receive stream
+ ******************************************************************/
+struct BrokerStream
+{
+    size_t id;
+    SoapyBroker::RingHeader *ring;
+    size_t mapSize;
+    size_t channel;
+    SoapySDR::ConverterRegistry::ConverterFunction convert;
+    size_t elemSize;
+    double rate;
+
+    //the next slot to read and the elements already read from it
+    uint64_t readSeq;
+    size_t offset;
+
+    //a released buffer was overwritten while the client held it
+    bool overwritten;
+
+    bool active;
+    bool hasStart;
+    long long startNs;
+    bool finite;
+    size_t remaining;
+};
+
+/*******************************************************************
+ * Broker client device
+ ******************************************************************/
+class BrokerDevice : public SoapySDR::Device
+{
+public:
+    BrokerDevice(const SoapySDR::Kwargs &args):
+        _fd(connectBroker(brokerPath(args)))
+    {
+        if (_fd < 0) throw std::runtime_error("BrokerDevice: cannot connect to " + brokerPath(args) + ": " + std::strerror(errno));
+    }
+
+    ~BrokerDevice(void)
+    {
+        close(_fd);
+    }
+
+    //send a request and return the results, the broker errors are thrown
+    Message call(const Message &request) const
+    {
+        Message reply;
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (not SoapyBroker::sendMessage(_fd, request) or not SoapyBroker::recvMessage(_fd, reply) or reply.empty())
+        {
+            throw std::runtime_error("BrokerDevice: lost connection to the broker");
+        }
+        if (reply.front() != "ok") throw std::runtime_error("BrokerDevice::" + request.front() + "() " + reply.back());
+        reply.erase(reply.begin());
+        return reply;
+    }
+
+    //call with the direction and channel
+    Message call(const std::string &name, const int direction, const size_t channel, const Message &args = Message()) const
+    {
+        Message request{name, std::to_string(direction), std::to_string(channel)};
+        request.insert(request.end(), args.begin(), args.end());
+        return this->call(request);
+    }
+
+    std::string callString(const std::string &name, const int direction, const size_t channel, const Message &args = Message()) const
+    {
+        return this->call(name, direction, channel, args).at(0);
+    }
+
+    double callDouble(const std::string &name, const int direction, const size_t channel, const Message &args = Message()) const
+    {
+        return std::stod(this->callString(name, direction, channel, args));
+    }
+
+    bool callBool(const std::string &name, const int direction, const size_t channel, const Message &args = Message()) const
+    {
+        return this->callString(name, direction, channel, args) == SOAPY_SDR_TRUE;
+    }
+
+    /*******************************************************************
+     * Identification API
+     ******************************************************************/
+    std::string getDriverKey(void) const
+    {
+        return "broker";
+    }
+
+    std::string getHardwareKey(void) const
+    {
+        return this->call({"getHardwareKey"}).at(0);
+    }
+
+    SoapySDR::Kwargs getHardwareInfo(void) const
+    {
+        auto info = SoapyBroker::toKwargs(this->call({"getHardwareInfo"}), 0);
+        info["driver"] = this->call({"getDriverKey"}).at(0);
+        return info;
+    }
+
+    /*******************************************************************
+     * Channels API
+     ******************************************************************/
+    size_t getNumChannels(const int direction) const
+    {
+        return std::stoul(this->call({"getNumChannels", std::to_string(direction)}).at(0));
+    }
+
+    SoapySDR::Kwargs getChannelInfo(const int direction, const size_t channel) const
+    {
+        return SoapyBroker::toKwargs(this->call("getChannelInfo", direction, channel), 0);
+    }
+
+    bool getFullDuplex(const int direction, const size_t channel) const
+    {
+        return this->callBool("getFullDuplex", direction, channel);
+    }
+
+    /*******************************************************************
+     * Stream API
+     ******************************************************************/
+    std::vector<std::string> getStreamFormats(const int direction, const size_t channel) const
+    {
+        //the shared ring holds the native format, the others are converted
+        double fullScale(0.0);
+        const auto native = this->getNativeStreamFormat(direction, channel, fullScale);
+        auto formats = SoapySDR::ConverterRegistry::listTargetFormats(native);
+        formats.insert(formats.begin(), native);
+        return formats;
+    }
+
+    std::string getNativeStreamFormat(const int direction, const size_t channel, double &fullScale) const
+    {
+        const auto reply = this->call("getNativeStreamFormat", direction, channel);
+        fullScale = std::stod(reply.at(1));
+        return reply.at(0);
+    }
+
+    SoapySDR::ArgInfoList getStreamArgsInfo(const int direction, const size_t) const
+    {
+        SoapySDR::ArgInfoList infos;
+        if (direction != SOAPY_SDR_RX) return infos;
+
+        SoapySDR::ArgInfo info;
+        info.key = "slots";
+        info.name = "Ring Slots";
+        info.value = "64";
+        info.units = "buffers";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "The number of stream MTU buffers in the shared memory ring, set by the first client of a stream.";
+        infos.push_back(info);
+        return infos;
+    }
+
+    SoapySDR::Stream *setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+    {
+        if (direction != SOAPY_SDR_RX) throw std::runtime_error("BrokerDevice::setupStream() only receive streams are shared");
+        const auto chans = channels.empty()?std::vector<size_t>(1, 0):channels;
+
+        Message request{"setupStream", std::to_string(chans.size())};
+        for (const auto ch : chans) request.push_back(std::to_string(ch));
+        SoapyBroker::appendKwargs(request, args);
+        const auto reply = this->call(request);
+
+        std::unique_ptr<BrokerStream> stream(new BrokerStream());
+        stream->id = std::stoul(reply.at(0));
+        stream->ring = nullptr;
+        const int fd = shm_open(reply.at(1).c_str(), O_RDWR, 0);
+        struct stat st;
+        if (fd >= 0 and fstat(fd, &st) == 0)
+        {
+            void *mem = mmap(nullptr, size_t(st.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mem != MAP_FAILED) stream->ring = reinterpret_cast<SoapyBroker::RingHeader *>(mem);
+            stream->mapSize = size_t(st.st_size);
+        }
+        if (fd >= 0) close(fd);
+        if (stream->ring == nullptr or stream->ring->magic != SoapyBroker::RING_MAGIC)
+        {
+            if (stream->ring != nullptr) munmap(stream->ring, stream->mapSize);
+            this->call({"closeStream", std::to_string(stream->id)});
+            throw std::runtime_error("BrokerDevice::setupStream() cannot map " + reply.at(1));
+        }
+
+        const std::string ringFormat(stream->ring->format);
+        stream->convert = nullptr;
+        if (format != ringFormat)
+        {
+            stream->convert = SoapySDR::ConverterRegistry::getFunction(ringFormat, format);
+            if (stream->convert == nullptr)
+            {
+                this->closeStream(reinterpret_cast<SoapySDR::Stream *>(stream.release()));
+                throw std::runtime_error("BrokerDevice::setupStream() cannot convert " + ringFormat + " to " + format);
+            }
+        }
+        stream->elemSize = SoapySDR::formatToSize(format);
+        stream->channel = chans.front();
+        stream->rate = this->getSampleRate(direction, stream->channel);
+        stream->readSeq = 0;
+        stream->offset = 0;
+        stream->overwritten = false;
+        stream->active = false;
+        return reinterpret_cast<SoapySDR::Stream *>(stream.release());
+    }
+
+    void closeStream(SoapySDR::Stream *handle)
+    {
+        std::unique_ptr<BrokerStream> stream(reinterpret_cast<BrokerStream *>(handle));
+        munmap(stream->ring, stream->mapSize);
+        this->call({"closeStream", std::to_string(stream->id)});
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *handle) const
+    {
+        auto stream = reinterpret_cast<BrokerStream *>(handle);
+        return stream->ring->slotElems;
+    }
+
+    int activateStream(SoapySDR::Stream *handle, const int flags, const long long timeNs, const size_t numElems)
+    {
+        //the shared stream runs continuously, timed and finite activations are applied by the reader
+        auto stream = reinterpret_cast<BrokerStream *>(handle);
+        if ((flags & ~SOAPY_SDR_HAS_TIME) != 0) return SOAPY_SDR_NOT_SUPPORTED;
+        this->call({"activateStream", std::to_string(stream->id)});
+        stream->rate = this->getSampleRate(SOAPY_SDR_RX, stream->channel);
+        stream->readSeq = stream->ring->writeSeq.load(std::memory_order_acquire);
+        stream->offset = 0;
+        stream->overwritten = false;
+        stream->hasStart = (flags & SOAPY_SDR_HAS_TIME) != 0;
+        stream->startNs = timeNs;
+        stream->finite = numElems != 0;
+        stream->remaining = numElems;
+        stream->active = true;
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *handle, const int flags, const long long)
+    {
+        auto stream = reinterpret_cast<BrokerStream *>(handle);
+        if (flags != 0) return SOAPY_SDR_NOT_SUPPORTED;
+        this->call({"deactivateStream", std::to_string(stream->id)});
+        stream->active = false;
+        return 0;
+    }
+
+    //wait for the next published slot, returns 0 or an error code
+    int waitSlot(BrokerStream *stream, const long timeoutUs, SoapyBroker::RingSlot *&slot)
+    {
+        auto ring = stream->ring;
+        if (ring->writeSeq.load(std::memory_order_acquire) <= stream->readSeq)
+        {
+            timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            const long long ns = deadline.tv_nsec + (long long)timeoutUs*1000;
+            deadline.tv_sec += time_t(ns/1000000000);
+            deadline.tv_nsec = long(ns%1000000000);
+
+            SoapyBroker::lockRing(ring);
+            int ret = 0;
+            while (ret == 0 and ring->writeSeq.load(std::memory_order_acquire) <= stream->readSeq)
+            {
+                ret = SoapyBroker::waitRing(ring, deadline);
+            }
+            pthread_mutex_unlock(&ring->mutex);
+            if (ring->writeSeq.load(std::memory_order_acquire) <= stream->readSeq) return SOAPY_SDR_TIMEOUT;
+        }
+
+        //the broker never waits, so a reader that falls a ring behind restarts at the newest slot
+        const uint64_t writeSeq = ring->writeSeq.load(std::memory_order_acquire);
+        slot = SoapyBroker::ringSlot(ring, size_t(stream->readSeq % ring->numSlots));
+        if (writeSeq - stream->readSeq > ring->numSlots or slot->seq.load(std::memory_order_acquire) != stream->readSeq)
+        {
+            stream->readSeq = writeSeq;
+            stream->offset = 0;
+            return SOAPY_SDR_OVERFLOW;
+        }
+        return 0;
+    }
+
+    int readStream(SoapySDR::Stream *handle, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<BrokerStream *>(handle);
+        if (not stream->active) return SOAPY_SDR_STREAM_ERROR;
+        if (stream->finite and stream->remaining == 0) return SOAPY_SDR_TIMEOUT;
+
+        while (true)
+        {
+            SoapyBroker::RingSlot *slot(nullptr);
+            const int err = this->waitSlot(stream, timeoutUs, slot);
+            if (err != 0) return err;
+            const int ret = std::min<int>(slot->ret, int(stream->ring->slotElems));
+            const int slotFlags = slot->flags;
+            const long long slotTimeNs = slot->timeNs;
+            if (ret <= 0)
+            {
+                stream->readSeq++;
+                if (ret < 0) return ret;
+                continue;
+            }
+
+            //drop the samples before a timed activation
+            if (stream->hasStart and (slotFlags & SOAPY_SDR_HAS_TIME) != 0)
+            {
+                const long long ticks = SoapySDR::timeNsToTicks(stream->startNs - slotTimeNs, stream->rate);
+                if (ticks >= ret)
+                {
+                    stream->readSeq++;
+                    continue;
+                }
+                stream->offset = std::max(stream->offset, size_t(std::max<long long>(ticks, 0)));
+                stream->hasStart = false;
+            }
+
+            size_t n = std::min(numElems, size_t(ret) - stream->offset);
+            if (stream->finite) n = std::min(n, stream->remaining);
+            const size_t index = size_t(stream->readSeq % stream->ring->numSlots);
+            const size_t ringElemSize = stream->ring->elemSize;
+            for (size_t i = 0; i < stream->ring->numChans; i++)
+            {
+                const char *src = SoapyBroker::ringBuffer(stream->ring, index, i) + stream->offset*ringElemSize;
+                if (stream->convert == nullptr) std::memcpy(buffs[i], src, n*stream->elemSize);
+                else stream->convert(src, buffs[i], n, 1.0);
+            }
+
+            //the slot may have been overwritten during the copy
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot->seq.load(std::memory_order_relaxed) != stream->readSeq)
+            {
+                stream->readSeq = stream->ring->writeSeq.load(std::memory_order_acquire);
+                stream->offset = 0;
+                return SOAPY_SDR_OVERFLOW;
+            }
+
+            flags = slotFlags & SOAPY_SDR_HAS_TIME;
+            timeNs = slotTimeNs + SoapySDR::ticksToTimeNs(stream->offset, stream->rate);
+            stream->offset += n;
+            if (stream->offset == size_t(ret))
+            {
+                flags |= slotFlags & SOAPY_SDR_END_BURST;
+                stream->readSeq++;
+                stream->offset = 0;
+            }
+            if (stream->finite and (stream->remaining -= n) == 0) flags |= SOAPY_SDR_END_BURST;
+            return int(n);
+        }
+    }
+
+    /*******************************************************************
+     * Direct buffer access API: the slots of the shared memory ring
+     ******************************************************************/
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *handle)
+    {
+        auto stream = reinterpret_cast<BrokerStream *>(handle);
+        return (stream->convert == nullptr)?stream->ring->numSlots:0;
+    }
+
+    int getDirectAccessBufferAddrs(SoapySDR::Stream *handle, const size_t bufHandle, void **buffs)
+    {
+        auto stream = reinterpret_cast<BrokerStream *>(handle);
+        if (stream->convert != nullptr or bufHandle >= stream->ring->numSlots) return SOAPY_SDR_NOT_SUPPORTED;
+        for (size_t i = 0; i < stream->ring->numChans; i++) buffs[i] = SoapyBroker::ringBuffer(stream->ring, bufHandle, i);
+        return 0;
+    }
+
+    int acquireReadBuffer(SoapySDR::Stream *handle, size_t &bufHandle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<BrokerStream *>(handle);
+        if (stream->convert != nullptr) return SOAPY_SDR_NOT_SUPPORTED;
+        if (not stream->active) return SOAPY_SDR_STREAM_ERROR;
+
+        //the samples of the last released buffer were lost
+        if (stream->overwritten)
+        {
+            stream->overwritten = false;
+            stream->readSeq = stream->ring->writeSeq.load(std::memory_order_acquire);
+            stream->offset = 0;
+            return SOAPY_SDR_OVERFLOW;
+        }
+
+        //the buffer stays valid until the broker wraps around the ring
+        SoapyBroker::RingSlot *slot(nullptr);
+        const int err = this->waitSlot(stream, timeoutUs, slot);
+        if (err != 0) return err;
+        const int ret = std::min<int>(slot->ret, int(stream->ring->slotElems));
+        if (ret < 0)
+        {
+            stream->readSeq++;
+            return ret;
+        }
+        bufHandle = size_t(stream->readSeq % stream->ring->numSlots);
+        for (size_t i = 0; i < stream->ring->numChans; i++) buffs[i] = SoapyBroker::ringBuffer(stream->ring, bufHandle, i);
+        flags = slot->flags;
+        timeNs = slot->timeNs;
+        stream->offset = 0;
+        return ret;
+    }
+
+    void releaseReadBuffer(SoapySDR::Stream *handle, const size_t bufHandle)
+    {
+        //the broker invalidates a slot before it writes into it,
+        //so the sequence is unchanged only if the buffer was intact
+        auto stream = reinterpret_cast<BrokerStream *>(handle);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto slot = SoapyBroker::ringSlot(stream->ring, bufHandle % stream->ring->numSlots);
+        if (slot->seq.load(std::memory_order_relaxed) != stream->readSeq) stream->overwritten = true;
+        stream->readSeq++;
+    }
+
+    /*******************************************************************
+     * Antenna API
+     ******************************************************************/
+    std::vector<std::string> listAntennas(const int direction, const size_t channel) const
+    {
+        return this->call("listAntennas", direction, channel);
+    }
+
+    void setAntenna(const int direction, const size_t channel, const std::string &name)
+    {
+        this->call("setAntenna", direction, channel, {name});
+    }
+
+    std::string getAntenna(const int direction, const size_t channel) const
+    {
+        return this->callString("getAntenna", direction, channel);
+    }
+
+    /*******************************************************************
+     * Frontend corrections API
+     ******************************************************************/
+    bool hasDCOffsetMode(const int direction, const size_t channel) const
+    {
+        return this->callBool("hasDCOffsetMode", direction, channel);
+    }
+
+    void setDCOffsetMode(const int direction, const size_t channel, const bool automatic)
+    {
+        this->call("setDCOffsetMode", direction, channel, {SoapySDR::SettingToString(automatic)});
+    }
+
+    bool getDCOffsetMode(const int direction, const size_t channel) const
+    {
+        return this->callBool("getDCOffsetMode", direction, channel);
+    }
+
+    /*******************************************************************
+     * Gain API
+     ******************************************************************/
+    std::vector<std::string> listGains(const int direction, const size_t channel) const
+    {
+        return this->call("listGains", direction, channel);
+    }
+
+    bool hasGainMode(const int direction, const size_t channel) const
+    {
+        return this->callBool("hasGainMode", direction, channel);
+    }
+
+    void setGainMode(const int direction, const size_t channel, const bool automatic)
+    {
+        this->call("setGainMode", direction, channel, {SoapySDR::SettingToString(automatic)});
+    }
+
+    bool getGainMode(const int direction, const size_t channel) const
+    {
+        return this->callBool("getGainMode", direction, channel);
+    }
+
+    void setGain(const int direction, const size_t channel, const double value)
+    {
+        this->call("setGain", direction, channel, {SoapyBroker::fromDouble(value)});
+    }
+
+    void setGain(const int direction, const size_t channel, const std::string &name, const double value)
+    {
+        this->call("setGainElement", direction, channel, {name, SoapyBroker::fromDouble(value)});
+    }
+
+    double getGain(const int direction, const size_t channel) const
+    {
+        return this->callDouble("getGain", direction, channel);
+    }
+
+    double getGain(const int direction, const size_t channel, const std::string &name) const
+    {
+        return this->callDouble("getGainElement", direction, channel, {name});
+    }
+
+    SoapySDR::Range getGainRange(const int direction, const size_t channel) const
+    {
+        return SoapyBroker::toRanges(this->call("getGainRange", direction, channel), 0).at(0);
+    }
+
+    SoapySDR::Range getGainRange(const int direction, const size_t channel, const std::string &name) const
+    {
+        return SoapyBroker::toRanges(this->call("getGainElementRange", direction, channel, {name}), 0).at(0);
+    }
+
+    /*******************************************************************
+     * Frequency API
+     ******************************************************************/
+    void setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args)
+    {
+        Message request{SoapyBroker::fromDouble(frequency)};
+        SoapyBroker::appendKwargs(request, args);
+        this->call("setFrequency", direction, channel, request);
+    }
+
+    void setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args)
+    {
+        Message request{name, SoapyBroker::fromDouble(frequency)};
+        SoapyBroker::appendKwargs(request, args);
+        this->call("setFrequencyComponent", direction, channel, request);
+    }
+
+    double getFrequency(const int direction, const size_t channel) const
+    {
+        return this->callDouble("getFrequency", direction, channel);
+    }
+
+    double getFrequency(const int direction, const size_t channel, const std::string &name) const
+    {
+        return this->callDouble("getFrequencyComponent", direction, channel, {name});
+    }
+
+    std::vector<std::string> listFrequencies(const int direction, const size_t channel) const
+    {
+        return this->call("listFrequencies", direction, channel);
+    }
+
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel) const
+    {
+        return SoapyBroker::toRanges(this->call("getFrequencyRange", direction, channel), 0);
+    }
+
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel, const std::string &name) const
+    {
+        return SoapyBroker::toRanges(this->call("getFrequencyComponentRange", direction, channel, {name}), 0);
+    }
+
+    /*******************************************************************
+     * Sample Rate API
+     ******************************************************************/
+    void setSampleRate(const int direction, const size_t channel, const double rate)
+    {
+        this->call("setSampleRate", direction, channel, {SoapyBroker::fromDouble(rate)});
+    }
+
+    double getSampleRate(const int direction, const size_t channel) const
+    {
+        return this->callDouble("getSampleRate", direction, channel);
+    }
+
+    SoapySDR::RangeList getSampleRateRange(const int direction, const size_t channel) const
+    {
+        return SoapyBroker::toRanges(this->call("getSampleRateRange", direction, channel), 0);
+    }
+
+    /*******************************************************************
+     * Bandwidth API
+     ******************************************************************/
+    void setBandwidth(const int direction, const size_t channel, const double bw)
+    {
+        this->call("setBandwidth", direction, channel, {SoapyBroker::fromDouble(bw)});
+    }
+
+    double getBandwidth(const int direction, const size_t channel) const
+    {
+        return this->callDouble("getBandwidth", direction, channel);
+    }
+
+    SoapySDR::RangeList getBandwidthRange(const int direction, const size_t channel) const
+    {
+        return SoapyBroker::toRanges(this->call("getBandwidthRange", direction, channel), 0);
+    }
+
+    /*******************************************************************
+     * Clocking API
+     ******************************************************************/
+    std::vector<std::string> listClockSources(void) const
+    {
+        return this->call({"listClockSources"});
+    }
+
+    void setClockSource(const std::string &source)
+    {
+        this->call({"setClockSource", source});
+    }
+
+    std::string getClockSource(void) const
+    {
+        return this->call({"getClockSource"}).at(0);
+    }
+
+    /*******************************************************************
+     * Time API
+     ******************************************************************/
+    std::vector<std::string> listTimeSources(void) const
+    {
+        return this->call({"listTimeSources"});
+    }
+
+    void setTimeSource(const std::string &source)
+    {
+        this->call({"setTimeSource", source});
+    }
+
+    std::string getTimeSource(void) const
+    {
+        return this->call({"getTimeSource"}).at(0);
+    }
+
+    bool hasHardwareTime(const std::string &what) const
+    {
+        return this->call({"hasHardwareTime", what}).at(0) == SOAPY_SDR_TRUE;
+    }
+
+    long long getHardwareTime(const std::string &what) const
+    {
+        return std::stoll(this->call({"getHardwareTime", what}).at(0));
+    }
+
+    void setHardwareTime(const long long timeNs, const std::string &what)
+    {
+        this->call({"setHardwareTime", std::to_string(timeNs), what});
+    }
+
+    /*******************************************************************
+     * Sensor API
+     ******************************************************************/
+    std::vector<std::string> listSensors(void) const
+    {
+        return this->call({"listSensors"});
+    }
+
+    std::string readSensor(const std::string &key) const
+    {
+        return this->call({"readSensor", key}).at(0);
+    }
+
+    std::vector<std::string> listSensors(const int direction, const size_t channel) const
+    {
+        return this->call("listChannelSensors", direction, channel);
+    }
+
+    std::string readSensor(const int direction, const size_t channel, const std::string &key) const
+    {
+        return this->callString("readChannelSensor", direction, channel, {key});
+    }
+
+    /*******************************************************************
+     * Settings API
+     ******************************************************************/
+    void writeSetting(const std::string &key, const std::string &value)
+    {
+        this->call({"writeSetting", key, value});
+    }
+
+    std::string readSetting(const std::string &key) const
+    {
+        return this->call({"readSetting", key}).at(0);
+    }
+
+    void writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value)
+    {
+        this->call("writeChannelSetting", direction, channel, {key, value});
+    }
+
+    std::string readSetting(const int direction, const size_t channel, const std::string &key) const
+    {
+        return this->callString("readChannelSetting", direction, channel, {key});
+    }
+
+private:
+    const int _fd;
+    mutable std::mutex _mutex;
+};
+
+/*******************************************************************
+ * Registration
+ ******************************************************************/
+static SoapySDR::KwargsList findBrokerDevice(const SoapySDR::Kwargs &args)
+{
+    SoapySDR::KwargsList results;
+    if (args.count("driver") == 0 or args.at("driver") != "broker") return results;
+
+    //a broker is found when its socket accepts a connection
+    const auto path = brokerPath(args);
+    const int fd = connectBroker(path);
+    if (fd < 0) return results;
+    close(fd);
+
+    SoapySDR::Kwargs result;
+    result["driver"] = "broker";
+    result["socket"] = path;
+    result["label"] = "Broker " + path;
+    results.push_back(result);
+    return results;
+}
+
+static SoapySDR::Device *makeBrokerDevice(const SoapySDR::Kwargs &args)
+{
+    return new BrokerDevice(args);
+}
+
+/*!
+ * lateLoadBrokerDevice() is called by loadModules()
+ * to load the broker device on-demand/not statically.
+ * See lateLoadNullDevice() for the reasoning.
+ */
+void lateLoadBrokerDevice(void)
+{
+    static SoapySDR::Registry registerBrokerDevice("broker", &findBrokerDevice, &makeBrokerDevice, SOAPY_SDR_ABI_VERSION);
+}
+
+#endif //_WIN32
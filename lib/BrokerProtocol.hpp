@@ -0,0 +1,238 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+/*!
+ * The broker shares one device between processes on a POSIX host.
+ * The broker process owns the device and serves control calls on a unix socket.
+ * Each shared receive stream is published into a shared memory ring,
+ * which any number of client processes read without blocking the broker.
+ * This header is shared by the broker in SoapySDRUtil and the broker driver.
+ */
+
+#ifndef _WIN32
+
+#include <SoapySDR/Types.hpp>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace SoapyBroker
+{
+
+static const char DEFAULT_SOCKET[] = "/tmp/SoapySDRBroker.sock";
+
+/*******************************************************************
+ * Control messages: a list of strings, each with a length prefix.
+ * A request starts with the call name, a reply starts with
+ * "ok" followed by the results, or "error" followed by the message.
+ ******************************************************************/
+typedef std::vector<std::string> Message;
+
+//limits on a received message, so that a bad peer cannot exhaust the memory
+static const uint32_t MAX_MESSAGE_STRINGS = 1 << 16;
+static const size_t MAX_MESSAGE_BYTES = 1 << 26;
+
+static inline bool sendAll(const int fd, const void *buff, size_t len)
+{
+    const char *p = reinterpret_cast<const char *>(buff);
+    while (len != 0)
+    {
+        const ssize_t ret = ::send(fd, p, len, MSG_NOSIGNAL);
+        if (ret <= 0) return false;
+        p += ret;
+        len -= size_t(ret);
+    }
+    return true;
+}
+
+static inline bool recvAll(const int fd, void *buff, size_t len)
+{
+    char *p = reinterpret_cast<char *>(buff);
+    while (len != 0)
+    {
+        const ssize_t ret = ::recv(fd, p, len, 0);
+        if (ret <= 0) return false;
+        p += ret;
+        len -= size_t(ret);
+    }
+    return true;
+}
+
+static inline bool sendMessage(const int fd, const Message &msg)
+{
+    std::string out;
+    const uint32_t count = uint32_t(msg.size());
+    out.append(reinterpret_cast<const char *>(&count), sizeof(count));
+    for (const auto &s : msg)
+    {
+        const uint32_t len = uint32_t(s.size());
+        out.append(reinterpret_cast<const char *>(&len), sizeof(len));
+        out.append(s);
+    }
+    return sendAll(fd, out.data(), out.size());
+}
+
+//false when the peer went away or sent a message over the limits
+static inline bool recvMessage(const int fd, Message &msg)
+{
+    uint32_t count = 0;
+    if (not recvAll(fd, &count, sizeof(count))) return false;
+    if (count > MAX_MESSAGE_STRINGS) return false;
+    msg.resize(count);
+    size_t total = 0;
+    for (auto &s : msg)
+    {
+        uint32_t len = 0;
+        if (not recvAll(fd, &len, sizeof(len))) return false;
+        total += len;
+        if (total > MAX_MESSAGE_BYTES) return false;
+        s.resize(len);
+        if (len != 0 and not recvAll(fd, &s[0], len)) return false;
+    }
+    return true;
+}
+
+//doubles are sent with full precision
+static inline std::string fromDouble(const double value)
+{
+    char buff[32];
+    std::snprintf(buff, sizeof(buff), "%.17g", value);
+    return buff;
+}
+
+//keyword arguments are a count followed by the keys and values
+static inline void appendKwargs(Message &msg, const SoapySDR::Kwargs &args)
+{
+    msg.push_back(std::to_string(args.size()));
+    for (const auto &it : args)
+    {
+        msg.push_back(it.first);
+        msg.push_back(it.second);
+    }
+}
+
+static inline SoapySDR::Kwargs toKwargs(const Message &msg, const size_t pos)
+{
+    SoapySDR::Kwargs args;
+    const size_t count = std::stoul(msg.at(pos));
+    for (size_t i = 0; i < count; i++) args[msg.at(pos+1+2*i)] = msg.at(pos+2+2*i);
+    return args;
+}
+
+//ranges are triples of minimum, maximum, and step
+static inline void appendRanges(Message &msg, const SoapySDR::RangeList &ranges)
+{
+    for (const auto &range : ranges)
+    {
+        msg.push_back(fromDouble(range.minimum()));
+        msg.push_back(fromDouble(range.maximum()));
+        msg.push_back(fromDouble(range.step()));
+    }
+}
+
+static inline SoapySDR::RangeList toRanges(const Message &msg, const size_t pos)
+{
+    SoapySDR::RangeList ranges;
+    for (size_t i = pos; i+2 < msg.size(); i += 3)
+    {
+        ranges.emplace_back(std::stod(msg[i]), std::stod(msg[i+1]), std::stod(msg[i+2]));
+    }
+    return ranges;
+}
+
+/*******************************************************************
+ * Shared memory ring: a header, the slot descriptors, then the
+ * buffers with one buffer per channel in each slot.
+ *
+ * The broker is the only writer and never waits on readers.
+ * A slot sequence is invalidated before its buffers are written,
+ * so a reader detects a slot which was overwritten while in use.
+ ******************************************************************/
+static const uint32_t RING_MAGIC = 0x534f4150;
+static const uint64_t INVALID_SEQ = ~uint64_t(0);
+static const size_t RING_ALIGNMENT = 64;
+
+struct RingSlot
+{
+    std::atomic<uint64_t> seq;
+    int32_t ret; //number of elements or an error code
+    int32_t flags;
+    int64_t timeNs;
+};
+
+struct RingHeader
+{
+    uint32_t magic;
+    uint32_t numChans;
+    uint32_t elemSize;
+    uint32_t numSlots;
+    uint32_t slotElems;
+    char format[16];
+
+    //process-shared wakeup of blocked readers,
+    //the mutex is robust since any process may die holding it
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    std::atomic<uint64_t> writeSeq;
+};
+
+static inline size_t alignUp(const size_t size)
+{
+    return ((size + RING_ALIGNMENT - 1)/RING_ALIGNMENT)*RING_ALIGNMENT;
+}
+
+static inline size_t ringBufferSize(const size_t elemSize, const size_t slotElems)
+{
+    return alignUp(elemSize*slotElems);
+}
+
+static inline size_t ringSize(const size_t numChans, const size_t elemSize, const size_t numSlots, const size_t slotElems)
+{
+    return alignUp(sizeof(RingHeader)) + alignUp(numSlots*sizeof(RingSlot)) + numSlots*numChans*ringBufferSize(elemSize, slotElems);
+}
+
+static inline RingSlot *ringSlot(RingHeader *header, const size_t index)
+{
+    return reinterpret_cast<RingSlot *>(reinterpret_cast<char *>(header) + alignUp(sizeof(RingHeader))) + index;
+}
+
+static inline char *ringBuffer(RingHeader *header, const size_t index, const size_t chan)
+{
+    const size_t buffSize = ringBufferSize(header->elemSize, header->slotElems);
+    char *base = reinterpret_cast<char *>(header) + alignUp(sizeof(RingHeader)) + alignUp(header->numSlots*sizeof(RingSlot));
+    return base + (index*header->numChans + chan)*buffSize;
+}
+
+/*******************************************************************
+ * The ring mutex only orders the wakeups and guards no state,
+ * so the mutex of a process which died holding it is simply recovered.
+ ******************************************************************/
+static inline void lockRing(RingHeader *header)
+{
+    if (pthread_mutex_lock(&header->mutex) == EOWNERDEAD) pthread_mutex_consistent(&header->mutex);
+}
+
+static inline int waitRing(RingHeader *header, const timespec &deadline)
+{
+    const int ret = pthread_cond_timedwait(&header->cond, &header->mutex, &deadline);
+    if (ret != EOWNERDEAD) return ret;
+    pthread_mutex_consistent(&header->mutex);
+    return 0;
+}
+
+}
+
+#endif //_WIN32
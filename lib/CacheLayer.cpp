@@ -0,0 +1,712 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "CacheLayer.hpp"
+#include <cstdio>
+#include <algorithm>
+
+//the cache key of a call: the method name and its arguments
+static std::string cacheKey(const char *method, const int direction = -1, const size_t channel = 0, const std::string &name = "")
+{
+    return std::string(method) + "/" + std::to_string(direction) + "/" + std::to_string(channel) + "/" + name;
+}
+
+/*******************************************************************
+ * Cache layer
+ ******************************************************************/
+CacheLayer::CacheLayer(SoapySDR::Device *device, const SoapySDR::Kwargs &args):
+    DeviceDecorator(device),
+    _generation(0),
+    _pendingUntilNs(0)
+{
+    const auto it = args.find("cache_exclude");
+    if (it == args.end()) return;
+    std::string method;
+    for (const auto ch : it->second + ",")
+    {
+        if (ch == ',' and not method.empty()) _excluded.insert(method);
+        if (ch == ',' or ch == ' ') method.clear();
+        else method.push_back(ch);
+    }
+}
+
+template <typename Type, typename Getter>
+Type CacheLayer::cached(const char *method, const int group, const std::string &key, const Getter &getter) const
+{
+    if (_excluded.count(method) != 0) return getter();
+    if ((group & ALL_STATE) != 0 and this->commandsPending()) return getter();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto &counts = _counts[method];
+    const auto it = _entries.find(key);
+    if (it != _entries.end())
+    {
+        counts.hits++;
+        return *std::static_pointer_cast<const Type>(it->second.value);
+    }
+    counts.misses++;
+
+    //call the device without the lock, an invalidation in the meantime discards the result
+    const auto generation = _generation;
+    lock.unlock();
+    std::shared_ptr<const Type> value(new Type(getter()));
+    lock.lock();
+    if (generation == _generation)
+    {
+        auto &entry = _entries[key];
+        entry.group = group;
+        entry.value = value;
+    }
+    return *value;
+}
+
+template <typename Setter>
+void CacheLayer::update(const int groups, const Setter &setter)
+{
+    try
+    {
+        setter();
+    }
+    catch (...)
+    {
+        //a failed call may have partially applied
+        this->invalidate(groups);
+        throw;
+    }
+    this->invalidate(groups);
+}
+
+void CacheLayer::invalidate(const int groups) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _generation++;
+    for (auto it = _entries.begin(); it != _entries.end();)
+    {
+        if ((it->second.group & groups) != 0) it = _entries.erase(it);
+        else ++it;
+    }
+}
+
+void CacheLayer::changesUntil(const long long timeNs)
+{
+    auto untilNs = _pendingUntilNs.load();
+    while (timeNs > untilNs and not _pendingUntilNs.compare_exchange_weak(untilNs, timeNs)){}
+}
+
+bool CacheLayer::commandsPending(void) const
+{
+    auto untilNs = _pendingUntilNs.load();
+    if (untilNs == 0) return false;
+    if (_device->getHardwareTime("") < untilNs) return true;
+
+    //values cached before the changes took effect are stale
+    if (_pendingUntilNs.compare_exchange_strong(untilNs, 0)) this->invalidate(ALL_STATE);
+    return false;
+}
+
+std::string CacheLayer::statsToJson(void) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    unsigned long long hits = 0, misses = 0;
+    std::string json("{");
+    for (const auto &pair : _counts)
+    {
+        char buff[256];
+        std::snprintf(buff, sizeof(buff), "\n  \"%s\": {\"hits\": %llu, \"misses\": %llu},",
+            pair.first.c_str(), pair.second.hits, pair.second.misses);
+        json += buff;
+        hits += pair.second.hits;
+        misses += pair.second.misses;
+    }
+    char buff[128];
+    std::snprintf(buff, sizeof(buff), "\n  \"total\": {\"hits\": %llu, \"misses\": %llu}\n}", hits, misses);
+    return json + buff;
+}
+
+/*******************************************************************
+ * Identification API
+ ******************************************************************/
+SoapySDR::Kwargs CacheLayer::getHardwareInfo(void) const
+{
+    return this->cached<SoapySDR::Kwargs>("getHardwareInfo", CAPABILITIES, cacheKey("getHardwareInfo"), [&]{return _device->getHardwareInfo();});
+}
+
+/*******************************************************************
+ * Channels API
+ ******************************************************************/
+void CacheLayer::setFrontendMapping(const int direction, const std::string &mapping)
+{
+    this->update(ALL, [&]{_device->setFrontendMapping(direction, mapping);});
+}
+
+std::string CacheLayer::getFrontendMapping(const int direction) const
+{
+    return this->cached<std::string>("getFrontendMapping", CAPABILITIES, cacheKey("getFrontendMapping", direction), [&]{return _device->getFrontendMapping(direction);});
+}
+
+size_t CacheLayer::getNumChannels(const int direction) const
+{
+    return this->cached<size_t>("getNumChannels", CAPABILITIES, cacheKey("getNumChannels", direction), [&]{return _device->getNumChannels(direction);});
+}
+
+SoapySDR::Kwargs CacheLayer::getChannelInfo(const int direction, const size_t channel) const
+{
+    return this->cached<SoapySDR::Kwargs>("getChannelInfo", CAPABILITIES, cacheKey("getChannelInfo", direction, channel), [&]{return _device->getChannelInfo(direction, channel);});
+}
+
+bool CacheLayer::getFullDuplex(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("getFullDuplex", CAPABILITIES, cacheKey("getFullDuplex", direction, channel), [&]{return _device->getFullDuplex(direction, channel);});
+}
+
+/*******************************************************************
+ * Stream API
+ ******************************************************************/
+std::vector<std::string> CacheLayer::getStreamFormats(const int direction, const size_t channel) const
+{
+    return this->cached<std::vector<std::string>>("getStreamFormats", CAPABILITIES, cacheKey("getStreamFormats", direction, channel), [&]{return _device->getStreamFormats(direction, channel);});
+}
+
+/*******************************************************************
+ * Antenna API
+ ******************************************************************/
+std::vector<std::string> CacheLayer::listAntennas(const int direction, const size_t channel) const
+{
+    return this->cached<std::vector<std::string>>("listAntennas", CAPABILITIES, cacheKey("listAntennas", direction, channel), [&]{return _device->listAntennas(direction, channel);});
+}
+
+void CacheLayer::setAntenna(const int direction, const size_t channel, const std::string & name)
+{
+    this->update(ANTENNA | GAIN, [&]{_device->setAntenna(direction, channel, name);});
+}
+
+std::string CacheLayer::getAntenna(const int direction, const size_t channel) const
+{
+    return this->cached<std::string>("getAntenna", ANTENNA, cacheKey("getAntenna", direction, channel), [&]{return _device->getAntenna(direction, channel);});
+}
+
+/*******************************************************************
+ * Frontend corrections API
+ ******************************************************************/
+bool CacheLayer::hasDCOffsetMode(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("hasDCOffsetMode", CAPABILITIES, cacheKey("hasDCOffsetMode", direction, channel), [&]{return _device->hasDCOffsetMode(direction, channel);});
+}
+
+void CacheLayer::setDCOffsetMode(const int direction, const size_t channel, const bool automatic)
+{
+    this->update(CORRECTIONS, [&]{_device->setDCOffsetMode(direction, channel, automatic);});
+}
+
+bool CacheLayer::getDCOffsetMode(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("getDCOffsetMode", CORRECTIONS, cacheKey("getDCOffsetMode", direction, channel), [&]{return _device->getDCOffsetMode(direction, channel);});
+}
+
+bool CacheLayer::hasDCOffset(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("hasDCOffset", CAPABILITIES, cacheKey("hasDCOffset", direction, channel), [&]{return _device->hasDCOffset(direction, channel);});
+}
+
+void CacheLayer::setDCOffset(const int direction, const size_t channel, const std::complex<double> & offset)
+{
+    this->update(CORRECTIONS, [&]{_device->setDCOffset(direction, channel, offset);});
+}
+
+std::complex<double> CacheLayer::getDCOffset(const int direction, const size_t channel) const
+{
+    return this->cached<std::complex<double>>("getDCOffset", CORRECTIONS, cacheKey("getDCOffset", direction, channel), [&]{return _device->getDCOffset(direction, channel);});
+}
+
+bool CacheLayer::hasIQBalance(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("hasIQBalance", CAPABILITIES, cacheKey("hasIQBalance", direction, channel), [&]{return _device->hasIQBalance(direction, channel);});
+}
+
+void CacheLayer::setIQBalance(const int direction, const size_t channel, const std::complex<double> & balance)
+{
+    this->update(CORRECTIONS, [&]{_device->setIQBalance(direction, channel, balance);});
+}
+
+std::complex<double> CacheLayer::getIQBalance(const int direction, const size_t channel) const
+{
+    return this->cached<std::complex<double>>("getIQBalance", CORRECTIONS, cacheKey("getIQBalance", direction, channel), [&]{return _device->getIQBalance(direction, channel);});
+}
+
+bool CacheLayer::hasIQBalanceMode(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("hasIQBalanceMode", CAPABILITIES, cacheKey("hasIQBalanceMode", direction, channel), [&]{return _device->hasIQBalanceMode(direction, channel);});
+}
+
+void CacheLayer::setIQBalanceMode(const int direction, const size_t channel, const bool automatic)
+{
+    this->update(CORRECTIONS, [&]{_device->setIQBalanceMode(direction, channel, automatic);});
+}
+
+bool CacheLayer::getIQBalanceMode(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("getIQBalanceMode", CORRECTIONS, cacheKey("getIQBalanceMode", direction, channel), [&]{return _device->getIQBalanceMode(direction, channel);});
+}
+
+bool CacheLayer::hasFrequencyCorrection(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("hasFrequencyCorrection", CAPABILITIES, cacheKey("hasFrequencyCorrection", direction, channel), [&]{return _device->hasFrequencyCorrection(direction, channel);});
+}
+
+void CacheLayer::setFrequencyCorrection(const int direction, const size_t channel, const double value)
+{
+    this->update(CORRECTIONS | FREQUENCY, [&]{_device->setFrequencyCorrection(direction, channel, value);});
+}
+
+double CacheLayer::getFrequencyCorrection(const int direction, const size_t channel) const
+{
+    return this->cached<double>("getFrequencyCorrection", CORRECTIONS, cacheKey("getFrequencyCorrection", direction, channel), [&]{return _device->getFrequencyCorrection(direction, channel);});
+}
+
+/*******************************************************************
+ * Gain API
+ ******************************************************************/
+std::vector<std::string> CacheLayer::listGains(const int direction, const size_t channel) const
+{
+    return this->cached<std::vector<std::string>>("listGains", ANTENNA, cacheKey("listGains", direction, channel), [&]{return _device->listGains(direction, channel);});
+}
+
+bool CacheLayer::hasGainMode(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("hasGainMode", CAPABILITIES, cacheKey("hasGainMode", direction, channel), [&]{return _device->hasGainMode(direction, channel);});
+}
+
+void CacheLayer::setGainMode(const int direction, const size_t channel, const bool automatic)
+{
+    this->update(GAIN, [&]{_device->setGainMode(direction, channel, automatic);});
+}
+
+bool CacheLayer::getGainMode(const int direction, const size_t channel) const
+{
+    return this->cached<bool>("getGainMode", GAIN, cacheKey("getGainMode", direction, channel), [&]{return _device->getGainMode(direction, channel);});
+}
+
+void CacheLayer::setGain(const int direction, const size_t channel, const double value)
+{
+    this->update(GAIN, [&]{_device->setGain(direction, channel, value);});
+}
+
+void CacheLayer::setGain(const int direction, const size_t channel, const std::string &name, const double value)
+{
+    this->update(GAIN, [&]{_device->setGain(direction, channel, name, value);});
+}
+
+double CacheLayer::getGain(const int direction, const size_t channel) const
+{
+    return this->cached<double>("getGain", GAIN, cacheKey("getGain", direction, channel), [&]{return _device->getGain(direction, channel);});
+}
+
+double CacheLayer::getGain(const int direction, const size_t channel, const std::string &name) const
+{
+    return this->cached<double>("getGain", GAIN, cacheKey("getGainElement", direction, channel, name), [&]{return _device->getGain(direction, channel, name);});
+}
+
+SoapySDR::Range CacheLayer::getGainRange(const int direction, const size_t channel) const
+{
+    return this->cached<SoapySDR::Range>("getGainRange", ANTENNA | FREQUENCY, cacheKey("getGainRange", direction, channel), [&]{return _device->getGainRange(direction, channel);});
+}
+
+SoapySDR::Range CacheLayer::getGainRange(const int direction, const size_t channel, const std::string &name) const
+{
+    return this->cached<SoapySDR::Range>("getGainRange", ANTENNA | FREQUENCY, cacheKey("getGainRangeElement", direction, channel, name), [&]{return _device->getGainRange(direction, channel, name);});
+}
+
+/*******************************************************************
+ * Frequency API
+ ******************************************************************/
+void CacheLayer::setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args)
+{
+    this->update(FREQUENCY, [&]{_device->setFrequency(direction, channel, frequency, args);});
+}
+
+void CacheLayer::setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args)
+{
+    this->update(FREQUENCY, [&]{_device->setFrequency(direction, channel, name, frequency, args);});
+}
+
+double CacheLayer::getFrequency(const int direction, const size_t channel) const
+{
+    return this->cached<double>("getFrequency", FREQUENCY, cacheKey("getFrequency", direction, channel), [&]{return _device->getFrequency(direction, channel);});
+}
+
+double CacheLayer::getFrequency(const int direction, const size_t channel, const std::string &name) const
+{
+    return this->cached<double>("getFrequency", FREQUENCY, cacheKey("getFrequencyComponent", direction, channel, name), [&]{return _device->getFrequency(direction, channel, name);});
+}
+
+std::vector<std::string> CacheLayer::listFrequencies(const int direction, const size_t channel) const
+{
+    return this->cached<std::vector<std::string>>("listFrequencies", CAPABILITIES, cacheKey("listFrequencies", direction, channel), [&]{return _device->listFrequencies(direction, channel);});
+}
+
+SoapySDR::RangeList CacheLayer::getFrequencyRange(const int direction, const size_t channel) const
+{
+    return this->cached<SoapySDR::RangeList>("getFrequencyRange", CAPABILITIES, cacheKey("getFrequencyRange", direction, channel), [&]{return _device->getFrequencyRange(direction, channel);});
+}
+
+SoapySDR::RangeList CacheLayer::getFrequencyRange(const int direction, const size_t channel, const std::string &name) const
+{
+    return this->cached<SoapySDR::RangeList>("getFrequencyRange", CAPABILITIES, cacheKey("getFrequencyRangeComponent", direction, channel, name), [&]{return _device->getFrequencyRange(direction, channel, name);});
+}
+
+SoapySDR::ArgInfoList CacheLayer::getFrequencyArgsInfo(const int direction, const size_t channel) const
+{
+    return this->cached<SoapySDR::ArgInfoList>("getFrequencyArgsInfo", CAPABILITIES, cacheKey("getFrequencyArgsInfo", direction, channel), [&]{return _device->getFrequencyArgsInfo(direction, channel);});
+}
+
+/*******************************************************************
+ * Frequency hopping API
+ ******************************************************************/
+void CacheLayer::applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs)
+{
+    if (timeNs > 0) this->changesUntil(timeNs);
+    this->update(FREQUENCY, [&]{_device->applyHop(table, index, timeNs);});
+}
+
+/*******************************************************************
+ * Sample Rate API
+ ******************************************************************/
+void CacheLayer::setSampleRate(const int direction, const size_t channel, const double rate)
+{
+    this->update(RATE | BANDWIDTH | FREQUENCY, [&]{_device->setSampleRate(direction, channel, rate);});
+}
+
+double CacheLayer::getSampleRate(const int direction, const size_t channel) const
+{
+    return this->cached<double>("getSampleRate", RATE, cacheKey("getSampleRate", direction, channel), [&]{return _device->getSampleRate(direction, channel);});
+}
+
+std::vector<double> CacheLayer::listSampleRates(const int direction, const size_t channel) const
+{
+    return this->cached<std::vector<double>>("listSampleRates", CLOCKS, cacheKey("listSampleRates", direction, channel), [&]{return _device->listSampleRates(direction, channel);});
+}
+
+SoapySDR::RangeList CacheLayer::getSampleRateRange(const int direction, const size_t channel) const
+{
+    return this->cached<SoapySDR::RangeList>("getSampleRateRange", CLOCKS, cacheKey("getSampleRateRange", direction, channel), [&]{return _device->getSampleRateRange(direction, channel);});
+}
+
+/*******************************************************************
+ * Bandwidth API
+ ******************************************************************/
+void CacheLayer::setBandwidth(const int direction, const size_t channel, const double bw)
+{
+    this->update(BANDWIDTH, [&]{_device->setBandwidth(direction, channel, bw);});
+}
+
+double CacheLayer::getBandwidth(const int direction, const size_t channel) const
+{
+    return this->cached<double>("getBandwidth", BANDWIDTH, cacheKey("getBandwidth", direction, channel), [&]{return _device->getBandwidth(direction, channel);});
+}
+
+std::vector<double> CacheLayer::listBandwidths(const int direction, const size_t channel) const
+{
+    return this->cached<std::vector<double>>("listBandwidths", CLOCKS | RATE, cacheKey("listBandwidths", direction, channel), [&]{return _device->listBandwidths(direction, channel);});
+}
+
+SoapySDR::RangeList CacheLayer::getBandwidthRange(const int direction, const size_t channel) const
+{
+    return this->cached<SoapySDR::RangeList>("getBandwidthRange", CLOCKS | RATE, cacheKey("getBandwidthRange", direction, channel), [&]{return _device->getBandwidthRange(direction, channel);});
+}
+
+/*******************************************************************
+ * Clocking API
+ ******************************************************************/
+void CacheLayer::setMasterClockRate(const double rate)
+{
+    this->update(CLOCKS | RATE | BANDWIDTH | FREQUENCY, [&]{_device->setMasterClockRate(rate);});
+}
+
+double CacheLayer::getMasterClockRate(void) const
+{
+    return this->cached<double>("getMasterClockRate", CLOCKS, cacheKey("getMasterClockRate"), [&]{return _device->getMasterClockRate();});
+}
+
+SoapySDR::RangeList CacheLayer::getMasterClockRates(void) const
+{
+    return this->cached<SoapySDR::RangeList>("getMasterClockRates", CAPABILITIES, cacheKey("getMasterClockRates"), [&]{return _device->getMasterClockRates();});
+}
+
+void CacheLayer::setReferenceClockRate(const double rate)
+{
+    this->update(CLOCKS | RATE | BANDWIDTH | FREQUENCY, [&]{_device->setReferenceClockRate(rate);});
+}
+
+double CacheLayer::getReferenceClockRate(void) const
+{
+    return this->cached<double>("getReferenceClockRate", CLOCKS, cacheKey("getReferenceClockRate"), [&]{return _device->getReferenceClockRate();});
+}
+
+SoapySDR::RangeList CacheLayer::getReferenceClockRates(void) const
+{
+    return this->cached<SoapySDR::RangeList>("getReferenceClockRates", CAPABILITIES, cacheKey("getReferenceClockRates"), [&]{return _device->getReferenceClockRates();});
+}
+
+std::vector<std::string> CacheLayer::listClockSources(void) const
+{
+    return this->cached<std::vector<std::string>>("listClockSources", CAPABILITIES, cacheKey("listClockSources"), [&]{return _device->listClockSources();});
+}
+
+void CacheLayer::setClockSource(const std::string & source)
+{
+    this->update(CLOCKS | RATE | BANDWIDTH | FREQUENCY, [&]{_device->setClockSource(source);});
+}
+
+std::string CacheLayer::getClockSource(void) const
+{
+    return this->cached<std::string>("getClockSource", CLOCKS, cacheKey("getClockSource"), [&]{return _device->getClockSource();});
+}
+
+/*******************************************************************
+ * Time API
+ ******************************************************************/
+std::vector<std::string> CacheLayer::listTimeSources(void) const
+{
+    return this->cached<std::vector<std::string>>("listTimeSources", CAPABILITIES, cacheKey("listTimeSources"), [&]{return _device->listTimeSources();});
+}
+
+void CacheLayer::setTimeSource(const std::string & source)
+{
+    this->update(CLOCKS, [&]{_device->setTimeSource(source);});
+}
+
+std::string CacheLayer::getTimeSource(void) const
+{
+    return this->cached<std::string>("getTimeSource", CLOCKS, cacheKey("getTimeSource"), [&]{return _device->getTimeSource();});
+}
+
+void CacheLayer::setHardwareTime(const long long timeNs, const std::string &what)
+{
+    //setters made until the command time is cleared take effect at that time
+    if (what == "CMD" and timeNs > 0) this->changesUntil(timeNs);
+    _device->setHardwareTime(timeNs, what);
+}
+
+void CacheLayer::setCommandTime(const long long timeNs, const std::string &what)
+{
+    if (timeNs > 0) this->changesUntil(timeNs);
+    _device->setCommandTime(timeNs, what);
+}
+
+/*******************************************************************
+ * Timed command API
+ ******************************************************************/
+size_t CacheLayer::queueCommands(const SoapySDR::TimedCommandList &commands)
+{
+    //commands change the state later, so state is not cached until they are applied
+    for (const auto &command : commands) this->changesUntil(command.timeNs);
+    size_t numAccepted(0);
+    this->update(ALL, [&]{numAccepted = _device->queueCommands(commands);});
+    return numAccepted;
+}
+
+/*******************************************************************
+ * Sensor API
+ ******************************************************************/
+std::vector<std::string> CacheLayer::listSensors(void) const
+{
+    return this->cached<std::vector<std::string>>("listSensors", CAPABILITIES, cacheKey("listSensors"), [&]{return _device->listSensors();});
+}
+
+SoapySDR::ArgInfo CacheLayer::getSensorInfo(const std::string &key) const
+{
+    return this->cached<SoapySDR::ArgInfo>("getSensorInfo", CAPABILITIES, cacheKey("getSensorInfo", -1, 0, key), [&]{return _device->getSensorInfo(key);});
+}
+
+std::vector<std::string> CacheLayer::listSensors(const int direction, const size_t channel) const
+{
+    return this->cached<std::vector<std::string>>("listSensors", CAPABILITIES, cacheKey("listChannelSensors", direction, channel), [&]{return _device->listSensors(direction, channel);});
+}
+
+SoapySDR::ArgInfo CacheLayer::getSensorInfo(const int direction, const size_t channel, const std::string &key) const
+{
+    return this->cached<SoapySDR::ArgInfo>("getSensorInfo", CAPABILITIES, cacheKey("getChannelSensorInfo", direction, channel, key), [&]{return _device->getSensorInfo(direction, channel, key);});
+}
+
+/*******************************************************************
+ * Register API
+ ******************************************************************/
+std::vector<std::string> CacheLayer::listRegisterInterfaces(void) const
+{
+    return this->cached<std::vector<std::string>>("listRegisterInterfaces", CAPABILITIES, cacheKey("listRegisterInterfaces"), [&]{return _device->listRegisterInterfaces();});
+}
+
+void CacheLayer::writeRegister(const std::string &name, const unsigned addr, const unsigned value)
+{
+    this->update(ALL_STATE, [&]{_device->writeRegister(name, addr, value);});
+}
+
+void CacheLayer::writeRegister(const unsigned addr, const unsigned value)
+{
+    this->update(ALL_STATE, [&]{_device->writeRegister(addr, value);});
+}
+
+void CacheLayer::writeRegisters(const std::string &name, const unsigned addr, const std::vector<unsigned> &value)
+{
+    this->update(ALL_STATE, [&]{_device->writeRegisters(name, addr, value);});
+}
+
+std::vector<unsigned> CacheLayer::transactRegisters(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops)
+{
+    const bool writes = std::any_of(ops.begin(), ops.end(), [](const SoapySDR::RegisterOp &op){return not op.read;});
+    if (not writes) return _device->transactRegisters(name, ops);
+    std::vector<unsigned> results;
+    this->update(ALL_STATE, [&]{results = _device->transactRegisters(name, ops);});
+    return results;
+}
+
+std::future<std::vector<unsigned>> CacheLayer::transactRegistersAsync(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops)
+{
+    //run the batch through this layer so that its writes invalidate the cache on completion
+    return SoapySDR::Device::transactRegistersAsync(name, ops);
+}
+
+/*******************************************************************
+ * Settings API
+ ******************************************************************/
+static SoapySDR::ArgInfo cacheStatsInfo(void)
+{
+    SoapySDR::ArgInfo info;
+    info.key = "cache_stats";
+    info.name = "Cache Statistics";
+    info.type = SoapySDR::ArgInfo::STRING;
+    info.description = "Read only: per-method cache hits and misses as JSON.";
+    return info;
+}
+
+static SoapySDR::ArgInfo cacheInvalidateInfo(void)
+{
+    SoapySDR::ArgInfo info;
+    info.key = "cache_invalidate";
+    info.name = "Invalidate Cache";
+    info.type = SoapySDR::ArgInfo::BOOL;
+    info.description = "Write only: clear all cached values.";
+    return info;
+}
+
+SoapySDR::ArgInfoList CacheLayer::getSettingInfo(void) const
+{
+    auto infos = this->cached<SoapySDR::ArgInfoList>("getSettingInfo", CAPABILITIES, cacheKey("getSettingInfo"), [&]{return _device->getSettingInfo();});
+    infos.push_back(cacheStatsInfo());
+    infos.push_back(cacheInvalidateInfo());
+    return infos;
+}
+
+SoapySDR::ArgInfo CacheLayer::getSettingInfo(const std::string &key) const
+{
+    if (key == "cache_stats") return cacheStatsInfo();
+    if (key == "cache_invalidate") return cacheInvalidateInfo();
+    return this->cached<SoapySDR::ArgInfo>("getSettingInfo", CAPABILITIES, cacheKey("getSettingInfoKey", -1, 0, key), [&]{return _device->getSettingInfo(key);});
+}
+
+void CacheLayer::writeSetting(const std::string &key, const std::string &value)
+{
+    if (key == "cache_invalidate") return this->invalidate(ALL);
+
+    //driver settings can change anything, including the capabilities
+    this->update(ALL, [&]{_device->writeSetting(key, value);});
+}
+
+std::string CacheLayer::readSetting(const std::string &key) const
+{
+    if (key == "cache_stats") return this->statsToJson();
+    return _device->readSetting(key);
+}
+
+void CacheLayer::writeSettingBool(const std::string &key, const bool value)
+{
+    if (key == "cache_invalidate") return this->invalidate(ALL);
+    this->update(ALL, [&]{_device->writeSettingBool(key, value);});
+}
+
+void CacheLayer::writeSettingInt(const std::string &key, const long long value)
+{
+    if (key == "cache_invalidate") return this->invalidate(ALL);
+    this->update(ALL, [&]{_device->writeSettingInt(key, value);});
+}
+
+void CacheLayer::writeSettingFloat(const std::string &key, const double value)
+{
+    if (key == "cache_invalidate") return this->invalidate(ALL);
+    this->update(ALL, [&]{_device->writeSettingFloat(key, value);});
+}
+
+SoapySDR::ArgInfoList CacheLayer::getSettingInfo(const int direction, const size_t channel) const
+{
+    return this->cached<SoapySDR::ArgInfoList>("getSettingInfo", CAPABILITIES, cacheKey("getChannelSettingInfo", direction, channel), [&]{return _device->getSettingInfo(direction, channel);});
+}
+
+void CacheLayer::writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value)
+{
+    this->update(ALL, [&]{_device->writeSetting(direction, channel, key, value);});
+}
+
+void CacheLayer::writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value)
+{
+    this->update(ALL, [&]{_device->writeSettingBool(direction, channel, key, value);});
+}
+
+void CacheLayer::writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value)
+{
+    this->update(ALL, [&]{_device->writeSettingInt(direction, channel, key, value);});
+}
+
+void CacheLayer::writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value)
+{
+    this->update(ALL, [&]{_device->writeSettingFloat(direction, channel, key, value);});
+}
+
+/*******************************************************************
+ * GPIO API
+ ******************************************************************/
+std::vector<std::string> CacheLayer::listGPIOBanks(void) const
+{
+    return this->cached<std::vector<std::string>>("listGPIOBanks", CAPABILITIES, cacheKey("listGPIOBanks"), [&]{return _device->listGPIOBanks();});
+}
+
+/*******************************************************************
+ * I2C API
+ ******************************************************************/
+void CacheLayer::writeI2C(const int addr, const std::string &data)
+{
+    this->update(ALL_STATE, [&]{_device->writeI2C(addr, data);});
+}
+
+std::vector<std::string> CacheLayer::transactI2C(const std::vector<SoapySDR::I2CMessage> &messages)
+{
+    const bool writes = std::any_of(messages.begin(), messages.end(), [](const SoapySDR::I2CMessage &msg){return not msg.read;});
+    if (not writes) return _device->transactI2C(messages);
+    std::vector<std::string> results;
+    this->update(ALL_STATE, [&]{results = _device->transactI2C(messages);});
+    return results;
+}
+
+/*******************************************************************
+ * SPI API
+ ******************************************************************/
+unsigned CacheLayer::transactSPI(const int addr, const unsigned data, const size_t numBits)
+{
+    unsigned result = 0;
+    this->update(ALL_STATE, [&]{result = _device->transactSPI(addr, data, numBits);});
+    return result;
+}
+
+std::vector<unsigned> CacheLayer::transactSPIBatch(const int addr, const std::vector<unsigned> &data, const size_t numBits)
+{
+    std::vector<unsigned> results;
+    this->update(ALL_STATE, [&]{results = _device->transactSPIBatch(addr, data, numBits);});
+    return results;
+}
+
+/*******************************************************************
+ * UART API
+ ******************************************************************/
+std::vector<std::string> CacheLayer::listUARTs(void) const
+{
+    return this->cached<std::vector<std::string>>("listUARTs", CAPABILITIES, cacheKey("listUARTs"), [&]{return _device->listUARTs();});
+}
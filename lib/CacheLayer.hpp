@@ -0,0 +1,270 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include "DeviceDecorator.hpp"
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <map>
+#include <set>
+
+/*!
+ * CacheLayer answers repeated control-plane getters from memory.
+ * The factory places it around the device when cache=true.
+ *
+ * Capability queries (ranges, lists, channel info) are cached until
+ * the frontend mapping changes, except for the queries which follow
+ * the state: gain elements and ranges are cached with the antenna
+ * and frequency, and sample rate and bandwidth lists and ranges
+ * with the clocks. State getters are cached until a setter
+ * which can change them: each setter invalidates the state groups that
+ * it may affect, on all channels, since channels often share hardware.
+ * Register, I2C, and SPI writes invalidate all cached state,
+ * and settings writes invalidate everything including capabilities.
+ * Setters made with a command time, timed hops, and queued commands
+ * change the state later, so state getters bypass the cache
+ * until the hardware time passes the latest of those times.
+ *
+ * Make arguments:
+ *  - cache_exclude: comma separated method names which are never cached
+ *
+ * Settings handled by the layer:
+ *  - cache_stats: read per-method hit and miss counts as JSON
+ *  - cache_invalidate: write any value to clear the cache
+ */
+class CacheLayer : public DeviceDecorator
+{
+public:
+    CacheLayer(SoapySDR::Device *device, const SoapySDR::Kwargs &args);
+
+    /*******************************************************************
+     * Identification API
+     ******************************************************************/
+    SoapySDR::Kwargs getHardwareInfo(void) const;
+
+    /*******************************************************************
+     * Channels API
+     ******************************************************************/
+    void setFrontendMapping(const int direction, const std::string &mapping);
+    std::string getFrontendMapping(const int direction) const;
+    size_t getNumChannels(const int direction) const;
+    SoapySDR::Kwargs getChannelInfo(const int direction, const size_t channel) const;
+    bool getFullDuplex(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Stream API
+     ******************************************************************/
+    std::vector<std::string> getStreamFormats(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Antenna API
+     ******************************************************************/
+    std::vector<std::string> listAntennas(const int direction, const size_t channel) const;
+    void setAntenna(const int direction, const size_t channel, const std::string &name);
+    std::string getAntenna(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Frontend corrections API
+     ******************************************************************/
+    bool hasDCOffsetMode(const int direction, const size_t channel) const;
+    void setDCOffsetMode(const int direction, const size_t channel, const bool automatic);
+    bool getDCOffsetMode(const int direction, const size_t channel) const;
+    bool hasDCOffset(const int direction, const size_t channel) const;
+    void setDCOffset(const int direction, const size_t channel, const std::complex<double> &offset);
+    std::complex<double> getDCOffset(const int direction, const size_t channel) const;
+    bool hasIQBalance(const int direction, const size_t channel) const;
+    void setIQBalance(const int direction, const size_t channel, const std::complex<double> &balance);
+    std::complex<double> getIQBalance(const int direction, const size_t channel) const;
+    bool hasIQBalanceMode(const int direction, const size_t channel) const;
+    void setIQBalanceMode(const int direction, const size_t channel, const bool automatic);
+    bool getIQBalanceMode(const int direction, const size_t channel) const;
+    bool hasFrequencyCorrection(const int direction, const size_t channel) const;
+    void setFrequencyCorrection(const int direction, const size_t channel, const double value);
+    double getFrequencyCorrection(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Gain API
+     ******************************************************************/
+    std::vector<std::string> listGains(const int direction, const size_t channel) const;
+    bool hasGainMode(const int direction, const size_t channel) const;
+    void setGainMode(const int direction, const size_t channel, const bool automatic);
+    bool getGainMode(const int direction, const size_t channel) const;
+    void setGain(const int direction, const size_t channel, const double value);
+    void setGain(const int direction, const size_t channel, const std::string &name, const double value);
+    double getGain(const int direction, const size_t channel) const;
+    double getGain(const int direction, const size_t channel, const std::string &name) const;
+    SoapySDR::Range getGainRange(const int direction, const size_t channel) const;
+    SoapySDR::Range getGainRange(const int direction, const size_t channel, const std::string &name) const;
+
+    /*******************************************************************
+     * Frequency API
+     ******************************************************************/
+    void setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args);
+    void setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args);
+    double getFrequency(const int direction, const size_t channel) const;
+    double getFrequency(const int direction, const size_t channel, const std::string &name) const;
+    std::vector<std::string> listFrequencies(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel, const std::string &name) const;
+    SoapySDR::ArgInfoList getFrequencyArgsInfo(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Frequency hopping API
+     ******************************************************************/
+    void applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs);
+
+    /*******************************************************************
+     * Sample Rate API
+     ******************************************************************/
+    void setSampleRate(const int direction, const size_t channel, const double rate);
+    double getSampleRate(const int direction, const size_t channel) const;
+    std::vector<double> listSampleRates(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getSampleRateRange(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Bandwidth API
+     ******************************************************************/
+    void setBandwidth(const int direction, const size_t channel, const double bw);
+    double getBandwidth(const int direction, const size_t channel) const;
+    std::vector<double> listBandwidths(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getBandwidthRange(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Clocking API
+     ******************************************************************/
+    void setMasterClockRate(const double rate);
+    double getMasterClockRate(void) const;
+    SoapySDR::RangeList getMasterClockRates(void) const;
+    void setReferenceClockRate(const double rate);
+    double getReferenceClockRate(void) const;
+    SoapySDR::RangeList getReferenceClockRates(void) const;
+    std::vector<std::string> listClockSources(void) const;
+    void setClockSource(const std::string &source);
+    std::string getClockSource(void) const;
+
+    /*******************************************************************
+     * Time API
+     ******************************************************************/
+    std::vector<std::string> listTimeSources(void) const;
+    void setTimeSource(const std::string &source);
+    std::string getTimeSource(void) const;
+    void setHardwareTime(const long long timeNs, const std::string &what);
+    void setCommandTime(const long long timeNs, const std::string &what);
+
+    /*******************************************************************
+     * Timed command API
+     ******************************************************************/
+    size_t queueCommands(const SoapySDR::TimedCommandList &commands);
+
+    /*******************************************************************
+     * Sensor API
+     ******************************************************************/
+    std::vector<std::string> listSensors(void) const;
+    SoapySDR::ArgInfo getSensorInfo(const std::string &key) const;
+    std::vector<std::string> listSensors(const int direction, const size_t channel) const;
+    SoapySDR::ArgInfo getSensorInfo(const int direction, const size_t channel, const std::string &key) const;
+
+    /*******************************************************************
+     * Register API
+     ******************************************************************/
+    std::vector<std::string> listRegisterInterfaces(void) const;
+    void writeRegister(const std::string &name, const unsigned addr, const unsigned value);
+    void writeRegister(const unsigned addr, const unsigned value);
+    void writeRegisters(const std::string &name, const unsigned addr, const std::vector<unsigned> &value);
+    std::vector<unsigned> transactRegisters(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops);
+    std::future<std::vector<unsigned>> transactRegistersAsync(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops);
+
+    /*******************************************************************
+     * Settings API
+     ******************************************************************/
+    SoapySDR::ArgInfoList getSettingInfo(void) const;
+    SoapySDR::ArgInfo getSettingInfo(const std::string &key) const;
+    void writeSetting(const std::string &key, const std::string &value);
+    std::string readSetting(const std::string &key) const;
+    void writeSettingBool(const std::string &key, const bool value);
+    void writeSettingInt(const std::string &key, const long long value);
+    void writeSettingFloat(const std::string &key, const double value);
+    SoapySDR::ArgInfoList getSettingInfo(const int direction, const size_t channel) const;
+    void writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value);
+    void writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value);
+    void writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value);
+    void writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value);
+
+    /*******************************************************************
+     * GPIO API
+     ******************************************************************/
+    std::vector<std::string> listGPIOBanks(void) const;
+
+    /*******************************************************************
+     * I2C API
+     ******************************************************************/
+    void writeI2C(const int addr, const std::string &data);
+    std::vector<std::string> transactI2C(const std::vector<SoapySDR::I2CMessage> &messages);
+
+    /*******************************************************************
+     * SPI API
+     ******************************************************************/
+    unsigned transactSPI(const int addr, const unsigned data, const size_t numBits);
+    std::vector<unsigned> transactSPIBatch(const int addr, const std::vector<unsigned> &data, const size_t numBits);
+
+    /*******************************************************************
+     * UART API
+     ******************************************************************/
+    std::vector<std::string> listUARTs(void) const;
+
+private:
+    //groups of cached values, setters invalidate whole groups
+    enum CacheGroup
+    {
+        CAPABILITIES = 1 << 0,
+        ANTENNA = 1 << 1,
+        CORRECTIONS = 1 << 2,
+        GAIN = 1 << 3,
+        FREQUENCY = 1 << 4,
+        RATE = 1 << 5,
+        BANDWIDTH = 1 << 6,
+        CLOCKS = 1 << 7,
+        ALL_STATE = ANTENNA | CORRECTIONS | GAIN | FREQUENCY | RATE | BANDWIDTH | CLOCKS,
+        ALL = CAPABILITIES | ALL_STATE,
+    };
+
+    struct Entry
+    {
+        int group;
+        std::shared_ptr<const void> value;
+    };
+
+    struct Counts
+    {
+        Counts(void): hits(0), misses(0){}
+        unsigned long long hits;
+        unsigned long long misses;
+    };
+
+    //get a value from the cache or from the getter on a miss
+    template <typename Type, typename Getter>
+    Type cached(const char *method, const int group, const std::string &key, const Getter &getter) const;
+
+    //call a setter and invalidate the groups it may change
+    template <typename Setter>
+    void update(const int groups, const Setter &setter);
+
+    void invalidate(const int groups) const;
+
+    //state changes until the hardware time passes this time
+    void changesUntil(const long long timeNs);
+
+    //true while timed state changes have not been applied
+    bool commandsPending(void) const;
+
+    std::string statsToJson(void) const;
+
+    std::set<std::string> _excluded;
+
+    mutable std::mutex _mutex;
+    mutable std::map<std::string, Entry> _entries;
+    mutable std::map<std::string, Counts> _counts;
+    mutable unsigned long long _generation;
+    mutable std::atomic<long long> _pendingUntilNs;
+};
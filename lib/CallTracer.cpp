@@ -0,0 +1,183 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "CallTracer.hpp"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <map>
+
+/*******************************************************************
+ * Method names shared by all tracers
+ ******************************************************************/
+static std::mutex &getMethodsMutex(void)
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::vector<std::string> &getMethodNames(void)
+{
+    static std::vector<std::string> names;
+    return names;
+}
+
+size_t CallTracer::methodIndex(const char *name)
+{
+    std::lock_guard<std::mutex> lock(getMethodsMutex());
+    auto &names = getMethodNames();
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        if (names[i] == name) return i;
+    }
+    if (names.size() == MAX_METHODS) throw std::runtime_error("CallTracer: too many methods");
+    names.push_back(name);
+    return names.size()-1;
+}
+
+/*******************************************************************
+ * Call tracer
+ ******************************************************************/
+CallTracer::MethodStats::MethodStats(void):
+    numCalls(0),
+    totalNs(0),
+    minNs(~0ULL),
+    maxNs(0)
+{
+    for (auto &bucket : buckets) bucket = 0;
+}
+
+CallTracer::CallTracer(const std::string &traceFile):
+    _epoch(std::chrono::steady_clock::now()),
+    _file(nullptr),
+    _firstEvent(true)
+{
+    for (auto &method : _methods) method = nullptr;
+    if (traceFile.empty()) return;
+
+    _file = std::fopen(traceFile.c_str(), "w");
+    if (_file == nullptr) throw std::runtime_error("CallTracer: failed to open " + traceFile);
+    std::fputs("[\n", _file);
+}
+
+CallTracer::~CallTracer(void)
+{
+    for (auto &method : _methods) delete method.load();
+    if (_file == nullptr) return;
+    std::fputs("\n]\n", _file);
+    std::fclose(_file);
+}
+
+size_t CallTracer::bucketIndex(const unsigned long long ns)
+{
+    if (ns < SUB_COUNT) return size_t(ns);
+    size_t exp = SUB_BITS;
+    while (exp < MAX_EXPONENT and (ns >> (exp+1)) != 0) exp++;
+    if ((ns >> (exp+1)) != 0) return NUM_BUCKETS-1;
+    const size_t sub = size_t(ns >> (exp - SUB_BITS)) & (SUB_COUNT-1);
+    return SUB_COUNT + (exp - SUB_BITS)*SUB_COUNT + sub;
+}
+
+unsigned long long CallTracer::bucketUpperBound(const size_t index)
+{
+    if (index < SUB_COUNT) return index;
+    const size_t shift = (index - SUB_COUNT)/SUB_COUNT;
+    const unsigned long long sub = (index - SUB_COUNT)%SUB_COUNT;
+    return ((SUB_COUNT + sub + 1) << shift) - 1;
+}
+
+void CallTracer::record(const size_t index, const char *name, const TimePoint &start, const TimePoint &stop)
+{
+    const auto ns = (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+    //the statistics of a method are made by the first call
+    auto stats = _methods[index].load(std::memory_order_acquire);
+    if (stats == nullptr)
+    {
+        MethodStats *expected = nullptr;
+        stats = new MethodStats();
+        if (not _methods[index].compare_exchange_strong(expected, stats))
+        {
+            delete stats;
+            stats = expected;
+        }
+    }
+
+    stats->numCalls.fetch_add(1, std::memory_order_relaxed);
+    stats->totalNs.fetch_add(ns, std::memory_order_relaxed);
+    stats->buckets[bucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+    auto minNs = stats->minNs.load(std::memory_order_relaxed);
+    while (ns < minNs and not stats->minNs.compare_exchange_weak(minNs, ns, std::memory_order_relaxed)){}
+    auto maxNs = stats->maxNs.load(std::memory_order_relaxed);
+    while (ns > maxNs and not stats->maxNs.compare_exchange_weak(maxNs, ns, std::memory_order_relaxed)){}
+
+    if (_file == nullptr) return;
+    const auto ts = std::chrono::duration_cast<std::chrono::nanoseconds>(start - _epoch).count();
+    const auto tid = std::hash<std::thread::id>()(std::this_thread::get_id()) % 1000000;
+    std::lock_guard<std::mutex> lock(_fileMutex);
+    std::fprintf(_file, "%s{\"name\":\"%s\",\"cat\":\"SoapySDR\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+        _firstEvent?"":",\n", name, unsigned(tid), ts/1e3, ns/1e3);
+    _firstEvent = false;
+}
+
+void CallTracer::reset(void)
+{
+    for (auto &method : _methods)
+    {
+        auto stats = method.load(std::memory_order_acquire);
+        if (stats == nullptr) continue;
+        stats->numCalls = 0;
+        stats->totalNs = 0;
+        stats->minNs = ~0ULL;
+        stats->maxNs = 0;
+        for (auto &bucket : stats->buckets) bucket = 0;
+    }
+}
+
+unsigned long long CallTracer::percentile(const MethodStats &stats, const unsigned long long numCalls, const double fraction)
+{
+    const auto target = (unsigned long long)(fraction*numCalls + 0.5);
+    unsigned long long count = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++)
+    {
+        count += stats.buckets[i].load(std::memory_order_relaxed);
+        if (count >= target and count != 0) return std::min(bucketUpperBound(i), stats.maxNs.load());
+    }
+    return stats.maxNs;
+}
+
+std::string CallTracer::toJson(void) const
+{
+    std::map<std::string, size_t> indexes;
+    {
+        std::lock_guard<std::mutex> lock(getMethodsMutex());
+        const auto &names = getMethodNames();
+        for (size_t i = 0; i < names.size(); i++) indexes[names[i]] = i;
+    }
+
+    std::string json("{");
+    for (const auto &pair : indexes)
+    {
+        const auto stats = _methods[pair.second].load(std::memory_order_acquire);
+        if (stats == nullptr) continue;
+        const auto numCalls = stats->numCalls.load(std::memory_order_relaxed);
+        if (numCalls == 0) continue;
+
+        char buff[512];
+        std::snprintf(buff, sizeof(buff),
+            "%s\n  \"%s\": {\"calls\": %llu, \"total_us\": %.3f, \"mean_us\": %.3f, \"min_us\": %.3f, "
+            "\"p50_us\": %.3f, \"p90_us\": %.3f, \"p99_us\": %.3f, \"p999_us\": %.3f, \"max_us\": %.3f}",
+            (json.size() == 1)?"":",", pair.first.c_str(), numCalls,
+            stats->totalNs/1e3, stats->totalNs/1e3/numCalls, stats->minNs/1e3,
+            percentile(*stats, numCalls, 0.5)/1e3,
+            percentile(*stats, numCalls, 0.9)/1e3,
+            percentile(*stats, numCalls, 0.99)/1e3,
+            percentile(*stats, numCalls, 0.999)/1e3,
+            stats->maxNs/1e3);
+        json += buff;
+    }
+    json += "\n}";
+    return json;
+}
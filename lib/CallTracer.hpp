@@ -0,0 +1,99 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Types.hpp>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <cstdio>
+
+/*!
+ * CallTracer records the latency of calls into a device.
+ * Each method has a call count and a log-linear latency histogram
+ * with eight sub-buckets per power of two (HDR-style, 12.5% precision).
+ * Recording is lock-free; method statistics are allocated on first use.
+ *
+ * When a trace file is given, every call is also written as a
+ * Chrome trace-event, which chrome://tracing and Perfetto can display.
+ */
+class CallTracer
+{
+public:
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    //! The maximum number of distinct method names
+    static const size_t MAX_METHODS = 512;
+
+    CallTracer(const std::string &traceFile);
+
+    ~CallTracer(void);
+
+    //! Get the index of a method name, shared by all tracers
+    static size_t methodIndex(const char *name);
+
+    //! Record a call of the method at index
+    void record(const size_t index, const char *name, const TimePoint &start, const TimePoint &stop);
+
+    //! Clear all statistics
+    void reset(void);
+
+    //! Per-method statistics as a JSON object
+    std::string toJson(void) const;
+
+private:
+    static const size_t SUB_BITS = 3;
+    static const size_t SUB_COUNT = 1 << SUB_BITS;
+    static const size_t MAX_EXPONENT = 42; //about an hour in nanoseconds
+    static const size_t NUM_BUCKETS = SUB_COUNT + (MAX_EXPONENT - SUB_BITS + 1)*SUB_COUNT;
+
+    struct MethodStats
+    {
+        MethodStats(void);
+        std::atomic<unsigned long long> numCalls;
+        std::atomic<unsigned long long> totalNs;
+        std::atomic<unsigned long long> minNs;
+        std::atomic<unsigned long long> maxNs;
+        std::atomic<unsigned long long> buckets[NUM_BUCKETS];
+    };
+
+    static size_t bucketIndex(const unsigned long long ns);
+    static unsigned long long bucketUpperBound(const size_t index);
+    static unsigned long long percentile(const MethodStats &stats, const unsigned long long numCalls, const double fraction);
+
+    std::atomic<MethodStats *> _methods[MAX_METHODS];
+
+    //chrome trace-event output
+    const TimePoint _epoch;
+    std::mutex _fileMutex;
+    std::FILE *_file;
+    bool _firstEvent;
+};
+
+/*!
+ * TraceScope records the lifetime of a call with a tracer.
+ */
+class TraceScope
+{
+public:
+    TraceScope(CallTracer &tracer, const size_t index, const char *name):
+        _tracer(tracer),
+        _index(index),
+        _name(name),
+        _start(std::chrono::steady_clock::now())
+    {
+        return;
+    }
+
+    ~TraceScope(void)
+    {
+        _tracer.record(_index, _name, _start, std::chrono::steady_clock::now());
+    }
+
+private:
+    CallTracer &_tracer;
+    const size_t _index;
+    const char *_name;
+    const CallTracer::TimePoint _start;
+};
@@ -0,0 +1,845 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ChannelizerLayer.hpp"
+#include "PolyphaseChannelizer.hpp"
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <condition_variable>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <cstring>
+#include <cmath>
+
+//blocks queued per stream before the oldest is dropped as an overflow
+static const size_t MAX_QUEUED_BLOCKS = 64;
+
+/*******************************************************************
+ * Shared wideband stream and its consumers
+ ******************************************************************/
+struct ChannelizerBlock
+{
+    std::vector<std::complex<float>> out; //channel k starts at k*numOut
+    size_t numOut;
+    bool hasTime;
+    long long timeNs;
+};
+
+struct ChannelizerConsumer
+{
+    std::vector<size_t> channels;
+    SoapySDR::ConverterRegistry::ConverterFunction convert;
+    size_t elemSize;
+    bool active;
+    bool hasStart;
+    long long startNs;
+    bool overflow;
+    std::deque<std::shared_ptr<ChannelizerBlock>> queue;
+    size_t offset;
+};
+
+struct ChannelizerEngine
+{
+    ChannelizerEngine(const size_t numChans, const size_t numTaps, const size_t numThreads):
+        pfb(numChans, numTaps, numThreads),
+        stream(nullptr),
+        mtu(0),
+        rate(0.0),
+        numInput(0),
+        inputHasTime(false),
+        inputTimeNs(0),
+        running(false),
+        numActive(0)
+    {
+        return;
+    }
+
+    PolyphaseChannelizer pfb;
+    SoapySDR::Stream *stream;
+    size_t mtu;
+    double rate;
+
+    //the history followed by the samples not yet channelized
+    std::vector<std::complex<float>> input;
+    size_t numInput;
+    bool inputHasTime;
+    long long inputTimeNs;
+
+    std::thread thread;
+    std::atomic<bool> running;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<ChannelizerConsumer *> consumers;
+    size_t numActive;
+};
+
+struct ChannelizerStream
+{
+    SoapySDR::Stream *passthrough;
+    std::unique_ptr<ChannelizerConsumer> consumer;
+};
+
+static void engineLoop(SoapySDR::Device *device, ChannelizerEngine *engine, const size_t numChans)
+{
+    const size_t history = engine->pfb.getHistoryLength();
+    bool failing = false;
+    while (engine->running)
+    {
+        int flags(0);
+        long long timeNs(0);
+        void *buffs[] = {engine->input.data() + engine->numInput};
+        const int ret = device->readStream(engine->stream, buffs, engine->mtu, flags, timeNs, 100000);
+        if (ret == SOAPY_SDR_TIMEOUT) continue;
+
+        //the history is no longer contiguous, restart the filters and report an overflow,
+        //once for an error which persists, and retry that error with a back off
+        if (ret < 0)
+        {
+            if (not failing)
+            {
+                std::fill(engine->input.begin(), engine->input.begin() + history, std::complex<float>());
+                engine->numInput = history;
+                std::lock_guard<std::mutex> lock(engine->mutex);
+                for (const auto consumer : engine->consumers) consumer->overflow = consumer->active;
+                engine->cond.notify_all();
+            }
+            failing = ret != SOAPY_SDR_OVERFLOW;
+            if (failing) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+        failing = false;
+
+        if (engine->numInput == history)
+        {
+            engine->inputHasTime = (flags & SOAPY_SDR_HAS_TIME) != 0;
+            engine->inputTimeNs = timeNs;
+        }
+        engine->numInput += size_t(ret);
+
+        const size_t numOut = (engine->numInput - history)/numChans;
+        if (numOut == 0) continue;
+        std::shared_ptr<ChannelizerBlock> block(new ChannelizerBlock());
+        block->out.resize(numOut*numChans);
+        block->numOut = numOut;
+        block->hasTime = engine->inputHasTime;
+        block->timeNs = engine->inputTimeNs;
+        engine->pfb.process(engine->input.data(), numOut, block->out.data());
+
+        //keep the history and the leftover samples for the next block
+        const size_t consumed = numOut*numChans;
+        std::memmove(engine->input.data(), engine->input.data() + consumed, (engine->numInput - consumed)*sizeof(std::complex<float>));
+        engine->numInput -= consumed;
+        engine->inputTimeNs += SoapySDR::ticksToTimeNs(consumed, engine->rate);
+
+        std::lock_guard<std::mutex> lock(engine->mutex);
+        for (const auto consumer : engine->consumers)
+        {
+            if (not consumer->active) continue;
+            if (consumer->queue.size() >= MAX_QUEUED_BLOCKS)
+            {
+                consumer->queue.pop_front();
+                consumer->offset = 0;
+                consumer->overflow = true;
+            }
+            consumer->queue.push_back(block);
+        }
+        engine->cond.notify_all();
+    }
+}
+
+/*******************************************************************
+ * Channelizer setup
+ ******************************************************************/
+ChannelizerLayer::ChannelizerLayer(SoapySDR::Device *device, const SoapySDR::Kwargs &args):
+    DeviceDecorator(device),
+    _numChans(SoapySDR::StringToSetting<size_t>(args.at("channelizer"))),
+    _numTaps((args.count("channelizer_taps") != 0)?SoapySDR::StringToSetting<size_t>(args.at("channelizer_taps")):8),
+    _numThreads((args.count("channelizer_threads") != 0)?SoapySDR::StringToSetting<size_t>(args.at("channelizer_threads")):2),
+    _wideChan(0),
+    _bins(_numChans)
+{
+    if (args.count("channelizer_chan") != 0) _wideChan = SoapySDR::StringToSetting<size_t>(args.at("channelizer_chan"));
+
+    std::string error;
+    if (_numChans < 2 or (_numChans & (_numChans-1)) != 0) error = "channelizer must be a power of two";
+    else if (_wideChan >= device->getNumChannels(SOAPY_SDR_RX)) error = "channelizer_chan out of range";
+    if (not error.empty())
+    {
+        _device = nullptr; //the caller still owns the device when construction fails
+        throw std::runtime_error("ChannelizerLayer: " + error);
+    }
+
+    for (size_t i = 0; i < _numChans; i++) _bins[i] = i;
+}
+
+ChannelizerLayer::~ChannelizerLayer(void)
+{
+    return;
+}
+
+size_t ChannelizerLayer::deviceChannel(const int direction, const size_t channel) const
+{
+    if (direction != SOAPY_SDR_RX) return channel;
+    if (channel >= _numChans) throw std::out_of_range("ChannelizerLayer: channel " + std::to_string(channel) + " out of range");
+    return _wideChan;
+}
+
+double ChannelizerLayer::channelSpacing(void) const
+{
+    return _device->getSampleRate(SOAPY_SDR_RX, _wideChan)/_numChans;
+}
+
+long ChannelizerLayer::binOffset(const size_t channel) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const size_t bin = _bins.at(channel);
+    return (bin < _numChans/2)?long(bin):(long(bin) - long(_numChans));
+}
+
+/*******************************************************************
+ * Channels API
+ ******************************************************************/
+size_t ChannelizerLayer::getNumChannels(const int direction) const
+{
+    if (direction == SOAPY_SDR_RX) return _numChans;
+    return _device->getNumChannels(direction);
+}
+
+SoapySDR::Kwargs ChannelizerLayer::getChannelInfo(const int direction, const size_t channel) const
+{
+    auto info = _device->getChannelInfo(direction, this->deviceChannel(direction, channel));
+    if (direction == SOAPY_SDR_RX) info["channelizer_bin"] = std::to_string(this->binOffset(channel));
+    return info;
+}
+
+bool ChannelizerLayer::getFullDuplex(const int direction, const size_t channel) const
+{
+    return _device->getFullDuplex(direction, this->deviceChannel(direction, channel));
+}
+
+/*******************************************************************
+ * Stream API
+ ******************************************************************/
+std::vector<std::string> ChannelizerLayer::getStreamFormats(const int direction, const size_t channel) const
+{
+    if (direction != SOAPY_SDR_RX) return _device->getStreamFormats(direction, channel);
+    auto formats = SoapySDR::ConverterRegistry::listTargetFormats(SOAPY_SDR_CF32);
+    if (std::find(formats.begin(), formats.end(), SOAPY_SDR_CF32) == formats.end()) formats.insert(formats.begin(), SOAPY_SDR_CF32);
+    return formats;
+}
+
+std::string ChannelizerLayer::getNativeStreamFormat(const int direction, const size_t channel, double &fullScale) const
+{
+    if (direction != SOAPY_SDR_RX) return _device->getNativeStreamFormat(direction, channel, fullScale);
+    fullScale = 1.0;
+    return SOAPY_SDR_CF32;
+}
+
+SoapySDR::ArgInfoList ChannelizerLayer::getStreamArgsInfo(const int direction, const size_t channel) const
+{
+    return _device->getStreamArgsInfo(direction, this->deviceChannel(direction, channel));
+}
+
+SoapySDR::Stream *ChannelizerLayer::setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+{
+    std::unique_ptr<ChannelizerStream> stream(new ChannelizerStream());
+    stream->passthrough = nullptr;
+    if (direction != SOAPY_SDR_RX)
+    {
+        stream->passthrough = _device->setupStream(direction, format, channels, args);
+        return reinterpret_cast<SoapySDR::Stream *>(stream.release());
+    }
+
+    std::unique_ptr<ChannelizerConsumer> consumer(new ChannelizerConsumer());
+    consumer->channels = channels.empty()?std::vector<size_t>(1, 0):channels;
+    for (const auto ch : consumer->channels) this->deviceChannel(direction, ch);
+    consumer->convert = nullptr;
+    if (format != SOAPY_SDR_CF32)
+    {
+        consumer->convert = SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CF32, format);
+        if (consumer->convert == nullptr) throw std::runtime_error("ChannelizerLayer::setupStream() cannot convert to " + format);
+    }
+    consumer->elemSize = SoapySDR::formatToSize(format);
+    consumer->active = false;
+    consumer->hasStart = false;
+    consumer->startNs = 0;
+    consumer->overflow = false;
+    consumer->offset = 0;
+
+    //the first virtual stream makes the shared wideband stream
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (not _engine)
+    {
+        std::unique_ptr<ChannelizerEngine> engine(new ChannelizerEngine(_numChans, _numTaps, _numThreads));
+        engine->stream = _device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {_wideChan}, args);
+        engine->mtu = _device->getStreamMTU(engine->stream);
+        engine->input.resize(engine->pfb.getHistoryLength() + engine->mtu);
+        _engine = std::move(engine);
+    }
+
+    std::lock_guard<std::mutex> engineLock(_engine->mutex);
+    _engine->consumers.push_back(consumer.get());
+    stream->consumer = std::move(consumer);
+    return reinterpret_cast<SoapySDR::Stream *>(stream.release());
+}
+
+void ChannelizerLayer::closeStream(SoapySDR::Stream *handle)
+{
+    std::unique_ptr<ChannelizerStream> stream(reinterpret_cast<ChannelizerStream *>(handle));
+    if (not stream->consumer) return _device->closeStream(stream->passthrough);
+
+    if (stream->consumer->active) this->deactivateStream(handle, 0, 0);
+    std::lock_guard<std::mutex> lock(_mutex);
+    {
+        std::lock_guard<std::mutex> engineLock(_engine->mutex);
+        auto &consumers = _engine->consumers;
+        consumers.erase(std::find(consumers.begin(), consumers.end(), stream->consumer.get()));
+        if (not consumers.empty()) return;
+    }
+
+    //the last virtual stream closes the shared wideband stream
+    _device->closeStream(_engine->stream);
+    _engine.reset();
+}
+
+size_t ChannelizerLayer::getStreamMTU(SoapySDR::Stream *handle) const
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->getStreamMTU(stream->passthrough);
+    return std::max<size_t>(_engine->mtu/_numChans, 1);
+}
+
+int ChannelizerLayer::activateStream(SoapySDR::Stream *handle, const int flags, const long long timeNs, const size_t numElems)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->activateStream(stream->passthrough, flags, timeNs, numElems);
+    if ((flags & ~SOAPY_SDR_HAS_TIME) != 0) return SOAPY_SDR_NOT_SUPPORTED;
+
+    //the first active virtual stream starts the wideband stream
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (stream->consumer->active) return 0;
+    if (_engine->numActive == 0)
+    {
+        const int ret = _device->activateStream(_engine->stream, 0, 0, 0);
+        if (ret != 0) return ret;
+        _engine->rate = _device->getSampleRate(SOAPY_SDR_RX, _wideChan);
+        _engine->numInput = _engine->pfb.getHistoryLength();
+        std::fill(_engine->input.begin(), _engine->input.end(), std::complex<float>());
+        _engine->running = true;
+        _engine->thread = std::thread(&engineLoop, _device, _engine.get(), _numChans);
+    }
+    _engine->numActive++;
+
+    std::lock_guard<std::mutex> engineLock(_engine->mutex);
+    auto &consumer = *stream->consumer;
+    consumer.queue.clear();
+    consumer.offset = 0;
+    consumer.overflow = false;
+    consumer.hasStart = (flags & SOAPY_SDR_HAS_TIME) != 0;
+    consumer.startNs = timeNs;
+    consumer.active = true;
+    return 0;
+}
+
+int ChannelizerLayer::deactivateStream(SoapySDR::Stream *handle, const int flags, const long long timeNs)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->deactivateStream(stream->passthrough, flags, timeNs);
+    if (flags != 0) return SOAPY_SDR_NOT_SUPPORTED;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (not stream->consumer->active) return 0;
+    {
+        std::lock_guard<std::mutex> engineLock(_engine->mutex);
+        stream->consumer->active = false;
+        stream->consumer->queue.clear();
+    }
+
+    //the last active virtual stream stops the wideband stream
+    if (--_engine->numActive != 0) return 0;
+    _engine->running = false;
+    _engine->thread.join();
+    return _device->deactivateStream(_engine->stream, 0, 0);
+}
+
+int ChannelizerLayer::readStream(SoapySDR::Stream *handle, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->readStream(stream->passthrough, buffs, numElems, flags, timeNs, timeoutUs);
+    auto &consumer = *stream->consumer;
+    if (not consumer.active) return SOAPY_SDR_STREAM_ERROR;
+
+    //the bins are read on every call so that virtual channels can be retuned while streaming
+    std::vector<size_t> bins;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto ch : consumer.channels) bins.push_back(_bins[ch]);
+    }
+
+    const double rate = _engine->rate/_numChans;
+    const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+    std::unique_lock<std::mutex> lock(_engine->mutex);
+    while (true)
+    {
+        if (not _engine->cond.wait_until(lock, exitTime, [&consumer]{return consumer.overflow or not consumer.queue.empty();})) return SOAPY_SDR_TIMEOUT;
+        if (consumer.overflow)
+        {
+            consumer.overflow = false;
+            return SOAPY_SDR_OVERFLOW;
+        }
+
+        //drop the outputs before a timed activation
+        const auto block = consumer.queue.front();
+        if (consumer.hasStart and block->hasTime)
+        {
+            const long long ticks = SoapySDR::timeNsToTicks(consumer.startNs - block->timeNs, rate);
+            if (ticks > 0) consumer.offset = std::max(consumer.offset, std::min<size_t>(size_t(ticks), block->numOut));
+            if (consumer.offset == block->numOut)
+            {
+                consumer.queue.pop_front();
+                consumer.offset = 0;
+                continue;
+            }
+            consumer.hasStart = false;
+        }
+
+        const size_t n = std::min(numElems, block->numOut - consumer.offset);
+        for (size_t i = 0; i < bins.size(); i++)
+        {
+            const auto src = block->out.data() + bins[i]*block->numOut + consumer.offset;
+            if (consumer.convert == nullptr) std::memcpy(buffs[i], src, n*consumer.elemSize);
+            else consumer.convert(src, buffs[i], n, 1.0);
+        }
+
+        flags = 0;
+        timeNs = 0;
+        if (block->hasTime)
+        {
+            flags |= SOAPY_SDR_HAS_TIME;
+            timeNs = block->timeNs + SoapySDR::ticksToTimeNs(consumer.offset, rate);
+        }
+        consumer.offset += n;
+        if (consumer.offset == block->numOut)
+        {
+            consumer.queue.pop_front();
+            consumer.offset = 0;
+        }
+        return int(n);
+    }
+}
+
+int ChannelizerLayer::writeStream(SoapySDR::Stream *handle, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->writeStream(stream->passthrough, buffs, numElems, flags, timeNs, timeoutUs);
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+int ChannelizerLayer::readStreamStatus(SoapySDR::Stream *handle, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->readStreamStatus(stream->passthrough, chanMask, flags, timeNs, timeoutUs);
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+int ChannelizerLayer::captureSamples(const int direction, const std::vector<size_t> &channels, const std::string &format, const long long timeNs, const size_t numElems, void * const *buffs, const long timeoutUs)
+{
+    //the generic capture uses the virtual streams of this layer
+    if (direction == SOAPY_SDR_RX) return SoapySDR::Device::captureSamples(direction, channels, format, timeNs, numElems, buffs, timeoutUs);
+    return _device->captureSamples(direction, channels, format, timeNs, numElems, buffs, timeoutUs);
+}
+
+SoapySDR::StreamStats ChannelizerLayer::getStreamStats(SoapySDR::Stream *handle) const
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->getStreamStats(stream->passthrough);
+    return SoapySDR::StreamStats();
+}
+
+/*******************************************************************
+ * Direct buffer access API
+ ******************************************************************/
+size_t ChannelizerLayer::getNumDirectAccessBuffers(SoapySDR::Stream *handle)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->getNumDirectAccessBuffers(stream->passthrough);
+    return 0;
+}
+
+int ChannelizerLayer::getDirectAccessBufferAddrs(SoapySDR::Stream *handle, const size_t bufHandle, void **buffs)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->getDirectAccessBufferAddrs(stream->passthrough, bufHandle, buffs);
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+int ChannelizerLayer::acquireReadBuffer(SoapySDR::Stream *handle, size_t &bufHandle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->acquireReadBuffer(stream->passthrough, bufHandle, buffs, flags, timeNs, timeoutUs);
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+void ChannelizerLayer::releaseReadBuffer(SoapySDR::Stream *handle, const size_t bufHandle)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->releaseReadBuffer(stream->passthrough, bufHandle);
+}
+
+int ChannelizerLayer::acquireWriteBuffer(SoapySDR::Stream *handle, size_t &bufHandle, void **buffs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->acquireWriteBuffer(stream->passthrough, bufHandle, buffs, timeoutUs);
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+void ChannelizerLayer::releaseWriteBuffer(SoapySDR::Stream *handle, const size_t bufHandle, const size_t numElems, int &flags, const long long timeNs)
+{
+    auto stream = reinterpret_cast<ChannelizerStream *>(handle);
+    if (not stream->consumer) return _device->releaseWriteBuffer(stream->passthrough, bufHandle, numElems, flags, timeNs);
+}
+
+/*******************************************************************
+ * Antenna API
+ ******************************************************************/
+std::vector<std::string> ChannelizerLayer::listAntennas(const int direction, const size_t channel) const
+{
+    return _device->listAntennas(direction, this->deviceChannel(direction, channel));
+}
+
+void ChannelizerLayer::setAntenna(const int direction, const size_t channel, const std::string &name)
+{
+    _device->setAntenna(direction, this->deviceChannel(direction, channel), name);
+}
+
+std::string ChannelizerLayer::getAntenna(const int direction, const size_t channel) const
+{
+    return _device->getAntenna(direction, this->deviceChannel(direction, channel));
+}
+
+/*******************************************************************
+ * Frontend corrections API
+ ******************************************************************/
+bool ChannelizerLayer::hasDCOffsetMode(const int direction, const size_t channel) const
+{
+    return _device->hasDCOffsetMode(direction, this->deviceChannel(direction, channel));
+}
+
+void ChannelizerLayer::setDCOffsetMode(const int direction, const size_t channel, const bool automatic)
+{
+    _device->setDCOffsetMode(direction, this->deviceChannel(direction, channel), automatic);
+}
+
+bool ChannelizerLayer::getDCOffsetMode(const int direction, const size_t channel) const
+{
+    return _device->getDCOffsetMode(direction, this->deviceChannel(direction, channel));
+}
+
+/*******************************************************************
+ * Gain API
+ ******************************************************************/
+std::vector<std::string> ChannelizerLayer::listGains(const int direction, const size_t channel) const
+{
+    return _device->listGains(direction, this->deviceChannel(direction, channel));
+}
+
+bool ChannelizerLayer::hasGainMode(const int direction, const size_t channel) const
+{
+    return _device->hasGainMode(direction, this->deviceChannel(direction, channel));
+}
+
+void ChannelizerLayer::setGainMode(const int direction, const size_t channel, const bool automatic)
+{
+    _device->setGainMode(direction, this->deviceChannel(direction, channel), automatic);
+}
+
+bool ChannelizerLayer::getGainMode(const int direction, const size_t channel) const
+{
+    return _device->getGainMode(direction, this->deviceChannel(direction, channel));
+}
+
+void ChannelizerLayer::setGain(const int direction, const size_t channel, const double value)
+{
+    _device->setGain(direction, this->deviceChannel(direction, channel), value);
+}
+
+void ChannelizerLayer::setGain(const int direction, const size_t channel, const std::string &name, const double value)
+{
+    _device->setGain(direction, this->deviceChannel(direction, channel), name, value);
+}
+
+double ChannelizerLayer::getGain(const int direction, const size_t channel) const
+{
+    return _device->getGain(direction, this->deviceChannel(direction, channel));
+}
+
+double ChannelizerLayer::getGain(const int direction, const size_t channel, const std::string &name) const
+{
+    return _device->getGain(direction, this->deviceChannel(direction, channel), name);
+}
+
+SoapySDR::Range ChannelizerLayer::getGainRange(const int direction, const size_t channel) const
+{
+    return _device->getGainRange(direction, this->deviceChannel(direction, channel));
+}
+
+SoapySDR::Range ChannelizerLayer::getGainRange(const int direction, const size_t channel, const std::string &name) const
+{
+    return _device->getGainRange(direction, this->deviceChannel(direction, channel), name);
+}
+
+/*******************************************************************
+ * Frequency API
+ *
+ * The overall frequency of a virtual channel selects the nearest
+ * channel center within the wideband capture. The "CH" component is
+ * the offset from the wideband center, and the device's components
+ * tune the shared wideband center for all virtual channels.
+ * The overall frequency only tunes "CH", which follows the
+ * usual component arguments: a value or "IGNORE".
+ * Frequencies outside of the capture are rejected.
+ ******************************************************************/
+void ChannelizerLayer::setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args)
+{
+    if (direction != SOAPY_SDR_RX) return _device->setFrequency(direction, channel, frequency, args);
+    const auto it = args.find("CH");
+    if (it != args.end() and it->second == "IGNORE") return;
+    const double center = _device->getFrequency(direction, _wideChan);
+    const double offset = (it != args.end())?std::stod(it->second):(frequency - center);
+    this->setFrequency(direction, channel, "CH", offset, args);
+}
+
+void ChannelizerLayer::setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args)
+{
+    if (direction != SOAPY_SDR_RX or name != "CH") return _device->setFrequency(direction, this->deviceChannel(direction, channel), name, frequency, args);
+    this->deviceChannel(direction, channel);
+
+    const long half = long(_numChans/2);
+    const long offset = long(std::lround(frequency/this->channelSpacing()));
+    if (offset < -half or offset > half-1) throw std::out_of_range("ChannelizerLayer::setFrequency() offset "
+        + std::to_string(frequency) + " Hz is outside of the wideband capture");
+    std::lock_guard<std::mutex> lock(_mutex);
+    _bins[channel] = size_t((offset + long(_numChans)) % long(_numChans));
+}
+
+double ChannelizerLayer::getFrequency(const int direction, const size_t channel) const
+{
+    if (direction != SOAPY_SDR_RX) return _device->getFrequency(direction, channel);
+    return _device->getFrequency(direction, this->deviceChannel(direction, channel)) + this->getFrequency(direction, channel, "CH");
+}
+
+double ChannelizerLayer::getFrequency(const int direction, const size_t channel, const std::string &name) const
+{
+    if (direction != SOAPY_SDR_RX or name != "CH") return _device->getFrequency(direction, this->deviceChannel(direction, channel), name);
+    this->deviceChannel(direction, channel);
+    return this->binOffset(channel)*this->channelSpacing();
+}
+
+std::vector<std::string> ChannelizerLayer::listFrequencies(const int direction, const size_t channel) const
+{
+    auto names = _device->listFrequencies(direction, this->deviceChannel(direction, channel));
+    if (direction == SOAPY_SDR_RX) names.push_back("CH");
+    return names;
+}
+
+SoapySDR::RangeList ChannelizerLayer::getFrequencyRange(const int direction, const size_t channel) const
+{
+    return _device->getFrequencyRange(direction, this->deviceChannel(direction, channel));
+}
+
+SoapySDR::RangeList ChannelizerLayer::getFrequencyRange(const int direction, const size_t channel, const std::string &name) const
+{
+    if (direction != SOAPY_SDR_RX or name != "CH") return _device->getFrequencyRange(direction, this->deviceChannel(direction, channel), name);
+    const double spacing = this->channelSpacing();
+    const double half = double(_numChans/2);
+    return {SoapySDR::Range(-half*spacing, (half-1)*spacing, spacing)};
+}
+
+SoapySDR::ArgInfoList ChannelizerLayer::getFrequencyArgsInfo(const int direction, const size_t channel) const
+{
+    return _device->getFrequencyArgsInfo(direction, this->deviceChannel(direction, channel));
+}
+
+/*******************************************************************
+ * Sample Rate API
+ *
+ * The filter bank is critically sampled, so a virtual channel rate
+ * sets the wideband rate to M times the requested rate. The rate is
+ * shared by every virtual channel, so once a stream is set up,
+ * rates other than the current wideband rate over M are rejected.
+ ******************************************************************/
+void ChannelizerLayer::setSampleRate(const int direction, const size_t channel, const double rate)
+{
+    if (direction != SOAPY_SDR_RX) return _device->setSampleRate(direction, channel, rate);
+    const size_t wideChan = this->deviceChannel(direction, channel);
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_engine and rate*_numChans != _device->getSampleRate(direction, wideChan))
+    {
+        throw std::invalid_argument("ChannelizerLayer::setSampleRate() cannot change the rate shared by the open streams");
+    }
+    _device->setSampleRate(direction, wideChan, rate*_numChans);
+}
+
+double ChannelizerLayer::getSampleRate(const int direction, const size_t channel) const
+{
+    if (direction != SOAPY_SDR_RX) return _device->getSampleRate(direction, channel);
+    return _device->getSampleRate(direction, this->deviceChannel(direction, channel))/_numChans;
+}
+
+std::vector<double> ChannelizerLayer::listSampleRates(const int direction, const size_t channel) const
+{
+    auto rates = _device->listSampleRates(direction, this->deviceChannel(direction, channel));
+    if (direction == SOAPY_SDR_RX) for (auto &rate : rates) rate /= _numChans;
+    return rates;
+}
+
+SoapySDR::RangeList ChannelizerLayer::getSampleRateRange(const int direction, const size_t channel) const
+{
+    auto ranges = _device->getSampleRateRange(direction, this->deviceChannel(direction, channel));
+    if (direction != SOAPY_SDR_RX) return ranges;
+    for (auto &range : ranges) range = SoapySDR::Range(range.minimum()/_numChans, range.maximum()/_numChans, range.step()/_numChans);
+    return ranges;
+}
+
+/*******************************************************************
+ * Bandwidth API
+ *
+ * The bandwidth of a virtual channel is the channel spacing.
+ ******************************************************************/
+void ChannelizerLayer::setBandwidth(const int direction, const size_t channel, const double bw)
+{
+    if (direction != SOAPY_SDR_RX) return _device->setBandwidth(direction, channel, bw);
+    this->deviceChannel(direction, channel);
+}
+
+double ChannelizerLayer::getBandwidth(const int direction, const size_t channel) const
+{
+    if (direction != SOAPY_SDR_RX) return _device->getBandwidth(direction, channel);
+    this->deviceChannel(direction, channel);
+    return this->channelSpacing();
+}
+
+std::vector<double> ChannelizerLayer::listBandwidths(const int direction, const size_t channel) const
+{
+    if (direction != SOAPY_SDR_RX) return _device->listBandwidths(direction, channel);
+    return {this->getBandwidth(direction, channel)};
+}
+
+SoapySDR::RangeList ChannelizerLayer::getBandwidthRange(const int direction, const size_t channel) const
+{
+    if (direction != SOAPY_SDR_RX) return _device->getBandwidthRange(direction, channel);
+    const double bw = this->getBandwidth(direction, channel);
+    return {SoapySDR::Range(bw, bw)};
+}
+
+/*******************************************************************
+ * Timed command API
+ ******************************************************************/
+size_t ChannelizerLayer::queueCommands(const SoapySDR::TimedCommandList &commands)
+{
+    //the device cannot time the virtual channel tuning,
+    //so offload only the commands up to the first one
+    SoapySDR::TimedCommandList deviceCommands;
+    for (auto command : commands)
+    {
+        if (command.type != SoapySDR::TimedCommand::GPIO and command.direction == SOAPY_SDR_RX)
+        {
+            if (command.type == SoapySDR::TimedCommand::FREQUENCY and (command.name.empty() or command.name == "CH")) break;
+            command.channel = this->deviceChannel(command.direction, command.channel);
+        }
+        deviceCommands.push_back(command);
+    }
+    if (deviceCommands.empty()) return 0;
+    return _device->queueCommands(deviceCommands);
+}
+
+/*******************************************************************
+ * Sensor API
+ ******************************************************************/
+std::vector<std::string> ChannelizerLayer::listSensors(const int direction, const size_t channel) const
+{
+    return _device->listSensors(direction, this->deviceChannel(direction, channel));
+}
+
+SoapySDR::ArgInfo ChannelizerLayer::getSensorInfo(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->getSensorInfo(direction, this->deviceChannel(direction, channel), key);
+}
+
+std::string ChannelizerLayer::readSensor(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSensor(direction, this->deviceChannel(direction, channel), key);
+}
+
+bool ChannelizerLayer::readSensorBool(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSensorBool(direction, this->deviceChannel(direction, channel), key);
+}
+
+long long ChannelizerLayer::readSensorInt(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSensorInt(direction, this->deviceChannel(direction, channel), key);
+}
+
+double ChannelizerLayer::readSensorFloat(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSensorFloat(direction, this->deviceChannel(direction, channel), key);
+}
+
+/*******************************************************************
+ * Settings API
+ ******************************************************************/
+SoapySDR::ArgInfoList ChannelizerLayer::getSettingInfo(const int direction, const size_t channel) const
+{
+    return _device->getSettingInfo(direction, this->deviceChannel(direction, channel));
+}
+
+SoapySDR::ArgInfo ChannelizerLayer::getSettingInfo(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->getSettingInfo(direction, this->deviceChannel(direction, channel), key);
+}
+
+void ChannelizerLayer::writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value)
+{
+    _device->writeSetting(direction, this->deviceChannel(direction, channel), key, value);
+}
+
+std::string ChannelizerLayer::readSetting(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSetting(direction, this->deviceChannel(direction, channel), key);
+}
+
+void ChannelizerLayer::writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value)
+{
+    _device->writeSettingBool(direction, this->deviceChannel(direction, channel), key, value);
+}
+
+void ChannelizerLayer::writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value)
+{
+    _device->writeSettingInt(direction, this->deviceChannel(direction, channel), key, value);
+}
+
+void ChannelizerLayer::writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value)
+{
+    _device->writeSettingFloat(direction, this->deviceChannel(direction, channel), key, value);
+}
+
+bool ChannelizerLayer::readSettingBool(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSettingBool(direction, this->deviceChannel(direction, channel), key);
+}
+
+long long ChannelizerLayer::readSettingInt(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSettingInt(direction, this->deviceChannel(direction, channel), key);
+}
+
+double ChannelizerLayer::readSettingFloat(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSettingFloat(direction, this->deviceChannel(direction, channel), key);
+}
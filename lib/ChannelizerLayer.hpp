@@ -0,0 +1,166 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include "DeviceDecorator.hpp"
+#include <memory>
+#include <mutex>
+
+struct ChannelizerEngine;
+
+/*!
+ * ChannelizerLayer splits one wideband receive channel into M virtual
+ * receive channels with a polyphase filter bank. The factory places it
+ * around a device when the channelizer=M argument is given to make().
+ * Each virtual channel is tuned to a channel center within the wideband
+ * capture, and any number of streams share one wideband stream.
+ * The virtual channels share one sample rate, which is fixed
+ * while any virtual stream is set up.
+ * Transmit calls are passed through to the device unchanged.
+ * Timed tuning of a virtual channel is never offloaded to the device,
+ * so the library scheduler applies it from that command onwards.
+ */
+class ChannelizerLayer : public DeviceDecorator
+{
+public:
+    ChannelizerLayer(SoapySDR::Device *device, const SoapySDR::Kwargs &args);
+
+    ~ChannelizerLayer(void);
+
+    /*******************************************************************
+     * Channels API
+     ******************************************************************/
+    size_t getNumChannels(const int direction) const;
+    SoapySDR::Kwargs getChannelInfo(const int direction, const size_t channel) const;
+    bool getFullDuplex(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Stream API
+     ******************************************************************/
+    std::vector<std::string> getStreamFormats(const int direction, const size_t channel) const;
+    std::string getNativeStreamFormat(const int direction, const size_t channel, double &fullScale) const;
+    SoapySDR::ArgInfoList getStreamArgsInfo(const int direction, const size_t channel) const;
+    SoapySDR::Stream *setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args);
+    void closeStream(SoapySDR::Stream *stream);
+    size_t getStreamMTU(SoapySDR::Stream *stream) const;
+    int activateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs, const size_t numElems);
+    int deactivateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs);
+    int readStream(SoapySDR::Stream *stream, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+    int writeStream(SoapySDR::Stream *stream, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs);
+    int readStreamStatus(SoapySDR::Stream *stream, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs);
+    int captureSamples(const int direction, const std::vector<size_t> &channels, const std::string &format, const long long timeNs, const size_t numElems, void * const *buffs, const long timeoutUs);
+    SoapySDR::StreamStats getStreamStats(SoapySDR::Stream *stream) const;
+
+    /*******************************************************************
+     * Direct buffer access API
+     ******************************************************************/
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *stream);
+    int getDirectAccessBufferAddrs(SoapySDR::Stream *stream, const size_t handle, void **buffs);
+    int acquireReadBuffer(SoapySDR::Stream *stream, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs);
+    void releaseReadBuffer(SoapySDR::Stream *stream, const size_t handle);
+    int acquireWriteBuffer(SoapySDR::Stream *stream, size_t &handle, void **buffs, const long timeoutUs);
+    void releaseWriteBuffer(SoapySDR::Stream *stream, const size_t handle, const size_t numElems, int &flags, const long long timeNs);
+
+    /*******************************************************************
+     * Antenna API
+     ******************************************************************/
+    std::vector<std::string> listAntennas(const int direction, const size_t channel) const;
+    void setAntenna(const int direction, const size_t channel, const std::string &name);
+    std::string getAntenna(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Frontend corrections API
+     ******************************************************************/
+    bool hasDCOffsetMode(const int direction, const size_t channel) const;
+    void setDCOffsetMode(const int direction, const size_t channel, const bool automatic);
+    bool getDCOffsetMode(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Gain API
+     ******************************************************************/
+    std::vector<std::string> listGains(const int direction, const size_t channel) const;
+    bool hasGainMode(const int direction, const size_t channel) const;
+    void setGainMode(const int direction, const size_t channel, const bool automatic);
+    bool getGainMode(const int direction, const size_t channel) const;
+    void setGain(const int direction, const size_t channel, const double value);
+    void setGain(const int direction, const size_t channel, const std::string &name, const double value);
+    double getGain(const int direction, const size_t channel) const;
+    double getGain(const int direction, const size_t channel, const std::string &name) const;
+    SoapySDR::Range getGainRange(const int direction, const size_t channel) const;
+    SoapySDR::Range getGainRange(const int direction, const size_t channel, const std::string &name) const;
+
+    /*******************************************************************
+     * Frequency API
+     ******************************************************************/
+    void setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args);
+    void setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args);
+    double getFrequency(const int direction, const size_t channel) const;
+    double getFrequency(const int direction, const size_t channel, const std::string &name) const;
+    std::vector<std::string> listFrequencies(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel, const std::string &name) const;
+    SoapySDR::ArgInfoList getFrequencyArgsInfo(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Sample Rate API
+     ******************************************************************/
+    void setSampleRate(const int direction, const size_t channel, const double rate);
+    double getSampleRate(const int direction, const size_t channel) const;
+    std::vector<double> listSampleRates(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getSampleRateRange(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Bandwidth API
+     ******************************************************************/
+    void setBandwidth(const int direction, const size_t channel, const double bw);
+    double getBandwidth(const int direction, const size_t channel) const;
+    std::vector<double> listBandwidths(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getBandwidthRange(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Timed command API
+     ******************************************************************/
+    size_t queueCommands(const SoapySDR::TimedCommandList &commands);
+
+    /*******************************************************************
+     * Sensor API
+     ******************************************************************/
+    std::vector<std::string> listSensors(const int direction, const size_t channel) const;
+    SoapySDR::ArgInfo getSensorInfo(const int direction, const size_t channel, const std::string &key) const;
+    std::string readSensor(const int direction, const size_t channel, const std::string &key) const;
+    bool readSensorBool(const int direction, const size_t channel, const std::string &key) const;
+    long long readSensorInt(const int direction, const size_t channel, const std::string &key) const;
+    double readSensorFloat(const int direction, const size_t channel, const std::string &key) const;
+
+    /*******************************************************************
+     * Settings API
+     ******************************************************************/
+    SoapySDR::ArgInfoList getSettingInfo(const int direction, const size_t channel) const;
+    SoapySDR::ArgInfo getSettingInfo(const int direction, const size_t channel, const std::string &key) const;
+    void writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value);
+    std::string readSetting(const int direction, const size_t channel, const std::string &key) const;
+    void writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value);
+    void writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value);
+    void writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value);
+    bool readSettingBool(const int direction, const size_t channel, const std::string &key) const;
+    long long readSettingInt(const int direction, const size_t channel, const std::string &key) const;
+    double readSettingFloat(const int direction, const size_t channel, const std::string &key) const;
+
+private:
+    //the device channel for a channel of this layer
+    size_t deviceChannel(const int direction, const size_t channel) const;
+    double channelSpacing(void) const;
+    long binOffset(const size_t channel) const;
+
+    const size_t _numChans;
+    const size_t _numTaps;
+    const size_t _numThreads;
+    size_t _wideChan;
+
+    //the selected filter bank bin of each virtual channel
+    mutable std::mutex _mutex;
+    std::vector<size_t> _bins;
+
+    //the shared wideband stream, made with the first virtual stream
+    std::unique_ptr<ChannelizerEngine> _engine;
+};
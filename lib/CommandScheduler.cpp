@@ -0,0 +1,132 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "CommandScheduler.hpp"
+#include <SoapySDR/Logger.hpp>
+#include <algorithm>
+#include <chrono>
+
+//read the hardware time this often while commands are waiting
+static const auto HARDWARE_TIME_RESYNC = std::chrono::milliseconds(100);
+
+//wait at most this long before checking the queue again
+static const auto MAX_IDLE_WAIT = std::chrono::milliseconds(10);
+
+/*******************************************************************
+ * Command scheduler
+ ******************************************************************/
+CommandScheduler::CommandScheduler(SoapySDR::Device *device, const ApplyFunction &apply, const long long leadNs):
+    _apply(apply),
+    _leadNs(leadNs),
+    _tracker(device),
+    _done(false)
+{
+    return;
+}
+
+CommandScheduler::~CommandScheduler(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _done = true;
+    }
+    _cond.notify_one();
+    if (_thread.joinable()) _thread.join();
+}
+
+void CommandScheduler::queue(SoapySDR::TimedCommandList::const_iterator first, SoapySDR::TimedCommandList::const_iterator last)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto it = first; it != last; ++it)
+    {
+        _queue.emplace(it->timeNs, *it);
+        _stats.numQueued++;
+    }
+    if (not _thread.joinable()) _thread = std::thread(&CommandScheduler::loop, this);
+    _cond.notify_one();
+}
+
+void CommandScheduler::clear(void)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queue.clear();
+    _cond.notify_one();
+}
+
+SoapySDR::CommandQueueStats CommandScheduler::getStats(void) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto stats = _stats;
+    stats.numPending = _queue.size();
+    return stats;
+}
+
+void CommandScheduler::loop(void)
+{
+    auto lastSample = std::chrono::steady_clock::now() - 2*HARDWARE_TIME_RESYNC;
+    bool timeFailed = false;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (not _done)
+    {
+        if (_queue.empty())
+        {
+            _cond.wait(lock);
+            continue;
+        }
+
+        //keep the time model fresh while commands are waiting
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastSample > HARDWARE_TIME_RESYNC)
+        {
+            lastSample = now;
+            lock.unlock();
+            try
+            {
+                _tracker.sample();
+            }
+            catch (const std::exception &ex)
+            {
+                if (not timeFailed) SoapySDR::logf(SOAPY_SDR_WARNING, "CommandScheduler failed to read the hardware time: %s", ex.what());
+                timeFailed = true;
+            }
+            lock.lock();
+            continue;
+        }
+
+        //wait until the latest possible device time is within the lead time
+        const auto estimate = _tracker.estimateHardwareTime();
+        auto it = _queue.begin();
+        const long long waitNs = it->first - _leadNs - (estimate.timeNs + estimate.errorNs);
+        if (not estimate.valid or waitNs > 0)
+        {
+            _cond.wait_for(lock, std::min<std::chrono::nanoseconds>(std::chrono::nanoseconds(std::max(waitNs, 0LL)), MAX_IDLE_WAIT));
+            continue;
+        }
+
+        const auto command = it->second;
+        _queue.erase(it);
+        lock.unlock();
+        bool failed = false;
+        try
+        {
+            _apply(command);
+        }
+        catch (const std::exception &ex)
+        {
+            SoapySDR::logf(SOAPY_SDR_WARNING, "CommandScheduler failed to apply a command at %lld ns: %s", command.timeNs, ex.what());
+            failed = true;
+        }
+        //late when the command was not in place by its time
+        const auto applied = _tracker.estimateHardwareTime();
+        lock.lock();
+
+        if (failed) _stats.numFailed++;
+        else _stats.numApplied++;
+        const long long lateNs = applied.timeNs - command.timeNs;
+        if (lateNs > 0)
+        {
+            _stats.numLate++;
+            _stats.maxLateNs = std::max(_stats.maxLateNs, lateNs);
+        }
+    }
+}
@@ -0,0 +1,57 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/TimeTracker.hpp>
+#include <condition_variable>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <map>
+
+/*!
+ * CommandScheduler applies timed commands to the device just in time.
+ * Commands are held in a time-ordered queue and applied by a dedicated
+ * thread, which starts with the first queued command. The device time
+ * is estimated with a TimeTracker that reads the hardware time at most
+ * every resync interval, so waiting for a command costs no round trips.
+ * A command is applied once the device time, plus the error bound of
+ * the estimate, is within the lead time of the command, and it counts
+ * as late when the estimated device time has already passed it.
+ */
+class CommandScheduler
+{
+public:
+    //! Apply one command with the command time set
+    typedef std::function<void(const SoapySDR::TimedCommand &)> ApplyFunction;
+
+    CommandScheduler(SoapySDR::Device *device, const ApplyFunction &apply, const long long leadNs);
+
+    ~CommandScheduler(void);
+
+    //! Queue the commands from first to last
+    void queue(SoapySDR::TimedCommandList::const_iterator first, SoapySDR::TimedCommandList::const_iterator last);
+
+    //! Drop the commands which have not been applied
+    void clear(void);
+
+    //! Get the counters of the scheduled commands
+    SoapySDR::CommandQueueStats getStats(void) const;
+
+private:
+    void loop(void);
+
+    const ApplyFunction _apply;
+    const long long _leadNs;
+    SoapySDR::TimeTracker _tracker;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _done;
+    std::thread _thread;
+
+    //commands with equal times stay in the order they were queued
+    std::multimap<long long, SoapySDR::TimedCommand> _queue;
+    SoapySDR::CommandQueueStats _stats;
+};
@@ -0,0 +1,423 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConfigLayer.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <memory>
+
+/*******************************************************************
+ * Config layer
+ ******************************************************************/
+static long long commandLeadNs(const SoapySDR::Kwargs &args)
+{
+    const auto it = args.find("command_lead");
+    if (it == args.end()) return 2000000;
+    return SoapySDR::StringToSetting<long long>(it->second)*1000;
+}
+
+ConfigLayer::ConfigLayer(SoapySDR::Device *device, const SoapySDR::Kwargs &args):
+    DeviceDecorator(device),
+    _tunedChannel(-1, 0),
+    _numOffloaded(0),
+    _commands(new CommandScheduler(device, [this](const SoapySDR::TimedCommand &command){this->applyCommand(command);}, commandLeadNs(args)))
+{
+    return;
+}
+
+ConfigLayer::CallQueue *ConfigLayer::transaction(void)
+{
+    const auto it = _transactions.find(std::this_thread::get_id());
+    return (it == _transactions.end())?nullptr:&it->second;
+}
+
+void ConfigLayer::apply(const std::function<void(void)> &call)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (auto queue = this->transaction())
+    {
+        queue->push_back(call);
+        return;
+    }
+    lock.unlock();
+    std::lock_guard<std::mutex> commandLock(_commandMutex);
+    call();
+}
+
+void ConfigLayer::locked(const std::function<void(void)> &call)
+{
+    std::lock_guard<std::mutex> commandLock(_commandMutex);
+    call();
+}
+
+void ConfigLayer::withCommandTime(const long long timeNs, const std::function<void(void)> &calls)
+{
+    if (timeNs < 0) return calls();
+
+    //drivers which ignore the what argument would set their clock,
+    //so callers check hasHardwareTime("CMD") before asking for a time
+    _device->setHardwareTime(timeNs, "CMD");
+    try
+    {
+        calls();
+    }
+    catch (...)
+    {
+        try {_device->setHardwareTime(0, "CMD");}
+        catch (...){}
+        throw;
+    }
+    _device->setHardwareTime(0, "CMD");
+}
+
+/*******************************************************************
+ * Configuration transaction API
+ ******************************************************************/
+void ConfigLayer::beginConfig(void)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (this->transaction() != nullptr) throw std::runtime_error("beginConfig() called during a transaction");
+    _transactions[std::this_thread::get_id()];
+}
+
+void ConfigLayer::commitConfig(const long long timeNs)
+{
+    CallQueue queue;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto transaction = this->transaction();
+        if (transaction == nullptr) throw std::runtime_error("commitConfig() called without beginConfig()");
+        if (timeNs >= 0 and not _device->hasHardwareTime("CMD")) throw std::runtime_error("commitConfig() with a time requires command time support");
+        queue.swap(*transaction);
+        _transactions.erase(std::this_thread::get_id());
+    }
+
+    std::lock_guard<std::mutex> commandLock(_commandMutex);
+    _device->beginConfig();
+    try
+    {
+        this->withCommandTime(timeNs, [&](void){for (const auto &call : queue) call();});
+    }
+    catch (...)
+    {
+        //leave the driver without a pending transaction
+        try {_device->cancelConfig();}
+        catch (...){}
+        throw;
+    }
+    _device->commitConfig(timeNs);
+}
+
+void ConfigLayer::cancelConfig(void)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_transactions.erase(std::this_thread::get_id()) == 0) throw std::runtime_error("cancelConfig() called without beginConfig()");
+}
+
+/*******************************************************************
+ * Timed command API
+ ******************************************************************/
+size_t ConfigLayer::queueCommands(const SoapySDR::TimedCommandList &commands)
+{
+    //checked first, so that a failed call has not queued any command
+    if (not _device->hasHardwareTime()) throw std::runtime_error("queueCommands() requires a hardware clock");
+
+    const size_t numOffloaded = std::min(_device->queueCommands(commands), commands.size());
+    _numOffloaded += numOffloaded;
+    if (numOffloaded == commands.size()) return commands.size();
+
+    _commands->queue(commands.begin() + numOffloaded, commands.end());
+    return commands.size();
+}
+
+void ConfigLayer::clearCommands(void)
+{
+    _commands->clear();
+    _device->clearCommands();
+}
+
+SoapySDR::CommandQueueStats ConfigLayer::getCommandQueueStats(void) const
+{
+    //the driver reports on the commands in its own queue
+    auto stats = _device->getCommandQueueStats();
+    const auto scheduled = _commands->getStats();
+    stats.numOffloaded = _numOffloaded;
+    stats.numQueued = stats.numOffloaded + scheduled.numQueued;
+    stats.numApplied += scheduled.numApplied;
+    stats.numLate += scheduled.numLate;
+    stats.numFailed += scheduled.numFailed;
+    stats.numPending += scheduled.numPending;
+    stats.maxLateNs = std::max(stats.maxLateNs, scheduled.maxLateNs);
+    return stats;
+}
+
+void ConfigLayer::applyCommand(const SoapySDR::TimedCommand &command)
+{
+    //without command times, the scheduler applies the command at its time
+    std::lock_guard<std::mutex> commandLock(_commandMutex);
+    const long long timeNs = _device->hasHardwareTime("CMD")?command.timeNs:-1;
+    this->withCommandTime(timeNs, [&](void)
+    {
+        switch (command.type)
+        {
+        case SoapySDR::TimedCommand::FREQUENCY:
+            this->forgetTuned();
+            if (command.name.empty()) _device->setFrequency(command.direction, command.channel, command.value, command.args);
+            else _device->setFrequency(command.direction, command.channel, command.name, command.value, command.args);
+            break;
+        case SoapySDR::TimedCommand::GAIN:
+            if (command.name.empty()) _device->setGain(command.direction, command.channel, command.value);
+            else _device->setGain(command.direction, command.channel, command.name, command.value);
+            break;
+        case SoapySDR::TimedCommand::GPIO:
+            _device->writeGPIO(command.name, command.gpioValue, command.gpioMask);
+            break;
+        case SoapySDR::TimedCommand::SETTING:
+            _device->writeSetting(command.direction, command.channel, command.name, command.settingValue);
+            break;
+        }
+    });
+}
+
+/*******************************************************************
+ * Antenna API
+ ******************************************************************/
+void ConfigLayer::setAntenna(const int direction, const size_t channel, const std::string &name)
+{
+    apply([=](void){_device->setAntenna(direction, channel, name);});
+}
+
+/*******************************************************************
+ * Frontend corrections API
+ ******************************************************************/
+void ConfigLayer::setDCOffsetMode(const int direction, const size_t channel, const bool automatic)
+{
+    apply([=](void){_device->setDCOffsetMode(direction, channel, automatic);});
+}
+
+void ConfigLayer::setDCOffset(const int direction, const size_t channel, const std::complex<double> &offset)
+{
+    apply([=](void){_device->setDCOffset(direction, channel, offset);});
+}
+
+void ConfigLayer::setIQBalance(const int direction, const size_t channel, const std::complex<double> &balance)
+{
+    apply([=](void){_device->setIQBalance(direction, channel, balance);});
+}
+
+void ConfigLayer::setIQBalanceMode(const int direction, const size_t channel, const bool automatic)
+{
+    apply([=](void){_device->setIQBalanceMode(direction, channel, automatic);});
+}
+
+void ConfigLayer::setFrequencyCorrection(const int direction, const size_t channel, const double value)
+{
+    apply([=](void){_device->setFrequencyCorrection(direction, channel, value);});
+}
+
+/*******************************************************************
+ * Gain API
+ ******************************************************************/
+void ConfigLayer::setGainMode(const int direction, const size_t channel, const bool automatic)
+{
+    apply([=](void){_device->setGainMode(direction, channel, automatic);});
+}
+
+void ConfigLayer::setGain(const int direction, const size_t channel, const double value)
+{
+    apply([=](void){_device->setGain(direction, channel, value);});
+}
+
+void ConfigLayer::setGain(const int direction, const size_t channel, const std::string &name, const double value)
+{
+    apply([=](void){_device->setGain(direction, channel, name, value);});
+}
+
+/*******************************************************************
+ * Frequency API
+ ******************************************************************/
+void ConfigLayer::setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args)
+{
+    apply([=](void){this->forgetTuned(); _device->setFrequency(direction, channel, frequency, args);});
+}
+
+void ConfigLayer::setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args)
+{
+    apply([=](void){this->forgetTuned(); _device->setFrequency(direction, channel, name, frequency, args);});
+}
+
+/*******************************************************************
+ * Frequency hopping API
+ ******************************************************************/
+SoapySDR::HopTable *ConfigLayer::prepareFrequencies(const int direction, const size_t channel, const std::vector<double> &frequencies, const SoapySDR::Kwargs &args)
+{
+    std::unique_ptr<LayerHopTable> table(new LayerHopTable());
+    table->direction = direction;
+    table->channel = channel;
+    table->frequencies = frequencies;
+    table->args = args;
+    table->driverTable = _device->prepareFrequencies(direction, channel, frequencies, args);
+    if (table->driverTable == nullptr)
+    {
+        //components which the arguments ignore are never set by hops
+        for (const auto &name : _device->listFrequencies(direction, channel))
+        {
+            const auto it = args.find(name);
+            if (it == args.end() or it->second != "IGNORE") table->components.push_back(name);
+        }
+        table->splits.resize(frequencies.size());
+    }
+    return reinterpret_cast<SoapySDR::HopTable *>(table.release());
+}
+
+void ConfigLayer::applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs)
+{
+    auto hopTable = reinterpret_cast<LayerHopTable *>(table);
+    if (index >= hopTable->frequencies.size()) throw std::out_of_range("applyHop() index out of range");
+
+    //queued hops are applied at the commit time
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (auto queue = this->transaction())
+        {
+            queue->push_back([=](void){this->hop(hopTable, index, false);});
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> commandLock(_commandMutex);
+    if (timeNs < 0) return this->hop(hopTable, index, true);
+
+    //the driver table times its own hops
+    if (hopTable->driverTable != nullptr) return _device->applyHop(hopTable->driverTable, index, timeNs);
+
+    //a timed hop cannot be measured since the readback is not yet valid
+    if (not _device->hasHardwareTime("CMD")) throw std::runtime_error("applyHop() with a time requires command time support");
+    this->withCommandTime(timeNs, [&](void){this->hop(hopTable, index, false);});
+}
+
+void ConfigLayer::closeHopTable(SoapySDR::HopTable *table)
+{
+    std::unique_ptr<LayerHopTable> hopTable(reinterpret_cast<LayerHopTable *>(table));
+    if (hopTable->driverTable != nullptr) _device->closeHopTable(hopTable->driverTable);
+}
+
+void ConfigLayer::hop(LayerHopTable *table, const size_t index, const bool measure)
+{
+    if (table->driverTable != nullptr) return _device->applyHop(table->driverTable, index, -1);
+
+    //channels may share synthesizers, so only the last channel is tracked
+    std::lock_guard<std::mutex> lock(_hopMutex);
+    const auto channel = std::make_pair(table->direction, table->channel);
+    if (channel != _tunedChannel) _tuned.clear();
+    _tunedChannel = channel;
+
+    const auto &split = table->splits[index];
+    try
+    {
+        //set only the components which differ from the last hop
+        for (const auto &comp : split)
+        {
+            const auto it = _tuned.find(comp.first);
+            if (it != _tuned.end() and it->second == comp.second) continue;
+            _device->setFrequency(table->direction, table->channel, comp.first, comp.second, table->args);
+            _tuned[comp.first] = comp.second;
+        }
+        if (not split.empty()) return;
+
+        //otherwise tune the overall frequency and read back the components
+        _tuned.clear();
+        _device->setFrequency(table->direction, table->channel, table->frequencies[index], table->args);
+        if (not measure) return;
+        ComponentList measured;
+        for (const auto &name : table->components)
+        {
+            measured.emplace_back(name, _device->getFrequency(table->direction, table->channel, name));
+            _tuned[name] = measured.back().second;
+        }
+        table->splits[index] = measured;
+    }
+    catch (...)
+    {
+        _tuned.clear();
+        throw;
+    }
+}
+
+void ConfigLayer::forgetTuned(void)
+{
+    std::lock_guard<std::mutex> lock(_hopMutex);
+    _tuned.clear();
+}
+
+/*******************************************************************
+ * Sample Rate API
+ ******************************************************************/
+void ConfigLayer::setSampleRate(const int direction, const size_t channel, const double rate)
+{
+    apply([=](void){_device->setSampleRate(direction, channel, rate);});
+}
+
+/*******************************************************************
+ * Bandwidth API
+ ******************************************************************/
+void ConfigLayer::setBandwidth(const int direction, const size_t channel, const double bw)
+{
+    apply([=](void){_device->setBandwidth(direction, channel, bw);});
+}
+
+/*******************************************************************
+ * Settings API
+ ******************************************************************/
+void ConfigLayer::writeSetting(const std::string &key, const std::string &value)
+{
+    locked([&](void){_device->writeSetting(key, value);});
+}
+
+void ConfigLayer::writeSettingBool(const std::string &key, const bool value)
+{
+    locked([&](void){_device->writeSettingBool(key, value);});
+}
+
+void ConfigLayer::writeSettingInt(const std::string &key, const long long value)
+{
+    locked([&](void){_device->writeSettingInt(key, value);});
+}
+
+void ConfigLayer::writeSettingFloat(const std::string &key, const double value)
+{
+    locked([&](void){_device->writeSettingFloat(key, value);});
+}
+
+void ConfigLayer::writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value)
+{
+    apply([=](void){_device->writeSetting(direction, channel, key, value);});
+}
+
+void ConfigLayer::writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value)
+{
+    apply([=](void){_device->writeSettingBool(direction, channel, key, value);});
+}
+
+void ConfigLayer::writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value)
+{
+    apply([=](void){_device->writeSettingInt(direction, channel, key, value);});
+}
+
+void ConfigLayer::writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value)
+{
+    apply([=](void){_device->writeSettingFloat(direction, channel, key, value);});
+}
+
+/*******************************************************************
+ * GPIO API
+ ******************************************************************/
+void ConfigLayer::writeGPIO(const std::string &bank, const unsigned value)
+{
+    locked([&](void){_device->writeGPIO(bank, value);});
+}
+
+void ConfigLayer::writeGPIO(const std::string &bank, const unsigned value, const unsigned mask)
+{
+    locked([&](void){_device->writeGPIO(bank, value, mask);});
+}
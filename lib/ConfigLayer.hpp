@@ -0,0 +1,184 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include "DeviceDecorator.hpp"
+#include "CommandScheduler.hpp"
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <map>
+
+/*!
+ * ConfigLayer implements configuration transactions
+ * and frequency hop tables for every driver.
+ * The factory places it around every device.
+ *
+ * Between beginConfig() and commitConfig(), the configuration setters
+ * of the calling thread are queued rather than called. Each thread has
+ * its own transaction, and the setters of other threads are not queued. On commit, the queued calls are replayed
+ * in order inside a driver transaction, so drivers which overload the
+ * transaction calls can coalesce them, and drivers which do not simply
+ * apply them one by one. When a commit time is given, the command time
+ * is set with setHardwareTime(timeNs, "CMD") around the replayed calls,
+ * and drivers without hasHardwareTime("CMD") cannot commit with a time.
+ * Getters and global settings are not queued, and getters report
+ * the state before the commit. Setters made outside of a transaction
+ * wait for any command time window to close, so that they are never
+ * applied at the time of a commit, hop, or scheduled command.
+ *
+ * Hop tables are passed to the driver when it implements them,
+ * and the driver is given the time of each timed hop.
+ * Otherwise the layer remembers the component frequencies which
+ * each hop has tuned, and the components last tuned by hops,
+ * so that a repeated hop only sets the components which change.
+ * Any other frequency setter forgets the tuned components.
+ * Only untimed hops are measured, since the readback of
+ * a timed hop is not valid until the command time.
+ *
+ * Timed commands are offered to the driver first, and the commands
+ * which it does not accept are applied by a CommandScheduler,
+ * with the command time set like a timed commit when the driver
+ * supports command times, otherwise untimed at the command time.
+ *
+ * Arguments handled by the layer:
+ *  - command_lead: the time in microseconds before its time
+ *    that the scheduler applies a command (default 2000)
+ */
+class ConfigLayer : public DeviceDecorator
+{
+public:
+    ConfigLayer(SoapySDR::Device *device, const SoapySDR::Kwargs &args);
+
+    /*******************************************************************
+     * Configuration transaction API
+     ******************************************************************/
+    void beginConfig(void);
+    void commitConfig(const long long timeNs);
+    void cancelConfig(void);
+
+    /*******************************************************************
+     * Timed command API
+     ******************************************************************/
+    size_t queueCommands(const SoapySDR::TimedCommandList &commands);
+    void clearCommands(void);
+    SoapySDR::CommandQueueStats getCommandQueueStats(void) const;
+
+    /*******************************************************************
+     * Antenna API
+     ******************************************************************/
+    void setAntenna(const int direction, const size_t channel, const std::string &name);
+
+    /*******************************************************************
+     * Frontend corrections API
+     ******************************************************************/
+    void setDCOffsetMode(const int direction, const size_t channel, const bool automatic);
+    void setDCOffset(const int direction, const size_t channel, const std::complex<double> &offset);
+    void setIQBalance(const int direction, const size_t channel, const std::complex<double> &balance);
+    void setIQBalanceMode(const int direction, const size_t channel, const bool automatic);
+    void setFrequencyCorrection(const int direction, const size_t channel, const double value);
+
+    /*******************************************************************
+     * Gain API
+     ******************************************************************/
+    void setGainMode(const int direction, const size_t channel, const bool automatic);
+    void setGain(const int direction, const size_t channel, const double value);
+    void setGain(const int direction, const size_t channel, const std::string &name, const double value);
+
+    /*******************************************************************
+     * Frequency API
+     ******************************************************************/
+    void setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args);
+    void setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args);
+
+    /*******************************************************************
+     * Frequency hopping API
+     ******************************************************************/
+    SoapySDR::HopTable *prepareFrequencies(const int direction, const size_t channel, const std::vector<double> &frequencies, const SoapySDR::Kwargs &args);
+    void applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs);
+    void closeHopTable(SoapySDR::HopTable *table);
+
+    /*******************************************************************
+     * Sample Rate API
+     ******************************************************************/
+    void setSampleRate(const int direction, const size_t channel, const double rate);
+
+    /*******************************************************************
+     * Bandwidth API
+     ******************************************************************/
+    void setBandwidth(const int direction, const size_t channel, const double bw);
+
+    /*******************************************************************
+     * Settings API
+     ******************************************************************/
+    void writeSetting(const std::string &key, const std::string &value);
+    void writeSettingBool(const std::string &key, const bool value);
+    void writeSettingInt(const std::string &key, const long long value);
+    void writeSettingFloat(const std::string &key, const double value);
+    void writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value);
+    void writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value);
+    void writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value);
+    void writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value);
+
+    /*******************************************************************
+     * GPIO API
+     ******************************************************************/
+    void writeGPIO(const std::string &bank, const unsigned value);
+    void writeGPIO(const std::string &bank, const unsigned value, const unsigned mask);
+
+private:
+    //queue the call during a transaction, otherwise make it now
+    void apply(const std::function<void(void)> &call);
+
+    //make the call now, outside of any command time window
+    void locked(const std::function<void(void)> &call);
+
+    //serializes the command time windows with the untimed setters,
+    //so that a setter is never applied at the time of another command
+    std::mutex _commandMutex;
+
+    //the queued calls of each thread in a transaction
+    typedef std::vector<std::function<void(void)>> CallQueue;
+    std::mutex _mutex;
+    std::map<std::thread::id, CallQueue> _transactions;
+
+    //the queue of the calling thread, or null outside of a transaction
+    CallQueue *transaction(void);
+
+    typedef std::vector<std::pair<std::string, double>> ComponentList;
+
+    struct LayerHopTable
+    {
+        int direction;
+        size_t channel;
+        std::vector<double> frequencies;
+        SoapySDR::Kwargs args;
+        SoapySDR::HopTable *driverTable;
+        std::vector<std::string> components;
+        //the tuned components of each hop, empty until measured
+        std::vector<ComponentList> splits;
+    };
+
+    //tune to a hop, measuring its components when allowed
+    void hop(LayerHopTable *table, const size_t index, const bool measure);
+
+    //forget the components tuned by hops after other frequency changes
+    void forgetTuned(void);
+
+    std::mutex _hopMutex;
+    std::pair<int, size_t> _tunedChannel;
+    std::map<std::string, double> _tuned;
+
+    //make the calls with the command time set, or now when the time is negative
+    void withCommandTime(const long long timeNs, const std::function<void(void)> &calls);
+
+    //apply a scheduled command with the command time set
+    void applyCommand(const SoapySDR::TimedCommand &command);
+
+    //the scheduler is last so that its thread stops first
+    std::atomic<unsigned long long> _numOffloaded;
+    std::unique_ptr<CommandScheduler> _commands;
+};
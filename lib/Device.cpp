@@ -3,9 +3,14 @@
 //                    2019 Nicholas Corgan
 // SPDX-License-Identifier: BSL-1.0
 
+#include "GainPlan.hpp"
 #include <SoapySDR/Device.hpp>
 #include <SoapySDR/Formats.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Time.hpp>
 #include <cstdlib>
+#include <cstring> //memmove
+#include <map>
 #include <algorithm> //min/max/find
 
 SoapySDR::Device::~Device(void)
@@ -123,6 +128,121 @@ int SoapySDR::Device::readStreamStatus(Stream *, size_t &, int &, long long &, c
     return SOAPY_SDR_NOT_SUPPORTED;
 }
 
+static int captureFromStream(
+    SoapySDR::Device &device,
+    SoapySDR::Stream *stream,
+    const SoapySDR::ConverterRegistry::ConverterFunction convert,
+    const size_t srcElemSize,
+    const size_t dstElemSize,
+    const size_t numChans,
+    const double sampleRate,
+    const long long timeNs,
+    const size_t numElems,
+    void * const *buffs,
+    const long timeoutUs)
+{
+    //request a finite burst, fall back to a continuous stream trimmed below
+    const int activateFlags = SOAPY_SDR_END_BURST | ((timeNs >= 0)?SOAPY_SDR_HAS_TIME:0);
+    int ret = device.activateStream(stream, activateFlags, timeNs, numElems);
+    if (ret == SOAPY_SDR_NOT_SUPPORTED) ret = device.activateStream(stream);
+    if (ret != 0) return ret;
+
+    //the first read also waits for the capture time to arrive
+    long waitUs = timeoutUs;
+    if (timeNs >= 0 and device.hasHardwareTime()) waitUs += long(std::max<long long>(timeNs - device.getHardwareTime(), 0)/1000);
+
+    bool started = false;
+    size_t total = 0;
+    std::vector<const void *> src(numChans);
+    std::vector<void *> dst(numChans);
+    while (total < numElems)
+    {
+        int flags(0);
+        long long bufTimeNs(0);
+        size_t handle(0);
+        if (convert != nullptr) ret = device.acquireReadBuffer(stream, handle, src.data(), flags, bufTimeNs, waitUs);
+        else
+        {
+            for (size_t i = 0; i < numChans; i++) dst[i] = reinterpret_cast<char *>(buffs[i]) + total*dstElemSize;
+            ret = device.readStream(stream, dst.data(), numElems-total, flags, bufTimeNs, waitUs);
+        }
+        if (ret < 0) break;
+        waitUs = timeoutUs;
+
+        //drop the samples before the requested time when the driver did not time the burst
+        size_t n = size_t(ret);
+        size_t skip = 0;
+        if (not started and timeNs >= 0 and (flags & SOAPY_SDR_HAS_TIME) != 0 and sampleRate > 0.0)
+        {
+            const long long ticks = SoapySDR::timeNsToTicks(timeNs - bufTimeNs, sampleRate);
+            skip = size_t(std::min<long long>(std::max<long long>(ticks, 0), n));
+        }
+        if (not started) started = skip < n;
+        n = std::min(n-skip, numElems-total);
+
+        for (size_t i = 0; i < numChans; i++)
+        {
+            char *out = reinterpret_cast<char *>(buffs[i]) + total*dstElemSize;
+            if (convert != nullptr) convert(reinterpret_cast<const char *>(src[i]) + skip*srcElemSize, out, n, 1.0);
+            else if (skip != 0) std::memmove(out, out + skip*dstElemSize, n*dstElemSize);
+        }
+        if (convert != nullptr) device.releaseReadBuffer(stream, handle);
+
+        total += n;
+        if ((flags & SOAPY_SDR_END_BURST) != 0) break;
+    }
+
+    device.deactivateStream(stream);
+    if (ret < 0) return ret;
+    return int(total);
+}
+
+int SoapySDR::Device::captureSamples(const int direction, const std::vector<size_t> &channels, const std::string &format, const long long timeNs, const size_t numElems, void * const *buffs, const long timeoutUs)
+{
+    if (direction != SOAPY_SDR_RX) return SOAPY_SDR_NOT_SUPPORTED;
+    const std::vector<size_t> chans(channels.empty()?std::vector<size_t>(1, 0):channels);
+
+    //prefer the native format with direct buffer access when a converter is available
+    double fullScale(0.0);
+    const auto nativeFormat = this->getNativeStreamFormat(direction, chans.front(), fullScale);
+    const auto formats = this->getStreamFormats(direction, chans.front());
+    const auto targets = ConverterRegistry::listTargetFormats(nativeFormat);
+    ConverterRegistry::ConverterFunction convert(nullptr);
+    if (std::find(formats.begin(), formats.end(), nativeFormat) != formats.end() and
+        std::find(targets.begin(), targets.end(), format) != targets.end())
+    {
+        convert = ConverterRegistry::getFunction(nativeFormat, format);
+    }
+
+    Stream *stream(nullptr);
+    if (convert != nullptr)
+    {
+        stream = this->setupStream(direction, nativeFormat, chans);
+        if (stream != nullptr and this->getNumDirectAccessBuffers(stream) == 0)
+        {
+            this->closeStream(stream);
+            stream = nullptr;
+        }
+        if (stream == nullptr) convert = nullptr;
+    }
+
+    //otherwise the driver reads and converts directly into the caller's buffers
+    if (stream == nullptr) stream = this->setupStream(direction, format, chans);
+    if (stream == nullptr) return SOAPY_SDR_NOT_SUPPORTED;
+
+    const int ret = captureFromStream(*this, stream, convert,
+        formatToSize(nativeFormat), formatToSize(format), chans.size(),
+        this->getSampleRate(direction, chans.front()),
+        timeNs, numElems, buffs, timeoutUs);
+    this->closeStream(stream);
+    return ret;
+}
+
+SoapySDR::StreamStats SoapySDR::Device::getStreamStats(Stream *) const
+{
+    return SoapySDR::StreamStats();
+}
+
 /*******************************************************************
  * Direct buffer access API
  ******************************************************************/
@@ -156,6 +276,57 @@ void SoapySDR::Device::releaseWriteBuffer(Stream *, const size_t, const size_t,
     return;
 }
 
+/*******************************************************************
+ * Stream tap API
+ ******************************************************************/
+SoapySDR::StreamTap *SoapySDR::Device::setupStreamTap(Stream *, const Kwargs &)
+{
+    return nullptr;
+}
+
+void SoapySDR::Device::closeStreamTap(StreamTap *)
+{
+    return;
+}
+
+int SoapySDR::Device::readStreamTap(StreamTap *, void * const *, const size_t, int &, long long &, const long)
+{
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+int SoapySDR::Device::acquireTapBuffer(StreamTap *, size_t &, const void **, int &, long long &, const long)
+{
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+void SoapySDR::Device::releaseTapBuffer(StreamTap *, const size_t)
+{
+    return;
+}
+
+unsigned long long SoapySDR::Device::getStreamTapDrops(StreamTap *) const
+{
+    return 0;
+}
+
+/*******************************************************************
+ * Sweep API
+ ******************************************************************/
+SoapySDR::Sweep *SoapySDR::Device::setupSweep(const int, const size_t, const std::string &, const std::vector<double> &, const size_t, const long long, const Kwargs &)
+{
+    return nullptr;
+}
+
+void SoapySDR::Device::closeSweep(Sweep *)
+{
+    return;
+}
+
+int SoapySDR::Device::readSweep(Sweep *, void *, int &, double &, long long &, const long)
+{
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
 /*******************************************************************
  * Antenna API
  ******************************************************************/
@@ -292,12 +463,13 @@ bool SoapySDR::Device::getGainMode(const int, const size_t) const
 void SoapySDR::Device::setGain(const int dir, const size_t channel, double gain)
 {
     //algorithm to distribute overall gain (TX gets BB first, RX gets RF first)
-    const auto names = this->listGains(dir, channel);
+    const auto plan = GainPlan::get(*this, dir, channel);
+    const auto &names = plan->names;
     if (dir == SOAPY_SDR_TX)
     {
         for (int i = names.size()-1; i >= 0; i--)
         {
-            const auto r = this->getGainRange(dir, channel, names[i]);
+            const auto &r = plan->ranges[i];
             const double g = std::min(gain, r.maximum()-r.minimum());
             this->setGain(dir, channel, names[i], g+r.minimum());
             gain -= this->getGain(dir, channel, names[i])-r.minimum();
@@ -307,7 +479,7 @@ void SoapySDR::Device::setGain(const int dir, const size_t channel, double gain)
     {
         for (size_t i = 0; i < names.size(); i++)
         {
-            const auto r = this->getGainRange(dir, channel, names[i]);
+            const auto &r = plan->ranges[i];
             const double g = std::min(gain, r.maximum()-r.minimum());
             this->setGain(dir, channel, names[i], g+r.minimum());
             gain -= this->getGain(dir, channel, names[i])-r.minimum();
@@ -323,11 +495,11 @@ void SoapySDR::Device::setGain(const int, const size_t, const std::string &, con
 double SoapySDR::Device::getGain(const int dir, const size_t channel) const
 {
     //algorithm to return an overall gain (summing each normalized gain)
+    const auto plan = GainPlan::get(*this, dir, channel);
     double gain = 0.0;
-    for (const auto &name : this->listGains(dir, channel))
+    for (size_t i = 0; i < plan->names.size(); i++)
     {
-        const auto r = this->getGainRange(dir, channel, name);
-        gain += this->getGain(dir, channel, name)-r.minimum();
+        gain += this->getGain(dir, channel, plan->names[i])-plan->ranges[i].minimum();
     }
     return gain;
 }
@@ -345,15 +517,20 @@ SoapySDR::Range SoapySDR::Device::getGainRange(const int, const size_t, const st
 SoapySDR::Range SoapySDR::Device::getGainRange(const int dir, const size_t channel) const
 {
     //algorithm to return an overall gain range (use 0 to max possible on each element)
+    const auto plan = GainPlan::get(*this, dir, channel);
     double gain = 0.0;
-    for (const auto &name : this->listGains(dir, channel))
+    for (const auto &r : plan->ranges)
     {
-        const auto r = this->getGainRange(dir, channel, name);
         gain += r.maximum()-r.minimum();
     }
     return SoapySDR::Range(0.0, gain);
 }
 
+SoapySDR::GainTable SoapySDR::Device::getGainTable(const int, const size_t) const
+{
+    return SoapySDR::GainTable();
+}
+
 /*******************************************************************
  * Frequency API
  ******************************************************************/
@@ -510,6 +687,24 @@ SoapySDR::ArgInfoList SoapySDR::Device::getFrequencyArgsInfo(const int dir, cons
     return args;
 }
 
+/*******************************************************************
+ * Frequency hopping API
+ ******************************************************************/
+SoapySDR::HopTable *SoapySDR::Device::prepareFrequencies(const int, const size_t, const std::vector<double> &, const Kwargs &)
+{
+    return nullptr;
+}
+
+void SoapySDR::Device::applyHop(HopTable *, const size_t, const long long)
+{
+    return;
+}
+
+void SoapySDR::Device::closeHopTable(HopTable *)
+{
+    return;
+}
+
 /*******************************************************************
  * Sample Rate API
  ******************************************************************/
@@ -655,6 +850,42 @@ void SoapySDR::Device::setCommandTime(const long long, const std::string &)
     return;
 }
 
+/*******************************************************************
+ * Configuration transaction API
+ ******************************************************************/
+void SoapySDR::Device::beginConfig(void)
+{
+    return;
+}
+
+void SoapySDR::Device::commitConfig(const long long)
+{
+    return;
+}
+
+void SoapySDR::Device::cancelConfig(void)
+{
+    return;
+}
+
+/*******************************************************************
+ * Timed command API
+ ******************************************************************/
+size_t SoapySDR::Device::queueCommands(const TimedCommandList &)
+{
+    return 0;
+}
+
+void SoapySDR::Device::clearCommands(void)
+{
+    return;
+}
+
+SoapySDR::CommandQueueStats SoapySDR::Device::getCommandQueueStats(void) const
+{
+    return SoapySDR::CommandQueueStats();
+}
+
 /*******************************************************************
  * Sensor API
  ******************************************************************/
@@ -673,6 +904,21 @@ std::string SoapySDR::Device::readSensor(const std::string &) const
     return "";
 }
 
+bool SoapySDR::Device::readSensorBool(const std::string &key) const
+{
+    return SoapySDR::StringToSetting<bool>(this->readSensor(key));
+}
+
+long long SoapySDR::Device::readSensorInt(const std::string &key) const
+{
+    return SoapySDR::StringToSetting<long long>(this->readSensor(key));
+}
+
+double SoapySDR::Device::readSensorFloat(const std::string &key) const
+{
+    return SoapySDR::StringToSetting<double>(this->readSensor(key));
+}
+
 std::vector<std::string> SoapySDR::Device::listSensors(const int, const size_t) const
 {
     return std::vector<std::string>();
@@ -688,6 +934,21 @@ std::string SoapySDR::Device::readSensor(const int, const size_t, const std::str
     return "";
 }
 
+bool SoapySDR::Device::readSensorBool(const int direction, const size_t channel, const std::string &key) const
+{
+    return SoapySDR::StringToSetting<bool>(this->readSensor(direction, channel, key));
+}
+
+long long SoapySDR::Device::readSensorInt(const int direction, const size_t channel, const std::string &key) const
+{
+    return SoapySDR::StringToSetting<long long>(this->readSensor(direction, channel, key));
+}
+
+double SoapySDR::Device::readSensorFloat(const int direction, const size_t channel, const std::string &key) const
+{
+    return SoapySDR::StringToSetting<double>(this->readSensor(direction, channel, key));
+}
+
 /*******************************************************************
  * Register API
  ******************************************************************/
@@ -726,6 +987,42 @@ std::vector<unsigned> SoapySDR::Device::readRegisters(const std::string &, const
     return std::vector<unsigned>(length, 0);
 }
 
+std::vector<unsigned> SoapySDR::Device::transactRegisters(const std::string &name, const std::vector<RegisterOp> &ops)
+{
+    //register values known from earlier operations in this batch
+    std::map<unsigned, unsigned> known;
+
+    std::vector<unsigned> results;
+    results.reserve(ops.size());
+    for (const auto &op : ops)
+    {
+        if (op.read)
+        {
+            const auto value = this->readRegister(name, op.addr);
+            known[op.addr] = value;
+            results.push_back(value & op.mask);
+            continue;
+        }
+
+        auto value = op.value;
+        if (op.mask != ~0u)
+        {
+            const auto it = known.find(op.addr);
+            const auto old = (it == known.end())?this->readRegister(name, op.addr):it->second;
+            value = (old & ~op.mask) | (op.value & op.mask);
+        }
+        this->writeRegister(name, op.addr, value);
+        known[op.addr] = value;
+        results.push_back(value);
+    }
+    return results;
+}
+
+std::future<std::vector<unsigned>> SoapySDR::Device::transactRegistersAsync(const std::string &name, const std::vector<RegisterOp> &ops)
+{
+    return std::async(std::launch::async, [this, name, ops](void){return this->transactRegisters(name, ops);});
+}
+
 /*******************************************************************
  * Settings API
  ******************************************************************/
@@ -758,6 +1055,36 @@ std::string SoapySDR::Device::readSetting(const std::string &) const
     return "";
 }
 
+void SoapySDR::Device::writeSettingBool(const std::string &key, const bool value)
+{
+    this->writeSetting(key, SoapySDR::SettingToString(value));
+}
+
+void SoapySDR::Device::writeSettingInt(const std::string &key, const long long value)
+{
+    this->writeSetting(key, SoapySDR::SettingToString(value));
+}
+
+void SoapySDR::Device::writeSettingFloat(const std::string &key, const double value)
+{
+    this->writeSetting(key, SoapySDR::SettingToString(value));
+}
+
+bool SoapySDR::Device::readSettingBool(const std::string &key) const
+{
+    return SoapySDR::StringToSetting<bool>(this->readSetting(key));
+}
+
+long long SoapySDR::Device::readSettingInt(const std::string &key) const
+{
+    return SoapySDR::StringToSetting<long long>(this->readSetting(key));
+}
+
+double SoapySDR::Device::readSettingFloat(const std::string &key) const
+{
+    return SoapySDR::StringToSetting<double>(this->readSetting(key));
+}
+
 SoapySDR::ArgInfoList SoapySDR::Device::getSettingInfo(const int, const size_t) const
 {
     return SoapySDR::ArgInfoList();
@@ -787,6 +1114,36 @@ std::string SoapySDR::Device::readSetting(const int, const size_t, const std::st
     return "";
 }
 
+void SoapySDR::Device::writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value)
+{
+    this->writeSetting(direction, channel, key, SoapySDR::SettingToString(value));
+}
+
+void SoapySDR::Device::writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value)
+{
+    this->writeSetting(direction, channel, key, SoapySDR::SettingToString(value));
+}
+
+void SoapySDR::Device::writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value)
+{
+    this->writeSetting(direction, channel, key, SoapySDR::SettingToString(value));
+}
+
+bool SoapySDR::Device::readSettingBool(const int direction, const size_t channel, const std::string &key) const
+{
+    return SoapySDR::StringToSetting<bool>(this->readSetting(direction, channel, key));
+}
+
+long long SoapySDR::Device::readSettingInt(const int direction, const size_t channel, const std::string &key) const
+{
+    return SoapySDR::StringToSetting<long long>(this->readSetting(direction, channel, key));
+}
+
+double SoapySDR::Device::readSettingFloat(const int direction, const size_t channel, const std::string &key) const
+{
+    return SoapySDR::StringToSetting<double>(this->readSetting(direction, channel, key));
+}
+
 /*******************************************************************
  * GPIO API
  ******************************************************************/
@@ -845,6 +1202,22 @@ std::string SoapySDR::Device::readI2C(const int, const size_t)
     return "";
 }
 
+std::vector<std::string> SoapySDR::Device::transactI2C(const std::vector<I2CMessage> &messages)
+{
+    std::vector<std::string> results;
+    results.reserve(messages.size());
+    for (const auto &message : messages)
+    {
+        if (message.read) results.push_back(this->readI2C(message.addr, message.numBytes));
+        else
+        {
+            this->writeI2C(message.addr, message.data);
+            results.push_back("");
+        }
+    }
+    return results;
+}
+
 /*******************************************************************
  * SPI API
  ******************************************************************/
@@ -853,6 +1226,14 @@ unsigned SoapySDR::Device::transactSPI(const int, const unsigned, const size_t)
     return 0;
 }
 
+std::vector<unsigned> SoapySDR::Device::transactSPIBatch(const int addr, const std::vector<unsigned> &data, const size_t numBits)
+{
+    std::vector<unsigned> results;
+    results.reserve(data.size());
+    for (const auto word : data) results.push_back(this->transactSPI(addr, word, numBits));
+    return results;
+}
+
 /*******************************************************************
  * UART API
  ******************************************************************/
@@ -220,6 +220,20 @@ int SoapySDRDevice_readStreamStatus(SoapySDRDevice *device, SoapySDRStream *stre
     __SOAPY_SDR_C_CATCH_RET(SOAPY_SDR_STREAM_ERROR);
 }
 
+int SoapySDRDevice_captureSamples(SoapySDRDevice *device, const int direction, const size_t *channels, const size_t numChans, const char *format, const long long timeNs, const size_t numElems, void * const *buffs, const long timeoutUs)
+{
+    __SOAPY_SDR_C_TRY
+    return device->captureSamples(direction, std::vector<size_t>(channels, channels+numChans), format, timeNs, numElems, buffs, timeoutUs);
+    __SOAPY_SDR_C_CATCH_RET(SOAPY_SDR_STREAM_ERROR);
+}
+
+int SoapySDRDevice_getStreamStats(const SoapySDRDevice *device, SoapySDRStream *stream, SoapySDRStreamStats *stats)
+{
+    __SOAPY_SDR_C_TRY
+    *stats = toStreamStats(device->getStreamStats(reinterpret_cast<SoapySDR::Stream *>(stream)));
+    __SOAPY_SDR_C_CATCH
+}
+
 /*******************************************************************
  * Direct buffer access API
  ******************************************************************/
@@ -282,6 +296,84 @@ void SoapySDRDevice_releaseWriteBuffer(SoapySDRDevice *device,
     __SOAPY_SDR_C_CATCH_RET(SoapySDRVoidRet);
 }
 
+/*******************************************************************
+ * Stream tap API
+ ******************************************************************/
+SoapySDRStreamTap *SoapySDRDevice_setupStreamTap(SoapySDRDevice *device, SoapySDRStream *stream, const SoapySDRKwargs *args)
+{
+    __SOAPY_SDR_C_TRY
+    return reinterpret_cast<SoapySDRStreamTap *>(device->setupStreamTap(reinterpret_cast<SoapySDR::Stream *>(stream), toKwargs(args)));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+int SoapySDRDevice_closeStreamTap(SoapySDRDevice *device, SoapySDRStreamTap *tap)
+{
+    __SOAPY_SDR_C_TRY
+    device->closeStreamTap(reinterpret_cast<SoapySDR::StreamTap *>(tap));
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRDevice_readStreamTap(SoapySDRDevice *device, SoapySDRStreamTap *tap, void * const *buffs, const size_t numElems, int *flags, long long *timeNs, const long timeoutUs)
+{
+    __SOAPY_SDR_C_TRY
+    return device->readStreamTap(reinterpret_cast<SoapySDR::StreamTap *>(tap), buffs, numElems, *flags, *timeNs, timeoutUs);
+    __SOAPY_SDR_C_CATCH_RET(SOAPY_SDR_STREAM_ERROR);
+}
+
+int SoapySDRDevice_acquireTapBuffer(SoapySDRDevice *device,
+    SoapySDRStreamTap *tap,
+    size_t *handle,
+    const void **buffs,
+    int *flags,
+    long long *timeNs,
+    const long timeoutUs)
+{
+    __SOAPY_SDR_C_TRY
+    return device->acquireTapBuffer(reinterpret_cast<SoapySDR::StreamTap *>(tap), *handle, buffs, *flags, *timeNs, timeoutUs);
+    __SOAPY_SDR_C_CATCH_RET(SOAPY_SDR_STREAM_ERROR);
+}
+
+void SoapySDRDevice_releaseTapBuffer(SoapySDRDevice *device,
+    SoapySDRStreamTap *tap,
+    const size_t handle)
+{
+    __SOAPY_SDR_C_TRY
+    return device->releaseTapBuffer(reinterpret_cast<SoapySDR::StreamTap *>(tap), handle);
+    __SOAPY_SDR_C_CATCH_RET(SoapySDRVoidRet);
+}
+
+unsigned long long SoapySDRDevice_getStreamTapDrops(const SoapySDRDevice *device, SoapySDRStreamTap *tap)
+{
+    __SOAPY_SDR_C_TRY
+    return device->getStreamTapDrops(reinterpret_cast<SoapySDR::StreamTap *>(tap));
+    __SOAPY_SDR_C_CATCH_RET(0);
+}
+
+/*******************************************************************
+ * Sweep API
+ ******************************************************************/
+SoapySDRSweep *SoapySDRDevice_setupSweep(SoapySDRDevice *device, const int direction, const size_t channel, const char *format, const double *frequencies, const size_t length, const size_t dwellElems, const long long settleNs, const SoapySDRKwargs *args)
+{
+    __SOAPY_SDR_C_TRY
+    const std::vector<double> freqs(frequencies, frequencies + length);
+    return reinterpret_cast<SoapySDRSweep *>(device->setupSweep(direction, channel, format, freqs, dwellElems, settleNs, toKwargs(args)));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+int SoapySDRDevice_closeSweep(SoapySDRDevice *device, SoapySDRSweep *sweep)
+{
+    __SOAPY_SDR_C_TRY
+    device->closeSweep(reinterpret_cast<SoapySDR::Sweep *>(sweep));
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRDevice_readSweep(SoapySDRDevice *device, SoapySDRSweep *sweep, void *buff, int *flags, double *frequency, long long *timeNs, const long timeoutUs)
+{
+    __SOAPY_SDR_C_TRY
+    return device->readSweep(reinterpret_cast<SoapySDR::Sweep *>(sweep), buff, *flags, *frequency, *timeNs, timeoutUs);
+    __SOAPY_SDR_C_CATCH
+}
+
 /*******************************************************************
  * Antenna API
  ******************************************************************/
@@ -493,6 +585,14 @@ SoapySDRRange SoapySDRDevice_getGainElementRange(const SoapySDRDevice *device, c
     __SOAPY_SDR_C_CATCH_RET(SoapySDRRangeNAN);
 }
 
+int SoapySDRDevice_getGainTable(const SoapySDRDevice *device, const int direction, const size_t channel, SoapySDRGainTable *table)
+{
+    std::memset(table, 0, sizeof(*table));
+    __SOAPY_SDR_C_TRY
+    *table = toGainTable(device->getGainTable(direction, channel));
+    __SOAPY_SDR_C_CATCH
+}
+
 /*******************************************************************
  * Frequency API
  ******************************************************************/
@@ -556,6 +656,31 @@ SoapySDRArgInfo *SoapySDRDevice_getFrequencyArgsInfo(const SoapySDRDevice *devic
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+/*******************************************************************
+ * Frequency hopping API
+ ******************************************************************/
+SoapySDRHopTable *SoapySDRDevice_prepareFrequencies(SoapySDRDevice *device, const int direction, const size_t channel, const double *frequencies, const size_t length, const SoapySDRKwargs *args)
+{
+    __SOAPY_SDR_C_TRY
+    const std::vector<double> freqs(frequencies, frequencies + length);
+    return reinterpret_cast<SoapySDRHopTable *>(device->prepareFrequencies(direction, channel, freqs, toKwargs(args)));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+int SoapySDRDevice_applyHop(SoapySDRDevice *device, SoapySDRHopTable *table, const size_t index, const long long timeNs)
+{
+    __SOAPY_SDR_C_TRY
+    device->applyHop(reinterpret_cast<SoapySDR::HopTable *>(table), index, timeNs);
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRDevice_closeHopTable(SoapySDRDevice *device, SoapySDRHopTable *table)
+{
+    __SOAPY_SDR_C_TRY
+    device->closeHopTable(reinterpret_cast<SoapySDR::HopTable *>(table));
+    __SOAPY_SDR_C_CATCH
+}
+
 /*******************************************************************
  * Sample Rate API
  ******************************************************************/
@@ -745,6 +870,70 @@ int SoapySDRDevice_setCommandTime(SoapySDRDevice *device, const long long timeNs
     __SOAPY_SDR_C_CATCH
 }
 
+/*******************************************************************
+ * Configuration transaction API
+ ******************************************************************/
+int SoapySDRDevice_beginConfig(SoapySDRDevice *device)
+{
+    __SOAPY_SDR_C_TRY
+    device->beginConfig();
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRDevice_commitConfig(SoapySDRDevice *device, const long long timeNs)
+{
+    __SOAPY_SDR_C_TRY
+    device->commitConfig(timeNs);
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRDevice_cancelConfig(SoapySDRDevice *device)
+{
+    __SOAPY_SDR_C_TRY
+    device->cancelConfig();
+    __SOAPY_SDR_C_CATCH
+}
+
+/*******************************************************************
+ * Timed command API
+ ******************************************************************/
+int SoapySDRDevice_queueCommands(SoapySDRDevice *device, const SoapySDRTimedCommand *commands, const size_t numCommands)
+{
+    __SOAPY_SDR_C_TRY
+    SoapySDR::TimedCommandList commandList(numCommands);
+    for (size_t i = 0; i < numCommands; i++)
+    {
+        const auto &in = commands[i];
+        auto &out = commandList[i];
+        out.timeNs = in.timeNs;
+        out.type = SoapySDR::TimedCommand::Type(in.type);
+        out.direction = in.direction;
+        out.channel = in.channel;
+        if (in.name != nullptr) out.name = in.name;
+        out.value = in.value;
+        out.args = toKwargs(&in.args);
+        out.gpioValue = in.gpioValue;
+        out.gpioMask = in.gpioMask;
+        if (in.settingValue != nullptr) out.settingValue = in.settingValue;
+    }
+    device->queueCommands(commandList);
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRDevice_clearCommands(SoapySDRDevice *device)
+{
+    __SOAPY_SDR_C_TRY
+    device->clearCommands();
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRDevice_getCommandQueueStats(const SoapySDRDevice *device, SoapySDRCommandQueueStats *stats)
+{
+    __SOAPY_SDR_C_TRY
+    *stats = toCommandQueueStats(device->getCommandQueueStats());
+    __SOAPY_SDR_C_CATCH
+}
+
 /*******************************************************************
  * Sensor API
  ******************************************************************/
@@ -834,6 +1023,19 @@ unsigned *SoapySDRDevice_readRegisters(const SoapySDRDevice *device, const char
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+int SoapySDRDevice_transactRegisters(SoapySDRDevice *device, const char *name, SoapySDRRegisterOp *ops, const size_t numOps)
+{
+    __SOAPY_SDR_C_TRY
+    std::vector<SoapySDR::RegisterOp> opList;
+    for (size_t i = 0; i < numOps; i++)
+    {
+        opList.emplace_back(ops[i].addr, ops[i].value, ops[i].mask, ops[i].read);
+    }
+    const auto results = device->transactRegisters(name, opList);
+    for (size_t i = 0; i < numOps and i < results.size(); i++) ops[i].value = results[i];
+    __SOAPY_SDR_C_CATCH
+}
+
 /*******************************************************************
  * Settings API
  ******************************************************************/
@@ -972,6 +1174,27 @@ char *SoapySDRDevice_readI2C(SoapySDRDevice *device, const int addr, size_t *num
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+int SoapySDRDevice_transactI2C(SoapySDRDevice *device, SoapySDRI2CMessage *messages, const size_t numMessages)
+{
+    __SOAPY_SDR_C_TRY
+    std::vector<SoapySDR::I2CMessage> messageList;
+    for (size_t i = 0; i < numMessages; i++)
+    {
+        const auto &msg = messages[i];
+        if (msg.read) messageList.emplace_back(msg.addr, msg.numBytes);
+        else messageList.emplace_back(msg.addr, std::string(msg.data, msg.numBytes));
+    }
+    const auto results = device->transactI2C(messageList);
+    for (size_t i = 0; i < numMessages and i < results.size(); i++)
+    {
+        auto &msg = messages[i];
+        if (not msg.read) continue;
+        msg.numBytes = std::min(msg.numBytes, results[i].size());
+        std::copy(results[i].begin(), results[i].begin() + msg.numBytes, msg.data);
+    }
+    __SOAPY_SDR_C_CATCH
+}
+
 /*******************************************************************
  * SPI API
  ******************************************************************/
@@ -982,6 +1205,15 @@ unsigned SoapySDRDevice_transactSPI(SoapySDRDevice *device, const int addr, cons
     __SOAPY_SDR_C_CATCH
 }
 
+int SoapySDRDevice_transactSPIBatch(SoapySDRDevice *device, const int addr, const unsigned *data, unsigned *readback, const size_t length, const size_t numBits)
+{
+    __SOAPY_SDR_C_TRY
+    const auto results = device->transactSPIBatch(addr, toNumericVector(data, length), numBits);
+    std::fill(readback, readback + length, 0);
+    std::copy(results.begin(), results.begin() + std::min(length, results.size()), readback);
+    __SOAPY_SDR_C_CATCH
+}
+
 /*******************************************************************
  * UART API
  ******************************************************************/
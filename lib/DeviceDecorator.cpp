@@ -0,0 +1,905 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "DeviceDecorator.hpp"
+
+DeviceDecorator::DeviceDecorator(SoapySDR::Device *device):
+    _device(device)
+{
+    return;
+}
+
+DeviceDecorator::~DeviceDecorator(void)
+{
+    delete _device;
+}
+
+/*******************************************************************
+ * Identification API
+ ******************************************************************/
+std::string DeviceDecorator::getDriverKey(void) const
+{
+    return _device->getDriverKey();
+}
+
+std::string DeviceDecorator::getHardwareKey(void) const
+{
+    return _device->getHardwareKey();
+}
+
+SoapySDR::Kwargs DeviceDecorator::getHardwareInfo(void) const
+{
+    return _device->getHardwareInfo();
+}
+
+/*******************************************************************
+ * Channels API
+ ******************************************************************/
+void DeviceDecorator::setFrontendMapping(const int direction, const std::string &mapping)
+{
+    _device->setFrontendMapping(direction, mapping);
+}
+
+std::string DeviceDecorator::getFrontendMapping(const int direction) const
+{
+    return _device->getFrontendMapping(direction);
+}
+
+size_t DeviceDecorator::getNumChannels(const int direction) const
+{
+    return _device->getNumChannels(direction);
+}
+
+SoapySDR::Kwargs DeviceDecorator::getChannelInfo(const int direction, const size_t channel) const
+{
+    return _device->getChannelInfo(direction, channel);
+}
+
+bool DeviceDecorator::getFullDuplex(const int direction, const size_t channel) const
+{
+    return _device->getFullDuplex(direction, channel);
+}
+
+/*******************************************************************
+ * Stream API
+ ******************************************************************/
+std::vector<std::string> DeviceDecorator::getStreamFormats(const int direction, const size_t channel) const
+{
+    return _device->getStreamFormats(direction, channel);
+}
+
+std::string DeviceDecorator::getNativeStreamFormat(const int direction, const size_t channel, double &fullScale) const
+{
+    return _device->getNativeStreamFormat(direction, channel, fullScale);
+}
+
+SoapySDR::ArgInfoList DeviceDecorator::getStreamArgsInfo(const int direction, const size_t channel) const
+{
+    return _device->getStreamArgsInfo(direction, channel);
+}
+
+SoapySDR::Stream *DeviceDecorator::setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+{
+    return _device->setupStream(direction, format, channels, args);
+}
+
+void DeviceDecorator::closeStream(SoapySDR::Stream *stream)
+{
+    _device->closeStream(stream);
+}
+
+size_t DeviceDecorator::getStreamMTU(SoapySDR::Stream *stream) const
+{
+    return _device->getStreamMTU(stream);
+}
+
+int DeviceDecorator::activateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs, const size_t numElems)
+{
+    return _device->activateStream(stream, flags, timeNs, numElems);
+}
+
+int DeviceDecorator::deactivateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs)
+{
+    return _device->deactivateStream(stream, flags, timeNs);
+}
+
+int DeviceDecorator::readStream(SoapySDR::Stream *stream, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    return _device->readStream(stream, buffs, numElems, flags, timeNs, timeoutUs);
+}
+
+int DeviceDecorator::writeStream(SoapySDR::Stream *stream, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+    return _device->writeStream(stream, buffs, numElems, flags, timeNs, timeoutUs);
+}
+
+int DeviceDecorator::readStreamStatus(SoapySDR::Stream *stream, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+{
+    return _device->readStreamStatus(stream, chanMask, flags, timeNs, timeoutUs);
+}
+
+int DeviceDecorator::captureSamples(const int direction, const std::vector<size_t> &channels, const std::string &format, const long long timeNs, const size_t numElems, void * const *buffs, const long timeoutUs)
+{
+    return _device->captureSamples(direction, channels, format, timeNs, numElems, buffs, timeoutUs);
+}
+
+SoapySDR::StreamStats DeviceDecorator::getStreamStats(SoapySDR::Stream *stream) const
+{
+    return _device->getStreamStats(stream);
+}
+
+/*******************************************************************
+ * Direct buffer access API
+ ******************************************************************/
+size_t DeviceDecorator::getNumDirectAccessBuffers(SoapySDR::Stream *stream)
+{
+    return _device->getNumDirectAccessBuffers(stream);
+}
+
+int DeviceDecorator::getDirectAccessBufferAddrs(SoapySDR::Stream *stream, const size_t handle, void **buffs)
+{
+    return _device->getDirectAccessBufferAddrs(stream, handle, buffs);
+}
+
+int DeviceDecorator::acquireReadBuffer(SoapySDR::Stream *stream, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    return _device->acquireReadBuffer(stream, handle, buffs, flags, timeNs, timeoutUs);
+}
+
+void DeviceDecorator::releaseReadBuffer(SoapySDR::Stream *stream, const size_t handle)
+{
+    _device->releaseReadBuffer(stream, handle);
+}
+
+int DeviceDecorator::acquireWriteBuffer(SoapySDR::Stream *stream, size_t &handle, void **buffs, const long timeoutUs)
+{
+    return _device->acquireWriteBuffer(stream, handle, buffs, timeoutUs);
+}
+
+void DeviceDecorator::releaseWriteBuffer(SoapySDR::Stream *stream, const size_t handle, const size_t numElems, int &flags, const long long timeNs)
+{
+    _device->releaseWriteBuffer(stream, handle, numElems, flags, timeNs);
+}
+
+/*******************************************************************
+ * Stream tap API
+ ******************************************************************/
+SoapySDR::StreamTap *DeviceDecorator::setupStreamTap(SoapySDR::Stream *stream, const SoapySDR::Kwargs &args)
+{
+    return _device->setupStreamTap(stream, args);
+}
+
+void DeviceDecorator::closeStreamTap(SoapySDR::StreamTap *tap)
+{
+    _device->closeStreamTap(tap);
+}
+
+int DeviceDecorator::readStreamTap(SoapySDR::StreamTap *tap, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    return _device->readStreamTap(tap, buffs, numElems, flags, timeNs, timeoutUs);
+}
+
+int DeviceDecorator::acquireTapBuffer(SoapySDR::StreamTap *tap, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    return _device->acquireTapBuffer(tap, handle, buffs, flags, timeNs, timeoutUs);
+}
+
+void DeviceDecorator::releaseTapBuffer(SoapySDR::StreamTap *tap, const size_t handle)
+{
+    _device->releaseTapBuffer(tap, handle);
+}
+
+unsigned long long DeviceDecorator::getStreamTapDrops(SoapySDR::StreamTap *tap) const
+{
+    return _device->getStreamTapDrops(tap);
+}
+
+/*******************************************************************
+ * Sweep API
+ ******************************************************************/
+SoapySDR::Sweep *DeviceDecorator::setupSweep(const int direction, const size_t channel, const std::string &format, const std::vector<double> &frequencies, const size_t dwellElems, const long long settleNs, const SoapySDR::Kwargs &args)
+{
+    return _device->setupSweep(direction, channel, format, frequencies, dwellElems, settleNs, args);
+}
+
+void DeviceDecorator::closeSweep(SoapySDR::Sweep *sweep)
+{
+    _device->closeSweep(sweep);
+}
+
+int DeviceDecorator::readSweep(SoapySDR::Sweep *sweep, void *buff, int &flags, double &frequency, long long &timeNs, const long timeoutUs)
+{
+    return _device->readSweep(sweep, buff, flags, frequency, timeNs, timeoutUs);
+}
+
+/*******************************************************************
+ * Antenna API
+ ******************************************************************/
+std::vector<std::string> DeviceDecorator::listAntennas(const int direction, const size_t channel) const
+{
+    return _device->listAntennas(direction, channel);
+}
+
+void DeviceDecorator::setAntenna(const int direction, const size_t channel, const std::string &name)
+{
+    _device->setAntenna(direction, channel, name);
+}
+
+std::string DeviceDecorator::getAntenna(const int direction, const size_t channel) const
+{
+    return _device->getAntenna(direction, channel);
+}
+
+/*******************************************************************
+ * Frontend corrections API
+ ******************************************************************/
+bool DeviceDecorator::hasDCOffsetMode(const int direction, const size_t channel) const
+{
+    return _device->hasDCOffsetMode(direction, channel);
+}
+
+void DeviceDecorator::setDCOffsetMode(const int direction, const size_t channel, const bool automatic)
+{
+    _device->setDCOffsetMode(direction, channel, automatic);
+}
+
+bool DeviceDecorator::getDCOffsetMode(const int direction, const size_t channel) const
+{
+    return _device->getDCOffsetMode(direction, channel);
+}
+
+bool DeviceDecorator::hasDCOffset(const int direction, const size_t channel) const
+{
+    return _device->hasDCOffset(direction, channel);
+}
+
+void DeviceDecorator::setDCOffset(const int direction, const size_t channel, const std::complex<double> &offset)
+{
+    _device->setDCOffset(direction, channel, offset);
+}
+
+std::complex<double> DeviceDecorator::getDCOffset(const int direction, const size_t channel) const
+{
+    return _device->getDCOffset(direction, channel);
+}
+
+bool DeviceDecorator::hasIQBalance(const int direction, const size_t channel) const
+{
+    return _device->hasIQBalance(direction, channel);
+}
+
+void DeviceDecorator::setIQBalance(const int direction, const size_t channel, const std::complex<double> &balance)
+{
+    _device->setIQBalance(direction, channel, balance);
+}
+
+std::complex<double> DeviceDecorator::getIQBalance(const int direction, const size_t channel) const
+{
+    return _device->getIQBalance(direction, channel);
+}
+
+bool DeviceDecorator::hasIQBalanceMode(const int direction, const size_t channel) const
+{
+    return _device->hasIQBalanceMode(direction, channel);
+}
+
+void DeviceDecorator::setIQBalanceMode(const int direction, const size_t channel, const bool automatic)
+{
+    _device->setIQBalanceMode(direction, channel, automatic);
+}
+
+bool DeviceDecorator::getIQBalanceMode(const int direction, const size_t channel) const
+{
+    return _device->getIQBalanceMode(direction, channel);
+}
+
+bool DeviceDecorator::hasFrequencyCorrection(const int direction, const size_t channel) const
+{
+    return _device->hasFrequencyCorrection(direction, channel);
+}
+
+void DeviceDecorator::setFrequencyCorrection(const int direction, const size_t channel, const double value)
+{
+    _device->setFrequencyCorrection(direction, channel, value);
+}
+
+double DeviceDecorator::getFrequencyCorrection(const int direction, const size_t channel) const
+{
+    return _device->getFrequencyCorrection(direction, channel);
+}
+
+/*******************************************************************
+ * Gain API
+ ******************************************************************/
+std::vector<std::string> DeviceDecorator::listGains(const int direction, const size_t channel) const
+{
+    return _device->listGains(direction, channel);
+}
+
+bool DeviceDecorator::hasGainMode(const int direction, const size_t channel) const
+{
+    return _device->hasGainMode(direction, channel);
+}
+
+void DeviceDecorator::setGainMode(const int direction, const size_t channel, const bool automatic)
+{
+    _device->setGainMode(direction, channel, automatic);
+}
+
+bool DeviceDecorator::getGainMode(const int direction, const size_t channel) const
+{
+    return _device->getGainMode(direction, channel);
+}
+
+void DeviceDecorator::setGain(const int direction, const size_t channel, const double value)
+{
+    _device->setGain(direction, channel, value);
+}
+
+void DeviceDecorator::setGain(const int direction, const size_t channel, const std::string &name, const double value)
+{
+    _device->setGain(direction, channel, name, value);
+}
+
+double DeviceDecorator::getGain(const int direction, const size_t channel) const
+{
+    return _device->getGain(direction, channel);
+}
+
+double DeviceDecorator::getGain(const int direction, const size_t channel, const std::string &name) const
+{
+    return _device->getGain(direction, channel, name);
+}
+
+SoapySDR::Range DeviceDecorator::getGainRange(const int direction, const size_t channel) const
+{
+    return _device->getGainRange(direction, channel);
+}
+
+SoapySDR::Range DeviceDecorator::getGainRange(const int direction, const size_t channel, const std::string &name) const
+{
+    return _device->getGainRange(direction, channel, name);
+}
+
+SoapySDR::GainTable DeviceDecorator::getGainTable(const int direction, const size_t channel) const
+{
+    return _device->getGainTable(direction, channel);
+}
+
+/*******************************************************************
+ * Frequency API
+ ******************************************************************/
+void DeviceDecorator::setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args)
+{
+    _device->setFrequency(direction, channel, frequency, args);
+}
+
+void DeviceDecorator::setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args)
+{
+    _device->setFrequency(direction, channel, name, frequency, args);
+}
+
+double DeviceDecorator::getFrequency(const int direction, const size_t channel) const
+{
+    return _device->getFrequency(direction, channel);
+}
+
+double DeviceDecorator::getFrequency(const int direction, const size_t channel, const std::string &name) const
+{
+    return _device->getFrequency(direction, channel, name);
+}
+
+std::vector<std::string> DeviceDecorator::listFrequencies(const int direction, const size_t channel) const
+{
+    return _device->listFrequencies(direction, channel);
+}
+
+SoapySDR::RangeList DeviceDecorator::getFrequencyRange(const int direction, const size_t channel) const
+{
+    return _device->getFrequencyRange(direction, channel);
+}
+
+SoapySDR::RangeList DeviceDecorator::getFrequencyRange(const int direction, const size_t channel, const std::string &name) const
+{
+    return _device->getFrequencyRange(direction, channel, name);
+}
+
+SoapySDR::ArgInfoList DeviceDecorator::getFrequencyArgsInfo(const int direction, const size_t channel) const
+{
+    return _device->getFrequencyArgsInfo(direction, channel);
+}
+
+/*******************************************************************
+ * Frequency hopping API
+ ******************************************************************/
+SoapySDR::HopTable *DeviceDecorator::prepareFrequencies(const int direction, const size_t channel, const std::vector<double> &frequencies, const SoapySDR::Kwargs &args)
+{
+    return _device->prepareFrequencies(direction, channel, frequencies, args);
+}
+
+void DeviceDecorator::applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs)
+{
+    _device->applyHop(table, index, timeNs);
+}
+
+void DeviceDecorator::closeHopTable(SoapySDR::HopTable *table)
+{
+    _device->closeHopTable(table);
+}
+
+/*******************************************************************
+ * Sample Rate API
+ ******************************************************************/
+void DeviceDecorator::setSampleRate(const int direction, const size_t channel, const double rate)
+{
+    _device->setSampleRate(direction, channel, rate);
+}
+
+double DeviceDecorator::getSampleRate(const int direction, const size_t channel) const
+{
+    return _device->getSampleRate(direction, channel);
+}
+
+std::vector<double> DeviceDecorator::listSampleRates(const int direction, const size_t channel) const
+{
+    return _device->listSampleRates(direction, channel);
+}
+
+SoapySDR::RangeList DeviceDecorator::getSampleRateRange(const int direction, const size_t channel) const
+{
+    return _device->getSampleRateRange(direction, channel);
+}
+
+/*******************************************************************
+ * Bandwidth API
+ ******************************************************************/
+void DeviceDecorator::setBandwidth(const int direction, const size_t channel, const double bw)
+{
+    _device->setBandwidth(direction, channel, bw);
+}
+
+double DeviceDecorator::getBandwidth(const int direction, const size_t channel) const
+{
+    return _device->getBandwidth(direction, channel);
+}
+
+std::vector<double> DeviceDecorator::listBandwidths(const int direction, const size_t channel) const
+{
+    return _device->listBandwidths(direction, channel);
+}
+
+SoapySDR::RangeList DeviceDecorator::getBandwidthRange(const int direction, const size_t channel) const
+{
+    return _device->getBandwidthRange(direction, channel);
+}
+
+/*******************************************************************
+ * Clocking API
+ ******************************************************************/
+void DeviceDecorator::setMasterClockRate(const double rate)
+{
+    _device->setMasterClockRate(rate);
+}
+
+double DeviceDecorator::getMasterClockRate(void) const
+{
+    return _device->getMasterClockRate();
+}
+
+SoapySDR::RangeList DeviceDecorator::getMasterClockRates(void) const
+{
+    return _device->getMasterClockRates();
+}
+
+void DeviceDecorator::setReferenceClockRate(const double rate)
+{
+    _device->setReferenceClockRate(rate);
+}
+
+double DeviceDecorator::getReferenceClockRate(void) const
+{
+    return _device->getReferenceClockRate();
+}
+
+SoapySDR::RangeList DeviceDecorator::getReferenceClockRates(void) const
+{
+    return _device->getReferenceClockRates();
+}
+
+std::vector<std::string> DeviceDecorator::listClockSources(void) const
+{
+    return _device->listClockSources();
+}
+
+void DeviceDecorator::setClockSource(const std::string &source)
+{
+    _device->setClockSource(source);
+}
+
+std::string DeviceDecorator::getClockSource(void) const
+{
+    return _device->getClockSource();
+}
+
+/*******************************************************************
+ * Time API
+ ******************************************************************/
+std::vector<std::string> DeviceDecorator::listTimeSources(void) const
+{
+    return _device->listTimeSources();
+}
+
+void DeviceDecorator::setTimeSource(const std::string &source)
+{
+    _device->setTimeSource(source);
+}
+
+std::string DeviceDecorator::getTimeSource(void) const
+{
+    return _device->getTimeSource();
+}
+
+bool DeviceDecorator::hasHardwareTime(const std::string &what) const
+{
+    return _device->hasHardwareTime(what);
+}
+
+long long DeviceDecorator::getHardwareTime(const std::string &what) const
+{
+    return _device->getHardwareTime(what);
+}
+
+void DeviceDecorator::setHardwareTime(const long long timeNs, const std::string &what)
+{
+    _device->setHardwareTime(timeNs, what);
+}
+
+void DeviceDecorator::setCommandTime(const long long timeNs, const std::string &what)
+{
+    _device->setCommandTime(timeNs, what);
+}
+
+/*******************************************************************
+ * Configuration transaction API
+ ******************************************************************/
+void DeviceDecorator::beginConfig(void)
+{
+    _device->beginConfig();
+}
+
+void DeviceDecorator::commitConfig(const long long timeNs)
+{
+    _device->commitConfig(timeNs);
+}
+
+void DeviceDecorator::cancelConfig(void)
+{
+    _device->cancelConfig();
+}
+
+/*******************************************************************
+ * Timed command API
+ ******************************************************************/
+size_t DeviceDecorator::queueCommands(const SoapySDR::TimedCommandList &commands)
+{
+    return _device->queueCommands(commands);
+}
+
+void DeviceDecorator::clearCommands(void)
+{
+    _device->clearCommands();
+}
+
+SoapySDR::CommandQueueStats DeviceDecorator::getCommandQueueStats(void) const
+{
+    return _device->getCommandQueueStats();
+}
+
+/*******************************************************************
+ * Sensor API
+ ******************************************************************/
+std::vector<std::string> DeviceDecorator::listSensors(void) const
+{
+    return _device->listSensors();
+}
+
+SoapySDR::ArgInfo DeviceDecorator::getSensorInfo(const std::string &key) const
+{
+    return _device->getSensorInfo(key);
+}
+
+std::string DeviceDecorator::readSensor(const std::string &key) const
+{
+    return _device->readSensor(key);
+}
+
+bool DeviceDecorator::readSensorBool(const std::string &key) const
+{
+    return _device->readSensorBool(key);
+}
+
+long long DeviceDecorator::readSensorInt(const std::string &key) const
+{
+    return _device->readSensorInt(key);
+}
+
+double DeviceDecorator::readSensorFloat(const std::string &key) const
+{
+    return _device->readSensorFloat(key);
+}
+
+std::vector<std::string> DeviceDecorator::listSensors(const int direction, const size_t channel) const
+{
+    return _device->listSensors(direction, channel);
+}
+
+SoapySDR::ArgInfo DeviceDecorator::getSensorInfo(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->getSensorInfo(direction, channel, key);
+}
+
+std::string DeviceDecorator::readSensor(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSensor(direction, channel, key);
+}
+
+bool DeviceDecorator::readSensorBool(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSensorBool(direction, channel, key);
+}
+
+long long DeviceDecorator::readSensorInt(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSensorInt(direction, channel, key);
+}
+
+double DeviceDecorator::readSensorFloat(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSensorFloat(direction, channel, key);
+}
+
+/*******************************************************************
+ * Register API
+ ******************************************************************/
+std::vector<std::string> DeviceDecorator::listRegisterInterfaces(void) const
+{
+    return _device->listRegisterInterfaces();
+}
+
+void DeviceDecorator::writeRegister(const std::string &name, const unsigned addr, const unsigned value)
+{
+    _device->writeRegister(name, addr, value);
+}
+
+unsigned DeviceDecorator::readRegister(const std::string &name, const unsigned addr) const
+{
+    return _device->readRegister(name, addr);
+}
+
+void DeviceDecorator::writeRegister(const unsigned addr, const unsigned value)
+{
+    _device->writeRegister(addr, value);
+}
+
+unsigned DeviceDecorator::readRegister(const unsigned addr) const
+{
+    return _device->readRegister(addr);
+}
+
+void DeviceDecorator::writeRegisters(const std::string &name, const unsigned addr, const std::vector<unsigned> &value)
+{
+    _device->writeRegisters(name, addr, value);
+}
+
+std::vector<unsigned> DeviceDecorator::readRegisters(const std::string &name, const unsigned addr, const size_t length) const
+{
+    return _device->readRegisters(name, addr, length);
+}
+
+std::vector<unsigned> DeviceDecorator::transactRegisters(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops)
+{
+    return _device->transactRegisters(name, ops);
+}
+
+std::future<std::vector<unsigned>> DeviceDecorator::transactRegistersAsync(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops)
+{
+    return _device->transactRegistersAsync(name, ops);
+}
+
+/*******************************************************************
+ * Settings API
+ ******************************************************************/
+SoapySDR::ArgInfoList DeviceDecorator::getSettingInfo(void) const
+{
+    return _device->getSettingInfo();
+}
+
+SoapySDR::ArgInfo DeviceDecorator::getSettingInfo(const std::string &key) const
+{
+    return _device->getSettingInfo(key);
+}
+
+void DeviceDecorator::writeSetting(const std::string &key, const std::string &value)
+{
+    _device->writeSetting(key, value);
+}
+
+std::string DeviceDecorator::readSetting(const std::string &key) const
+{
+    return _device->readSetting(key);
+}
+
+void DeviceDecorator::writeSettingBool(const std::string &key, const bool value)
+{
+    _device->writeSettingBool(key, value);
+}
+
+void DeviceDecorator::writeSettingInt(const std::string &key, const long long value)
+{
+    _device->writeSettingInt(key, value);
+}
+
+void DeviceDecorator::writeSettingFloat(const std::string &key, const double value)
+{
+    _device->writeSettingFloat(key, value);
+}
+
+bool DeviceDecorator::readSettingBool(const std::string &key) const
+{
+    return _device->readSettingBool(key);
+}
+
+long long DeviceDecorator::readSettingInt(const std::string &key) const
+{
+    return _device->readSettingInt(key);
+}
+
+double DeviceDecorator::readSettingFloat(const std::string &key) const
+{
+    return _device->readSettingFloat(key);
+}
+
+SoapySDR::ArgInfoList DeviceDecorator::getSettingInfo(const int direction, const size_t channel) const
+{
+    return _device->getSettingInfo(direction, channel);
+}
+
+SoapySDR::ArgInfo DeviceDecorator::getSettingInfo(const int direction, const size_t channnel, const std::string &key) const
+{
+    return _device->getSettingInfo(direction, channnel, key);
+}
+
+void DeviceDecorator::writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value)
+{
+    _device->writeSetting(direction, channel, key, value);
+}
+
+std::string DeviceDecorator::readSetting(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSetting(direction, channel, key);
+}
+
+void DeviceDecorator::writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value)
+{
+    _device->writeSettingBool(direction, channel, key, value);
+}
+
+void DeviceDecorator::writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value)
+{
+    _device->writeSettingInt(direction, channel, key, value);
+}
+
+void DeviceDecorator::writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value)
+{
+    _device->writeSettingFloat(direction, channel, key, value);
+}
+
+bool DeviceDecorator::readSettingBool(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSettingBool(direction, channel, key);
+}
+
+long long DeviceDecorator::readSettingInt(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSettingInt(direction, channel, key);
+}
+
+double DeviceDecorator::readSettingFloat(const int direction, const size_t channel, const std::string &key) const
+{
+    return _device->readSettingFloat(direction, channel, key);
+}
+
+/*******************************************************************
+ * GPIO API
+ ******************************************************************/
+std::vector<std::string> DeviceDecorator::listGPIOBanks(void) const
+{
+    return _device->listGPIOBanks();
+}
+
+void DeviceDecorator::writeGPIO(const std::string &bank, const unsigned value)
+{
+    _device->writeGPIO(bank, value);
+}
+
+void DeviceDecorator::writeGPIO(const std::string &bank, const unsigned value, const unsigned mask)
+{
+    _device->writeGPIO(bank, value, mask);
+}
+
+unsigned DeviceDecorator::readGPIO(const std::string &bank) const
+{
+    return _device->readGPIO(bank);
+}
+
+void DeviceDecorator::writeGPIODir(const std::string &bank, const unsigned dir)
+{
+    _device->writeGPIODir(bank, dir);
+}
+
+void DeviceDecorator::writeGPIODir(const std::string &bank, const unsigned dir, const unsigned mask)
+{
+    _device->writeGPIODir(bank, dir, mask);
+}
+
+unsigned DeviceDecorator::readGPIODir(const std::string &bank) const
+{
+    return _device->readGPIODir(bank);
+}
+
+/*******************************************************************
+ * I2C API
+ ******************************************************************/
+void DeviceDecorator::writeI2C(const int addr, const std::string &data)
+{
+    _device->writeI2C(addr, data);
+}
+
+std::string DeviceDecorator::readI2C(const int addr, const size_t numBytes)
+{
+    return _device->readI2C(addr, numBytes);
+}
+
+std::vector<std::string> DeviceDecorator::transactI2C(const std::vector<SoapySDR::I2CMessage> &messages)
+{
+    return _device->transactI2C(messages);
+}
+
+/*******************************************************************
+ * SPI API
+ ******************************************************************/
+unsigned DeviceDecorator::transactSPI(const int addr, const unsigned data, const size_t numBits)
+{
+    return _device->transactSPI(addr, data, numBits);
+}
+
+std::vector<unsigned> DeviceDecorator::transactSPIBatch(const int addr, const std::vector<unsigned> &data, const size_t numBits)
+{
+    return _device->transactSPIBatch(addr, data, numBits);
+}
+
+/*******************************************************************
+ * UART API
+ ******************************************************************/
+std::vector<std::string> DeviceDecorator::listUARTs(void) const
+{
+    return _device->listUARTs();
+}
+
+void DeviceDecorator::writeUART(const std::string &which, const std::string &data)
+{
+    _device->writeUART(which, data);
+}
+
+std::string DeviceDecorator::readUART(const std::string &which, const long timeoutUs) const
+{
+    return _device->readUART(which, timeoutUs);
+}
+
+/*******************************************************************
+ * Native Access API
+ ******************************************************************/
+void *DeviceDecorator::getNativeDeviceHandle(void) const
+{
+    return _device->getNativeDeviceHandle();
+}
@@ -6,6 +6,13 @@
 #include <SoapySDR/Registry.hpp>
 #include <SoapySDR/Modules.hpp>
 #include <SoapySDR/Logger.hpp>
+#include "StreamLayer.hpp"
+#include "ChannelizerLayer.hpp"
+#include "ResamplerLayer.hpp"
+#include "TraceLayer.hpp"
+#include "CacheLayer.hpp"
+#include "ConfigLayer.hpp"
+#include "GainLayer.hpp"
 #include <algorithm>
 #include <stdexcept>
 #include <exception>
@@ -38,6 +45,38 @@ static DeviceCounts &getDeviceCounts(void)
 
 void automaticLoadModules(void);
 
+/*******************************************************************
+ * Library layers around the device made by the driver
+ ******************************************************************/
+static bool isLayerArg(const std::string &key)
+{
+    return key.compare(0, 11, "channelizer") == 0 or key == "resample" or
+        key == "trace" or key == "trace_file" or
+        key == "cache" or key == "cache_exclude" or
+        key == "command_lead" or key == "stream_layer";
+}
+
+static SoapySDR::Device *decorateDevice(SoapySDR::Device *device, const SoapySDR::Kwargs &args)
+{
+    if (device == nullptr) return device;
+    try
+    {
+        if (args.count("trace") != 0 and SoapySDR::StringToSetting<bool>(args.at("trace"))) device = new TraceLayer(device, args);
+        device = new GainLayer(device);
+        if (args.count("channelizer") != 0) device = new ChannelizerLayer(device, args);
+        if (args.count("resample") != 0 and SoapySDR::StringToSetting<bool>(args.at("resample"))) device = new ResamplerLayer(device);
+        if (args.count("cache") != 0 and SoapySDR::StringToSetting<bool>(args.at("cache"))) device = new CacheLayer(device, args);
+        device = new ConfigLayer(device, args);
+        if (args.count("stream_layer") != 0 and SoapySDR::StringToSetting<bool>(args.at("stream_layer"))) device = new StreamLayer(device);
+        return device;
+    }
+    catch (...)
+    {
+        delete device;
+        throw;
+    }
+}
+
 SoapySDR::KwargsList SoapySDR::Device::enumerate(const Kwargs &args)
 {
     automaticLoadModules(); //perform one-shot load
@@ -130,6 +169,15 @@ static SoapySDR::Device* getDeviceFromTable(const SoapySDR::Kwargs &args)
     return device;
 }
 
+/*!
+ * Built-in drivers that are only used when explicitly specified,
+ * they never count as the single available driver option in make().
+ */
+static bool isExplicitOnlyDriver(const std::string &key)
+{
+    return key == "null" or key == "sim" or key == "file" or key == "multi" or key == "broker";
+}
+
 SoapySDR::Device* SoapySDR::Device::make(const Kwargs &inputArgs)
 {
     std::unique_lock<std::recursive_mutex> lock(getFactoryMutex());
@@ -146,6 +194,12 @@ SoapySDR::Device* SoapySDR::Device::make(const Kwargs &inputArgs)
     if (not results.empty()) discoveredArgs = results.front();
     lock.lock();
 
+    //the same device with different layers is a different table entry
+    if (not discoveredArgs.empty()) for (const auto &it : inputArgs)
+    {
+        if (isLayerArg(it.first)) discoveredArgs[it.first] = it.second;
+    }
+
     //check the device table for an already allocated device
     device = getDeviceFromTable(discoveredArgs);
     if (device != nullptr) return device;
@@ -161,7 +215,12 @@ SoapySDR::Device* SoapySDR::Device::make(const Kwargs &inputArgs)
     //unless there is only one available driver option
     const bool specifiedDriver = hybridArgs.count("driver") != 0;
     const auto makeFunctions = Registry::listMakeFunctions();
-    if (not specifiedDriver and makeFunctions.size() > 2) //more than factory: null + one loaded driver
+    size_t numImplicitDrivers = 0;
+    for (const auto &it : makeFunctions)
+    {
+        if (not isExplicitOnlyDriver(it.first)) numImplicitDrivers++;
+    }
+    if (not specifiedDriver and numImplicitDrivers > 1) //more than one loaded driver
     {
         throw std::runtime_error("SoapySDR::Device::make() no driver specified and no enumeration results");
     }
@@ -171,7 +230,7 @@ SoapySDR::Device* SoapySDR::Device::make(const Kwargs &inputArgs)
     std::shared_future<Device *> deviceFuture;
     for (const auto &it : makeFunctions)
     {
-        if (not specifiedDriver and it.first == "null") continue; //skip null unless explicitly specified
+        if (not specifiedDriver and isExplicitOnlyDriver(it.first)) continue; //skip built-ins unless explicitly specified
         if (specifiedDriver and hybridArgs.at("driver") != it.first) continue; //filter for driver match
         auto &cacheEntry = cache[discoveredArgs];
         if (not cacheEntry.valid()) cacheEntry = std::async(std::launch::deferred, it.second, hybridArgs);
@@ -192,7 +251,7 @@ SoapySDR::Device* SoapySDR::Device::make(const Kwargs &inputArgs)
     cache.erase(discoveredArgs);
 
     //store into the table
-    device = deviceFuture.get(); //may throw
+    device = decorateDevice(deviceFuture.get(), hybridArgs); //may throw
     getDeviceTable()[discoveredArgs] = device;
     getDeviceCounts()[device]++;
 
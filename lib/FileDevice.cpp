@@ -0,0 +1,766 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#define fseek64 _fseeki64
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define fseek64 fseeko
+#endif
+
+/*******************************************************************
+ * Read-only memory mapping of a recording
+ ******************************************************************/
+class MappedFile
+{
+public:
+    MappedFile(const std::string &path):
+        _data(nullptr),
+        _size(0)
+    {
+        #ifdef _WIN32
+        _file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (_file == INVALID_HANDLE_VALUE) throw std::runtime_error("FileDevice: cannot open " + path);
+        LARGE_INTEGER size;
+        GetFileSizeEx(_file, &size);
+        _size = size_t(size.QuadPart);
+        _mapping = nullptr;
+        if (_size == 0) return;
+        _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mapping != nullptr) _data = reinterpret_cast<const char *>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (_data == nullptr)
+        {
+            this->close();
+            throw std::runtime_error("FileDevice: cannot map " + path);
+        }
+        #else
+        _fd = ::open(path.c_str(), O_RDONLY);
+        if (_fd < 0) throw std::runtime_error("FileDevice: cannot open " + path);
+        struct stat st;
+        if (::fstat(_fd, &st) != 0)
+        {
+            this->close();
+            throw std::runtime_error("FileDevice: cannot stat " + path);
+        }
+        _size = size_t(st.st_size);
+        if (_size == 0) return;
+        void *p = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, _fd, 0);
+        if (p == MAP_FAILED)
+        {
+            this->close();
+            throw std::runtime_error("FileDevice: cannot map " + path);
+        }
+        _data = reinterpret_cast<const char *>(p);
+        ::madvise(p, _size, MADV_SEQUENTIAL);
+        #endif
+    }
+
+    ~MappedFile(void)
+    {
+        this->close();
+    }
+
+    const char *data(void) const
+    {
+        return _data;
+    }
+
+    size_t size(void) const
+    {
+        return _size;
+    }
+
+private:
+    void close(void)
+    {
+        #ifdef _WIN32
+        if (_data != nullptr) UnmapViewOfFile(_data);
+        if (_mapping != nullptr) CloseHandle(_mapping);
+        CloseHandle(_file);
+        #else
+        if (_data != nullptr) ::munmap(const_cast<char *>(_data), _size);
+        ::close(_fd);
+        #endif
+        _data = nullptr;
+    }
+
+    #ifdef _WIN32
+    HANDLE _file;
+    HANDLE _mapping;
+    #else
+    int _fd;
+    #endif
+    const char *_data;
+    size_t _size;
+};
+
+/*******************************************************************
+ * SigMF metadata helpers
+ ******************************************************************/
+static const std::vector<std::pair<std::string, std::string>> &sigmfDatatypes(void)
+{
+    static const std::vector<std::pair<std::string, std::string>> types = {
+        {"cf64_le", SOAPY_SDR_CF64},
+        {"cf32_le", SOAPY_SDR_CF32},
+        {"ci32_le", SOAPY_SDR_CS32},
+        {"ci16_le", SOAPY_SDR_CS16},
+        {"cu16_le", SOAPY_SDR_CU16},
+        {"ci8", SOAPY_SDR_CS8},
+        {"cu8", SOAPY_SDR_CU8},
+    };
+    return types;
+}
+
+static std::string formatFromSigMF(const std::string &datatype)
+{
+    for (const auto &type : sigmfDatatypes())
+    {
+        if (type.first == datatype) return type.second;
+    }
+    throw std::runtime_error("FileDevice: unsupported SigMF datatype " + datatype);
+}
+
+static std::string formatToSigMF(const std::string &format)
+{
+    for (const auto &type : sigmfDatatypes())
+    {
+        if (type.second == format) return type.first;
+    }
+    throw std::runtime_error("FileDevice: unsupported stream format " + format);
+}
+
+/*!
+ * Find the value of the first occurrence of a key in a JSON document.
+ * This is not a JSON parser, but the core SigMF fields used here
+ * are scalars that are unique within the metadata document.
+ */
+static std::string findJsonValue(const std::string &json, const std::string &key)
+{
+    const std::string quoted = "\"" + key + "\"";
+    auto pos = json.find(quoted);
+    if (pos == std::string::npos) return "";
+    pos = json.find(':', pos+quoted.size());
+    if (pos == std::string::npos) return "";
+    pos = json.find_first_not_of(" \t\r\n", pos+1);
+    if (pos == std::string::npos) return "";
+    if (json[pos] == '"')
+    {
+        const auto end = json.find('"', pos+1);
+        return json.substr(pos+1, end-pos-1);
+    }
+    const auto end = json.find_first_of(",}] \t\r\n", pos);
+    return json.substr(pos, end-pos);
+}
+
+//days since the unix epoch for a civil date (proleptic gregorian)
+static long long daysFromCivil(long long y, const unsigned m, const unsigned d)
+{
+    y -= (m <= 2)?1:0;
+    const long long era = ((y >= 0)?y:(y-399))/400;
+    const unsigned yoe = unsigned(y - era*400);
+    const unsigned doy = (153*(m + ((m > 2)?-3:9)) + 2)/5 + d-1;
+    const unsigned doe = yoe*365 + yoe/4 - yoe/100 + doy;
+    return era*146097 + (long long)(doe) - 719468;
+}
+
+//parse an ISO 8601 UTC timestamp such as 2026-01-02T03:04:05.123456Z
+static long long parseDatetimeNs(const std::string &datetime)
+{
+    int year, month, day, hour, minute;
+    double second;
+    if (std::sscanf(datetime.c_str(), "%d-%d-%dT%d:%d:%lfZ", &year, &month, &day, &hour, &minute, &second) != 6)
+    {
+        throw std::runtime_error("FileDevice: cannot parse SigMF datetime " + datetime);
+    }
+    const long long secs = daysFromCivil(year, unsigned(month), unsigned(day))*86400 + hour*3600 + minute*60;
+    return secs*1000000000ll + (long long)(second*1e9 + 0.5);
+}
+
+static bool endsWith(const std::string &s, const std::string &suffix)
+{
+    return s.size() >= suffix.size() and s.compare(s.size()-suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/*******************************************************************
+ * Replay and record stream state
+ ******************************************************************/
+struct FileStream
+{
+    int direction;
+    size_t elemSize;
+    size_t mtu;
+    SoapySDR::ConverterRegistry::ConverterFunction convert;
+
+    //receive position in elements within the recording
+    bool active;
+    size_t pos;
+    size_t endPos;
+    bool finite;
+
+    //transmit file and the time of its first element
+    std::FILE *fp;
+    long long epochNs;
+    long long nextTick;
+};
+
+/*******************************************************************
+ * File replay device
+ ******************************************************************/
+class FileDevice : public SoapySDR::Device
+{
+public:
+    FileDevice(const SoapySDR::Kwargs &args):
+        _format(SOAPY_SDR_CF32),
+        _rxRate(1e6),
+        _txRate(1e6),
+        _frequency(0.0),
+        _startNs(0),
+        _fast(false),
+        _repeat(false),
+        _baseNs(0),
+        _baseWall(std::chrono::steady_clock::now()),
+        _fastNs(0)
+    {
+        if (args.count("pace") != 0) _fast = args.at("pace") == "fast";
+        if (args.count("repeat") != 0) _repeat = args.at("repeat") == "true";
+        if (args.count("tx_file") != 0) _txPath = args.at("tx_file");
+
+        //raw recordings are described by the device arguments
+        if (args.count("format") != 0) _format = args.at("format");
+        if (args.count("rate") != 0) _rxRate = SoapySDR::StringToSetting<double>(args.at("rate"));
+        if (args.count("time") != 0) _startNs = SoapySDR::StringToSetting<long long>(args.at("time"));
+        if (args.count("freq") != 0) _frequency = SoapySDR::StringToSetting<double>(args.at("freq"));
+
+        //SigMF recordings are described by the metadata file
+        if (args.count("file") != 0)
+        {
+            std::string path = args.at("file");
+            std::string metaPath;
+            if (endsWith(path, ".sigmf-meta")) metaPath = path, path = path.substr(0, path.size()-4) + "data";
+            else if (endsWith(path, ".sigmf-data")) metaPath = path.substr(0, path.size()-4) + "meta";
+            if (not metaPath.empty()) this->loadSigMF(metaPath);
+            _rxFile.reset(new MappedFile(path));
+        }
+
+        SoapySDR::formatToSize(_format); //validates the format
+        _txRate = _rxRate;
+        _baseNs = _fastNs = _startNs;
+    }
+
+    /*******************************************************************
+     * Identification API
+     ******************************************************************/
+    std::string getDriverKey(void) const
+    {
+        return "file";
+    }
+
+    std::string getHardwareKey(void) const
+    {
+        return "file";
+    }
+
+    SoapySDR::Kwargs getHardwareInfo(void) const
+    {
+        SoapySDR::Kwargs info;
+        info["format"] = _format;
+        info["pace"] = _fast?"fast":"realtime";
+        if (_rxFile) info["num_elements"] = std::to_string(this->numFileElems());
+        return info;
+    }
+
+    /*******************************************************************
+     * Channels API
+     ******************************************************************/
+    size_t getNumChannels(const int direction) const
+    {
+        if (direction == SOAPY_SDR_RX) return _rxFile?1:0;
+        return _txPath.empty()?0:1;
+    }
+
+    bool getFullDuplex(const int, const size_t) const
+    {
+        return true;
+    }
+
+    /*******************************************************************
+     * Stream API
+     ******************************************************************/
+    std::vector<std::string> getStreamFormats(const int direction, const size_t) const
+    {
+        //transmit files are written in the stream format
+        if (direction == SOAPY_SDR_TX) return {SOAPY_SDR_CF64, SOAPY_SDR_CF32, SOAPY_SDR_CS32, SOAPY_SDR_CS16, SOAPY_SDR_CU16, SOAPY_SDR_CS8, SOAPY_SDR_CU8};
+
+        //receive streams convert from the recording format
+        auto formats = SoapySDR::ConverterRegistry::listTargetFormats(_format);
+        if (std::find(formats.begin(), formats.end(), _format) == formats.end()) formats.insert(formats.begin(), _format);
+        return formats;
+    }
+
+    std::string getNativeStreamFormat(const int direction, const size_t, double &fullScale) const
+    {
+        const std::string format = (direction == SOAPY_SDR_RX)?_format:SOAPY_SDR_CF32;
+        const size_t bits = SoapySDR::formatToSize(format)*4;
+        const bool isFloat = format == SOAPY_SDR_CF32 or format == SOAPY_SDR_CF64;
+        fullScale = isFloat?1.0:double(1ull << (bits-1));
+        return format;
+    }
+
+    SoapySDR::ArgInfoList getStreamArgsInfo(const int, const size_t) const
+    {
+        SoapySDR::ArgInfoList infos;
+
+        SoapySDR::ArgInfo info;
+        info.key = "bufflen";
+        info.name = "Buffer Length";
+        info.value = "4096";
+        info.units = "elements";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "The number of elements per direct access buffer (the stream MTU).";
+        infos.push_back(info);
+
+        return infos;
+    }
+
+    SoapySDR::Stream *setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+    {
+        if (channels.size() > 1 or (not channels.empty() and channels.front() != 0))
+        {
+            throw std::runtime_error("FileDevice::setupStream() only channel 0 is supported");
+        }
+        if (this->getNumChannels(direction) == 0)
+        {
+            throw std::runtime_error(std::string("FileDevice::setupStream() no ") + ((direction == SOAPY_SDR_RX)?"file":"tx_file") + " specified");
+        }
+
+        std::unique_ptr<FileStream> stream(new FileStream());
+        stream->direction = direction;
+        stream->elemSize = SoapySDR::formatToSize(format);
+        stream->mtu = 4096;
+        if (args.count("bufflen") != 0) stream->mtu = std::max<size_t>(SoapySDR::StringToSetting<size_t>(args.at("bufflen")), 1);
+        stream->convert = nullptr;
+        stream->active = false;
+        stream->pos = 0;
+        stream->endPos = 0;
+        stream->finite = false;
+        stream->fp = nullptr;
+        stream->epochNs = 0;
+        stream->nextTick = 0;
+
+        if (direction == SOAPY_SDR_RX and format != _format)
+        {
+            stream->convert = SoapySDR::ConverterRegistry::getFunction(_format, format);
+            if (stream->convert == nullptr) throw std::runtime_error("FileDevice::setupStream() cannot convert "+_format+" to "+format);
+        }
+
+        if (direction == SOAPY_SDR_TX)
+        {
+            stream->fp = std::fopen(_txPath.c_str(), "wb");
+            if (stream->fp == nullptr) throw std::runtime_error("FileDevice::setupStream() cannot open " + _txPath);
+            _txFormat = format;
+        }
+
+        return reinterpret_cast<SoapySDR::Stream *>(stream.release());
+    }
+
+    void closeStream(SoapySDR::Stream *handle)
+    {
+        auto stream = reinterpret_cast<FileStream *>(handle);
+        if (stream->fp != nullptr)
+        {
+            std::fclose(stream->fp);
+            if (endsWith(_txPath, ".sigmf-data")) this->writeSigMF(stream);
+        }
+        delete stream;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *handle) const
+    {
+        return reinterpret_cast<FileStream *>(handle)->mtu;
+    }
+
+    int activateStream(SoapySDR::Stream *handle, const int flags, const long long timeNs, const size_t numElems)
+    {
+        auto stream = reinterpret_cast<FileStream *>(handle);
+        if ((flags & ~(SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST)) != 0) return SOAPY_SDR_NOT_SUPPORTED;
+        if ((flags & SOAPY_SDR_END_BURST) != 0 and numElems == 0) return SOAPY_SDR_NOT_SUPPORTED;
+
+        if (stream->direction == SOAPY_SDR_TX)
+        {
+            stream->epochNs = ((flags & SOAPY_SDR_HAS_TIME) != 0)?timeNs:this->getHardwareTime();
+            stream->nextTick = 0;
+            stream->active = true;
+            return 0;
+        }
+
+        //a timed activation seeks to that time within the recording
+        size_t pos = 0;
+        if ((flags & SOAPY_SDR_HAS_TIME) != 0)
+        {
+            const long long ticks = SoapySDR::timeNsToTicks(timeNs - this->elemTimeNs(0), _rxRate);
+            if (ticks < 0 or (unsigned long long)(ticks) >= this->numFileElems()) return SOAPY_SDR_TIME_ERROR;
+            pos = size_t(ticks);
+        }
+        stream->pos = pos;
+        stream->finite = (flags & SOAPY_SDR_END_BURST) != 0;
+        stream->endPos = stream->finite?std::min(pos+numElems, this->numFileElems()):this->numFileElems();
+        stream->active = true;
+
+        //the hardware time follows the replay position
+        const long long baseNs = this->elemTimeNs(pos);
+        std::lock_guard<std::mutex> lock(_timeMutex);
+        _baseNs = baseNs;
+        _baseWall = std::chrono::steady_clock::now();
+        _fastNs = _baseNs;
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *handle, const int flags, const long long)
+    {
+        auto stream = reinterpret_cast<FileStream *>(handle);
+        if (flags != 0) return SOAPY_SDR_NOT_SUPPORTED;
+        stream->active = false;
+        if (stream->fp != nullptr) std::fflush(stream->fp);
+        return 0;
+    }
+
+    int readStream(SoapySDR::Stream *handle, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<FileStream *>(handle);
+        if (stream->direction != SOAPY_SDR_RX) return SOAPY_SDR_NOT_SUPPORTED;
+
+        const void *src(nullptr);
+        const int ret = this->replay(stream, std::min(numElems, stream->mtu), src, flags, timeNs, timeoutUs);
+        if (ret <= 0) return ret;
+
+        if (stream->convert == nullptr) std::memcpy(buffs[0], src, size_t(ret)*stream->elemSize);
+        else stream->convert(src, buffs[0], size_t(ret), 1.0);
+        return ret;
+    }
+
+    int writeStream(SoapySDR::Stream *handle, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long)
+    {
+        auto stream = reinterpret_cast<FileStream *>(handle);
+        if (stream->direction != SOAPY_SDR_TX) return SOAPY_SDR_NOT_SUPPORTED;
+        if (not stream->active) return SOAPY_SDR_STREAM_ERROR;
+
+        //timed writes seek to their offset, leaving holes in the sparse file
+        if ((flags & SOAPY_SDR_HAS_TIME) != 0)
+        {
+            const long long tick = SoapySDR::timeNsToTicks(timeNs - stream->epochNs, _txRate);
+            if (tick < 0) return SOAPY_SDR_TIME_ERROR;
+            stream->nextTick = tick;
+        }
+
+        if (fseek64(stream->fp, stream->nextTick*(long long)(stream->elemSize), SEEK_SET) != 0) return SOAPY_SDR_STREAM_ERROR;
+        const size_t n = std::fwrite(buffs[0], stream->elemSize, numElems, stream->fp);
+        if (n != numElems) return SOAPY_SDR_STREAM_ERROR;
+        stream->nextTick += n;
+
+        //in fast mode the hardware time follows the transmit position
+        if (_fast)
+        {
+            const long long endNs = stream->epochNs + SoapySDR::ticksToTimeNs(stream->nextTick, _txRate);
+            if (endNs > _fastNs.load()) _fastNs = endNs;
+        }
+        return int(n);
+    }
+
+    /*******************************************************************
+     * Direct buffer access API
+     ******************************************************************/
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *handle)
+    {
+        //every MTU sized chunk of the mapping is a buffer in native format
+        auto stream = reinterpret_cast<FileStream *>(handle);
+        if (stream->direction != SOAPY_SDR_RX or stream->convert != nullptr) return 0;
+        return (this->numFileElems() + stream->mtu - 1)/stream->mtu;
+    }
+
+    int getDirectAccessBufferAddrs(SoapySDR::Stream *handle, const size_t index, void **buffs)
+    {
+        auto stream = reinterpret_cast<FileStream *>(handle);
+        if (index >= this->getNumDirectAccessBuffers(handle)) return SOAPY_SDR_STREAM_ERROR;
+        buffs[0] = const_cast<char *>(_rxFile->data()) + index*stream->mtu*stream->elemSize;
+        return 0;
+    }
+
+    int acquireReadBuffer(SoapySDR::Stream *handle, size_t &index, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<FileStream *>(handle);
+        if (this->getNumDirectAccessBuffers(handle) == 0) return SOAPY_SDR_NOT_SUPPORTED;
+
+        //read up to the next buffer boundary so the pointer is a whole or partial buffer
+        index = stream->pos/stream->mtu;
+        const size_t boundary = (index+1)*stream->mtu;
+        return this->replay(stream, boundary-stream->pos, buffs[0], flags, timeNs, timeoutUs);
+    }
+
+    void releaseReadBuffer(SoapySDR::Stream *, const size_t)
+    {
+        return;
+    }
+
+    /*******************************************************************
+     * Antenna API
+     ******************************************************************/
+    std::vector<std::string> listAntennas(const int direction, const size_t) const
+    {
+        return {(direction == SOAPY_SDR_RX)?"RX":"TX"};
+    }
+
+    std::string getAntenna(const int direction, const size_t) const
+    {
+        return (direction == SOAPY_SDR_RX)?"RX":"TX";
+    }
+
+    /*******************************************************************
+     * Frequency API
+     ******************************************************************/
+    void setFrequency(const int, const size_t, const double frequency, const SoapySDR::Kwargs &)
+    {
+        _frequency = frequency;
+    }
+
+    double getFrequency(const int, const size_t) const
+    {
+        return _frequency;
+    }
+
+    /*******************************************************************
+     * Sample Rate API
+     ******************************************************************/
+    void setSampleRate(const int direction, const size_t, const double rate)
+    {
+        if (rate <= 0.0) throw std::runtime_error("FileDevice::setSampleRate() invalid rate");
+        if (direction == SOAPY_SDR_RX) _rxRate = rate;
+        else _txRate = rate;
+    }
+
+    double getSampleRate(const int direction, const size_t) const
+    {
+        return (direction == SOAPY_SDR_RX)?_rxRate:_txRate;
+    }
+
+    SoapySDR::RangeList getSampleRateRange(const int, const size_t) const
+    {
+        return {SoapySDR::Range(1.0, 1e12)};
+    }
+
+    /*******************************************************************
+     * Time API
+     ******************************************************************/
+    bool hasHardwareTime(const std::string &what) const
+    {
+        return what.empty();
+    }
+
+    long long getHardwareTime(const std::string & = "") const
+    {
+        if (_fast) return _fastNs.load();
+        std::lock_guard<std::mutex> lock(_timeMutex);
+        const auto elapsed = std::chrono::steady_clock::now() - _baseWall;
+        return _baseNs + std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+
+    void setHardwareTime(const long long timeNs, const std::string & = "")
+    {
+        std::lock_guard<std::mutex> lock(_timeMutex);
+        _baseNs = timeNs;
+        _baseWall = std::chrono::steady_clock::now();
+        _fastNs = timeNs;
+    }
+
+private:
+    size_t numFileElems(void) const
+    {
+        return _rxFile?(_rxFile->size()/SoapySDR::formatToSize(_format)):0;
+    }
+
+    long long elemTimeNs(const size_t pos) const
+    {
+        std::lock_guard<std::mutex> lock(_timeMutex);
+        return _startNs + SoapySDR::ticksToTimeNs(pos, _rxRate);
+    }
+
+    /*!
+     * Point into the mapping at the current replay position.
+     * In real-time mode the elements are released at the sample rate,
+     * and in fast mode they are available immediately.
+     */
+    int replay(FileStream *stream, size_t numElems, const void *&src, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        flags = 0;
+        if (not stream->active) return SOAPY_SDR_STREAM_ERROR;
+
+        if (stream->pos >= stream->endPos)
+        {
+            if (not _repeat or stream->finite)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(timeoutUs));
+                return SOAPY_SDR_TIMEOUT;
+            }
+
+            //loop playback continues the timeline after the end of the recording
+            const long long loopNs = SoapySDR::ticksToTimeNs(stream->endPos, _rxRate);
+            std::lock_guard<std::mutex> lock(_timeMutex);
+            _startNs += loopNs;
+            stream->pos = 0;
+        }
+
+        numElems = std::min(numElems, stream->endPos-stream->pos);
+        const long long endNs = this->elemTimeNs(stream->pos+numElems);
+        if (not _fast)
+        {
+            const long long waitNs = endNs - this->getHardwareTime();
+            if (waitNs > (long long)(timeoutUs)*1000)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(timeoutUs));
+                return SOAPY_SDR_TIMEOUT;
+            }
+            if (waitNs > 0) std::this_thread::sleep_for(std::chrono::nanoseconds(waitNs));
+        }
+        else if (endNs > _fastNs.load()) _fastNs = endNs;
+
+        src = _rxFile->data() + stream->pos*SoapySDR::formatToSize(_format);
+        flags |= SOAPY_SDR_HAS_TIME;
+        timeNs = this->elemTimeNs(stream->pos);
+        stream->pos += numElems;
+        if (stream->pos == stream->endPos) flags |= SOAPY_SDR_END_BURST;
+        return int(numElems);
+    }
+
+    void loadSigMF(const std::string &metaPath)
+    {
+        std::ifstream meta(metaPath);
+        if (not meta) throw std::runtime_error("FileDevice: cannot open " + metaPath);
+        std::stringstream ss;
+        ss << meta.rdbuf();
+        const std::string json = ss.str();
+
+        const auto datatype = findJsonValue(json, "core:datatype");
+        const auto rate = findJsonValue(json, "core:sample_rate");
+        const auto datetime = findJsonValue(json, "core:datetime");
+        const auto freq = findJsonValue(json, "core:frequency");
+        if (datatype.empty()) throw std::runtime_error("FileDevice: missing core:datatype in " + metaPath);
+        _format = formatFromSigMF(datatype);
+        if (not rate.empty()) _rxRate = SoapySDR::StringToSetting<double>(rate);
+        if (not datetime.empty()) _startNs = parseDatetimeNs(datetime);
+        if (not freq.empty()) _frequency = SoapySDR::StringToSetting<double>(freq);
+    }
+
+    void writeSigMF(const FileStream *stream) const
+    {
+        //the datetime is the stream epoch formatted in UTC
+        const long long secs = stream->epochNs/1000000000ll;
+        const long long nanos = stream->epochNs%1000000000ll;
+        const long long days = secs/86400, rem = secs%86400;
+        const long long z = days + 719468, era = ((z >= 0)?z:(z-146096))/146097;
+        const long long doe = z - era*146097;
+        const long long yoe = (doe - doe/1460 + doe/36524 - doe/146096)/365;
+        const long long doy = doe - (365*yoe + yoe/4 - yoe/100);
+        const long long mp = (5*doy + 2)/153;
+        const long long d = doy - (153*mp + 2)/5 + 1;
+        const long long m = mp + ((mp < 10)?3:-9);
+        const long long y = yoe + era*400 + ((m <= 2)?1:0);
+        char datetime[160]; //room for the widest value of every field
+        std::snprintf(datetime, sizeof(datetime), "%04lld-%02lld-%02lldT%02lld:%02lld:%02lld.%09lldZ",
+            y, m, d, rem/3600, (rem%3600)/60, rem%60, nanos);
+
+        const std::string metaPath = _txPath.substr(0, _txPath.size()-4) + "meta";
+        std::ofstream meta(metaPath);
+        meta << "{\n"
+             << "    \"global\": {\n"
+             << "        \"core:datatype\": \"" << formatToSigMF(_txFormat) << "\",\n"
+             << "        \"core:sample_rate\": " << SoapySDR::SettingToString(_txRate) << ",\n"
+             << "        \"core:version\": \"1.0.0\"\n"
+             << "    },\n"
+             << "    \"captures\": [\n"
+             << "        {\n"
+             << "            \"core:sample_start\": 0,\n"
+             << "            \"core:datetime\": \"" << datetime << "\",\n"
+             << "            \"core:frequency\": " << SoapySDR::SettingToString(_frequency) << "\n"
+             << "        }\n"
+             << "    ],\n"
+             << "    \"annotations\": []\n"
+             << "}\n";
+    }
+
+    std::unique_ptr<MappedFile> _rxFile;
+    std::string _txPath;
+    std::string _txFormat;
+    std::string _format;
+    double _rxRate;
+    double _txRate;
+    double _frequency;
+    long long _startNs;
+    bool _fast;
+    bool _repeat;
+
+    //the hardware time follows the replay position
+    mutable std::mutex _timeMutex;
+    long long _baseNs;
+    std::chrono::steady_clock::time_point _baseWall;
+    std::atomic<long long> _fastNs;
+};
+
+/*******************************************************************
+ * Registration
+ ******************************************************************/
+SoapySDR::KwargsList findFileDevice(const SoapySDR::Kwargs &args)
+{
+    SoapySDR::KwargsList results;
+
+    //require that the user specify type=file or driver=file
+    const bool typeMatch = args.count("type") != 0 and args.at("type") == "file";
+    const bool driverMatch = args.count("driver") != 0 and args.at("driver") == "file";
+    if (not typeMatch and not driverMatch) return results;
+    if (args.count("file") == 0 and args.count("tx_file") == 0) return results;
+
+    SoapySDR::Kwargs fileArgs;
+    fileArgs["type"] = "file";
+    fileArgs["label"] = "File replay: " + ((args.count("file") != 0)?args.at("file"):args.at("tx_file"));
+    for (const auto &key : {"file", "tx_file"})
+    {
+        if (args.count(key) != 0) fileArgs[key] = args.at(key);
+    }
+    results.push_back(fileArgs);
+
+    return results;
+}
+
+SoapySDR::Device *makeFileDevice(const SoapySDR::Kwargs &args)
+{
+    return new FileDevice(args);
+}
+
+/*!
+ * lateLoadFileDevice() is called by loadModules()
+ * to load the file device on-demand/not statically.
+ * See lateLoadNullDevice() for the reasoning.
+ */
+void lateLoadFileDevice(void)
+{
+    static SoapySDR::Registry registerFileDevice("file", &findFileDevice, &makeFileDevice, SOAPY_SDR_ABI_VERSION);
+}
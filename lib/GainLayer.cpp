@@ -0,0 +1,310 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "GainLayer.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/*******************************************************************
+ * Gain layer
+ ******************************************************************/
+GainLayer::GainLayer(SoapySDR::Device *device):
+    DeviceDecorator(device),
+    _driver(device)
+{
+    while (auto decorator = dynamic_cast<DeviceDecorator *>(_driver)) _driver = decorator->getUnderlyingDevice();
+}
+
+GainLayer::ChannelGain &GainLayer::channelGain(const int direction, const size_t channel) const
+{
+    const auto key = std::make_pair(direction, channel);
+    auto it = _channels.find(key);
+    if (it != _channels.end()) return it->second;
+
+    ChannelGain state;
+    state.table = _device->getGainTable(direction, channel);
+    const auto &table = state.table;
+    if (table.values.size() != table.gains.size()*table.elements.size())
+    {
+        throw std::runtime_error("getGainTable() returned a table without one value per element and row");
+    }
+    return _channels.emplace(key, state).first->second;
+}
+
+std::shared_ptr<const GainPlan> GainLayer::channelPlan(const int direction, const size_t channel) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto &state = this->channelGain(direction, channel);
+    if (not state.plan) state.plan = GainPlan::make(*_device, direction, channel);
+    return state.plan;
+}
+
+void GainLayer::forgetRow(const int direction, const size_t channel)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _channels.find(std::make_pair(direction, channel));
+    if (it != _channels.end()) it->second.row = -1;
+}
+
+void GainLayer::invalidate(void)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _channels.clear();
+    _bands.clear();
+}
+
+void GainLayer::checkBand(const int direction, const size_t channel, const std::string &name, const double frequency)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto &band = _bands[std::make_tuple(direction, channel, name)];
+        if (band.index == -2)
+        {
+            band.ranges = name.empty()?
+                _device->getFrequencyRange(direction, channel):
+                _device->getFrequencyRange(direction, channel, name);
+        }
+
+        int index = -1;
+        for (size_t i = 0; i < band.ranges.size(); i++)
+        {
+            if (frequency < band.ranges[i].minimum() or frequency > band.ranges[i].maximum()) continue;
+            index = int(i);
+            break;
+        }
+
+        const bool changed = band.index != -2 and band.index != index;
+        band.index = index;
+        if (not changed) return;
+    }
+    this->invalidate();
+}
+
+/*******************************************************************
+ * Channels API
+ ******************************************************************/
+void GainLayer::setFrontendMapping(const int direction, const std::string &mapping)
+{
+    _device->setFrontendMapping(direction, mapping);
+    this->invalidate();
+}
+
+/*******************************************************************
+ * Antenna API
+ ******************************************************************/
+void GainLayer::setAntenna(const int direction, const size_t channel, const std::string &name)
+{
+    _device->setAntenna(direction, channel, name);
+    this->invalidate();
+}
+
+/*******************************************************************
+ * Gain API
+ ******************************************************************/
+void GainLayer::setGainMode(const int direction, const size_t channel, const bool automatic)
+{
+    this->forgetRow(direction, channel);
+    _device->setGainMode(direction, channel, automatic);
+}
+
+void GainLayer::setGain(const int direction, const size_t channel, const double value)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto &state = this->channelGain(direction, channel);
+    const auto &table = state.table;
+    if (table.gains.empty())
+    {
+        lock.unlock();
+        GainPlan::Scope scope(*_driver, direction, channel, this->channelPlan(direction, channel));
+        return _device->setGain(direction, channel, value);
+    }
+
+    //the row of the largest overall gain not above the request
+    const auto upper = std::upper_bound(table.gains.begin(), table.gains.end(), value);
+    const size_t row = (upper == table.gains.begin())?0:size_t(upper - table.gains.begin())-1;
+
+    //only write the elements which differ from the last row
+    const int lastRow = state.row;
+    const size_t numElems = table.elements.size();
+    state.row = -1;
+    for (size_t i = 0; i < numElems; i++)
+    {
+        const double gain = table.values[row*numElems + i];
+        if (lastRow >= 0 and table.values[size_t(lastRow)*numElems + i] == gain) continue;
+        _device->setGain(direction, channel, table.elements[i], gain);
+    }
+    state.row = int(row);
+}
+
+void GainLayer::setGain(const int direction, const size_t channel, const std::string &name, const double value)
+{
+    this->forgetRow(direction, channel);
+    _device->setGain(direction, channel, name, value);
+}
+
+double GainLayer::getGain(const int direction, const size_t channel) const
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto &state = this->channelGain(direction, channel);
+        if (state.row >= 0) return state.table.gains[state.row];
+    }
+    GainPlan::Scope scope(*_driver, direction, channel, this->channelPlan(direction, channel));
+    return _device->getGain(direction, channel);
+}
+
+SoapySDR::Range GainLayer::getGainRange(const int direction, const size_t channel) const
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto &gains = this->channelGain(direction, channel).table.gains;
+        if (not gains.empty()) return SoapySDR::Range(gains.front(), gains.back());
+    }
+    GainPlan::Scope scope(*_driver, direction, channel, this->channelPlan(direction, channel));
+    return _device->getGainRange(direction, channel);
+}
+
+/*******************************************************************
+ * Frequency API
+ ******************************************************************/
+void GainLayer::setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args)
+{
+    _device->setFrequency(direction, channel, frequency, args);
+    this->checkBand(direction, channel, "", frequency);
+}
+
+void GainLayer::setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args)
+{
+    _device->setFrequency(direction, channel, name, frequency, args);
+    this->checkBand(direction, channel, name, frequency);
+}
+
+/*******************************************************************
+ * Frequency hopping API
+ ******************************************************************/
+SoapySDR::HopTable *GainLayer::prepareFrequencies(const int direction, const size_t channel, const std::vector<double> &frequencies, const SoapySDR::Kwargs &args)
+{
+    //without a driver table, hops are made with setFrequency()
+    auto driverTable = _device->prepareFrequencies(direction, channel, frequencies, args);
+    if (driverTable == nullptr) return nullptr;
+    auto table = new GainHopTable();
+    table->driverTable = driverTable;
+    table->direction = direction;
+    table->channel = channel;
+    table->frequencies = frequencies;
+    return reinterpret_cast<SoapySDR::HopTable *>(table);
+}
+
+void GainLayer::applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs)
+{
+    auto hopTable = reinterpret_cast<GainHopTable *>(table);
+    const double frequency = hopTable->frequencies.at(index);
+    _device->applyHop(hopTable->driverTable, index, timeNs);
+    this->checkBand(hopTable->direction, hopTable->channel, "", frequency);
+}
+
+void GainLayer::closeHopTable(SoapySDR::HopTable *table)
+{
+    std::unique_ptr<GainHopTable> hopTable(reinterpret_cast<GainHopTable *>(table));
+    _device->closeHopTable(hopTable->driverTable);
+}
+
+/*******************************************************************
+ * Timed command API
+ ******************************************************************/
+size_t GainLayer::queueCommands(const SoapySDR::TimedCommandList &commands)
+{
+    //the index of the command which each device command came from
+    SoapySDR::TimedCommandList deviceCommands;
+    std::vector<size_t> sources;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 0; i < commands.size(); i++)
+        {
+            const auto &command = commands[i];
+            if (command.type != SoapySDR::TimedCommand::GAIN)
+            {
+                deviceCommands.push_back(command);
+                sources.push_back(i);
+                continue;
+            }
+
+            //the last row applied is unknown once a gain command is queued
+            auto &state = this->channelGain(command.direction, command.channel);
+            state.row = -1;
+            const auto &table = state.table;
+            if (not command.name.empty() or table.gains.empty())
+            {
+                deviceCommands.push_back(command);
+                sources.push_back(i);
+                continue;
+            }
+
+            const auto upper = std::upper_bound(table.gains.begin(), table.gains.end(), command.value);
+            const size_t row = (upper == table.gains.begin())?0:size_t(upper - table.gains.begin())-1;
+            const size_t numElems = table.elements.size();
+            for (size_t j = 0; j < numElems; j++)
+            {
+                deviceCommands.push_back(SoapySDR::TimedCommand::gain(command.timeNs,
+                    command.direction, command.channel, table.elements[j], table.values[row*numElems + j]));
+                sources.push_back(i);
+            }
+        }
+    }
+
+    //a command is accepted when all of its device commands were accepted
+    const size_t numAccepted = _device->queueCommands(deviceCommands);
+    if (numAccepted >= deviceCommands.size()) return commands.size();
+    return sources[numAccepted];
+}
+
+/*******************************************************************
+ * Settings API
+ ******************************************************************/
+void GainLayer::writeSetting(const std::string &key, const std::string &value)
+{
+    _device->writeSetting(key, value);
+    this->invalidate();
+}
+
+void GainLayer::writeSettingBool(const std::string &key, const bool value)
+{
+    _device->writeSettingBool(key, value);
+    this->invalidate();
+}
+
+void GainLayer::writeSettingInt(const std::string &key, const long long value)
+{
+    _device->writeSettingInt(key, value);
+    this->invalidate();
+}
+
+void GainLayer::writeSettingFloat(const std::string &key, const double value)
+{
+    _device->writeSettingFloat(key, value);
+    this->invalidate();
+}
+
+void GainLayer::writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value)
+{
+    _device->writeSetting(direction, channel, key, value);
+    this->invalidate();
+}
+
+void GainLayer::writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value)
+{
+    _device->writeSettingBool(direction, channel, key, value);
+    this->invalidate();
+}
+
+void GainLayer::writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value)
+{
+    _device->writeSettingInt(direction, channel, key, value);
+    this->invalidate();
+}
+
+void GainLayer::writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value)
+{
+    _device->writeSettingFloat(direction, channel, key, value);
+    this->invalidate();
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include "DeviceDecorator.hpp"
+#include "GainPlan.hpp"
+#include <memory>
+#include <mutex>
+#include <map>
+#include <tuple>
+#include <vector>
+
+/*!
+ * GainLayer applies driver gain tables and keeps the gain plans fresh.
+ * The factory places it around every device.
+ *
+ * When the driver provides a gain table for a channel, the overall
+ * setGain() selects a row of the table and only writes the elements
+ * which differ from the last row it applied. Otherwise the call goes
+ * to the driver, where the default algorithm uses the GainPlan
+ * which this layer caches for the channel.
+ *
+ * Timed overall gain commands on a channel with a table are queued
+ * as commands for every element of the selected row, since the
+ * element gains at the command time are not known in advance.
+ *
+ * Tables and plans are rebuilt after an antenna, frontend mapping,
+ * or settings change, and after a frequency change or hop into another
+ * band, where a band is one of the ranges reported by getFrequencyRange().
+ * The tables and plans are kept by this layer, so changes made
+ * on the driver directly never leave a stale plan behind.
+ */
+class GainLayer : public DeviceDecorator
+{
+public:
+    GainLayer(SoapySDR::Device *device);
+
+    /*******************************************************************
+     * Channels API
+     ******************************************************************/
+    void setFrontendMapping(const int direction, const std::string &mapping);
+
+    /*******************************************************************
+     * Antenna API
+     ******************************************************************/
+    void setAntenna(const int direction, const size_t channel, const std::string &name);
+
+    /*******************************************************************
+     * Gain API
+     ******************************************************************/
+    void setGainMode(const int direction, const size_t channel, const bool automatic);
+    void setGain(const int direction, const size_t channel, const double value);
+    void setGain(const int direction, const size_t channel, const std::string &name, const double value);
+    double getGain(const int direction, const size_t channel) const;
+    SoapySDR::Range getGainRange(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Frequency API
+     ******************************************************************/
+    void setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args);
+    void setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args);
+
+    /*******************************************************************
+     * Frequency hopping API
+     ******************************************************************/
+    SoapySDR::HopTable *prepareFrequencies(const int direction, const size_t channel, const std::vector<double> &frequencies, const SoapySDR::Kwargs &args);
+    void applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs);
+    void closeHopTable(SoapySDR::HopTable *table);
+
+    /*******************************************************************
+     * Timed command API
+     ******************************************************************/
+    size_t queueCommands(const SoapySDR::TimedCommandList &commands);
+
+    /*******************************************************************
+     * Settings API
+     ******************************************************************/
+    void writeSetting(const std::string &key, const std::string &value);
+    void writeSettingBool(const std::string &key, const bool value);
+    void writeSettingInt(const std::string &key, const long long value);
+    void writeSettingFloat(const std::string &key, const double value);
+    void writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value);
+    void writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value);
+    void writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value);
+    void writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value);
+
+private:
+    struct ChannelGain
+    {
+        ChannelGain(void): row(-1){}
+        SoapySDR::GainTable table;
+        int row; //the last row applied, or -1 when unknown
+        std::shared_ptr<const GainPlan> plan; //built on first use
+    };
+
+    //a driver hop table and its frequencies for the band checks
+    struct GainHopTable
+    {
+        SoapySDR::HopTable *driverTable;
+        int direction;
+        size_t channel;
+        std::vector<double> frequencies;
+    };
+
+    struct Band
+    {
+        Band(void): index(-2){}
+        SoapySDR::RangeList ranges;
+        int index; //the range of the last frequency, or -2 when unknown
+    };
+
+    //the gain state of a channel, the table is fetched on first use
+    ChannelGain &channelGain(const int direction, const size_t channel) const;
+
+    //the cached plan of a channel without a table
+    std::shared_ptr<const GainPlan> channelPlan(const int direction, const size_t channel) const;
+
+    //forget the gain state of a channel after its elements were changed
+    void forgetRow(const int direction, const size_t channel);
+
+    //rebuild the tables and plans after a change of the gain elements
+    void invalidate(void);
+
+    //invalidate when a frequency moves into another band
+    void checkBand(const int direction, const size_t channel, const std::string &name, const double frequency);
+
+    //the device made by the driver, which runs the default gain algorithm
+    SoapySDR::Device *_driver;
+
+    mutable std::mutex _mutex;
+    mutable std::map<std::pair<int, size_t>, ChannelGain> _channels;
+    std::map<std::tuple<int, size_t, std::string>, Band> _bands;
+};
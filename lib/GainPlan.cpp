@@ -0,0 +1,39 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "GainPlan.hpp"
+
+//the innermost scope of the calling thread
+static thread_local GainPlan::Scope *currentScope = nullptr;
+
+std::shared_ptr<const GainPlan> GainPlan::make(const SoapySDR::Device &device, const int direction, const size_t channel)
+{
+    std::shared_ptr<GainPlan> plan(new GainPlan());
+    plan->names = device.listGains(direction, channel);
+    for (const auto &name : plan->names) plan->ranges.push_back(device.getGainRange(direction, channel, name));
+    return plan;
+}
+
+std::shared_ptr<const GainPlan> GainPlan::get(const SoapySDR::Device &device, const int direction, const size_t channel)
+{
+    for (auto scope = currentScope; scope != nullptr; scope = scope->previous)
+    {
+        if (scope->device == &device and scope->direction == direction and scope->channel == channel) return scope->plan;
+    }
+    return GainPlan::make(device, direction, channel);
+}
+
+GainPlan::Scope::Scope(const SoapySDR::Device &device, const int direction, const size_t channel, const std::shared_ptr<const GainPlan> &plan):
+    device(&device),
+    direction(direction),
+    channel(channel),
+    plan(plan),
+    previous(currentScope)
+{
+    currentScope = this;
+}
+
+GainPlan::Scope::~Scope(void)
+{
+    currentScope = previous;
+}
@@ -0,0 +1,43 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Device.hpp>
+#include <memory>
+#include <vector>
+#include <string>
+
+/*!
+ * GainPlan is the gain distribution of a channel for the default
+ * overall gain algorithm: the gain elements in order and their ranges.
+ *
+ * The gain layer caches the plans of its device, since it sees every
+ * antenna, frequency, and settings change which can invalidate them.
+ * It supplies the cached plan to the default algorithm with a Scope
+ * around the forwarded call. Calls made on the device directly
+ * have no scope and build a fresh plan from the device.
+ */
+struct GainPlan
+{
+    std::vector<std::string> names;
+    std::vector<SoapySDR::Range> ranges;
+
+    //! Build the plan of a channel from the device
+    static std::shared_ptr<const GainPlan> make(const SoapySDR::Device &device, const int direction, const size_t channel);
+
+    //! Get the plan supplied by a scope on this thread, or build it from the device
+    static std::shared_ptr<const GainPlan> get(const SoapySDR::Device &device, const int direction, const size_t channel);
+
+    //! Supply a plan to the calls on the device, direction, and channel made by this thread
+    struct Scope
+    {
+        Scope(const SoapySDR::Device &device, const int direction, const size_t channel, const std::shared_ptr<const GainPlan> &plan);
+        ~Scope(void);
+
+        const SoapySDR::Device *device;
+        const int direction;
+        const size_t channel;
+        const std::shared_ptr<const GainPlan> plan;
+        Scope *const previous;
+    };
+};
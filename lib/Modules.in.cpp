@@ -314,6 +314,10 @@ std::string SoapySDR::unloadModule(const std::string &path)
  **********************************************************************/
 
 void lateLoadNullDevice(void);
+void lateLoadSimDevice(void);
+void lateLoadFileDevice(void);
+void lateLoadMultiDevice(void);
+void lateLoadBrokerDevice(void);
 
 void automaticLoadModules(void)
 {
@@ -327,6 +331,10 @@ void automaticLoadModules(void)
     //initialize any static units in the library
     //rather than rely on static initialization
     lateLoadNullDevice();
+    lateLoadSimDevice();
+    lateLoadFileDevice();
+    lateLoadMultiDevice();
+    lateLoadBrokerDevice();
 
     //load the modules when not otherwise disabled
     if (enableAutomaticLoadModules) SoapySDR::loadModules();
@@ -339,6 +347,10 @@ void SoapySDR::loadModules(void)
     //initialize any static units in the library
     //rather than rely on static initialization
     lateLoadNullDevice();
+    lateLoadSimDevice();
+    lateLoadFileDevice();
+    lateLoadMultiDevice();
+    lateLoadBrokerDevice();
 
     const auto paths = listModules();
     for (size_t i = 0; i < paths.size(); i++)
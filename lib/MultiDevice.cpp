@@ -0,0 +1,816 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <deque>
+#include <memory>
+#include <cstring>
+
+/*******************************************************************
+ * Child device arguments are given as key[N]=value
+ ******************************************************************/
+static SoapySDR::KwargsList parseChildArgs(const SoapySDR::Kwargs &args)
+{
+    SoapySDR::KwargsList children;
+    for (const auto &it : args)
+    {
+        const auto open = it.first.find('[');
+        if (open == std::string::npos or it.first.back() != ']') continue;
+        const size_t index = SoapySDR::StringToSetting<size_t>(it.first.substr(open+1, it.first.size()-open-2));
+        if (children.size() <= index) children.resize(index+1);
+        children[index][it.first.substr(0, open)] = it.second;
+    }
+    for (size_t i = 0; i < children.size(); i++)
+    {
+        if (children[i].empty()) throw std::runtime_error("MultiDevice: missing args for child " + std::to_string(i));
+    }
+    return children;
+}
+
+/*******************************************************************
+ * Stream state: one child stream per device with a reader thread
+ ******************************************************************/
+struct MultiBlock
+{
+    std::vector<std::vector<char>> buffs;
+    size_t numElems;
+    size_t offset;
+    int flags;
+    long long timeNs;
+};
+
+struct MultiChildStream
+{
+    SoapySDR::Device *device;
+    SoapySDR::Stream *stream;
+    std::vector<size_t> outIndex; //caller's buffer index for each child channel
+    size_t mtu;
+
+    //blocks read by the thread, waiting to be aligned
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<std::unique_ptr<MultiBlock>> pool;
+    std::deque<MultiBlock *> free;
+    std::deque<MultiBlock *> full;
+    std::atomic<int> error;
+
+    //elements written by the first child but not this one, padded by the next write
+    size_t owed;
+};
+
+struct MultiStream
+{
+    int direction;
+    size_t channel; //the first channel of the stream
+    size_t elemSize;
+    double rate;
+    std::atomic<bool> running;
+    std::vector<std::unique_ptr<MultiChildStream>> children;
+};
+
+/*******************************************************************
+ * Aggregation of several devices into one
+ ******************************************************************/
+class MultiDevice : public SoapySDR::Device
+{
+public:
+    MultiDevice(const SoapySDR::Kwargs &args):
+        _numBlocks(8)
+    {
+        const auto childArgs = parseChildArgs(args);
+        if (childArgs.empty()) throw std::runtime_error("MultiDevice: no child devices specified, use key[N]=value");
+        if (args.count("buffers") != 0) _numBlocks = std::max<size_t>(SoapySDR::StringToSetting<size_t>(args.at("buffers")), 2);
+        _devices = SoapySDR::Device::make(childArgs);
+
+        //the channels are the union of the children's channels in order
+        for (const int dir : {SOAPY_SDR_TX, SOAPY_SDR_RX})
+        {
+            for (size_t i = 0; i < _devices.size(); i++)
+            {
+                const size_t numChans = _devices[i]->getNumChannels(dir);
+                for (size_t ch = 0; ch < numChans; ch++) _channels[dir].emplace_back(i, ch);
+            }
+        }
+    }
+
+    ~MultiDevice(void)
+    {
+        SoapySDR::Device::unmake(_devices);
+    }
+
+    /*******************************************************************
+     * Identification API
+     ******************************************************************/
+    std::string getDriverKey(void) const
+    {
+        return "multi";
+    }
+
+    std::string getHardwareKey(void) const
+    {
+        std::string key;
+        for (const auto device : _devices)
+        {
+            if (not key.empty()) key += ",";
+            key += device->getHardwareKey();
+        }
+        return key;
+    }
+
+    SoapySDR::Kwargs getHardwareInfo(void) const
+    {
+        SoapySDR::Kwargs info;
+        for (size_t i = 0; i < _devices.size(); i++)
+        {
+            const auto suffix = "[" + std::to_string(i) + "]";
+            info["driver" + suffix] = _devices[i]->getDriverKey();
+            info["hardware" + suffix] = _devices[i]->getHardwareKey();
+            for (const auto &it : _devices[i]->getHardwareInfo()) info[it.first + suffix] = it.second;
+        }
+        return info;
+    }
+
+    /*******************************************************************
+     * Channels API
+     ******************************************************************/
+    size_t getNumChannels(const int direction) const
+    {
+        return _channels[direction].size();
+    }
+
+    SoapySDR::Kwargs getChannelInfo(const int direction, const size_t channel) const
+    {
+        auto info = this->child(direction, channel)->getChannelInfo(direction, this->local(direction, channel));
+        info["device"] = std::to_string(_channels[direction].at(channel).first);
+        return info;
+    }
+
+    bool getFullDuplex(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getFullDuplex(direction, this->local(direction, channel));
+    }
+
+    /*******************************************************************
+     * Stream API
+     ******************************************************************/
+    std::vector<std::string> getStreamFormats(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getStreamFormats(direction, this->local(direction, channel));
+    }
+
+    std::string getNativeStreamFormat(const int direction, const size_t channel, double &fullScale) const
+    {
+        return this->child(direction, channel)->getNativeStreamFormat(direction, this->local(direction, channel), fullScale);
+    }
+
+    SoapySDR::ArgInfoList getStreamArgsInfo(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getStreamArgsInfo(direction, this->local(direction, channel));
+    }
+
+    SoapySDR::Stream *setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+    {
+        const std::vector<size_t> chans(channels.empty()?std::vector<size_t>(1, 0):channels);
+        std::unique_ptr<MultiStream> stream(new MultiStream());
+        stream->direction = direction;
+        stream->channel = chans.front();
+        stream->elemSize = SoapySDR::formatToSize(format);
+        stream->rate = 0.0;
+        stream->running = false;
+
+        //group the requested channels by child device
+        std::vector<std::vector<size_t>> localChans(_devices.size());
+        std::vector<std::vector<size_t>> outIndex(_devices.size());
+        for (size_t i = 0; i < chans.size(); i++)
+        {
+            const auto &mapping = _channels[direction].at(chans[i]);
+            localChans[mapping.first].push_back(mapping.second);
+            outIndex[mapping.first].push_back(i);
+        }
+
+        try
+        {
+            for (size_t i = 0; i < _devices.size(); i++)
+            {
+                if (localChans[i].empty()) continue;
+                std::unique_ptr<MultiChildStream> child(new MultiChildStream());
+                child->device = _devices[i];
+                child->stream = _devices[i]->setupStream(direction, format, localChans[i], args);
+                child->outIndex = outIndex[i];
+                child->mtu = _devices[i]->getStreamMTU(child->stream);
+                child->error = 0;
+                child->owed = 0;
+                stream->children.push_back(std::move(child));
+            }
+        }
+        catch (...)
+        {
+            for (const auto &child : stream->children) child->device->closeStream(child->stream);
+            throw;
+        }
+        return reinterpret_cast<SoapySDR::Stream *>(stream.release());
+    }
+
+    void closeStream(SoapySDR::Stream *handle)
+    {
+        auto stream = reinterpret_cast<MultiStream *>(handle);
+        this->stopReaders(stream);
+        for (const auto &child : stream->children) child->device->closeStream(child->stream);
+        delete stream;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *handle) const
+    {
+        auto stream = reinterpret_cast<MultiStream *>(handle);
+        size_t mtu = stream->children.front()->mtu;
+        for (const auto &child : stream->children) mtu = std::min(mtu, child->mtu);
+        return mtu;
+    }
+
+    int activateStream(SoapySDR::Stream *handle, const int flags, const long long timeNs, const size_t numElems)
+    {
+        auto stream = reinterpret_cast<MultiStream *>(handle);
+        for (size_t i = 0; i < stream->children.size(); i++)
+        {
+            const auto &child = stream->children[i];
+            const int ret = child->device->activateStream(child->stream, flags, timeNs, numElems);
+            if (ret == 0) continue;
+
+            //leave none of the children streaming when one of them fails
+            for (size_t j = 0; j < i; j++) stream->children[j]->device->deactivateStream(stream->children[j]->stream, 0, 0);
+            return ret;
+        }
+        for (const auto &child : stream->children) child->owed = 0;
+
+        //the time alignment uses the rate of the first channel of the stream
+        stream->rate = this->getSampleRate(stream->direction, stream->channel);
+        if (stream->direction == SOAPY_SDR_RX) this->startReaders(stream);
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *handle, const int flags, const long long timeNs)
+    {
+        auto stream = reinterpret_cast<MultiStream *>(handle);
+        this->stopReaders(stream);
+        int ret = 0;
+        for (const auto &child : stream->children)
+        {
+            const int r = child->device->deactivateStream(child->stream, flags, timeNs);
+            if (r != 0) ret = r;
+        }
+        return ret;
+    }
+
+    /*!
+     * Align the blocks of each child by timestamp and return
+     * the overlapping elements from every child in one read.
+     */
+    int readStream(SoapySDR::Stream *handle, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<MultiStream *>(handle);
+        if (stream->direction != SOAPY_SDR_RX) return SOAPY_SDR_NOT_SUPPORTED;
+        if (not stream->running) return SOAPY_SDR_STREAM_ERROR;
+        const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+        flags = 0;
+
+        while (true)
+        {
+            //report errors such as overflow from any child, the next read realigns
+            for (const auto &child : stream->children)
+            {
+                const int error = child->error.exchange(0);
+                if (error != 0) return error;
+            }
+
+            //wait for a block from every child
+            std::vector<MultiBlock *> heads;
+            for (const auto &child : stream->children)
+            {
+                std::unique_lock<std::mutex> lock(child->mutex);
+                if (not child->cond.wait_until(lock, exitTime, [&child]{return not child->full.empty();})) return SOAPY_SDR_TIMEOUT;
+                heads.push_back(child->full.front());
+            }
+
+            //drop the leading elements of children that started before the others
+            bool aligned = true;
+            const bool hasTime = stream->rate > 0.0 and std::all_of(heads.begin(), heads.end(),
+                [](const MultiBlock *b){return (b->flags & SOAPY_SDR_HAS_TIME) != 0;});
+            long long alignNs = 0;
+            if (hasTime)
+            {
+                for (const auto head : heads) alignNs = std::max(alignNs, this->headTimeNs(stream, head));
+                for (size_t i = 0; i < heads.size(); i++)
+                {
+                    const long long ticks = SoapySDR::timeNsToTicks(alignNs - this->headTimeNs(stream, heads[i]), stream->rate);
+                    if (ticks <= 0) continue;
+                    aligned = false;
+                    heads[i]->offset += std::min<size_t>(size_t(ticks), heads[i]->numElems-heads[i]->offset);
+                    if (heads[i]->offset == heads[i]->numElems) this->recycle(stream->children[i].get());
+                }
+            }
+            if (not aligned) continue;
+
+            //copy the overlapping elements into the caller's buffers
+            size_t n = numElems;
+            for (const auto head : heads) n = std::min(n, head->numElems-head->offset);
+            for (size_t i = 0; i < heads.size(); i++)
+            {
+                const auto &child = stream->children[i];
+                for (size_t ch = 0; ch < child->outIndex.size(); ch++)
+                {
+                    std::memcpy(buffs[child->outIndex[ch]], heads[i]->buffs[ch].data()+heads[i]->offset*stream->elemSize, n*stream->elemSize);
+                }
+                heads[i]->offset += n;
+                if (heads[i]->offset != heads[i]->numElems) continue;
+                if ((heads[i]->flags & SOAPY_SDR_END_BURST) != 0) flags |= SOAPY_SDR_END_BURST;
+                this->recycle(child.get());
+            }
+
+            if (hasTime)
+            {
+                flags |= SOAPY_SDR_HAS_TIME;
+                timeNs = alignNs;
+            }
+            return int(n);
+        }
+    }
+
+    int writeStream(SoapySDR::Stream *handle, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<MultiStream *>(handle);
+        if (stream->direction != SOAPY_SDR_TX) return SOAPY_SDR_NOT_SUPPORTED;
+
+        //pad the children that failed a previous write with zeros,
+        //a timed write realigns every child so the padding is not needed
+        for (const auto &child : stream->children)
+        {
+            if ((flags & SOAPY_SDR_HAS_TIME) != 0) child->owed = 0;
+            const std::vector<char> zeros(std::min(child->owed, child->mtu)*stream->elemSize, 0);
+            const std::vector<const void *> ptrs(child->outIndex.size(), zeros.data());
+            while (child->owed != 0)
+            {
+                int padFlags = 0;
+                const int ret = child->device->writeStream(child->stream, ptrs.data(), std::min(child->owed, child->mtu), padFlags, 0, timeoutUs);
+                if (ret < 0) return ret;
+                child->owed -= size_t(ret);
+            }
+        }
+
+        //write the same elements to every child so that they stay aligned:
+        //the first child accepts what it can, and the others write exactly that many,
+        //a child that fails owes the rest and the error is returned after the others are written
+        size_t numWritten = numElems;
+        int error = 0;
+        for (const auto &child : stream->children)
+        {
+            const bool first = child == stream->children.front();
+            std::vector<const void *> ptrs(child->outIndex.size());
+            size_t total = 0;
+            do
+            {
+                for (size_t ch = 0; ch < ptrs.size(); ch++)
+                {
+                    ptrs[ch] = reinterpret_cast<const char *>(buffs[child->outIndex[ch]]) + total*stream->elemSize;
+                }
+                int childFlags = flags;
+                if (total != 0) childFlags &= ~SOAPY_SDR_HAS_TIME;
+                if (numWritten != numElems) childFlags &= ~SOAPY_SDR_END_BURST;
+                const int ret = child->device->writeStream(child->stream, ptrs.data(), numWritten-total, childFlags, timeNs, timeoutUs);
+                if (ret < 0 and first) return ret;
+                if (ret < 0)
+                {
+                    child->owed += numWritten-total;
+                    error = ret;
+                    break;
+                }
+                total += size_t(ret);
+                if (first) numWritten = total;
+            } while (total < numWritten);
+        }
+        return (error != 0)?error:int(numWritten);
+    }
+
+    int readStreamStatus(SoapySDR::Stream *handle, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<MultiStream *>(handle);
+        const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+
+        //poll the children, the channel mask is translated to the caller's channels
+        do
+        {
+            for (const auto &child : stream->children)
+            {
+                size_t childMask = 0;
+                const int ret = child->device->readStreamStatus(child->stream, childMask, flags, timeNs, 0);
+                if (ret == SOAPY_SDR_TIMEOUT) continue;
+                if (ret == SOAPY_SDR_NOT_SUPPORTED) return ret;
+                chanMask = 0;
+                for (size_t ch = 0; ch < child->outIndex.size(); ch++)
+                {
+                    if ((childMask & (size_t(1) << ch)) != 0) chanMask |= size_t(1) << child->outIndex[ch];
+                }
+                return ret;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        } while (std::chrono::steady_clock::now() < exitTime);
+        return SOAPY_SDR_TIMEOUT;
+    }
+
+    /*******************************************************************
+     * Antenna API
+     ******************************************************************/
+    std::vector<std::string> listAntennas(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->listAntennas(direction, this->local(direction, channel));
+    }
+
+    void setAntenna(const int direction, const size_t channel, const std::string &name)
+    {
+        this->child(direction, channel)->setAntenna(direction, this->local(direction, channel), name);
+    }
+
+    std::string getAntenna(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getAntenna(direction, this->local(direction, channel));
+    }
+
+    /*******************************************************************
+     * Gain API
+     ******************************************************************/
+    std::vector<std::string> listGains(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->listGains(direction, this->local(direction, channel));
+    }
+
+    bool hasGainMode(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->hasGainMode(direction, this->local(direction, channel));
+    }
+
+    void setGainMode(const int direction, const size_t channel, const bool automatic)
+    {
+        this->child(direction, channel)->setGainMode(direction, this->local(direction, channel), automatic);
+    }
+
+    bool getGainMode(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getGainMode(direction, this->local(direction, channel));
+    }
+
+    void setGain(const int direction, const size_t channel, const double value)
+    {
+        this->child(direction, channel)->setGain(direction, this->local(direction, channel), value);
+    }
+
+    void setGain(const int direction, const size_t channel, const std::string &name, const double value)
+    {
+        this->child(direction, channel)->setGain(direction, this->local(direction, channel), name, value);
+    }
+
+    double getGain(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getGain(direction, this->local(direction, channel));
+    }
+
+    double getGain(const int direction, const size_t channel, const std::string &name) const
+    {
+        return this->child(direction, channel)->getGain(direction, this->local(direction, channel), name);
+    }
+
+    SoapySDR::Range getGainRange(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getGainRange(direction, this->local(direction, channel));
+    }
+
+    SoapySDR::Range getGainRange(const int direction, const size_t channel, const std::string &name) const
+    {
+        return this->child(direction, channel)->getGainRange(direction, this->local(direction, channel), name);
+    }
+
+    /*******************************************************************
+     * Frequency API
+     ******************************************************************/
+    void setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args)
+    {
+        this->child(direction, channel)->setFrequency(direction, this->local(direction, channel), frequency, args);
+    }
+
+    void setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args)
+    {
+        this->child(direction, channel)->setFrequency(direction, this->local(direction, channel), name, frequency, args);
+    }
+
+    double getFrequency(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getFrequency(direction, this->local(direction, channel));
+    }
+
+    double getFrequency(const int direction, const size_t channel, const std::string &name) const
+    {
+        return this->child(direction, channel)->getFrequency(direction, this->local(direction, channel), name);
+    }
+
+    std::vector<std::string> listFrequencies(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->listFrequencies(direction, this->local(direction, channel));
+    }
+
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getFrequencyRange(direction, this->local(direction, channel));
+    }
+
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel, const std::string &name) const
+    {
+        return this->child(direction, channel)->getFrequencyRange(direction, this->local(direction, channel), name);
+    }
+
+    SoapySDR::ArgInfoList getFrequencyArgsInfo(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getFrequencyArgsInfo(direction, this->local(direction, channel));
+    }
+
+    /*******************************************************************
+     * Sample Rate API
+     ******************************************************************/
+    void setSampleRate(const int direction, const size_t channel, const double rate)
+    {
+        this->child(direction, channel)->setSampleRate(direction, this->local(direction, channel), rate);
+    }
+
+    double getSampleRate(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getSampleRate(direction, this->local(direction, channel));
+    }
+
+    SoapySDR::RangeList getSampleRateRange(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getSampleRateRange(direction, this->local(direction, channel));
+    }
+
+    /*******************************************************************
+     * Bandwidth API
+     ******************************************************************/
+    void setBandwidth(const int direction, const size_t channel, const double bw)
+    {
+        this->child(direction, channel)->setBandwidth(direction, this->local(direction, channel), bw);
+    }
+
+    double getBandwidth(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getBandwidth(direction, this->local(direction, channel));
+    }
+
+    SoapySDR::RangeList getBandwidthRange(const int direction, const size_t channel) const
+    {
+        return this->child(direction, channel)->getBandwidthRange(direction, this->local(direction, channel));
+    }
+
+    /*******************************************************************
+     * Clocking API
+     ******************************************************************/
+    void setMasterClockRate(const double rate)
+    {
+        this->forEachDevice([rate](SoapySDR::Device *d){d->setMasterClockRate(rate);});
+    }
+
+    double getMasterClockRate(void) const
+    {
+        return _devices.front()->getMasterClockRate();
+    }
+
+    std::vector<std::string> listClockSources(void) const
+    {
+        return _devices.front()->listClockSources();
+    }
+
+    void setClockSource(const std::string &source)
+    {
+        this->forEachDevice([&source](SoapySDR::Device *d){d->setClockSource(source);});
+    }
+
+    std::string getClockSource(void) const
+    {
+        return _devices.front()->getClockSource();
+    }
+
+    /*******************************************************************
+     * Time API
+     ******************************************************************/
+    std::vector<std::string> listTimeSources(void) const
+    {
+        return _devices.front()->listTimeSources();
+    }
+
+    void setTimeSource(const std::string &source)
+    {
+        this->forEachDevice([&source](SoapySDR::Device *d){d->setTimeSource(source);});
+    }
+
+    std::string getTimeSource(void) const
+    {
+        return _devices.front()->getTimeSource();
+    }
+
+    bool hasHardwareTime(const std::string &what) const
+    {
+        return _devices.front()->hasHardwareTime(what);
+    }
+
+    long long getHardwareTime(const std::string &what) const
+    {
+        return _devices.front()->getHardwareTime(what);
+    }
+
+    void setHardwareTime(const long long timeNs, const std::string &what)
+    {
+        this->forEachDevice([timeNs, &what](SoapySDR::Device *d){d->setHardwareTime(timeNs, what);});
+    }
+
+    void setCommandTime(const long long timeNs, const std::string &what)
+    {
+        this->forEachDevice([timeNs, &what](SoapySDR::Device *d){d->setCommandTime(timeNs, what);});
+    }
+
+    /*******************************************************************
+     * Settings API
+     ******************************************************************/
+    void writeSetting(const std::string &key, const std::string &value)
+    {
+        this->forEachDevice([&key, &value](SoapySDR::Device *d){d->writeSetting(key, value);});
+    }
+
+    std::string readSetting(const std::string &key) const
+    {
+        return _devices.front()->readSetting(key);
+    }
+
+    void writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value)
+    {
+        this->child(direction, channel)->writeSetting(direction, this->local(direction, channel), key, value);
+    }
+
+    std::string readSetting(const int direction, const size_t channel, const std::string &key) const
+    {
+        return this->child(direction, channel)->readSetting(direction, this->local(direction, channel), key);
+    }
+
+private:
+    SoapySDR::Device *child(const int direction, const size_t channel) const
+    {
+        return _devices[_channels[direction].at(channel).first];
+    }
+
+    size_t local(const int direction, const size_t channel) const
+    {
+        return _channels[direction].at(channel).second;
+    }
+
+    //apply a call to every child in parallel, rethrowing the first error
+    void forEachDevice(const std::function<void(SoapySDR::Device *)> &fcn)
+    {
+        std::vector<std::future<void>> futures;
+        for (const auto device : _devices) futures.push_back(std::async(std::launch::async, fcn, device));
+        for (auto &future : futures) future.wait();
+        for (auto &future : futures) future.get();
+    }
+
+    long long headTimeNs(const MultiStream *stream, const MultiBlock *block) const
+    {
+        return block->timeNs + SoapySDR::ticksToTimeNs(block->offset, stream->rate);
+    }
+
+    void recycle(MultiChildStream *child)
+    {
+        std::lock_guard<std::mutex> lock(child->mutex);
+        child->free.push_back(child->full.front());
+        child->full.pop_front();
+        child->cond.notify_all();
+    }
+
+    void startReaders(MultiStream *stream)
+    {
+        stream->running = true;
+        for (const auto &child : stream->children)
+        {
+            if (child->pool.empty()) for (size_t i = 0; i < _numBlocks; i++)
+            {
+                std::unique_ptr<MultiBlock> block(new MultiBlock());
+                block->buffs.resize(child->outIndex.size(), std::vector<char>(child->mtu*stream->elemSize));
+                child->pool.push_back(std::move(block));
+            }
+            child->free.clear();
+            child->full.clear();
+            for (const auto &block : child->pool) child->free.push_back(block.get());
+            child->error = 0;
+            child->thread = std::thread(&MultiDevice::readerThread, stream, child.get());
+        }
+    }
+
+    void stopReaders(MultiStream *stream)
+    {
+        stream->running = false;
+        for (const auto &child : stream->children)
+        {
+            {
+                std::lock_guard<std::mutex> lock(child->mutex);
+                child->cond.notify_all();
+            }
+            if (child->thread.joinable()) child->thread.join();
+        }
+    }
+
+    static void readerThread(MultiStream *stream, MultiChildStream *child)
+    {
+        std::vector<void *> ptrs(child->outIndex.size());
+        while (stream->running)
+        {
+            MultiBlock *block(nullptr);
+            {
+                std::unique_lock<std::mutex> lock(child->mutex);
+                child->cond.wait(lock, [stream, child]{return not stream->running or not child->free.empty();});
+                if (not stream->running) return;
+                block = child->free.front();
+                child->free.pop_front();
+            }
+
+            for (size_t ch = 0; ch < ptrs.size(); ch++) ptrs[ch] = block->buffs[ch].data();
+            const int ret = child->device->readStream(child->stream, ptrs.data(), child->mtu, block->flags, block->timeNs, 100000);
+            if (ret < 0 and ret != SOAPY_SDR_TIMEOUT) child->error = ret;
+
+            {
+                std::lock_guard<std::mutex> lock(child->mutex);
+                if (ret <= 0) child->free.push_front(block);
+                else
+                {
+                    block->numElems = size_t(ret);
+                    block->offset = 0;
+                    child->full.push_back(block);
+                }
+                child->cond.notify_all();
+            }
+
+            //an error other than an overflow may persist, so do not spin on it
+            if (ret < 0 and ret != SOAPY_SDR_TIMEOUT and ret != SOAPY_SDR_OVERFLOW)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+    }
+
+    std::vector<SoapySDR::Device *> _devices;
+    std::vector<std::pair<size_t, size_t>> _channels[2]; //(device index, child channel) per direction
+    size_t _numBlocks;
+};
+
+/*******************************************************************
+ * Registration
+ ******************************************************************/
+SoapySDR::KwargsList findMultiDevice(const SoapySDR::Kwargs &args)
+{
+    SoapySDR::KwargsList results;
+
+    //require that the user specify driver=multi
+    if (args.count("driver") == 0 or args.at("driver") != "multi") return results;
+    const auto children = parseChildArgs(args);
+    if (children.empty()) return results;
+
+    //the child args identify this aggregate device
+    SoapySDR::Kwargs multiArgs;
+    for (const auto &it : args)
+    {
+        if (it.first.find('[') != std::string::npos) multiArgs[it.first] = it.second;
+    }
+    multiArgs["label"] = "Multi device (" + std::to_string(children.size()) + " children)";
+    results.push_back(multiArgs);
+
+    return results;
+}
+
+SoapySDR::Device *makeMultiDevice(const SoapySDR::Kwargs &args)
+{
+    return new MultiDevice(args);
+}
+
+/*!
+ * lateLoadMultiDevice() is called by loadModules()
+ * to load the multi device on-demand/not statically.
+ * See lateLoadNullDevice() for the reasoning.
+ */
+void lateLoadMultiDevice(void)
+{
+    static SoapySDR::Registry registerMultiDevice("multi", &findMultiDevice, &makeMultiDevice, SOAPY_SDR_ABI_VERSION);
+}
@@ -0,0 +1,200 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "PolyphaseChannelizer.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+static const double PI = 3.14159265358979323846;
+
+//below this many outputs per worker the job runs on the calling thread
+static const size_t MIN_OUTPUTS_PER_JOB = 64;
+
+/*******************************************************************
+ * Filter design and setup
+ ******************************************************************/
+PolyphaseChannelizer::PolyphaseChannelizer(const size_t numChans, const size_t tapsPerChan, const size_t numThreads):
+    _numChans(numChans),
+    _numTaps(std::max<size_t>(tapsPerChan, 1)),
+    _in(nullptr),
+    _out(nullptr),
+    _numOut(0),
+    _numJobs(0),
+    _scratch(numThreads+1, std::vector<float>(2*numChans)),
+    _generation(0),
+    _pending(0),
+    _done(false)
+{
+    if (numChans < 2 or (numChans & (numChans-1)) != 0)
+    {
+        throw std::runtime_error("PolyphaseChannelizer: the number of channels must be a power of two");
+    }
+
+    //windowed sinc prototype with a cutoff at half the channel spacing
+    const size_t length = _numChans*_numTaps;
+    std::vector<double> proto(length);
+    double sum = 0.0;
+    for (size_t i = 0; i < length; i++)
+    {
+        const double t = (double(i) - (length-1)/2.0)/_numChans;
+        const double sinc = (t == 0.0)?1.0:std::sin(PI*t)/(PI*t);
+        const double x = 2*PI*i/(length-1);
+        const double window = 0.35875 - 0.48829*std::cos(x) + 0.14128*std::cos(2*x) - 0.01168*std::cos(3*x);
+        proto[i] = sinc*window;
+        sum += proto[i];
+    }
+
+    //branch p holds taps h[p*M + M-1-m] so the inner loop runs forward over the input
+    _branches.resize(_numTaps, std::vector<float>(2*_numChans));
+    for (size_t p = 0; p < _numTaps; p++)
+    {
+        for (size_t m = 0; m < _numChans; m++)
+        {
+            const float tap = float(proto[p*_numChans + _numChans-1-m]/sum);
+            _branches[p][2*m+0] = tap;
+            _branches[p][2*m+1] = tap;
+        }
+    }
+
+    //fft tables
+    size_t bits = 0;
+    while ((size_t(1) << bits) < _numChans) bits++;
+    _bitReverse.resize(_numChans);
+    for (size_t i = 0; i < _numChans; i++)
+    {
+        size_t r = 0;
+        for (size_t b = 0; b < bits; b++) if ((i >> b) & 1) r |= size_t(1) << (bits-1-b);
+        _bitReverse[i] = r;
+    }
+    _twiddles.resize(_numChans);
+    for (size_t i = 0; i < _numChans/2; i++)
+    {
+        _twiddles[2*i+0] = float(std::cos(-2*PI*i/_numChans));
+        _twiddles[2*i+1] = float(std::sin(-2*PI*i/_numChans));
+    }
+
+    for (size_t i = 0; i < numThreads; i++)
+    {
+        _workers.emplace_back(&PolyphaseChannelizer::workerLoop, this, i+1);
+    }
+}
+
+PolyphaseChannelizer::~PolyphaseChannelizer(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _done = true;
+        _cond.notify_all();
+    }
+    for (auto &worker : _workers) worker.join();
+}
+
+/*******************************************************************
+ * Processing
+ ******************************************************************/
+void PolyphaseChannelizer::process(const std::complex<float> *in, const size_t numOut, std::complex<float> *out)
+{
+    _in = in;
+    _out = out;
+    _numOut = numOut;
+    _numJobs = std::max<size_t>(std::min(_workers.size()+1, numOut/MIN_OUTPUTS_PER_JOB), 1);
+    if (_numJobs == 1) return this->processRange(0, numOut, _scratch[0]);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending = _workers.size();
+        _generation++;
+        _cond.notify_all();
+    }
+
+    this->processRange(0, numOut/_numJobs, _scratch[0]);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cond.wait(lock, [this]{return _pending == 0;});
+}
+
+void PolyphaseChannelizer::workerLoop(const size_t index)
+{
+    unsigned long long generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cond.wait(lock, [this, generation]{return _done or _generation != generation;});
+            if (_done) return;
+            generation = _generation;
+        }
+
+        if (index < _numJobs)
+        {
+            const size_t first = index*_numOut/_numJobs;
+            const size_t last = (index+1)*_numOut/_numJobs;
+            this->processRange(first, last, _scratch[index]);
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_pending == 0) _cond.notify_all();
+    }
+}
+
+void PolyphaseChannelizer::processRange(const size_t first, const size_t last, std::vector<float> &scratch)
+{
+    const float *in = reinterpret_cast<const float *>(_in);
+    float *w = scratch.data();
+    const size_t width = 2*_numChans;
+
+    for (size_t n = first; n < last; n++)
+    {
+        //branch filters, one output chunk of M samples uses the K most recent chunks
+        std::fill(scratch.begin(), scratch.end(), 0.0f);
+        for (size_t p = 0; p < _numTaps; p++)
+        {
+            const float *x = in + (n + _numTaps-1 - p)*width;
+            const float *g = _branches[p].data();
+            for (size_t i = 0; i < width; i++) w[i] += g[i]*x[i];
+        }
+
+        //the fft of the branch outputs is one sample for every channel
+        this->fft(w);
+        for (size_t k = 0; k < _numChans; k++)
+        {
+            _out[k*_numOut + n] = std::complex<float>(w[2*k+0], w[2*k+1]);
+        }
+    }
+}
+
+void PolyphaseChannelizer::fft(float *data) const
+{
+    //bit reversed reordering
+    for (size_t i = 0; i < _numChans; i++)
+    {
+        const size_t r = _bitReverse[i];
+        if (r <= i) continue;
+        std::swap(data[2*i+0], data[2*r+0]);
+        std::swap(data[2*i+1], data[2*r+1]);
+    }
+
+    //iterative radix-2 butterflies
+    for (size_t size = 2; size <= _numChans; size *= 2)
+    {
+        const size_t half = size/2;
+        const size_t stride = _numChans/size;
+        for (size_t start = 0; start < _numChans; start += size)
+        {
+            for (size_t j = 0; j < half; j++)
+            {
+                const float wr = _twiddles[2*j*stride+0];
+                const float wi = _twiddles[2*j*stride+1];
+                float *a = data + 2*(start+j);
+                float *b = data + 2*(start+j+half);
+                const float tr = b[0]*wr - b[1]*wi;
+                const float ti = b[0]*wi + b[1]*wr;
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <condition_variable>
+#include <complex>
+#include <vector>
+#include <thread>
+#include <mutex>
+
+/*!
+ * PolyphaseChannelizer is a critically sampled analysis filter bank.
+ * Every M input samples produce one output sample for each of the M channels,
+ * channel k is centered on k*rate/M (channels above M/2 are negative offsets).
+ * The M branch filters are followed by an FFT, and large blocks are split
+ * across a small pool of worker threads.
+ */
+class PolyphaseChannelizer
+{
+public:
+    /*!
+     * \param numChans the number of channels M, a power of two
+     * \param tapsPerChan the prototype filter length per branch
+     * \param numThreads the number of worker threads besides the caller
+     */
+    PolyphaseChannelizer(const size_t numChans, const size_t tapsPerChan, const size_t numThreads);
+
+    ~PolyphaseChannelizer(void);
+
+    //! The number of input samples which must precede the input block
+    size_t getHistoryLength(void) const
+    {
+        return (_numTaps-1)*_numChans;
+    }
+
+    /*!
+     * Channelize numOut*M input samples.
+     * \param in the history followed by numOut*M new input samples
+     * \param numOut the number of output samples per channel
+     * \param out the output, channel k starts at out + k*numOut
+     */
+    void process(const std::complex<float> *in, const size_t numOut, std::complex<float> *out);
+
+private:
+    void processRange(const size_t first, const size_t last, std::vector<float> &scratch);
+    void fft(float *data) const;
+    void workerLoop(const size_t index);
+
+    const size_t _numChans;
+    const size_t _numTaps;
+
+    //branch filters, each tap duplicated for the real and imaginary parts
+    std::vector<std::vector<float>> _branches;
+
+    //fft tables
+    std::vector<size_t> _bitReverse;
+    std::vector<float> _twiddles;
+
+    //the current job, split in equal ranges between the workers
+    const std::complex<float> *_in;
+    std::complex<float> *_out;
+    size_t _numOut;
+    size_t _numJobs;
+    std::vector<std::vector<float>> _scratch;
+
+    //worker pool
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    unsigned long long _generation;
+    size_t _pending;
+    bool _done;
+};
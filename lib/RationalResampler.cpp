@@ -0,0 +1,111 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "RationalResampler.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+static const double PI = 3.14159265358979323846;
+
+//sinc zero crossings on each side of the prototype center
+static const size_t ZERO_CROSSINGS = 8;
+
+//independent accumulators in the inner loop, the vector width in floats
+static const size_t LANES = 8;
+
+/*******************************************************************
+ * Filter design and setup
+ ******************************************************************/
+RationalResampler::RationalResampler(const size_t interp, const size_t decim):
+    _interp(interp),
+    _decim(decim),
+    _numTaps(0),
+    _time(0)
+{
+    if (interp == 0 or decim == 0) throw std::runtime_error("RationalResampler: zero rate ratio");
+
+    //taps per phase cover the zero crossings of the narrower cutoff,
+    //rounded up so that a phase is a whole number of vectors
+    const size_t widest = std::max(interp, decim);
+    _numTaps = (2*ZERO_CROSSINGS*widest + interp-1)/interp;
+    _numTaps = ((2*_numTaps + LANES-1)/LANES)*LANES/2;
+
+    //windowed sinc prototype at the interpolated rate with a cutoff at the lower nyquist rate
+    const size_t length = _numTaps*_interp;
+    std::vector<double> proto(length);
+    double sum = 0.0;
+    for (size_t i = 0; i < length; i++)
+    {
+        const double t = (double(i) - (length-1)/2.0)/widest;
+        const double sinc = (t == 0.0)?1.0:std::sin(PI*t)/(PI*t);
+        const double x = 2*PI*(i+0.5)/length;
+        const double window = 0.35875 - 0.48829*std::cos(x) + 0.14128*std::cos(2*x) - 0.01168*std::cos(3*x);
+        proto[i] = sinc*window;
+        sum += proto[i];
+    }
+
+    //each phase has unity gain, duplicated for the real and imaginary parts
+    _phases.resize(_interp, std::vector<float>(2*_numTaps));
+    for (size_t p = 0; p < _interp; p++)
+    {
+        for (size_t i = 0; i < _numTaps; i++)
+        {
+            const float tap = float(proto[p + (_numTaps-1-i)*_interp]*_interp/sum);
+            _phases[p][2*i+0] = tap;
+            _phases[p][2*i+1] = tap;
+        }
+    }
+
+    this->reset();
+}
+
+double RationalResampler::getNextPosition(void) const
+{
+    const double delay = (_numTaps*_interp - 1)/2.0;
+    return (_time - delay)/_interp;
+}
+
+void RationalResampler::reset(void)
+{
+    _input.assign(_numTaps-1, std::complex<float>());
+    _time = 0;
+}
+
+/*******************************************************************
+ * Processing
+ ******************************************************************/
+size_t RationalResampler::process(const std::complex<float> *in, const size_t numIn, std::complex<float> *out)
+{
+    _input.insert(_input.end(), in, in + numIn);
+    const float *input = reinterpret_cast<const float *>(_input.data());
+    const size_t width = 2*_numTaps;
+
+    size_t numOut = 0;
+    while (_time/_interp < numIn)
+    {
+        //the window ends at the newest input sample for this output
+        const float *x = input + 2*(_time/_interp);
+        const float *g = _phases[_time%_interp].data();
+
+        float acc[LANES] = {};
+        for (size_t i = 0; i < width; i += LANES)
+        {
+            for (size_t j = 0; j < LANES; j++) acc[j] += g[i+j]*x[i+j];
+        }
+
+        float re = 0.0f, im = 0.0f;
+        for (size_t j = 0; j < LANES; j += 2)
+        {
+            re += acc[j+0];
+            im += acc[j+1];
+        }
+        out[numOut++] = std::complex<float>(re, im);
+        _time += _decim;
+    }
+
+    //keep the history for the next call
+    _input.erase(_input.begin(), _input.begin() + numIn);
+    _time -= numIn*_interp;
+    return numOut;
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <complex>
+#include <vector>
+
+/*!
+ * RationalResampler changes the sample rate of a complex stream by interp/decim.
+ * It is a polyphase filter: each output selects one of the interp phases of a
+ * windowed-sinc prototype and filters the most recent input samples with it.
+ * The filter state is kept across calls so a stream can be fed in any chunk size.
+ */
+class RationalResampler
+{
+public:
+    RationalResampler(const size_t interp, const size_t decim);
+
+    //! The largest number of outputs produced by numIn input samples
+    size_t getMaxOutputs(const size_t numIn) const
+    {
+        return (numIn*_interp)/_decim + 1;
+    }
+
+    /*!
+     * The signal position of the next output relative to the next input sample.
+     * The position is in input samples and includes the filter delay.
+     */
+    double getNextPosition(void) const;
+
+    //! Clear the filter history for a discontinuous input
+    void reset(void);
+
+    //! Resample numIn input samples, returns the number of outputs written
+    size_t process(const std::complex<float> *in, const size_t numIn, std::complex<float> *out);
+
+private:
+    const size_t _interp;
+    const size_t _decim;
+    size_t _numTaps;
+
+    //phase p holds taps h[p + (K-1-i)*interp] so the inner loop runs forward over the input
+    std::vector<std::vector<float>> _phases;
+
+    //the history followed by the current input
+    std::vector<std::complex<float>> _input;
+
+    //the time of the next output in units of 1/interp input samples
+    size_t _time;
+};
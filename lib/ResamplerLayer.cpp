@@ -0,0 +1,548 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ResamplerLayer.hpp"
+#include "RationalResampler.hpp"
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <memory>
+#include <cstring>
+#include <cmath>
+
+//the largest interpolation or decimation term of a ratio
+static const size_t MAX_TERM = 1024;
+
+//the lowest rate is the lowest device rate divided by this
+static const size_t MAX_DECIM = 64;
+
+/*******************************************************************
+ * Rate selection
+ ******************************************************************/
+static double chooseDeviceRate(const SoapySDR::RangeList &ranges, const double rate)
+{
+    //the lowest supported rate at or above the requested rate
+    double best = 0.0, highest = 0.0;
+    for (const auto &range : ranges)
+    {
+        highest = std::max(highest, range.maximum());
+        if (rate > range.maximum()) continue;
+        double candidate = std::max(rate, range.minimum());
+        if (range.step() > 0.0)
+        {
+            const double steps = std::ceil((candidate - range.minimum())/range.step() - 1e-9);
+            candidate = std::min(range.minimum() + steps*range.step(), range.maximum());
+        }
+        if (best == 0.0 or candidate < best) best = candidate;
+    }
+    return (best == 0.0)?highest:best;
+}
+
+static void rationalApprox(const double ratio, size_t &num, size_t &den)
+{
+    //continued fraction convergents until the terms get too large
+    size_t p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+    num = 1;
+    den = 1;
+    double x = ratio;
+    for (size_t i = 0; i < 64; i++)
+    {
+        const size_t a = size_t(std::floor(x));
+        const size_t p2 = a*p1 + p0, q2 = a*q1 + q0;
+        if (p2 > MAX_TERM or q2 > MAX_TERM) break;
+        p0 = p1; q0 = q1;
+        p1 = p2; q1 = q2;
+        if (p1 != 0)
+        {
+            num = p1;
+            den = q1;
+        }
+        const double frac = x - std::floor(x);
+        if (frac < 1e-9) break;
+        x = 1.0/frac;
+    }
+}
+
+/*******************************************************************
+ * Per-channel jobs on a small thread pool
+ ******************************************************************/
+class ChannelWorkers
+{
+public:
+    ChannelWorkers(const size_t numChans):
+        _job(nullptr),
+        _generation(0),
+        _pending(0),
+        _done(false)
+    {
+        for (size_t i = 1; i < numChans; i++)
+        {
+            _threads.emplace_back(&ChannelWorkers::workerLoop, this, i);
+        }
+    }
+
+    ~ChannelWorkers(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _done = true;
+            _cond.notify_all();
+        }
+        for (auto &thread : _threads) thread.join();
+    }
+
+    //run the job for every channel, channel 0 runs on the calling thread
+    void run(const std::function<void(const size_t)> &job)
+    {
+        if (_threads.empty()) return job(0);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _job = &job;
+            _pending = _threads.size();
+            _generation++;
+            _cond.notify_all();
+        }
+        job(0);
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this]{return _pending == 0;});
+    }
+
+private:
+    void workerLoop(const size_t index)
+    {
+        unsigned long long generation = 0;
+        while (true)
+        {
+            const std::function<void(const size_t)> *job = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cond.wait(lock, [this, generation]{return _done or _generation != generation;});
+                if (_done) return;
+                generation = _generation;
+                job = _job;
+            }
+            (*job)(index);
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (--_pending == 0) _cond.notify_all();
+        }
+    }
+
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    const std::function<void(const size_t)> *_job;
+    unsigned long long _generation;
+    size_t _pending;
+    bool _done;
+};
+
+/*******************************************************************
+ * Stream state
+ ******************************************************************/
+struct ResamplerStream
+{
+    SoapySDR::Stream *stream;
+    int direction;
+    size_t numChans;
+    SoapySDR::ConverterRegistry::ConverterFunction convert;
+    size_t elemSize;
+    size_t mtu;
+
+    //the resampler inputs and outputs for each channel
+    double inRate, outRate;
+    size_t inCapacity;
+    size_t delay;
+    std::vector<std::unique_ptr<RationalResampler>> resamplers;
+    std::vector<std::vector<std::complex<float>>> inBuffs, outBuffs;
+    std::unique_ptr<ChannelWorkers> workers;
+
+    //resampled outputs which are not yet read or written
+    size_t offset, count;
+    int outFlags;
+    long long outTimeNs;
+
+    //receive activation
+    bool hasStart;
+    long long startNs;
+    bool finite;
+    size_t remaining;
+
+    size_t resample(const size_t numIn)
+    {
+        std::vector<size_t> counts(numChans);
+        workers->run([this, numIn, &counts](const size_t ch)
+        {
+            counts[ch] = resamplers[ch]->process(inBuffs[ch].data(), numIn, outBuffs[ch].data() + count);
+        });
+        return counts[0];
+    }
+
+    void reset(void)
+    {
+        for (auto &resampler : resamplers) resampler->reset();
+        offset = 0;
+        count = 0;
+        outFlags = 0;
+        outTimeNs = 0;
+    }
+};
+
+/*******************************************************************
+ * Resampler setup
+ ******************************************************************/
+ResamplerLayer::ResamplerLayer(SoapySDR::Device *device):
+    DeviceDecorator(device)
+{
+    return;
+}
+
+ResamplerLayer::Ratio ResamplerLayer::getRatio(const int direction, const size_t channel) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _ratios.find(std::make_pair(direction, channel));
+    if (it != _ratios.end()) return it->second;
+    Ratio ratio;
+    ratio.deviceRate = 0.0;
+    ratio.interp = 1;
+    ratio.decim = 1;
+    return ratio;
+}
+
+/*******************************************************************
+ * Sample Rate API
+ ******************************************************************/
+void ResamplerLayer::setSampleRate(const int direction, const size_t channel, const double rate)
+{
+    const auto ranges = _device->getSampleRateRange(direction, channel);
+    _device->setSampleRate(direction, channel, ranges.empty()?rate:chooseDeviceRate(ranges, rate));
+
+    Ratio ratio;
+    ratio.deviceRate = _device->getSampleRate(direction, channel);
+    ratio.interp = 1;
+    ratio.decim = 1;
+    if (ratio.deviceRate > 0.0 and rate > 0.0)
+    {
+        //the device rate is never below the requested rate, unless it is above the highest rate
+        const double clipped = std::max(std::min(rate/ratio.deviceRate, 1.0), 1.0/MAX_DECIM);
+        rationalApprox(clipped, ratio.interp, ratio.decim);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (ratio.interp == ratio.decim) _ratios.erase(std::make_pair(direction, channel));
+    else _ratios[std::make_pair(direction, channel)] = ratio;
+}
+
+double ResamplerLayer::getSampleRate(const int direction, const size_t channel) const
+{
+    const auto ratio = this->getRatio(direction, channel);
+    if (ratio.interp == ratio.decim) return _device->getSampleRate(direction, channel);
+    return (ratio.deviceRate*ratio.interp)/ratio.decim;
+}
+
+SoapySDR::RangeList ResamplerLayer::getSampleRateRange(const int direction, const size_t channel) const
+{
+    const auto ranges = _device->getSampleRateRange(direction, channel);
+    if (ranges.empty()) return ranges;
+    double lowest = ranges.front().minimum(), highest = ranges.front().maximum();
+    for (const auto &range : ranges)
+    {
+        lowest = std::min(lowest, range.minimum());
+        highest = std::max(highest, range.maximum());
+    }
+    return {SoapySDR::Range(lowest/MAX_DECIM, highest)};
+}
+
+/*******************************************************************
+ * Stream API
+ ******************************************************************/
+SoapySDR::Stream *ResamplerLayer::setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+{
+    std::unique_ptr<ResamplerStream> stream(new ResamplerStream());
+    stream->direction = direction;
+    stream->numChans = channels.empty()?1:channels.size();
+
+    //all channels of a stream share one device stream, so they must share one ratio
+    const auto ratio = this->getRatio(direction, channels.empty()?0:channels.front());
+    for (size_t i = 1; i < channels.size(); i++)
+    {
+        const auto other = this->getRatio(direction, channels[i]);
+        if (other.interp != ratio.interp or other.decim != ratio.decim or other.deviceRate != ratio.deviceRate)
+        {
+            throw std::runtime_error("ResamplerLayer::setupStream() channels have different sample rates");
+        }
+    }
+
+    if (ratio.interp == ratio.decim)
+    {
+        stream->stream = _device->setupStream(direction, format, channels, args);
+        return reinterpret_cast<SoapySDR::Stream *>(stream.release());
+    }
+
+    stream->convert = nullptr;
+    if (format != SOAPY_SDR_CF32)
+    {
+        stream->convert = (direction == SOAPY_SDR_RX)?
+            SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CF32, format):
+            SoapySDR::ConverterRegistry::getFunction(format, SOAPY_SDR_CF32);
+        if (stream->convert == nullptr) throw std::runtime_error("ResamplerLayer::setupStream() cannot convert " + format);
+    }
+    stream->elemSize = SoapySDR::formatToSize(format);
+
+    //receive resamples from the device rate, transmit resamples to the device rate
+    const double userRate = (ratio.deviceRate*ratio.interp)/ratio.decim;
+    const size_t interp = (direction == SOAPY_SDR_RX)?ratio.interp:ratio.decim;
+    const size_t decim = (direction == SOAPY_SDR_RX)?ratio.decim:ratio.interp;
+    stream->inRate = (direction == SOAPY_SDR_RX)?ratio.deviceRate:userRate;
+    stream->outRate = (direction == SOAPY_SDR_RX)?userRate:ratio.deviceRate;
+    for (size_t i = 0; i < stream->numChans; i++)
+    {
+        stream->resamplers.emplace_back(new RationalResampler(interp, decim));
+    }
+    stream->delay = size_t(std::ceil(-stream->resamplers.front()->getNextPosition())) + 1;
+
+    stream->stream = _device->setupStream(direction, SOAPY_SDR_CF32, channels, args);
+    stream->mtu = _device->getStreamMTU(stream->stream);
+    stream->inCapacity = (direction == SOAPY_SDR_RX)?stream->mtu:std::max<size_t>((stream->mtu*decim)/interp, 1);
+    const size_t outCapacity = stream->resamplers.front()->getMaxOutputs(stream->inCapacity) + stream->resamplers.front()->getMaxOutputs(stream->delay);
+    stream->inBuffs.resize(stream->numChans, std::vector<std::complex<float>>(std::max(stream->inCapacity, stream->delay)));
+    stream->outBuffs.resize(stream->numChans, std::vector<std::complex<float>>(outCapacity));
+    stream->workers.reset(new ChannelWorkers(stream->numChans));
+    stream->hasStart = false;
+    stream->startNs = 0;
+    stream->finite = false;
+    stream->remaining = 0;
+    stream->reset();
+    return reinterpret_cast<SoapySDR::Stream *>(stream.release());
+}
+
+void ResamplerLayer::closeStream(SoapySDR::Stream *handle)
+{
+    std::unique_ptr<ResamplerStream> stream(reinterpret_cast<ResamplerStream *>(handle));
+    _device->closeStream(stream->stream);
+}
+
+size_t ResamplerLayer::getStreamMTU(SoapySDR::Stream *handle) const
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty()) return _device->getStreamMTU(stream->stream);
+    if (stream->direction == SOAPY_SDR_RX) return std::max<size_t>(size_t(stream->mtu*stream->outRate/stream->inRate), 1);
+    return stream->inCapacity;
+}
+
+int ResamplerLayer::activateStream(SoapySDR::Stream *handle, const int flags, const long long timeNs, const size_t numElems)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty() or stream->direction != SOAPY_SDR_RX)
+    {
+        if (not stream->resamplers.empty()) stream->reset();
+        return _device->activateStream(stream->stream, flags, timeNs, numElems);
+    }
+
+    //start the device early so the first output at the requested time has a full filter history
+    stream->reset();
+    stream->hasStart = (flags & SOAPY_SDR_HAS_TIME) != 0;
+    stream->startNs = timeNs;
+    stream->finite = numElems != 0;
+    stream->remaining = numElems;
+    const long long deviceTimeNs = stream->hasStart?(timeNs - SoapySDR::ticksToTimeNs(stream->delay, stream->inRate)):timeNs;
+    const size_t deviceElems = stream->finite?(size_t(std::ceil(numElems*stream->inRate/stream->outRate)) + 2*stream->delay):0;
+    return _device->activateStream(stream->stream, flags, deviceTimeNs, deviceElems);
+}
+
+int ResamplerLayer::deactivateStream(SoapySDR::Stream *handle, const int flags, const long long timeNs)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (not stream->resamplers.empty()) stream->reset();
+    return _device->deactivateStream(stream->stream, flags, timeNs);
+}
+
+int ResamplerLayer::readStream(SoapySDR::Stream *handle, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty()) return _device->readStream(stream->stream, buffs, numElems, flags, timeNs, timeoutUs);
+    if (stream->finite and stream->remaining == 0) return SOAPY_SDR_TIMEOUT;
+
+    //resample the next device buffer when the outputs are used up
+    while (stream->offset == stream->count)
+    {
+        std::vector<void *> inPtrs(stream->numChans);
+        for (size_t i = 0; i < stream->numChans; i++) inPtrs[i] = stream->inBuffs[i].data();
+        int inFlags(0);
+        long long inTimeNs(0);
+        const int ret = _device->readStream(stream->stream, inPtrs.data(), stream->inCapacity, inFlags, inTimeNs, timeoutUs);
+        if (ret == SOAPY_SDR_OVERFLOW) stream->reset();
+        if (ret < 0) return ret;
+
+        //the time of the first output from its position in the device buffer
+        const double position = stream->resamplers.front()->getNextPosition();
+        stream->offset = 0;
+        stream->count = 0;
+        stream->count = stream->resample(size_t(ret));
+        stream->outFlags = inFlags & (SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST);
+        stream->outTimeNs = inTimeNs + (long long)std::llround(position*1e9/stream->inRate);
+
+        //drop the outputs before a timed activation
+        if (stream->hasStart and (stream->outFlags & SOAPY_SDR_HAS_TIME) != 0)
+        {
+            const double skip = std::ceil((stream->startNs - stream->outTimeNs)*stream->outRate/1e9 - 1e-6);
+            stream->offset = size_t(std::max(0.0, std::min(skip, double(stream->count))));
+            if (stream->offset < stream->count) stream->hasStart = false;
+        }
+
+        //an end of burst is reported even without outputs
+        if (stream->count == 0 and (stream->outFlags & SOAPY_SDR_END_BURST) != 0)
+        {
+            flags = SOAPY_SDR_END_BURST;
+            return 0;
+        }
+    }
+
+    size_t n = std::min(numElems, stream->count - stream->offset);
+    if (stream->finite) n = std::min(n, stream->remaining);
+    for (size_t i = 0; i < stream->numChans; i++)
+    {
+        const auto src = stream->outBuffs[i].data() + stream->offset;
+        if (stream->convert == nullptr) std::memcpy(buffs[i], src, n*stream->elemSize);
+        else stream->convert(src, buffs[i], n, 1.0);
+    }
+
+    flags = stream->outFlags & SOAPY_SDR_HAS_TIME;
+    timeNs = stream->outTimeNs + SoapySDR::ticksToTimeNs(stream->offset, stream->outRate);
+    stream->offset += n;
+    if (stream->offset == stream->count) flags |= stream->outFlags & SOAPY_SDR_END_BURST;
+    if (stream->finite and (stream->remaining -= n) == 0) flags |= SOAPY_SDR_END_BURST;
+    return int(n);
+}
+
+int ResamplerLayer::writeStream(SoapySDR::Stream *handle, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty()) return _device->writeStream(stream->stream, buffs, numElems, flags, timeNs, timeoutUs);
+
+    //outputs from the previous call go out first
+    std::vector<const void *> outPtrs(stream->numChans);
+    while (stream->offset < stream->count)
+    {
+        for (size_t i = 0; i < stream->numChans; i++) outPtrs[i] = stream->outBuffs[i].data() + stream->offset;
+        int outFlags = stream->outFlags;
+        const int ret = _device->writeStream(stream->stream, outPtrs.data(), stream->count - stream->offset, outFlags, stream->outTimeNs, timeoutUs);
+        if (ret < 0) return ret;
+        stream->offset += size_t(ret);
+        if (ret != 0) stream->outFlags &= ~SOAPY_SDR_HAS_TIME;
+    }
+
+    //a timed write starts a new burst, the first output is early by the filter delay
+    if ((flags & SOAPY_SDR_HAS_TIME) != 0)
+    {
+        stream->reset();
+        const double position = stream->resamplers.front()->getNextPosition();
+        stream->outTimeNs = timeNs + (long long)std::llround(position*1e9/stream->inRate);
+        stream->outFlags = SOAPY_SDR_HAS_TIME;
+    }
+
+    const size_t numIn = std::min(numElems, stream->inCapacity);
+    for (size_t i = 0; i < stream->numChans; i++)
+    {
+        if (stream->convert == nullptr) std::memcpy(stream->inBuffs[i].data(), buffs[i], numIn*stream->elemSize);
+        else stream->convert(buffs[i], stream->inBuffs[i].data(), numIn, 1.0);
+    }
+    stream->offset = 0;
+    stream->count = 0;
+    stream->count = stream->resample(numIn);
+
+    //flush the filter tail with zeros at the end of a burst
+    const bool endBurst = (flags & SOAPY_SDR_END_BURST) != 0 and numIn == numElems;
+    if (endBurst)
+    {
+        for (auto &buff : stream->inBuffs) std::fill(buff.begin(), buff.begin() + stream->delay, std::complex<float>());
+        stream->count += stream->resample(stream->delay);
+        stream->outFlags |= SOAPY_SDR_END_BURST;
+    }
+
+    //the remainder of a partial write is sent on the next call,
+    //but the end of a burst is written out before the burst is accepted
+    while (stream->offset < stream->count)
+    {
+        for (size_t i = 0; i < stream->numChans; i++) outPtrs[i] = stream->outBuffs[i].data() + stream->offset;
+        int outFlags = stream->outFlags;
+        const int ret = _device->writeStream(stream->stream, outPtrs.data(), stream->count - stream->offset, outFlags, stream->outTimeNs, timeoutUs);
+        if (ret == SOAPY_SDR_TIMEOUT and endBurst) continue;
+        if (ret == SOAPY_SDR_TIMEOUT) break;
+        if (ret < 0) return ret;
+        stream->offset += size_t(ret);
+        if (ret != 0) stream->outFlags &= ~SOAPY_SDR_HAS_TIME;
+    }
+    if (endBurst) stream->reset();
+    return int(numIn);
+}
+
+int ResamplerLayer::readStreamStatus(SoapySDR::Stream *handle, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    return _device->readStreamStatus(stream->stream, chanMask, flags, timeNs, timeoutUs);
+}
+
+int ResamplerLayer::captureSamples(const int direction, const std::vector<size_t> &channels, const std::string &format, const long long timeNs, const size_t numElems, void * const *buffs, const long timeoutUs)
+{
+    //the generic capture uses the resampled streams of this layer
+    for (const auto ch : channels)
+    {
+        const auto ratio = this->getRatio(direction, ch);
+        if (ratio.interp != ratio.decim) return SoapySDR::Device::captureSamples(direction, channels, format, timeNs, numElems, buffs, timeoutUs);
+    }
+    return _device->captureSamples(direction, channels, format, timeNs, numElems, buffs, timeoutUs);
+}
+
+SoapySDR::StreamStats ResamplerLayer::getStreamStats(SoapySDR::Stream *handle) const
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    return _device->getStreamStats(stream->stream);
+}
+
+/*******************************************************************
+ * Direct buffer access API
+ ******************************************************************/
+size_t ResamplerLayer::getNumDirectAccessBuffers(SoapySDR::Stream *handle)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty()) return _device->getNumDirectAccessBuffers(stream->stream);
+    return 0;
+}
+
+int ResamplerLayer::getDirectAccessBufferAddrs(SoapySDR::Stream *handle, const size_t bufHandle, void **buffs)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty()) return _device->getDirectAccessBufferAddrs(stream->stream, bufHandle, buffs);
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+int ResamplerLayer::acquireReadBuffer(SoapySDR::Stream *handle, size_t &bufHandle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty()) return _device->acquireReadBuffer(stream->stream, bufHandle, buffs, flags, timeNs, timeoutUs);
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+void ResamplerLayer::releaseReadBuffer(SoapySDR::Stream *handle, const size_t bufHandle)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty()) return _device->releaseReadBuffer(stream->stream, bufHandle);
+}
+
+int ResamplerLayer::acquireWriteBuffer(SoapySDR::Stream *handle, size_t &bufHandle, void **buffs, const long timeoutUs)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty()) return _device->acquireWriteBuffer(stream->stream, bufHandle, buffs, timeoutUs);
+    return SOAPY_SDR_NOT_SUPPORTED;
+}
+
+void ResamplerLayer::releaseWriteBuffer(SoapySDR::Stream *handle, const size_t bufHandle, const size_t numElems, int &flags, const long long timeNs)
+{
+    auto stream = reinterpret_cast<ResamplerStream *>(handle);
+    if (stream->resamplers.empty()) return _device->releaseWriteBuffer(stream->stream, bufHandle, numElems, flags, timeNs);
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include "DeviceDecorator.hpp"
+#include <utility>
+#include <mutex>
+#include <map>
+
+/*!
+ * ResamplerLayer accepts any sample rate for a channel of the device.
+ * The factory places it around a device when the resample argument is given to make().
+ * The device is tuned to the nearest supported rate at or above the requested rate,
+ * and streams on that channel are resampled in software by a rational factor.
+ * Channels with a rate that the device supports directly are passed through.
+ */
+class ResamplerLayer : public DeviceDecorator
+{
+public:
+    ResamplerLayer(SoapySDR::Device *device);
+
+    /*******************************************************************
+     * Stream API
+     ******************************************************************/
+    SoapySDR::Stream *setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args);
+    void closeStream(SoapySDR::Stream *stream);
+    size_t getStreamMTU(SoapySDR::Stream *stream) const;
+    int activateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs, const size_t numElems);
+    int deactivateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs);
+    int readStream(SoapySDR::Stream *stream, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+    int writeStream(SoapySDR::Stream *stream, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs);
+    int readStreamStatus(SoapySDR::Stream *stream, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs);
+    int captureSamples(const int direction, const std::vector<size_t> &channels, const std::string &format, const long long timeNs, const size_t numElems, void * const *buffs, const long timeoutUs);
+    SoapySDR::StreamStats getStreamStats(SoapySDR::Stream *stream) const;
+
+    /*******************************************************************
+     * Direct buffer access API
+     ******************************************************************/
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *stream);
+    int getDirectAccessBufferAddrs(SoapySDR::Stream *stream, const size_t handle, void **buffs);
+    int acquireReadBuffer(SoapySDR::Stream *stream, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs);
+    void releaseReadBuffer(SoapySDR::Stream *stream, const size_t handle);
+    int acquireWriteBuffer(SoapySDR::Stream *stream, size_t &handle, void **buffs, const long timeoutUs);
+    void releaseWriteBuffer(SoapySDR::Stream *stream, const size_t handle, const size_t numElems, int &flags, const long long timeNs);
+
+    /*******************************************************************
+     * Sample Rate API
+     ******************************************************************/
+    void setSampleRate(const int direction, const size_t channel, const double rate);
+    double getSampleRate(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getSampleRateRange(const int direction, const size_t channel) const;
+
+private:
+    struct Ratio
+    {
+        double deviceRate;
+        size_t interp;
+        size_t decim;
+    };
+
+    //the resampling ratio of a channel, 1/1 when the device rate is used directly
+    Ratio getRatio(const int direction, const size_t channel) const;
+
+    mutable std::mutex _mutex;
+    std::map<std::pair<int, size_t>, Ratio> _ratios;
+};
@@ -0,0 +1,131 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "RxGapFiller.hpp"
+#include <SoapySDR/Time.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+RxGapFiller::RxGapFiller(
+    SoapySDR::Device *device,
+    SoapySDR::Stream *stream,
+    const size_t numChans,
+    const size_t elemSize,
+    const SoapySDR::Kwargs &args):
+    _device(device),
+    _stream(stream),
+    _numChans(numChans),
+    _elemSize(elemSize),
+    _maxGap(1 << 24),
+    _sampleRate(0.0),
+    _timeValid(false),
+    _nextTicks(0),
+    _pendingZeros(0),
+    _stash(numChans),
+    _stashElems(0),
+    _stashOffset(0),
+    _stashFlags(0),
+    _numGaps(0),
+    _numGapElems(0),
+    _numOverflows(0)
+{
+    if (args.count("GAP_FILL_MAX") != 0) _maxGap = SoapySDR::StringToSetting<long long>(args.at("GAP_FILL_MAX"));
+}
+
+void RxGapFiller::reset(const double sampleRate)
+{
+    _sampleRate = sampleRate;
+    _timeValid = false;
+    _pendingZeros = 0;
+    _stashElems = 0;
+    _stashOffset = 0;
+}
+
+int RxGapFiller::read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    //drain the zeros and stashed data from a previous gap first
+    if (_pendingZeros != 0 or _stashElems != 0) return this->readPending(buffs, numElems, flags, timeNs);
+
+    //retries after an overflow share the one timeout of the call
+    const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+    long remainingUs = timeoutUs;
+    while (true)
+    {
+        int ret = _device->readStream(_stream, buffs, numElems, flags, timeNs, remainingUs);
+
+        //an overflow is recoverable once the stream is being tracked by time,
+        //the lost samples are accounted for by the timestamp of the next read
+        if (ret == SOAPY_SDR_OVERFLOW and _timeValid)
+        {
+            _numOverflows++;
+            remainingUs = long(std::chrono::duration_cast<std::chrono::microseconds>(exitTime - std::chrono::steady_clock::now()).count());
+            if (remainingUs <= 0) return SOAPY_SDR_TIMEOUT;
+            continue;
+        }
+        if (ret <= 0) return ret;
+
+        //cannot track the stream without timestamps or a sample rate
+        if ((flags & SOAPY_SDR_HAS_TIME) == 0 or _sampleRate <= 0.0)
+        {
+            _timeValid = false;
+            return ret;
+        }
+
+        const long long ticks = SoapySDR::timeNsToTicks(timeNs, _sampleRate);
+        const long long gap = ticks - _nextTicks;
+
+        //contiguous data or the first read since activation
+        if (not _timeValid or gap == 0 or gap < 0 or gap > _maxGap)
+        {
+            if (_timeValid and gap != 0) SoapySDR::logf(SOAPY_SDR_DEBUG,
+                "RxGapFiller: discontinuity of %lld samples, re-synchronizing", gap);
+            _timeValid = true;
+            _nextTicks = ticks + ret;
+            return ret;
+        }
+
+        //stash the data after the gap and fill the gap with zeros first
+        for (size_t i = 0; i < _numChans; i++)
+        {
+            const char *p = reinterpret_cast<const char *>(buffs[i]);
+            _stash[i].assign(p, p+size_t(ret)*_elemSize);
+        }
+        _stashElems = size_t(ret);
+        _stashOffset = 0;
+        _stashFlags = flags;
+        _pendingZeros = gap;
+        _numGaps++;
+        _numGapElems += gap;
+        return this->readPending(buffs, numElems, flags, timeNs);
+    }
+}
+
+int RxGapFiller::readPending(void * const *buffs, const size_t numElems, int &flags, long long &timeNs)
+{
+    flags = SOAPY_SDR_HAS_TIME;
+    timeNs = SoapySDR::ticksToTimeNs(_nextTicks, _sampleRate);
+
+    size_t n = 0;
+    if (_pendingZeros != 0)
+    {
+        n = size_t(std::min<long long>(_pendingZeros, numElems));
+        for (size_t i = 0; i < _numChans; i++) std::memset(buffs[i], 0, n*_elemSize);
+        _pendingZeros -= n;
+    }
+    else
+    {
+        n = std::min(_stashElems, numElems);
+        for (size_t i = 0; i < _numChans; i++)
+        {
+            std::memcpy(buffs[i], _stash[i].data()+_stashOffset*_elemSize, n*_elemSize);
+        }
+        _stashOffset += n;
+        _stashElems -= n;
+        if (_stashElems == 0) flags = _stashFlags;
+    }
+
+    _nextTicks += n;
+    return int(n);
+}
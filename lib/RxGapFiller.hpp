@@ -0,0 +1,73 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Device.hpp>
+#include <atomic>
+#include <vector>
+
+/*!
+ * RxGapFiller keeps a receive stream gapless across overflows.
+ * The buffer timestamps and the stream sample rate are used to
+ * detect dropped samples, and exactly that number of zero samples
+ * is inserted before the data which follows the gap.
+ * Gaps longer than the configured limit re-synchronize the stream.
+ */
+class RxGapFiller
+{
+public:
+    RxGapFiller(
+        SoapySDR::Device *device,
+        SoapySDR::Stream *stream,
+        const size_t numChans,
+        const size_t elemSize,
+        const SoapySDR::Kwargs &args);
+
+    //! Reset the stream tracking (called on stream activation)
+    void reset(const double sampleRate);
+
+    //! Read elements with gaps filled, same semantics as readStream()
+    int read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+
+    //! The number of gaps that were detected
+    unsigned long long getNumGaps(void) const
+    {
+        return _numGaps;
+    }
+
+    //! The total number of elements inserted into gaps
+    unsigned long long getNumGapElems(void) const
+    {
+        return _numGapElems;
+    }
+
+    //! The number of overflows absorbed and not returned to the caller
+    unsigned long long getNumOverflows(void) const
+    {
+        return _numOverflows;
+    }
+
+private:
+    int readPending(void * const *buffs, const size_t numElems, int &flags, long long &timeNs);
+
+    SoapySDR::Device *_device;
+    SoapySDR::Stream *_stream;
+    const size_t _numChans;
+    const size_t _elemSize;
+    long long _maxGap;
+
+    double _sampleRate;
+    bool _timeValid;
+    long long _nextTicks;
+
+    //zeros owed to the caller, followed by the data read after the gap
+    long long _pendingZeros;
+    std::vector<std::vector<char>> _stash;
+    size_t _stashElems;
+    size_t _stashOffset;
+    int _stashFlags;
+
+    std::atomic<unsigned long long> _numGaps;
+    std::atomic<unsigned long long> _numGapElems;
+    std::atomic<unsigned long long> _numOverflows;
+};
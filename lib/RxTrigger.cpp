@@ -0,0 +1,313 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "RxTrigger.hpp"
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+#include <cstring>
+#include <cmath>
+#include <cstdint>
+
+/*******************************************************************
+ * Magnitude squared normalized to full scale,
+ * simple loops that the compiler can vectorize
+ ******************************************************************/
+template <typename Type, long long FullScale, long long Offset>
+static void magnitudeSquared(const void *in, float *out, const size_t numElems)
+{
+    const Type *p = reinterpret_cast<const Type *>(in);
+    const float scale = 1.0f/(float(FullScale)*float(FullScale));
+    for (size_t i = 0; i < numElems; i++)
+    {
+        const float re = float(p[2*i+0]) - float(Offset);
+        const float im = float(p[2*i+1]) - float(Offset);
+        out[i] = (re*re + im*im)*scale;
+    }
+}
+
+static void (*getMagnitudeFunction(const std::string &format))(const void *, float *, const size_t)
+{
+    if (format == SOAPY_SDR_CF64) return &magnitudeSquared<double, 1, 0>;
+    if (format == SOAPY_SDR_CF32) return &magnitudeSquared<float, 1, 0>;
+    if (format == SOAPY_SDR_CS32) return &magnitudeSquared<int32_t, (1ll << 31), 0>;
+    if (format == SOAPY_SDR_CU16) return &magnitudeSquared<uint16_t, (1ll << 15), (1ll << 15)>;
+    if (format == SOAPY_SDR_CS16) return &magnitudeSquared<int16_t, (1ll << 15), 0>;
+    if (format == SOAPY_SDR_CU8) return &magnitudeSquared<uint8_t, (1ll << 7), (1ll << 7)>;
+    if (format == SOAPY_SDR_CS8) return &magnitudeSquared<int8_t, (1ll << 7), 0>;
+    throw std::runtime_error("RxTrigger: unsupported stream format " + format);
+}
+
+/*******************************************************************
+ * Trigger setup
+ ******************************************************************/
+RxTrigger::RxTrigger(
+    const Reader &reader,
+    const std::string &format,
+    const size_t numChans,
+    const size_t elemSize,
+    const size_t mtu,
+    const SoapySDR::Kwargs &args):
+    _reader(reader),
+    _numChans(numChans),
+    _elemSize(elemSize),
+    _mtu(std::max<size_t>(mtu, 1)),
+    _mode(LEVEL),
+    _threshold(0.01f),
+    _numPre(1024),
+    _numPost(4096),
+    _triggerChan(0),
+    _magnitude(getMagnitudeFunction(format)),
+    _prevAbove(false),
+    _avgRing(64),
+    _avgIndex(0),
+    _avgCount(0),
+    _avgSum(0.0),
+    _sampleRate(0.0),
+    _block(numChans),
+    _mags(_mtu),
+    _blockElems(0),
+    _blockOffset(0),
+    _blockHasTime(false),
+    _blockTimeNs(0),
+    _history(numChans),
+    _historyPos(0),
+    _historyCount(0),
+    _window(numChans),
+    _windowElems(0),
+    _windowOffset(0),
+    _postRemaining(0),
+    _collecting(false),
+    _windowReady(false),
+    _windowHasTime(false),
+    _windowTimeNs(0)
+{
+    const std::string mode = args.at("TRIGGER");
+    if (mode == "POWER") _mode = POWER;
+    else if (mode == "LEVEL") _mode = LEVEL;
+    else if (mode == "EDGE") _mode = EDGE;
+    else throw std::runtime_error("RxTrigger: unknown TRIGGER mode " + mode);
+
+    //the threshold is specified in dB relative to full scale
+    if (args.count("TRIGGER_LEVEL") != 0) _threshold = std::pow(10.0f, SoapySDR::StringToSetting<float>(args.at("TRIGGER_LEVEL"))/10.0f);
+    if (args.count("TRIGGER_PRE") != 0) _numPre = SoapySDR::StringToSetting<size_t>(args.at("TRIGGER_PRE"));
+    if (args.count("TRIGGER_POST") != 0) _numPost = SoapySDR::StringToSetting<size_t>(args.at("TRIGGER_POST"));
+    if (args.count("TRIGGER_AVG") != 0) _avgRing.resize(std::max<size_t>(SoapySDR::StringToSetting<size_t>(args.at("TRIGGER_AVG")), 1));
+    if (args.count("TRIGGER_CHANNEL") != 0) _triggerChan = SoapySDR::StringToSetting<size_t>(args.at("TRIGGER_CHANNEL"));
+    if (_triggerChan >= numChans) throw std::runtime_error("RxTrigger: TRIGGER_CHANNEL out of range");
+    _numPost = std::max<size_t>(_numPost, 1);
+
+    for (size_t i = 0; i < numChans; i++)
+    {
+        _block[i].resize(_mtu*_elemSize);
+        _history[i].resize(_numPre*_elemSize);
+        _window[i].reserve((_numPre+_numPost)*_elemSize);
+    }
+}
+
+void RxTrigger::reset(const double sampleRate)
+{
+    _sampleRate = sampleRate;
+    _blockElems = 0;
+    _blockOffset = 0;
+    this->rearm();
+}
+
+void RxTrigger::rearm(void)
+{
+    _prevAbove = false;
+    std::fill(_avgRing.begin(), _avgRing.end(), 0.0f);
+    _avgIndex = 0;
+    _avgCount = 0;
+    _avgSum = 0.0;
+    _historyPos = 0;
+    _historyCount = 0;
+    _windowElems = 0;
+    _windowOffset = 0;
+    _collecting = false;
+    _windowReady = false;
+}
+
+/*******************************************************************
+ * Read triggered windows
+ ******************************************************************/
+int RxTrigger::read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    //one deadline for the whole call, each read gets the time that remains
+    const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+
+    //consume blocks from the reader until a window is complete
+    while (not _windowReady)
+    {
+        if (_blockOffset == _blockElems)
+        {
+            std::vector<void *> ptrs(_numChans);
+            for (size_t i = 0; i < _numChans; i++) ptrs[i] = _block[i].data();
+            int readFlags = 0;
+            long long readTimeNs = 0;
+            const auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(exitTime - std::chrono::steady_clock::now());
+            const int ret = _reader(ptrs.data(), _mtu, readFlags, readTimeNs, long(std::max<long long>(remaining.count(), 0)));
+            if (ret == SOAPY_SDR_TIMEOUT) return ret;
+
+            //the history is no longer contiguous after an error
+            if (ret < 0)
+            {
+                this->rearm();
+                return ret;
+            }
+
+            _blockElems = size_t(ret);
+            _blockOffset = 0;
+            _blockHasTime = (readFlags & SOAPY_SDR_HAS_TIME) != 0;
+            _blockTimeNs = readTimeNs;
+            this->computeMagnitudes();
+        }
+
+        this->processBlock();
+        if (not _windowReady and std::chrono::steady_clock::now() > exitTime) return SOAPY_SDR_TIMEOUT;
+    }
+
+    //deliver the window in chunks of the caller's size
+    const size_t n = std::min(numElems, _windowElems-_windowOffset);
+    for (size_t i = 0; i < _numChans; i++)
+    {
+        std::memcpy(buffs[i], _window[i].data()+_windowOffset*_elemSize, n*_elemSize);
+    }
+
+    flags = 0;
+    timeNs = 0;
+    if (_windowHasTime)
+    {
+        flags |= SOAPY_SDR_HAS_TIME;
+        timeNs = _windowTimeNs + SoapySDR::ticksToTimeNs(_windowOffset, _sampleRate);
+    }
+
+    _windowOffset += n;
+    if (_windowOffset == _windowElems)
+    {
+        flags |= SOAPY_SDR_END_BURST;
+        _windowReady = false;
+        _windowElems = 0;
+        _windowOffset = 0;
+    }
+    return int(n);
+}
+
+void RxTrigger::computeMagnitudes(void)
+{
+    _magnitude(_block[_triggerChan].data(), _mags.data(), _blockElems);
+}
+
+bool RxTrigger::detect(const float mag)
+{
+    if (_mode == POWER)
+    {
+        //running average over the last N magnitudes
+        _avgSum += mag - _avgRing[_avgIndex];
+        _avgRing[_avgIndex] = mag;
+        _avgIndex = (_avgIndex+1) % _avgRing.size();
+        if (_avgCount < _avgRing.size()) _avgCount++;
+        return _avgCount == _avgRing.size() and _avgSum >= _threshold*_avgRing.size();
+    }
+
+    const bool above = mag >= _threshold;
+    const bool rising = above and not _prevAbove;
+    _prevAbove = above;
+    return (_mode == EDGE)?rising:above;
+}
+
+void RxTrigger::processBlock(void)
+{
+    //armed: scan for the trigger condition
+    size_t numDetected = 0;
+    if (not _collecting)
+    {
+        const size_t start = _blockOffset;
+        for (size_t i = start; i < _blockElems; i++)
+        {
+            if (not this->detect(_mags[i])) continue;
+            this->pushHistory(start, i-start);
+            this->startWindow(i);
+            _blockOffset = i;
+            numDetected = 1;
+            break;
+        }
+        if (not _collecting)
+        {
+            this->pushHistory(start, _blockElems-start);
+            _blockOffset = _blockElems;
+            return;
+        }
+    }
+
+    //collecting: append the post-trigger samples to the window,
+    //the detector and history keep tracking the stream for the next trigger
+    const size_t n = std::min(_postRemaining, _blockElems-_blockOffset);
+    for (size_t i = 0; i < _numChans; i++)
+    {
+        const char *p = _block[i].data()+_blockOffset*_elemSize;
+        _window[i].insert(_window[i].end(), p, p+n*_elemSize);
+    }
+    for (size_t i = numDetected; i < n; i++) this->detect(_mags[_blockOffset+i]);
+    this->pushHistory(_blockOffset, n);
+    _windowElems += n;
+    _blockOffset += n;
+    _postRemaining -= n;
+
+    if (_postRemaining == 0)
+    {
+        _collecting = false;
+        _windowReady = true;
+        _windowOffset = 0;
+    }
+}
+
+void RxTrigger::pushHistory(const size_t offset, const size_t numElems)
+{
+    if (_numPre == 0) return;
+
+    //only the most recent samples can remain in the ring
+    const size_t skip = (numElems > _numPre)?(numElems-_numPre):0;
+    size_t remaining = numElems-skip;
+    size_t src = offset+skip;
+    while (remaining != 0)
+    {
+        const size_t n = std::min(remaining, _numPre-_historyPos);
+        for (size_t i = 0; i < _numChans; i++)
+        {
+            std::memcpy(_history[i].data()+_historyPos*_elemSize, _block[i].data()+src*_elemSize, n*_elemSize);
+        }
+        _historyPos = (_historyPos+n) % _numPre;
+        src += n;
+        remaining -= n;
+    }
+    _historyCount = std::min(_historyCount+numElems, _numPre);
+}
+
+void RxTrigger::startWindow(const size_t offset)
+{
+    //linearize the history ring into the start of the window
+    const size_t first = (_historyPos+_numPre-_historyCount) % std::max<size_t>(_numPre, 1);
+    for (size_t i = 0; i < _numChans; i++)
+    {
+        _window[i].clear();
+        const char *p = _history[i].data();
+        const size_t n0 = std::min(_historyCount, _numPre-first);
+        _window[i].insert(_window[i].end(), p+first*_elemSize, p+(first+n0)*_elemSize);
+        _window[i].insert(_window[i].end(), p, p+(_historyCount-n0)*_elemSize);
+    }
+
+    _windowElems = _historyCount;
+    _windowOffset = 0;
+    _postRemaining = _numPost;
+    _collecting = true;
+
+    //the window starts the length of the history before the trigger sample
+    _windowHasTime = _blockHasTime and _sampleRate > 0.0;
+    if (not _windowHasTime) return;
+    _windowTimeNs = _blockTimeNs
+        + SoapySDR::ticksToTimeNs(offset, _sampleRate)
+        - SoapySDR::ticksToTimeNs(_historyCount, _sampleRate);
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Device.hpp>
+#include <functional>
+#include <vector>
+#include <string>
+
+/*!
+ * RxTrigger is a software trigger stage for receive streams.
+ * The magnitude of one channel is compared against a threshold
+ * in power (averaged), level, or rising edge mode.
+ * A ring buffer keeps the pre-trigger history, and only complete
+ * triggered windows are delivered to the caller, each window
+ * timestamped with the time of its first sample and terminated
+ * with SOAPY_SDR_END_BURST.
+ */
+class RxTrigger
+{
+public:
+    //! The source of samples, same semantics as readStream()
+    typedef std::function<int(void * const *, const size_t, int &, long long &, const long)> Reader;
+
+    RxTrigger(
+        const Reader &reader,
+        const std::string &format,
+        const size_t numChans,
+        const size_t elemSize,
+        const size_t mtu,
+        const SoapySDR::Kwargs &args);
+
+    //! Re-arm the trigger and clear the history (called on stream activation)
+    void reset(const double sampleRate);
+
+    //! Read elements from a triggered window, same semantics as readStream()
+    int read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+
+private:
+    enum Mode {POWER, LEVEL, EDGE};
+
+    void rearm(void);
+    void computeMagnitudes(void);
+    bool detect(const float mag);
+    void processBlock(void);
+    void pushHistory(const size_t offset, const size_t numElems);
+    void startWindow(const size_t offset);
+
+    Reader _reader;
+    const size_t _numChans;
+    const size_t _elemSize;
+    const size_t _mtu;
+
+    //configuration from stream args
+    Mode _mode;
+    float _threshold;
+    size_t _numPre;
+    size_t _numPost;
+    size_t _triggerChan;
+    void (*_magnitude)(const void *, float *, const size_t);
+
+    //detector state
+    bool _prevAbove;
+    std::vector<float> _avgRing;
+    size_t _avgIndex;
+    size_t _avgCount;
+    double _avgSum;
+
+    //the most recent block from the reader
+    double _sampleRate;
+    std::vector<std::vector<char>> _block;
+    std::vector<float> _mags;
+    size_t _blockElems;
+    size_t _blockOffset;
+    bool _blockHasTime;
+    long long _blockTimeNs;
+
+    //pre-trigger history ring
+    std::vector<std::vector<char>> _history;
+    size_t _historyPos;
+    size_t _historyCount;
+
+    //the window being collected or delivered
+    std::vector<std::vector<char>> _window;
+    size_t _windowElems;
+    size_t _windowOffset;
+    size_t _postRemaining;
+    bool _collecting;
+    bool _windowReady;
+    bool _windowHasTime;
+    long long _windowTimeNs;
+};
@@ -0,0 +1,312 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/SensorSampler.hpp>
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <condition_variable>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <cstring>
+#include <mutex>
+
+const size_t SoapySDR::SensorSampler::MAX_STRING_SIZE;
+
+static long long steadyTimeNs(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+SoapySDR::SensorReading::SensorReading(void):
+    valid(false),
+    type(ArgInfo::STRING),
+    boolValue(false),
+    intValue(0),
+    floatValue(0.0),
+    timeNs(0),
+    numErrors(0)
+{
+    return;
+}
+
+/*******************************************************************
+ * Implementation details
+ ******************************************************************/
+
+/*!
+ * The latest reading of one sensor behind a sequence counter.
+ * The sampler thread is the only writer: it makes the sequence odd,
+ * writes the fields, and makes it even again. Readers copy the fields
+ * and retry when the sequence was odd or changed during the copy.
+ * The fields are relaxed atomics, and the string is copied through
+ * atomic words, so that a torn copy is discarded rather than a race.
+ */
+struct SensorSlot
+{
+    SensorSlot(void):
+        sequence(0),
+        numErrors(0),
+        valid(false),
+        boolValue(false),
+        intValue(0),
+        floatValue(0.0),
+        timeNs(0),
+        stringSize(0)
+    {
+        for (auto &word : stringWords) word.store(0, std::memory_order_relaxed);
+    }
+
+    std::atomic<unsigned> sequence;
+    std::atomic<unsigned long long> numErrors;
+
+    std::atomic<bool> valid;
+    std::atomic<bool> boolValue;
+    std::atomic<long long> intValue;
+    std::atomic<double> floatValue;
+    std::atomic<long long> timeNs;
+    std::atomic<size_t> stringSize;
+    std::atomic<unsigned long long> stringWords[SoapySDR::SensorSampler::MAX_STRING_SIZE/sizeof(unsigned long long)];
+};
+
+static_assert(SoapySDR::SensorSampler::MAX_STRING_SIZE % sizeof(unsigned long long) == 0, "string words must fill MAX_STRING_SIZE");
+
+struct SampledSensor
+{
+    bool global;
+    int direction;
+    size_t channel;
+    std::string key;
+    std::chrono::nanoseconds interval;
+    SoapySDR::ArgInfo info;
+    std::unique_ptr<SensorSlot> slot;
+};
+
+class SoapySDR::SensorSampler::Impl
+{
+public:
+    Impl(SoapySDR::Device *device):
+        device(device),
+        done(true)
+    {
+        return;
+    }
+
+    size_t add(SampledSensor &&sensor);
+    size_t find(const bool global, const int direction, const size_t channel, const std::string &key) const;
+    void sample(SampledSensor &sensor);
+    void loop(void);
+
+    SoapySDR::Device *device;
+    std::vector<SampledSensor> sensors;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    bool done;
+    std::thread thread;
+};
+
+size_t SoapySDR::SensorSampler::Impl::add(SampledSensor &&sensor)
+{
+    if (thread.joinable()) throw std::runtime_error("SensorSampler::addSensor() called after start()");
+    if (sensor.interval.count() <= 0) throw std::invalid_argument("SensorSampler::addSensor() interval must be positive");
+    sensor.slot.reset(new SensorSlot());
+    sensors.push_back(std::move(sensor));
+    return sensors.size()-1;
+}
+
+size_t SoapySDR::SensorSampler::Impl::find(const bool global, const int direction, const size_t channel, const std::string &key) const
+{
+    for (size_t i = 0; i < sensors.size(); i++)
+    {
+        const auto &sensor = sensors[i];
+        if (sensor.key != key or sensor.global != global) continue;
+        if (global or (sensor.direction == direction and sensor.channel == channel)) return i;
+    }
+    throw std::invalid_argument("SensorSampler::read("+key+") sensor is not sampled");
+}
+
+void SoapySDR::SensorSampler::Impl::sample(SampledSensor &sensor)
+{
+    auto &slot = *sensor.slot;
+    std::string value;
+    bool boolValue(false);
+    long long intValue(0);
+    double floatValue(0.0);
+    try
+    {
+        value = sensor.global?device->readSensor(sensor.key):device->readSensor(sensor.direction, sensor.channel, sensor.key);
+        switch (sensor.info.type)
+        {
+        case ArgInfo::BOOL: boolValue = SoapySDR::StringToSetting<bool>(value); break;
+        case ArgInfo::INT: intValue = SoapySDR::StringToSetting<long long>(value); break;
+        case ArgInfo::FLOAT: floatValue = SoapySDR::StringToSetting<double>(value); break;
+        case ArgInfo::STRING: break;
+        }
+    }
+    catch (const std::exception &ex)
+    {
+        if (slot.numErrors.fetch_add(1) == 0)
+        {
+            SoapySDR::logf(SOAPY_SDR_WARNING, "SensorSampler failed to read %s: %s", sensor.key.c_str(), ex.what());
+        }
+        return;
+    }
+
+    const auto sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence+1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.valid.store(true, std::memory_order_relaxed);
+    slot.boolValue.store(boolValue, std::memory_order_relaxed);
+    slot.intValue.store(intValue, std::memory_order_relaxed);
+    slot.floatValue.store(floatValue, std::memory_order_relaxed);
+    slot.timeNs.store(steadyTimeNs(), std::memory_order_relaxed);
+    const size_t stringSize = std::min(value.size(), MAX_STRING_SIZE);
+    slot.stringSize.store(stringSize, std::memory_order_relaxed);
+    for (size_t i = 0; i*sizeof(unsigned long long) < stringSize; i++)
+    {
+        unsigned long long word(0);
+        std::memcpy(&word, value.data()+i*sizeof(word), std::min(sizeof(word), stringSize-i*sizeof(word)));
+        slot.stringWords[i].store(word, std::memory_order_relaxed);
+    }
+    slot.sequence.store(sequence+2, std::memory_order_release);
+}
+
+void SoapySDR::SensorSampler::Impl::loop(void)
+{
+    std::vector<std::chrono::steady_clock::time_point> due(sensors.size(), std::chrono::steady_clock::now());
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (not done)
+    {
+        lock.unlock();
+        auto now = std::chrono::steady_clock::now();
+        auto next = std::chrono::steady_clock::time_point::max();
+        for (size_t i = 0; i < sensors.size(); i++)
+        {
+            if (due[i] <= now)
+            {
+                this->sample(sensors[i]);
+                now = std::chrono::steady_clock::now();
+
+                //skip the missed intervals of a slow sensor rather than bursting
+                due[i] += sensors[i].interval;
+                if (due[i] <= now) due[i] = now + sensors[i].interval;
+            }
+            next = std::min(next, due[i]);
+        }
+        lock.lock();
+        cond.wait_until(lock, next, [this]{return done;});
+    }
+}
+
+/*******************************************************************
+ * Sensor sampler
+ ******************************************************************/
+SoapySDR::SensorSampler::SensorSampler(Device *device):
+    _impl(new Impl(device))
+{
+    return;
+}
+
+SoapySDR::SensorSampler::~SensorSampler(void)
+{
+    this->stop();
+}
+
+size_t SoapySDR::SensorSampler::addSensor(const std::string &key, const long long intervalNs)
+{
+    SampledSensor sensor;
+    sensor.global = true;
+    sensor.direction = 0;
+    sensor.channel = 0;
+    sensor.key = key;
+    sensor.interval = std::chrono::nanoseconds(intervalNs);
+    sensor.info = _impl->device->getSensorInfo(key);
+    return _impl->add(std::move(sensor));
+}
+
+size_t SoapySDR::SensorSampler::addSensor(const int direction, const size_t channel, const std::string &key, const long long intervalNs)
+{
+    SampledSensor sensor;
+    sensor.global = false;
+    sensor.direction = direction;
+    sensor.channel = channel;
+    sensor.key = key;
+    sensor.interval = std::chrono::nanoseconds(intervalNs);
+    sensor.info = _impl->device->getSensorInfo(direction, channel, key);
+    return _impl->add(std::move(sensor));
+}
+
+size_t SoapySDR::SensorSampler::getNumSensors(void) const
+{
+    return _impl->sensors.size();
+}
+
+SoapySDR::ArgInfo SoapySDR::SensorSampler::getSensorInfo(const size_t index) const
+{
+    return _impl->sensors.at(index).info;
+}
+
+void SoapySDR::SensorSampler::start(void)
+{
+    if (_impl->thread.joinable()) return;
+    _impl->done = false;
+    _impl->thread = std::thread(&Impl::loop, _impl.get());
+}
+
+void SoapySDR::SensorSampler::stop(void)
+{
+    if (not _impl->thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        _impl->done = true;
+    }
+    _impl->cond.notify_one();
+    _impl->thread.join();
+}
+
+SoapySDR::SensorReading SoapySDR::SensorSampler::read(const size_t index) const
+{
+    const auto &sensor = _impl->sensors.at(index);
+    const auto &slot = *sensor.slot;
+
+    SensorReading reading;
+    reading.type = sensor.info.type;
+    reading.numErrors = slot.numErrors.load(std::memory_order_relaxed);
+
+    unsigned long long stringWords[MAX_STRING_SIZE/sizeof(unsigned long long)];
+    size_t stringSize(0);
+    while (true)
+    {
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) != 0) continue;
+        reading.valid = slot.valid.load(std::memory_order_relaxed);
+        reading.boolValue = slot.boolValue.load(std::memory_order_relaxed);
+        reading.intValue = slot.intValue.load(std::memory_order_relaxed);
+        reading.floatValue = slot.floatValue.load(std::memory_order_relaxed);
+        reading.timeNs = slot.timeNs.load(std::memory_order_relaxed);
+        stringSize = std::min(slot.stringSize.load(std::memory_order_relaxed), MAX_STRING_SIZE);
+        for (size_t i = 0; i*sizeof(unsigned long long) < stringSize; i++)
+        {
+            stringWords[i] = slot.stringWords[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == sequence) break;
+    }
+    reading.stringValue.assign(reinterpret_cast<const char *>(stringWords), stringSize);
+    return reading;
+}
+
+SoapySDR::SensorReading SoapySDR::SensorSampler::read(const std::string &key) const
+{
+    return this->read(_impl->find(true, 0, 0, key));
+}
+
+SoapySDR::SensorReading SoapySDR::SensorSampler::read(const int direction, const size_t channel, const std::string &key) const
+{
+    return this->read(_impl->find(false, direction, channel, key));
+}
@@ -0,0 +1,840 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <deque>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+static const double PI = 3.14159265358979323846;
+
+/*******************************************************************
+ * Sample generation: a tone plus uniform noise in any complex format
+ ******************************************************************/
+template <typename Type, long long FullScale, long long Offset>
+static void quantize(const float *in, void *out, const size_t numElems)
+{
+    Type *p = reinterpret_cast<Type *>(out);
+    const float scale = float(FullScale-1);
+    for (size_t i = 0; i < numElems*2; i++)
+    {
+        const float x = std::max(-1.0f, std::min(1.0f, in[i]));
+        p[i] = Type(x*scale + float(Offset));
+    }
+}
+
+static void quantizeCF64(const float *in, void *out, const size_t numElems)
+{
+    double *p = reinterpret_cast<double *>(out);
+    for (size_t i = 0; i < numElems*2; i++) p[i] = in[i];
+}
+
+static void quantizeCF32(const float *in, void *out, const size_t numElems)
+{
+    std::memcpy(out, in, numElems*2*sizeof(float));
+}
+
+typedef void (*QuantizeFunction)(const float *, void *, const size_t);
+
+static QuantizeFunction getQuantizeFunction(const std::string &format)
+{
+    if (format == SOAPY_SDR_CF64) return &quantizeCF64;
+    if (format == SOAPY_SDR_CF32) return &quantizeCF32;
+    if (format == SOAPY_SDR_CS32) return &quantize<int32_t, (1ll << 31), 0>;
+    if (format == SOAPY_SDR_CU16) return &quantize<uint16_t, (1ll << 15), (1ll << 15)>;
+    if (format == SOAPY_SDR_CS16) return &quantize<int16_t, (1ll << 15), 0>;
+    if (format == SOAPY_SDR_CU8) return &quantize<uint8_t, (1ll << 7), (1ll << 7)>;
+    if (format == SOAPY_SDR_CS8) return &quantize<int8_t, (1ll << 7), 0>;
+    throw std::runtime_error("SimDevice::setupStream("+format+") unsupported format");
+}
+
+/*******************************************************************
+ * Simulated stream state
+ ******************************************************************/
+struct SimStream
+{
+    int direction;
+    std::vector<size_t> channels;
+    size_t elemSize;
+    QuantizeFunction quantize;
+
+    //direct access buffers, one per channel per handle
+    size_t mtu;
+    size_t numBuffs;
+    size_t nextHandle;
+    std::vector<std::vector<std::vector<char>>> buffs;
+    std::vector<float> scratch;
+
+    //stream timing: sample ticks since startNs
+    bool active;
+    double rate;
+    long long startNs;
+    long long ticks;
+    bool finite;
+    size_t burstRemaining;
+    bool txInBurst;
+    uint32_t noiseState;
+
+    //status reports for readStreamStatus()
+    std::mutex statusMutex;
+    std::condition_variable statusCond;
+    struct Status {int ret; int flags; long long timeNs;};
+    std::deque<Status> status;
+};
+
+/*******************************************************************
+ * Simulated device
+ ******************************************************************/
+class SimDevice : public SoapySDR::Device
+{
+public:
+    SimDevice(const SoapySDR::Kwargs &args):
+        _numChans(2),
+        _virtualClock(false),
+        _rateStep(0.0),
+        _epoch(std::chrono::steady_clock::now()),
+        _timeOffsetNs(0),
+        _virtualNs(0),
+        _toneFreq(10e3),
+        _toneAmpl(0.5),
+        _noiseAmpl(0.01),
+        _injectOverflow(0),
+        _injectUnderflow(0)
+    {
+        if (args.count("channels") != 0) _numChans = SoapySDR::StringToSetting<size_t>(args.at("channels"));
+        if (args.count("clock") != 0) _virtualClock = args.at("clock") == "virtual";
+        if (args.count("rate_step") != 0) _rateStep = SoapySDR::StringToSetting<double>(args.at("rate_step"));
+        for (int dir : {SOAPY_SDR_TX, SOAPY_SDR_RX})
+        {
+            _sampleRate[dir] = 1e6;
+            _frequency[dir].resize(_numChans, 1e9);
+            _bandwidth[dir].resize(_numChans, 1e6);
+            _gain[dir].resize(_numChans, 0.0);
+        }
+    }
+
+    /*******************************************************************
+     * Identification API
+     ******************************************************************/
+    std::string getDriverKey(void) const
+    {
+        return "sim";
+    }
+
+    std::string getHardwareKey(void) const
+    {
+        return "sim";
+    }
+
+    SoapySDR::Kwargs getHardwareInfo(void) const
+    {
+        SoapySDR::Kwargs info;
+        info["clock"] = _virtualClock?"virtual":"real";
+        info["channels"] = std::to_string(_numChans);
+        return info;
+    }
+
+    /*******************************************************************
+     * Channels API
+     ******************************************************************/
+    size_t getNumChannels(const int) const
+    {
+        return _numChans;
+    }
+
+    bool getFullDuplex(const int, const size_t) const
+    {
+        return true;
+    }
+
+    /*******************************************************************
+     * Stream API
+     ******************************************************************/
+    std::vector<std::string> getStreamFormats(const int, const size_t) const
+    {
+        return {SOAPY_SDR_CF64, SOAPY_SDR_CF32, SOAPY_SDR_CS32, SOAPY_SDR_CS16, SOAPY_SDR_CU16, SOAPY_SDR_CS8, SOAPY_SDR_CU8};
+    }
+
+    std::string getNativeStreamFormat(const int, const size_t, double &fullScale) const
+    {
+        fullScale = double(1 << 15);
+        return SOAPY_SDR_CS16;
+    }
+
+    SoapySDR::ArgInfoList getStreamArgsInfo(const int, const size_t) const
+    {
+        SoapySDR::ArgInfoList infos;
+
+        SoapySDR::ArgInfo info;
+        info.key = "bufflen";
+        info.name = "Buffer Length";
+        info.value = "1024";
+        info.units = "elements";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "The number of elements per buffer (the stream MTU).";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "buffers";
+        info.name = "Buffer Count";
+        info.value = "16";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "The number of buffers, the simulated overflow depth.";
+        infos.push_back(info);
+
+        return infos;
+    }
+
+    SoapySDR::Stream *setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+    {
+        std::unique_ptr<SimStream> stream(new SimStream());
+        stream->direction = direction;
+        stream->channels = channels.empty()?std::vector<size_t>(1, 0):channels;
+        for (const auto ch : stream->channels)
+        {
+            if (ch >= _numChans) throw std::runtime_error("SimDevice::setupStream() invalid channel "+std::to_string(ch));
+        }
+        stream->elemSize = SoapySDR::formatToSize(format);
+        stream->quantize = getQuantizeFunction(format);
+        stream->mtu = 1024;
+        stream->numBuffs = 16;
+        if (args.count("bufflen") != 0) stream->mtu = std::max<size_t>(SoapySDR::StringToSetting<size_t>(args.at("bufflen")), 1);
+        if (args.count("buffers") != 0) stream->numBuffs = std::max<size_t>(SoapySDR::StringToSetting<size_t>(args.at("buffers")), 1);
+        stream->nextHandle = 0;
+        stream->buffs.resize(stream->numBuffs);
+        for (auto &buff : stream->buffs)
+        {
+            buff.resize(stream->channels.size(), std::vector<char>(stream->mtu*stream->elemSize));
+        }
+        stream->scratch.resize(stream->mtu*2);
+        stream->active = false;
+        stream->rate = 0.0;
+        stream->startNs = 0;
+        stream->ticks = 0;
+        stream->finite = false;
+        stream->burstRemaining = 0;
+        stream->txInBurst = false;
+        stream->noiseState = 0x12345678;
+        return reinterpret_cast<SoapySDR::Stream *>(stream.release());
+    }
+
+    void closeStream(SoapySDR::Stream *stream)
+    {
+        delete reinterpret_cast<SimStream *>(stream);
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *stream) const
+    {
+        return reinterpret_cast<SimStream *>(stream)->mtu;
+    }
+
+    int activateStream(SoapySDR::Stream *handle, const int flags, const long long timeNs, const size_t numElems)
+    {
+        auto stream = reinterpret_cast<SimStream *>(handle);
+        if ((flags & ~(SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST)) != 0) return SOAPY_SDR_NOT_SUPPORTED;
+        if ((flags & SOAPY_SDR_END_BURST) != 0 and numElems == 0) return SOAPY_SDR_NOT_SUPPORTED;
+
+        stream->rate = this->getSampleRate(stream->direction, stream->channels.front());
+        stream->startNs = ((flags & SOAPY_SDR_HAS_TIME) != 0)?timeNs:this->getHardwareTime();
+        stream->ticks = 0;
+        stream->finite = (flags & SOAPY_SDR_END_BURST) != 0;
+        stream->burstRemaining = numElems;
+        stream->txInBurst = false;
+        stream->active = true;
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *handle, const int flags, const long long)
+    {
+        auto stream = reinterpret_cast<SimStream *>(handle);
+        if (flags != 0) return SOAPY_SDR_NOT_SUPPORTED;
+        stream->active = false;
+        return 0;
+    }
+
+    int readStream(SoapySDR::Stream *handle, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<SimStream *>(handle);
+        if (stream->direction != SOAPY_SDR_RX) return SOAPY_SDR_NOT_SUPPORTED;
+        return this->receive(stream, buffs, numElems, flags, timeNs, timeoutUs);
+    }
+
+    int writeStream(SoapySDR::Stream *handle, const void * const *, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<SimStream *>(handle);
+        if (stream->direction != SOAPY_SDR_TX) return SOAPY_SDR_NOT_SUPPORTED;
+        return this->transmit(stream, numElems, flags, timeNs, timeoutUs);
+    }
+
+    int readStreamStatus(SoapySDR::Stream *handle, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<SimStream *>(handle);
+        std::unique_lock<std::mutex> lock(stream->statusMutex);
+        if (not stream->statusCond.wait_for(lock, std::chrono::microseconds(timeoutUs), [stream]{return not stream->status.empty();}))
+        {
+            return SOAPY_SDR_TIMEOUT;
+        }
+        const auto status = stream->status.front();
+        stream->status.pop_front();
+        chanMask = (size_t(1) << stream->channels.size())-1;
+        flags = status.flags;
+        timeNs = status.timeNs;
+        return status.ret;
+    }
+
+    /*******************************************************************
+     * Direct buffer access API
+     ******************************************************************/
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *handle)
+    {
+        return reinterpret_cast<SimStream *>(handle)->numBuffs;
+    }
+
+    int getDirectAccessBufferAddrs(SoapySDR::Stream *handle, const size_t index, void **buffs)
+    {
+        auto stream = reinterpret_cast<SimStream *>(handle);
+        if (index >= stream->numBuffs) return SOAPY_SDR_STREAM_ERROR;
+        for (size_t i = 0; i < stream->channels.size(); i++) buffs[i] = stream->buffs[index][i].data();
+        return 0;
+    }
+
+    int acquireReadBuffer(SoapySDR::Stream *handle, size_t &index, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        auto stream = reinterpret_cast<SimStream *>(handle);
+        if (stream->direction != SOAPY_SDR_RX) return SOAPY_SDR_NOT_SUPPORTED;
+        index = stream->nextHandle;
+        std::vector<void *> ptrs(stream->channels.size());
+        this->getDirectAccessBufferAddrs(handle, index, ptrs.data());
+        const int ret = this->receive(stream, ptrs.data(), stream->mtu, flags, timeNs, timeoutUs);
+        if (ret < 0) return ret;
+        stream->nextHandle = (index+1) % stream->numBuffs;
+        for (size_t i = 0; i < ptrs.size(); i++) buffs[i] = ptrs[i];
+        return ret;
+    }
+
+    void releaseReadBuffer(SoapySDR::Stream *, const size_t)
+    {
+        return;
+    }
+
+    int acquireWriteBuffer(SoapySDR::Stream *handle, size_t &index, void **buffs, const long)
+    {
+        auto stream = reinterpret_cast<SimStream *>(handle);
+        if (stream->direction != SOAPY_SDR_TX) return SOAPY_SDR_NOT_SUPPORTED;
+        index = stream->nextHandle;
+        stream->nextHandle = (index+1) % stream->numBuffs;
+        this->getDirectAccessBufferAddrs(handle, index, buffs);
+        return int(stream->mtu);
+    }
+
+    void releaseWriteBuffer(SoapySDR::Stream *handle, const size_t, const size_t numElems, int &flags, const long long timeNs)
+    {
+        auto stream = reinterpret_cast<SimStream *>(handle);
+        size_t remaining = numElems;
+        while (remaining != 0)
+        {
+            int writeFlags = (remaining == numElems)?flags:(flags & ~SOAPY_SDR_HAS_TIME);
+            const int ret = this->transmit(stream, remaining, writeFlags, timeNs, 100000);
+            if (ret == SOAPY_SDR_TIMEOUT) continue;
+            if (ret < 0) break;
+            remaining -= ret;
+        }
+    }
+
+    /*******************************************************************
+     * Antenna API
+     ******************************************************************/
+    std::vector<std::string> listAntennas(const int direction, const size_t) const
+    {
+        return {(direction == SOAPY_SDR_RX)?"RX":"TX"};
+    }
+
+    std::string getAntenna(const int direction, const size_t) const
+    {
+        return (direction == SOAPY_SDR_RX)?"RX":"TX";
+    }
+
+    /*******************************************************************
+     * Gain API
+     ******************************************************************/
+    std::vector<std::string> listGains(const int, const size_t) const
+    {
+        return {"PGA"};
+    }
+
+    void setGain(const int direction, const size_t channel, const double value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _gain[direction].at(channel) = value;
+    }
+
+    double getGain(const int direction, const size_t channel) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _gain[direction].at(channel);
+    }
+
+    void setGain(const int direction, const size_t channel, const std::string &, const double value)
+    {
+        this->setGain(direction, channel, value);
+    }
+
+    double getGain(const int direction, const size_t channel, const std::string &) const
+    {
+        return this->getGain(direction, channel);
+    }
+
+    SoapySDR::Range getGainRange(const int, const size_t) const
+    {
+        return SoapySDR::Range(0.0, 60.0, 1.0);
+    }
+
+    SoapySDR::Range getGainRange(const int direction, const size_t channel, const std::string &) const
+    {
+        return this->getGainRange(direction, channel);
+    }
+
+    /*******************************************************************
+     * Frequency API
+     ******************************************************************/
+    void setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _frequency[direction].at(channel) = frequency;
+    }
+
+    double getFrequency(const int direction, const size_t channel) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _frequency[direction].at(channel);
+    }
+
+    void setFrequency(const int direction, const size_t channel, const std::string &, const double frequency, const SoapySDR::Kwargs &args)
+    {
+        this->setFrequency(direction, channel, frequency, args);
+    }
+
+    double getFrequency(const int direction, const size_t channel, const std::string &) const
+    {
+        return this->getFrequency(direction, channel);
+    }
+
+    std::vector<std::string> listFrequencies(const int, const size_t) const
+    {
+        return {"RF"};
+    }
+
+    SoapySDR::RangeList getFrequencyRange(const int, const size_t) const
+    {
+        return {SoapySDR::Range(0.0, 6e9)};
+    }
+
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel, const std::string &) const
+    {
+        return this->getFrequencyRange(direction, channel);
+    }
+
+    /*******************************************************************
+     * Sample Rate API
+     ******************************************************************/
+    void setSampleRate(const int direction, const size_t, const double rate)
+    {
+        if (rate <= 0.0) throw std::runtime_error("SimDevice::setSampleRate() invalid rate");
+        std::lock_guard<std::mutex> lock(_mutex);
+        _sampleRate[direction] = (_rateStep > 0.0)?std::max(1.0, std::round(rate/_rateStep))*_rateStep:rate;
+    }
+
+    double getSampleRate(const int direction, const size_t) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _sampleRate[direction];
+    }
+
+    SoapySDR::RangeList getSampleRateRange(const int, const size_t) const
+    {
+        //a rate step mimics hardware with an integer clock divider
+        if (_rateStep > 0.0) return {SoapySDR::Range(_rateStep, 1e9, _rateStep)};
+        return {SoapySDR::Range(1e3, 1e9)};
+    }
+
+    /*******************************************************************
+     * Bandwidth API
+     ******************************************************************/
+    void setBandwidth(const int direction, const size_t channel, const double bw)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _bandwidth[direction].at(channel) = bw;
+    }
+
+    double getBandwidth(const int direction, const size_t channel) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _bandwidth[direction].at(channel);
+    }
+
+    SoapySDR::RangeList getBandwidthRange(const int, const size_t) const
+    {
+        return {SoapySDR::Range(1e3, 1e9)};
+    }
+
+    /*******************************************************************
+     * Time API
+     ******************************************************************/
+    std::vector<std::string> listTimeSources(void) const
+    {
+        return {"internal"};
+    }
+
+    std::string getTimeSource(void) const
+    {
+        return "internal";
+    }
+
+    bool hasHardwareTime(const std::string &what) const
+    {
+        return what.empty();
+    }
+
+    long long getHardwareTime(const std::string & = "") const
+    {
+        if (_virtualClock) return _virtualNs.load();
+        const auto elapsed = std::chrono::steady_clock::now() - _epoch;
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() + _timeOffsetNs.load();
+    }
+
+    void setHardwareTime(const long long timeNs, const std::string &what = "")
+    {
+        if (not what.empty()) return; //no command queue, "CMD" times are ignored
+        if (_virtualClock) _virtualNs = timeNs;
+        else _timeOffsetNs += timeNs - this->getHardwareTime();
+    }
+
+    /*******************************************************************
+     * Settings API
+     ******************************************************************/
+    SoapySDR::ArgInfoList getSettingInfo(void) const
+    {
+        SoapySDR::ArgInfoList infos;
+
+        SoapySDR::ArgInfo info;
+        info.key = "tone_freq";
+        info.name = "Tone Frequency";
+        info.value = "10e3";
+        info.units = "Hz";
+        info.type = SoapySDR::ArgInfo::FLOAT;
+        info.description = "The offset frequency of the generated tone.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "tone_ampl";
+        info.name = "Tone Amplitude";
+        info.value = "0.5";
+        info.type = SoapySDR::ArgInfo::FLOAT;
+        info.range = SoapySDR::Range(0.0, 1.0);
+        info.description = "The amplitude of the generated tone relative to full scale.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "noise_ampl";
+        info.name = "Noise Amplitude";
+        info.value = "0.01";
+        info.type = SoapySDR::ArgInfo::FLOAT;
+        info.range = SoapySDR::Range(0.0, 1.0);
+        info.description = "The amplitude of the uniform noise relative to full scale.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "inject_overflow";
+        info.name = "Inject Overflow";
+        info.value = "0";
+        info.units = "elements";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "Drop this many elements on the next receive call and report an overflow.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "inject_underflow";
+        info.name = "Inject Underflow";
+        info.value = "0";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "Report this many underflows on the following transmit calls.";
+        infos.push_back(info);
+
+        return infos;
+    }
+
+    void writeSetting(const std::string &key, const std::string &value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (key == "tone_freq") _toneFreq = SoapySDR::StringToSetting<double>(value);
+        else if (key == "tone_ampl") _toneAmpl = SoapySDR::StringToSetting<double>(value);
+        else if (key == "noise_ampl") _noiseAmpl = SoapySDR::StringToSetting<double>(value);
+        else if (key == "inject_overflow") _injectOverflow += SoapySDR::StringToSetting<long long>(value);
+        else if (key == "inject_underflow") _injectUnderflow += SoapySDR::StringToSetting<long long>(value);
+    }
+
+    std::string readSetting(const std::string &key) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (key == "tone_freq") return SoapySDR::SettingToString(_toneFreq);
+        if (key == "tone_ampl") return SoapySDR::SettingToString(_toneAmpl);
+        if (key == "noise_ampl") return SoapySDR::SettingToString(_noiseAmpl);
+        if (key == "inject_overflow") return SoapySDR::SettingToString(_injectOverflow.load());
+        if (key == "inject_underflow") return SoapySDR::SettingToString(_injectUnderflow.load());
+        return "";
+    }
+
+private:
+    long long streamTimeNs(const SimStream *stream, const long long ticks) const
+    {
+        return stream->startNs + SoapySDR::ticksToTimeNs(ticks, stream->rate);
+    }
+
+    //advance the virtual clock, it never goes backwards
+    void advanceVirtualClock(const long long timeNs)
+    {
+        long long current = _virtualNs.load();
+        while (current < timeNs and not _virtualNs.compare_exchange_weak(current, timeNs)) {}
+    }
+
+    //wait until the hardware time reaches timeNs or return false on timeout
+    bool waitForTime(const long long timeNs, const long timeoutUs)
+    {
+        if (_virtualClock)
+        {
+            this->advanceVirtualClock(timeNs);
+            return true;
+        }
+        const long long waitNs = timeNs - this->getHardwareTime();
+        if (waitNs <= 0) return true;
+        if (waitNs > (long long)(timeoutUs)*1000)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(timeoutUs));
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::nanoseconds(waitNs));
+        return true;
+    }
+
+    void postStatus(SimStream *stream, const int ret, const int flags, const long long timeNs)
+    {
+        std::lock_guard<std::mutex> lock(stream->statusMutex);
+        stream->status.push_back(SimStream::Status{ret, flags, timeNs});
+        stream->statusCond.notify_all();
+    }
+
+    int receive(SimStream *stream, void * const *buffs, size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        flags = 0;
+        if (not stream->active) return SOAPY_SDR_STREAM_ERROR;
+
+        //a finite burst has completed, there is nothing more to receive
+        if (stream->finite and stream->burstRemaining == 0)
+        {
+            if (not _virtualClock) std::this_thread::sleep_for(std::chrono::microseconds(timeoutUs));
+            return SOAPY_SDR_TIMEOUT;
+        }
+
+        //drop samples when an overflow was requested
+        const long long inject = _injectOverflow.exchange(0);
+        if (inject > 0)
+        {
+            stream->ticks += inject;
+            return SOAPY_SDR_OVERFLOW;
+        }
+
+        //drop samples when the caller fell behind by more than the buffering
+        if (not _virtualClock)
+        {
+            const long long behind = this->getHardwareTime() - this->streamTimeNs(stream, stream->ticks);
+            const long long capacity = SoapySDR::ticksToTimeNs(stream->mtu*stream->numBuffs, stream->rate);
+            if (behind > capacity)
+            {
+                stream->ticks += SoapySDR::timeNsToTicks(behind, stream->rate);
+                return SOAPY_SDR_OVERFLOW;
+            }
+        }
+
+        numElems = std::min(numElems, stream->mtu);
+        if (stream->finite) numElems = std::min(numElems, stream->burstRemaining);
+
+        //the samples are available once the last one was received
+        if (not this->waitForTime(this->streamTimeNs(stream, stream->ticks+numElems), timeoutUs)) return SOAPY_SDR_TIMEOUT;
+
+        double toneFreq, toneAmpl, noiseAmpl;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            toneFreq = _toneFreq;
+            toneAmpl = _toneAmpl;
+            noiseAmpl = _noiseAmpl;
+        }
+
+        for (size_t i = 0; i < stream->channels.size(); i++)
+        {
+            this->generate(stream, stream->channels[i], numElems, toneFreq, toneAmpl, noiseAmpl);
+            stream->quantize(stream->scratch.data(), buffs[i], numElems);
+        }
+
+        flags |= SOAPY_SDR_HAS_TIME;
+        timeNs = this->streamTimeNs(stream, stream->ticks);
+        stream->ticks += numElems;
+        if (stream->finite)
+        {
+            stream->burstRemaining -= numElems;
+            if (stream->burstRemaining == 0) flags |= SOAPY_SDR_END_BURST;
+        }
+        return int(numElems);
+    }
+
+    void generate(SimStream *stream, const size_t channel, const size_t numElems, const double toneFreq, const double toneAmpl, const double noiseAmpl)
+    {
+        //the phase is derived from the absolute tick count so that it stays continuous
+        const double phaseInc = 2*PI*toneFreq/stream->rate;
+        const double phase0 = std::fmod(phaseInc*double(stream->ticks), 2*PI) + 0.5*channel;
+        const float rotRe = float(std::cos(phaseInc)), rotIm = float(std::sin(phaseInc));
+        float re = float(toneAmpl*std::cos(phase0)), im = float(toneAmpl*std::sin(phase0));
+
+        const float noiseScale = float(noiseAmpl)/float(1u << 31);
+        uint32_t state = stream->noiseState;
+        float *out = stream->scratch.data();
+        for (size_t i = 0; i < numElems; i++)
+        {
+            //xorshift32 for cheap uniform noise
+            state ^= state << 13; state ^= state >> 17; state ^= state << 5;
+            const float nRe = float(int32_t(state))*noiseScale;
+            state ^= state << 13; state ^= state >> 17; state ^= state << 5;
+            const float nIm = float(int32_t(state))*noiseScale;
+            out[2*i+0] = re + nRe;
+            out[2*i+1] = im + nIm;
+            const float nextRe = re*rotRe - im*rotIm;
+            im = re*rotIm + im*rotRe;
+            re = nextRe;
+        }
+        stream->noiseState = state;
+    }
+
+    int transmit(SimStream *stream, size_t numElems, const int flags, const long long timeNs, const long timeoutUs)
+    {
+        if (not stream->active) return SOAPY_SDR_STREAM_ERROR;
+        numElems = std::min(numElems, stream->mtu);
+        const long long nowNs = this->getHardwareTime();
+
+        //a timed burst starts the stream timeline at the requested time
+        if ((flags & SOAPY_SDR_HAS_TIME) != 0)
+        {
+            if (timeNs < nowNs)
+            {
+                this->postStatus(stream, SOAPY_SDR_TIME_ERROR, SOAPY_SDR_HAS_TIME, timeNs);
+                stream->txInBurst = false;
+                return int(numElems);
+            }
+            stream->startNs = timeNs;
+            stream->ticks = 0;
+            stream->txInBurst = true;
+        }
+
+        //an untimed burst starts now
+        else if (not stream->txInBurst)
+        {
+            stream->startNs = nowNs;
+            stream->ticks = 0;
+            stream->txInBurst = true;
+        }
+
+        //the stream already passed the time of these samples
+        else if (not _virtualClock and nowNs > this->streamTimeNs(stream, stream->ticks))
+        {
+            this->postStatus(stream, SOAPY_SDR_UNDERFLOW, SOAPY_SDR_HAS_TIME, nowNs);
+            stream->startNs = nowNs;
+            stream->ticks = 0;
+        }
+
+        if (_injectUnderflow.load() > 0 and _injectUnderflow.fetch_sub(1) > 0)
+        {
+            this->postStatus(stream, SOAPY_SDR_UNDERFLOW, SOAPY_SDR_HAS_TIME, this->streamTimeNs(stream, stream->ticks));
+        }
+
+        //back-pressure: the buffering can hold a limited amount ahead of the hardware time
+        const long long capacity = SoapySDR::ticksToTimeNs(stream->mtu*stream->numBuffs, stream->rate);
+        const long long firstNs = this->streamTimeNs(stream, stream->ticks);
+        if (not _virtualClock and not this->waitForTime(firstNs - capacity, timeoutUs)) return SOAPY_SDR_TIMEOUT;
+        if (_virtualClock) this->advanceVirtualClock(this->streamTimeNs(stream, stream->ticks+numElems));
+
+        stream->ticks += numElems;
+        if ((flags & SOAPY_SDR_END_BURST) != 0)
+        {
+            stream->txInBurst = false;
+            this->postStatus(stream, 0, SOAPY_SDR_END_BURST | SOAPY_SDR_HAS_TIME, this->streamTimeNs(stream, stream->ticks));
+        }
+        return int(numElems);
+    }
+
+    size_t _numChans;
+    bool _virtualClock;
+    double _rateStep;
+    const std::chrono::steady_clock::time_point _epoch;
+    std::atomic<long long> _timeOffsetNs;
+    std::atomic<long long> _virtualNs;
+
+    //configuration protected by the mutex
+    mutable std::mutex _mutex;
+    double _sampleRate[2];
+    std::vector<double> _frequency[2];
+    std::vector<double> _bandwidth[2];
+    std::vector<double> _gain[2];
+    double _toneFreq;
+    double _toneAmpl;
+    double _noiseAmpl;
+
+    //pending fault injections
+    std::atomic<long long> _injectOverflow;
+    std::atomic<long long> _injectUnderflow;
+};
+
+/*******************************************************************
+ * Registration
+ ******************************************************************/
+SoapySDR::KwargsList findSimDevice(const SoapySDR::Kwargs &args)
+{
+    SoapySDR::KwargsList results;
+
+    //require that the user specify type=sim or driver=sim
+    const bool typeMatch = args.count("type") != 0 and args.at("type") == "sim";
+    const bool driverMatch = args.count("driver") != 0 and args.at("driver") == "sim";
+    if (not typeMatch and not driverMatch) return results;
+
+    SoapySDR::Kwargs simArgs;
+    simArgs["type"] = "sim";
+    simArgs["label"] = "Simulated SDR";
+    if (args.count("serial") != 0) simArgs["serial"] = args.at("serial"); //distinguishes instances
+    results.push_back(simArgs);
+
+    return results;
+}
+
+SoapySDR::Device *makeSimDevice(const SoapySDR::Kwargs &args)
+{
+    return new SimDevice(args);
+}
+
+/*!
+ * lateLoadSimDevice() is called by loadModules()
+ * to load the sim device on-demand/not statically.
+ * See lateLoadNullDevice() for the reasoning.
+ */
+void lateLoadSimDevice(void)
+{
+    static SoapySDR::Registry registerSimDevice("sim", &findSimDevice, &makeSimDevice, SOAPY_SDR_ABI_VERSION);
+}
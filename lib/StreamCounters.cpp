@@ -0,0 +1,70 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "StreamCounters.hpp"
+#include <SoapySDR/Errors.h>
+
+StreamCounters::StreamCounters(void):
+    _numElems(0),
+    _numCalls(0),
+    _numTimeouts(0),
+    _numOverflows(0),
+    _numUnderflows(0),
+    _numTimeErrors(0)
+{
+    for (auto &bucket : _latencyHistogram) bucket.store(0);
+}
+
+void StreamCounters::recordCall(const int ret, const TimePoint &start)
+{
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    unsigned long long us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    //floor(log2(us)) clipped to the size of the histogram
+    size_t bucket = 0;
+    while ((us >>= 1) != 0 and bucket < SOAPY_SDR_STREAM_STATS_HISTOGRAM_SIZE-1) bucket++;
+    _latencyHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    _numCalls.fetch_add(1, std::memory_order_relaxed);
+
+    if (ret > 0) _numElems.fetch_add(ret, std::memory_order_relaxed);
+    else this->recordError(ret);
+}
+
+void StreamCounters::recordElems(const size_t numElems)
+{
+    _numElems.fetch_add(numElems, std::memory_order_relaxed);
+}
+
+void StreamCounters::recordStatus(const int ret)
+{
+    //timeouts on the status are the normal polling case and not counted
+    if (ret != SOAPY_SDR_TIMEOUT) this->recordError(ret);
+}
+
+void StreamCounters::recordError(const int ret)
+{
+    switch (ret)
+    {
+    case SOAPY_SDR_TIMEOUT: _numTimeouts.fetch_add(1, std::memory_order_relaxed); break;
+    case SOAPY_SDR_OVERFLOW: _numOverflows.fetch_add(1, std::memory_order_relaxed); break;
+    case SOAPY_SDR_UNDERFLOW: _numUnderflows.fetch_add(1, std::memory_order_relaxed); break;
+    case SOAPY_SDR_TIME_ERROR: _numTimeErrors.fetch_add(1, std::memory_order_relaxed); break;
+    default: break;
+    }
+}
+
+SoapySDR::StreamStats StreamCounters::getStats(void) const
+{
+    SoapySDR::StreamStats stats;
+    stats.numElems = _numElems.load(std::memory_order_relaxed);
+    stats.numCalls = _numCalls.load(std::memory_order_relaxed);
+    stats.numTimeouts = _numTimeouts.load(std::memory_order_relaxed);
+    stats.numOverflows = _numOverflows.load(std::memory_order_relaxed);
+    stats.numUnderflows = _numUnderflows.load(std::memory_order_relaxed);
+    stats.numTimeErrors = _numTimeErrors.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < SOAPY_SDR_STREAM_STATS_HISTOGRAM_SIZE; i++)
+    {
+        stats.latencyHistogram[i] = _latencyHistogram[i].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
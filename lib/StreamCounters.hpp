@@ -0,0 +1,43 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Types.hpp>
+#include <atomic>
+#include <chrono>
+
+/*!
+ * StreamCounters accumulates the runtime statistics of one stream.
+ * All counters are relaxed atomics so that recording is lock-free
+ * and safe from concurrent read, write, and status calls.
+ */
+class StreamCounters
+{
+public:
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    StreamCounters(void);
+
+    //! Record the result of a read, write, or acquire call started at start
+    void recordCall(const int ret, const TimePoint &start);
+
+    //! Record elements transferred outside of a recorded call
+    void recordElems(const size_t numElems);
+
+    //! Record an error code reported by the stream status
+    void recordStatus(const int ret);
+
+    //! Get a snapshot of the counters
+    SoapySDR::StreamStats getStats(void) const;
+
+private:
+    void recordError(const int ret);
+
+    std::atomic<unsigned long long> _numElems;
+    std::atomic<unsigned long long> _numCalls;
+    std::atomic<unsigned long long> _numTimeouts;
+    std::atomic<unsigned long long> _numOverflows;
+    std::atomic<unsigned long long> _numUnderflows;
+    std::atomic<unsigned long long> _numTimeErrors;
+    std::atomic<unsigned long long> _latencyHistogram[SOAPY_SDR_STREAM_STATS_HISTOGRAM_SIZE];
+};
@@ -0,0 +1,512 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "StreamLayer.hpp"
+#include "TxScheduler.hpp"
+#include "RxGapFiller.hpp"
+#include "RxTrigger.hpp"
+#include "StreamCounters.hpp"
+#include "StreamTap.hpp"
+#include "SweepEngine.hpp"
+#include <SoapySDR/Formats.hpp>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+/*******************************************************************
+ * Per-stream library state
+ ******************************************************************/
+struct LayerStream
+{
+    SoapySDR::Stream *stream; //the underlying driver stream
+    int direction;
+    std::string format;
+    std::vector<size_t> channels;
+    size_t elemSize;
+
+    //optional software scheduler for transmit streams
+    std::unique_ptr<TxScheduler> scheduler;
+
+    //optional gap filling for receive streams
+    std::unique_ptr<RxGapFiller> gapFiller;
+
+    //optional software trigger for receive streams
+    std::unique_ptr<RxTrigger> trigger;
+
+    //runtime statistics for getStreamStats()
+    StreamCounters counters;
+
+    //broadcast ring for stream taps, made by the first tap
+    size_t tapSlots;
+    std::mutex tapMutex;
+    std::shared_ptr<StreamTapRing> tapRingOwner;
+    std::atomic<StreamTapRing *> tapRing;
+};
+
+//null handles from drivers without streaming support pass through as a null driver stream
+static LayerStream nullLayerStream;
+
+static inline LayerStream *toLayerStream(SoapySDR::Stream *stream)
+{
+    if (stream == nullptr) return &nullLayerStream;
+    return reinterpret_cast<LayerStream *>(stream);
+}
+
+static inline StreamTapReader *toTapReader(SoapySDR::StreamTap *tap)
+{
+    if (tap == nullptr) throw std::invalid_argument("null stream tap handle");
+    return reinterpret_cast<StreamTapReader *>(tap);
+}
+
+//a sweep is either implemented by the driver or by the library engine
+struct LayerSweep
+{
+    SoapySDR::Sweep *driverSweep;
+    std::unique_ptr<SweepEngine> engine;
+};
+
+static inline LayerSweep *toLayerSweep(SoapySDR::Sweep *sweep)
+{
+    if (sweep == nullptr) throw std::invalid_argument("null sweep handle");
+    return reinterpret_cast<LayerSweep *>(sweep);
+}
+
+//publish a receive result to the taps, a single atomic load when there are none
+static inline void publishToTaps(LayerStream *layerStream, const void * const *buffs, const int ret, const int flags, const long long timeNs)
+{
+    auto ring = layerStream->tapRing.load(std::memory_order_acquire);
+    if (ring != nullptr) ring->publish(buffs, ret, flags, timeNs);
+}
+
+//stream args consumed by the layer and not passed to the driver
+static bool isLayerStreamArg(const std::string &key)
+{
+    return key == "SCHEDULER" or
+        key == "CONTINUOUS" or
+        key == "SCHEDULER_LEAD" or
+        key == "SCHEDULER_QUEUE" or
+        key == "GAP_FILL" or
+        key == "GAP_FILL_MAX" or
+        key == "TAP_SLOTS" or
+        key.compare(0, 7, "TRIGGER") == 0;
+}
+
+static bool argEnabled(const SoapySDR::Kwargs &args, const std::string &key)
+{
+    return args.count(key) != 0 and SoapySDR::StringToSetting<bool>(args.at(key));
+}
+
+/*******************************************************************
+ * Stream layer
+ ******************************************************************/
+StreamLayer::StreamLayer(SoapySDR::Device *device):
+    DeviceDecorator(device)
+{
+    return;
+}
+
+SoapySDR::ArgInfoList StreamLayer::getStreamArgsInfo(const int direction, const size_t channel) const
+{
+    auto infos = _device->getStreamArgsInfo(direction, channel);
+
+    if (direction == SOAPY_SDR_TX)
+    {
+        SoapySDR::ArgInfo info;
+        info.key = "SCHEDULER";
+        info.name = "Software Scheduler";
+        info.value = "false";
+        info.type = SoapySDR::ArgInfo::BOOL;
+        info.description = "Queue timed bursts and release them to the driver just in time.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "CONTINUOUS";
+        info.name = "Continuous Transmit";
+        info.value = "false";
+        info.type = SoapySDR::ArgInfo::BOOL;
+        info.description = "Fill the gaps between scheduled bursts with zeros.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "SCHEDULER_LEAD";
+        info.name = "Scheduler Lead Time";
+        info.value = "2000";
+        info.units = "us";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "Release scheduled bursts this long before their time.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "SCHEDULER_QUEUE";
+        info.name = "Scheduler Queue Size";
+        info.value = "4194304";
+        info.units = "elements";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "Maximum number of elements held by the scheduler before writes block.";
+        infos.push_back(info);
+    }
+
+    if (direction == SOAPY_SDR_RX)
+    {
+        SoapySDR::ArgInfo info;
+        info.key = "GAP_FILL";
+        info.name = "Gap Filling";
+        info.value = "false";
+        info.type = SoapySDR::ArgInfo::BOOL;
+        info.description = "Replace samples lost to overflows with zeros using the buffer timestamps.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "GAP_FILL_MAX";
+        info.name = "Maximum Gap";
+        info.value = "16777216";
+        info.units = "elements";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "Gaps longer than this re-synchronize the stream instead of being filled.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "TRIGGER";
+        info.name = "Software Trigger";
+        info.value = "";
+        info.type = SoapySDR::ArgInfo::STRING;
+        info.description = "Deliver only windows around a trigger condition on the magnitude.";
+        info.options = {"", "POWER", "LEVEL", "EDGE"};
+        info.optionNames = {"Off", "Average Power", "Level", "Rising Edge"};
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "TRIGGER_LEVEL";
+        info.name = "Trigger Level";
+        info.value = "-20";
+        info.units = "dBFS";
+        info.type = SoapySDR::ArgInfo::FLOAT;
+        info.description = "The trigger threshold relative to full scale.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "TRIGGER_PRE";
+        info.name = "Pre-trigger Length";
+        info.value = "1024";
+        info.units = "elements";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "The number of elements before the trigger to include in each window.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "TRIGGER_POST";
+        info.name = "Post-trigger Length";
+        info.value = "4096";
+        info.units = "elements";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "The number of elements from the trigger onwards to include in each window.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "TRIGGER_AVG";
+        info.name = "Power Averaging";
+        info.value = "64";
+        info.units = "elements";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "The averaging length of the POWER trigger.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "TRIGGER_CHANNEL";
+        info.name = "Trigger Channel";
+        info.value = "0";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "The index into the stream channels of the channel to trigger on.";
+        infos.push_back(info);
+
+        info = SoapySDR::ArgInfo();
+        info.key = "TAP_SLOTS";
+        info.name = "Stream Tap Slots";
+        info.value = "16";
+        info.units = "buffers";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.description = "The number of stream buffers shared with the stream taps.";
+        infos.push_back(info);
+    }
+
+    return infos;
+}
+
+SoapySDR::Stream *StreamLayer::setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+{
+    SoapySDR::Kwargs driverArgs;
+    for (const auto &pair : args)
+    {
+        if (not isLayerStreamArg(pair.first)) driverArgs.insert(pair);
+    }
+
+    auto stream = _device->setupStream(direction, format, channels, driverArgs);
+    if (stream == nullptr) return nullptr;
+
+    std::unique_ptr<LayerStream> layerStream(new LayerStream());
+    layerStream->stream = stream;
+    layerStream->direction = direction;
+    layerStream->format = format;
+    layerStream->channels = channels.empty()?std::vector<size_t>(1, 0):channels;
+    layerStream->elemSize = SoapySDR::formatToSize(format);
+    layerStream->tapSlots = 16;
+    layerStream->tapRing = nullptr;
+
+    try
+    {
+        if (args.count("TAP_SLOTS") != 0)
+        {
+            layerStream->tapSlots = SoapySDR::StringToSetting<size_t>(args.at("TAP_SLOTS"));
+        }
+        if (direction == SOAPY_SDR_TX and argEnabled(args, "SCHEDULER"))
+        {
+            layerStream->scheduler.reset(new TxScheduler(_device, stream,
+                layerStream->channels.size(), layerStream->elemSize, args));
+        }
+        if (direction == SOAPY_SDR_RX and argEnabled(args, "GAP_FILL"))
+        {
+            layerStream->gapFiller.reset(new RxGapFiller(_device, stream,
+                layerStream->channels.size(), layerStream->elemSize, args));
+        }
+        if (direction == SOAPY_SDR_RX and args.count("TRIGGER") != 0 and not args.at("TRIGGER").empty())
+        {
+            //the trigger reads from the gap filler when both are enabled
+            auto ls = layerStream.get();
+            auto reader = [this, ls](void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+            {
+                if (ls->gapFiller) return ls->gapFiller->read(buffs, numElems, flags, timeNs, timeoutUs);
+                return _device->readStream(ls->stream, buffs, numElems, flags, timeNs, timeoutUs);
+            };
+            layerStream->trigger.reset(new RxTrigger(reader, format, layerStream->channels.size(),
+                layerStream->elemSize, _device->getStreamMTU(stream), args));
+        }
+    }
+    catch (...)
+    {
+        _device->closeStream(stream);
+        throw;
+    }
+
+    return reinterpret_cast<SoapySDR::Stream *>(layerStream.release());
+}
+
+void StreamLayer::closeStream(SoapySDR::Stream *stream)
+{
+    if (stream == nullptr) return _device->closeStream(nullptr);
+    std::unique_ptr<LayerStream> layerStream(toLayerStream(stream));
+    layerStream->scheduler.reset();
+    _device->closeStream(layerStream->stream);
+}
+
+size_t StreamLayer::getStreamMTU(SoapySDR::Stream *stream) const
+{
+    return _device->getStreamMTU(toLayerStream(stream)->stream);
+}
+
+int StreamLayer::activateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs, const size_t numElems)
+{
+    auto layerStream = toLayerStream(stream);
+
+    //a software trigger takes the place of the hardware trigger
+    const int driverFlags = layerStream->trigger?(flags & ~SOAPY_SDR_WAIT_TRIGGER):flags;
+    const int ret = _device->activateStream(layerStream->stream, driverFlags, timeNs, numElems);
+    if (ret != 0) return ret;
+
+    if (layerStream->scheduler)
+    {
+        layerStream->scheduler->start(_device->getSampleRate(layerStream->direction, layerStream->channels.front()));
+    }
+    if (layerStream->gapFiller)
+    {
+        layerStream->gapFiller->reset(_device->getSampleRate(layerStream->direction, layerStream->channels.front()));
+    }
+    if (layerStream->trigger)
+    {
+        layerStream->trigger->reset(_device->getSampleRate(layerStream->direction, layerStream->channels.front()));
+    }
+    return ret;
+}
+
+int StreamLayer::deactivateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs)
+{
+    auto layerStream = toLayerStream(stream);
+    if (layerStream->scheduler) layerStream->scheduler->stop();
+    return _device->deactivateStream(layerStream->stream, flags, timeNs);
+}
+
+int StreamLayer::readStream(SoapySDR::Stream *stream, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto layerStream = toLayerStream(stream);
+    const auto start = std::chrono::steady_clock::now();
+    int ret(0);
+    if (layerStream->trigger) ret = layerStream->trigger->read(buffs, numElems, flags, timeNs, timeoutUs);
+    else if (layerStream->gapFiller) ret = layerStream->gapFiller->read(buffs, numElems, flags, timeNs, timeoutUs);
+    else ret = _device->readStream(layerStream->stream, buffs, numElems, flags, timeNs, timeoutUs);
+    layerStream->counters.recordCall(ret, start);
+    publishToTaps(layerStream, buffs, ret, flags, timeNs);
+    return ret;
+}
+
+int StreamLayer::writeStream(SoapySDR::Stream *stream, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+    auto layerStream = toLayerStream(stream);
+    const auto start = std::chrono::steady_clock::now();
+    int ret(0);
+    if (layerStream->scheduler) ret = layerStream->scheduler->write(buffs, numElems, flags, timeNs, timeoutUs);
+    else ret = _device->writeStream(layerStream->stream, buffs, numElems, flags, timeNs, timeoutUs);
+    layerStream->counters.recordCall(ret, start);
+    return ret;
+}
+
+int StreamLayer::readStreamStatus(SoapySDR::Stream *stream, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto layerStream = toLayerStream(stream);
+    int ret(0);
+    if (layerStream->scheduler) ret = layerStream->scheduler->readStatus(chanMask, flags, timeNs, timeoutUs);
+    else ret = _device->readStreamStatus(layerStream->stream, chanMask, flags, timeNs, timeoutUs);
+    layerStream->counters.recordStatus(ret);
+    return ret;
+}
+
+SoapySDR::StreamStats StreamLayer::getStreamStats(SoapySDR::Stream *stream) const
+{
+    auto layerStream = toLayerStream(stream);
+    auto stats = layerStream->counters.getStats();
+    if (layerStream->gapFiller)
+    {
+        stats.numGaps = layerStream->gapFiller->getNumGaps();
+        stats.numGapElems = layerStream->gapFiller->getNumGapElems();
+        stats.numOverflows += layerStream->gapFiller->getNumOverflows();
+    }
+    return stats;
+}
+
+/*******************************************************************
+ * Direct buffer access API
+ ******************************************************************/
+size_t StreamLayer::getNumDirectAccessBuffers(SoapySDR::Stream *stream)
+{
+    //scheduled, gap filled, and triggered streams must go through the read/write calls
+    auto layerStream = toLayerStream(stream);
+    if (layerStream->scheduler or layerStream->gapFiller or layerStream->trigger) return 0;
+    return _device->getNumDirectAccessBuffers(layerStream->stream);
+}
+
+int StreamLayer::getDirectAccessBufferAddrs(SoapySDR::Stream *stream, const size_t handle, void **buffs)
+{
+    return _device->getDirectAccessBufferAddrs(toLayerStream(stream)->stream, handle, buffs);
+}
+
+int StreamLayer::acquireReadBuffer(SoapySDR::Stream *stream, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto layerStream = toLayerStream(stream);
+    if (layerStream->gapFiller or layerStream->trigger) return SOAPY_SDR_NOT_SUPPORTED;
+    const auto start = std::chrono::steady_clock::now();
+    const int ret = _device->acquireReadBuffer(layerStream->stream, handle, buffs, flags, timeNs, timeoutUs);
+    layerStream->counters.recordCall(ret, start);
+    publishToTaps(layerStream, buffs, ret, flags, timeNs);
+    return ret;
+}
+
+void StreamLayer::releaseReadBuffer(SoapySDR::Stream *stream, const size_t handle)
+{
+    _device->releaseReadBuffer(toLayerStream(stream)->stream, handle);
+}
+
+int StreamLayer::acquireWriteBuffer(SoapySDR::Stream *stream, size_t &handle, void **buffs, const long timeoutUs)
+{
+    auto layerStream = toLayerStream(stream);
+    if (layerStream->scheduler) return SOAPY_SDR_NOT_SUPPORTED;
+    const auto start = std::chrono::steady_clock::now();
+    const int ret = _device->acquireWriteBuffer(layerStream->stream, handle, buffs, timeoutUs);
+
+    //the elements are counted when the buffer is released
+    layerStream->counters.recordCall(std::min(ret, 0), start);
+    return ret;
+}
+
+void StreamLayer::releaseWriteBuffer(SoapySDR::Stream *stream, const size_t handle, const size_t numElems, int &flags, const long long timeNs)
+{
+    auto layerStream = toLayerStream(stream);
+    layerStream->counters.recordElems(numElems);
+    _device->releaseWriteBuffer(layerStream->stream, handle, numElems, flags, timeNs);
+}
+
+/*******************************************************************
+ * Stream tap API
+ ******************************************************************/
+SoapySDR::StreamTap *StreamLayer::setupStreamTap(SoapySDR::Stream *stream, const SoapySDR::Kwargs &)
+{
+    auto layerStream = toLayerStream(stream);
+    if (stream == nullptr or layerStream->direction != SOAPY_SDR_RX)
+    {
+        throw std::invalid_argument("setupStreamTap() requires a receive stream");
+    }
+
+    std::lock_guard<std::mutex> lock(layerStream->tapMutex);
+    if (not layerStream->tapRingOwner)
+    {
+        //a slot holds one MTU, larger reads are published in fragments
+        const size_t mtu = _device->getStreamMTU(layerStream->stream);
+        layerStream->tapRingOwner.reset(new StreamTapRing(layerStream->channels.size(),
+            layerStream->elemSize, (mtu == 0)?4096:mtu, layerStream->tapSlots));
+        layerStream->tapRing.store(layerStream->tapRingOwner.get(), std::memory_order_release);
+    }
+    return reinterpret_cast<SoapySDR::StreamTap *>(new StreamTapReader(layerStream->tapRingOwner));
+}
+
+void StreamLayer::closeStreamTap(SoapySDR::StreamTap *tap)
+{
+    delete toTapReader(tap);
+}
+
+int StreamLayer::readStreamTap(SoapySDR::StreamTap *tap, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    return toTapReader(tap)->read(buffs, numElems, flags, timeNs, timeoutUs);
+}
+
+int StreamLayer::acquireTapBuffer(SoapySDR::StreamTap *tap, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    return toTapReader(tap)->acquire(handle, buffs, flags, timeNs, timeoutUs);
+}
+
+void StreamLayer::releaseTapBuffer(SoapySDR::StreamTap *tap, const size_t handle)
+{
+    toTapReader(tap)->release(handle);
+}
+
+unsigned long long StreamLayer::getStreamTapDrops(SoapySDR::StreamTap *tap) const
+{
+    return toTapReader(tap)->getNumDrops();
+}
+
+/*******************************************************************
+ * Sweep API
+ ******************************************************************/
+SoapySDR::Sweep *StreamLayer::setupSweep(const int direction, const size_t channel, const std::string &format, const std::vector<double> &frequencies, const size_t dwellElems, const long long settleNs, const SoapySDR::Kwargs &args)
+{
+    std::unique_ptr<LayerSweep> layerSweep(new LayerSweep());
+    layerSweep->driverSweep = _device->setupSweep(direction, channel, format, frequencies, dwellElems, settleNs, args);
+
+    //the engine uses this layer, so that sweeps get the library stream features
+    if (layerSweep->driverSweep == nullptr)
+    {
+        layerSweep->engine.reset(new SweepEngine(*this, direction, channel, format, frequencies, dwellElems, settleNs, args));
+    }
+    return reinterpret_cast<SoapySDR::Sweep *>(layerSweep.release());
+}
+
+void StreamLayer::closeSweep(SoapySDR::Sweep *sweep)
+{
+    std::unique_ptr<LayerSweep> layerSweep(toLayerSweep(sweep));
+    if (layerSweep->driverSweep != nullptr) _device->closeSweep(layerSweep->driverSweep);
+}
+
+int StreamLayer::readSweep(SoapySDR::Sweep *sweep, void *buff, int &flags, double &frequency, long long &timeNs, const long timeoutUs)
+{
+    auto layerSweep = toLayerSweep(sweep);
+    if (layerSweep->driverSweep != nullptr) return _device->readSweep(layerSweep->driverSweep, buff, flags, frequency, timeNs, timeoutUs);
+    return layerSweep->engine->read(buff, flags, frequency, timeNs, timeoutUs);
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include "DeviceDecorator.hpp"
+
+/*!
+ * StreamLayer is the library-side stream processing layer.
+ * The factory places it around the device when stream_layer=true,
+ * so that devices made without it keep the driver stream handles.
+ * Streams are wrapped with library state so that features
+ * requested through stream args work for any driver.
+ * Captures are passed to the device, since their temporary
+ * streams have no handle for statistics or taps.
+ */
+class StreamLayer : public DeviceDecorator
+{
+public:
+    StreamLayer(SoapySDR::Device *device);
+
+    /*******************************************************************
+     * Stream API
+     ******************************************************************/
+    SoapySDR::ArgInfoList getStreamArgsInfo(const int direction, const size_t channel) const;
+    SoapySDR::Stream *setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args);
+    void closeStream(SoapySDR::Stream *stream);
+    size_t getStreamMTU(SoapySDR::Stream *stream) const;
+    int activateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs, const size_t numElems);
+    int deactivateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs);
+    int readStream(SoapySDR::Stream *stream, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+    int writeStream(SoapySDR::Stream *stream, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs);
+    int readStreamStatus(SoapySDR::Stream *stream, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs);
+    SoapySDR::StreamStats getStreamStats(SoapySDR::Stream *stream) const;
+
+    /*******************************************************************
+     * Direct buffer access API
+     ******************************************************************/
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *stream);
+    int getDirectAccessBufferAddrs(SoapySDR::Stream *stream, const size_t handle, void **buffs);
+    int acquireReadBuffer(SoapySDR::Stream *stream, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs);
+    void releaseReadBuffer(SoapySDR::Stream *stream, const size_t handle);
+    int acquireWriteBuffer(SoapySDR::Stream *stream, size_t &handle, void **buffs, const long timeoutUs);
+    void releaseWriteBuffer(SoapySDR::Stream *stream, const size_t handle, const size_t numElems, int &flags, const long long timeNs);
+
+    /*******************************************************************
+     * Stream tap API
+     ******************************************************************/
+    SoapySDR::StreamTap *setupStreamTap(SoapySDR::Stream *stream, const SoapySDR::Kwargs &args);
+    void closeStreamTap(SoapySDR::StreamTap *tap);
+    int readStreamTap(SoapySDR::StreamTap *tap, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+    int acquireTapBuffer(SoapySDR::StreamTap *tap, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs);
+    void releaseTapBuffer(SoapySDR::StreamTap *tap, const size_t handle);
+    unsigned long long getStreamTapDrops(SoapySDR::StreamTap *tap) const;
+
+    /*******************************************************************
+     * Sweep API
+     ******************************************************************/
+    SoapySDR::Sweep *setupSweep(const int direction, const size_t channel, const std::string &format, const std::vector<double> &frequencies, const size_t dwellElems, const long long settleNs, const SoapySDR::Kwargs &args);
+    void closeSweep(SoapySDR::Sweep *sweep);
+    int readSweep(SoapySDR::Sweep *sweep, void *buff, int &flags, double &frequency, long long &timeNs, const long timeoutUs);
+};
@@ -0,0 +1,273 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "StreamTap.hpp"
+#include <SoapySDR/Constants.h>
+#include <SoapySDR/Errors.h>
+#include <algorithm>
+#include <cstring>
+
+/*******************************************************************
+ * Broadcast ring
+ ******************************************************************/
+StreamTapRing::Slot::Slot(void):
+    refs(0),
+    seq(~0ULL),
+    ret(0),
+    flags(0),
+    timeNs(0)
+{
+    return;
+}
+
+StreamTapRing::StreamTapRing(
+    const size_t numChans,
+    const size_t elemSize,
+    const size_t slotElems,
+    const size_t numSlots):
+    _numChans(numChans),
+    _elemSize(elemSize),
+    _slotElems(slotElems),
+    _slots(std::max<size_t>(numSlots, 2)),
+    _numTaps(0),
+    _writeSeq(0),
+    _numWaiters(0)
+{
+    for (auto &slot : _slots)
+    {
+        slot.buffs.assign(_numChans, std::vector<char>(_slotElems*_elemSize));
+    }
+}
+
+void StreamTapRing::publish(const void * const *buffs, const int ret, const int flags, const long long timeNs)
+{
+    if (_numTaps.load(std::memory_order_relaxed) == 0) return;
+    if (ret == 0 or ret == SOAPY_SDR_TIMEOUT) return;
+    if (ret < 0) return this->publishSlot(nullptr, 0, ret, flags, timeNs);
+
+    //results larger than a slot are published as fragments
+    for (size_t offset = 0; offset < size_t(ret); offset += _slotElems)
+    {
+        const size_t numElems = std::min(_slotElems, size_t(ret) - offset);
+        int fragFlags = flags;
+        if (offset != 0) fragFlags &= ~SOAPY_SDR_HAS_TIME;
+        if (offset + numElems < size_t(ret)) fragFlags = (fragFlags | SOAPY_SDR_MORE_FRAGMENTS) & ~SOAPY_SDR_END_BURST;
+        this->publishSlot(buffs, offset, int(numElems), fragFlags, timeNs);
+    }
+}
+
+void StreamTapRing::publishSlot(const void * const *buffs, const size_t offset, const int ret, const int flags, const long long timeNs)
+{
+    const auto seq = _writeSeq.load(std::memory_order_relaxed);
+    auto &slot = _slots[seq % _slots.size()];
+
+    //a slot still held by a tap is skipped, and the taps count it as dropped
+    int refs = 0;
+    if (slot.refs.compare_exchange_strong(refs, -1, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        slot.seq = seq;
+        slot.ret = ret;
+        slot.flags = flags;
+        slot.timeNs = timeNs;
+        for (size_t i = 0; ret > 0 and i < _numChans; i++)
+        {
+            std::memcpy(slot.buffs[i].data(), reinterpret_cast<const char *>(buffs[i]) + offset*_elemSize, size_t(ret)*_elemSize);
+        }
+        slot.refs.store(0, std::memory_order_release);
+    }
+
+    _writeSeq.store(seq + 1);
+
+    //only take the lock when a tap is blocked waiting
+    if (_numWaiters.load() != 0)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _cond.notify_all();
+    }
+}
+
+unsigned long long StreamTapRing::attach(void)
+{
+    _numTaps++;
+    return _writeSeq.load();
+}
+
+void StreamTapRing::detach(void)
+{
+    _numTaps--;
+}
+
+int StreamTapRing::acquire(unsigned long long &seq, unsigned long long &drops, const long timeoutUs)
+{
+    const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+    while (true)
+    {
+        const auto writeSeq = _writeSeq.load(std::memory_order_acquire);
+        if (seq >= writeSeq)
+        {
+            if (not this->wait(seq, exitTime)) return -1;
+            continue;
+        }
+
+        //slots more than one lap behind the writer were overwritten
+        if (writeSeq - seq > _slots.size())
+        {
+            drops += writeSeq - _slots.size() - seq;
+            seq = writeSeq - _slots.size();
+        }
+
+        const size_t index = seq % _slots.size();
+        if (this->hold(index, seq++)) return int(index);
+        drops++;
+    }
+}
+
+void StreamTapRing::release(const size_t index)
+{
+    _slots[index].refs.fetch_sub(1, std::memory_order_release);
+}
+
+bool StreamTapRing::hold(const size_t index, const unsigned long long seq)
+{
+    auto &slot = _slots[index];
+    int refs = slot.refs.load(std::memory_order_relaxed);
+    do
+    {
+        if (refs < 0) return false; //the writer is reusing the slot
+    } while (not slot.refs.compare_exchange_weak(refs, refs + 1, std::memory_order_acquire, std::memory_order_relaxed));
+
+    //the slot may hold a newer sequence, or an older one when it was skipped
+    if (slot.seq == seq) return true;
+    slot.refs.fetch_sub(1, std::memory_order_release);
+    return false;
+}
+
+bool StreamTapRing::wait(const unsigned long long seq, const std::chrono::steady_clock::time_point &exitTime)
+{
+    _numWaiters++;
+    bool ready = false;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        ready = _cond.wait_until(lock, exitTime, [this, seq]{return _writeSeq.load() > seq;});
+    }
+    _numWaiters--;
+    return ready;
+}
+
+/*******************************************************************
+ * Tap reader
+ ******************************************************************/
+StreamTapReader::StreamTapReader(const std::shared_ptr<StreamTapRing> &ring):
+    _ring(ring),
+    _readSeq(ring->attach()),
+    _numDrops(0),
+    _pending(-1),
+    _current(-1),
+    _currentOffset(0),
+    _currentFlags(0),
+    _currentTimeNs(0)
+{
+    return;
+}
+
+StreamTapReader::~StreamTapReader(void)
+{
+    if (_pending >= 0) _ring->release(size_t(_pending));
+    if (_current >= 0) _ring->release(size_t(_current));
+    for (const auto index : _acquired) _ring->release(index);
+    _ring->detach();
+}
+
+int StreamTapReader::acquireSlot(int &index, int &flags, long long &timeNs, const long timeoutUs)
+{
+    index = _pending;
+    _pending = -1;
+    flags = 0;
+
+    if (index < 0)
+    {
+        unsigned long long drops = 0;
+        const int next = _ring->acquire(_readSeq, drops, timeoutUs);
+        if (drops != 0)
+        {
+            //report the overflow first and return the slot on the next call
+            _numDrops += drops;
+            _pending = next;
+            return SOAPY_SDR_OVERFLOW;
+        }
+        if (next < 0) return SOAPY_SDR_TIMEOUT;
+        index = next;
+    }
+
+    const int ret = _ring->getRet(size_t(index));
+    flags = _ring->getFlags(size_t(index));
+    timeNs = _ring->getTimeNs(size_t(index));
+
+    //errors from the stream carry no data
+    if (ret < 0)
+    {
+        _ring->release(size_t(index));
+        index = -1;
+    }
+    return ret;
+}
+
+int StreamTapReader::read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    if (_current < 0)
+    {
+        const int ret = this->acquireSlot(_current, _currentFlags, _currentTimeNs, timeoutUs);
+        if (ret < 0)
+        {
+            flags = _currentFlags;
+            return ret;
+        }
+        _currentOffset = 0;
+    }
+
+    const size_t index = size_t(_current);
+    const size_t total = size_t(_ring->getRet(index));
+    const size_t elemSize = _ring->getElemSize();
+    const size_t n = std::min(numElems, total - _currentOffset);
+    for (size_t i = 0; i < _ring->getNumChans(); i++)
+    {
+        std::memcpy(buffs[i], _ring->getBuffer(index, i) + _currentOffset*elemSize, n*elemSize);
+    }
+
+    //a slot larger than the caller's buffers is returned in fragments
+    flags = _currentFlags;
+    timeNs = _currentTimeNs;
+    if (_currentOffset != 0) flags &= ~SOAPY_SDR_HAS_TIME;
+    _currentOffset += n;
+    if (_currentOffset < total) flags = (flags | SOAPY_SDR_MORE_FRAGMENTS) & ~SOAPY_SDR_END_BURST;
+    else
+    {
+        _ring->release(index);
+        _current = -1;
+    }
+    return int(n);
+}
+
+int StreamTapReader::acquire(size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    int index = -1;
+    const int ret = this->acquireSlot(index, flags, timeNs, timeoutUs);
+    if (ret < 0) return ret;
+
+    for (size_t i = 0; i < _ring->getNumChans(); i++)
+    {
+        buffs[i] = _ring->getBuffer(size_t(index), i);
+    }
+    handle = size_t(index);
+    _acquired.push_back(handle);
+    return ret;
+}
+
+void StreamTapReader::release(const size_t handle)
+{
+    //ignore unknown handles so that the slot references stay balanced
+    auto it = std::find(_acquired.begin(), _acquired.end(), handle);
+    if (it == _acquired.end()) return;
+    _acquired.erase(it);
+    _ring->release(handle);
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Device.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <vector>
+
+/*!
+ * StreamTapRing broadcasts the results of a receive stream to its taps.
+ * The stream thread is the only writer: each result is copied once
+ * into the next slot, and every tap reads the slots in place.
+ *
+ * A slot holds a reference count of the taps using it.
+ * The writer claims a slot only when no tap holds it,
+ * otherwise that result is skipped instead of waiting on the tap.
+ * Taps detect overwritten and skipped slots from the slot sequence
+ * and count them as dropped buffers.
+ */
+class StreamTapRing
+{
+public:
+    StreamTapRing(
+        const size_t numChans,
+        const size_t elemSize,
+        const size_t slotElems,
+        const size_t numSlots);
+
+    //! Publish the result of a read or acquire call, never blocks
+    void publish(const void * const *buffs, const int ret, const int flags, const long long timeNs);
+
+    //! Attach a tap, returns the sequence of the next slot to read
+    unsigned long long attach(void);
+
+    //! Detach a tap, publishing stops when there are no taps
+    void detach(void);
+
+    /*!
+     * Hold the next available slot at or after seq.
+     * \param [inout] seq the sequence to read, advanced past the slot
+     * \param [inout] drops incremented for every slot that was missed
+     * \param timeoutUs the maximum time to wait for a new slot
+     * \return the slot index or -1 on timeout
+     */
+    int acquire(unsigned long long &seq, unsigned long long &drops, const long timeoutUs);
+
+    //! Release a slot from acquire()
+    void release(const size_t index);
+
+    //! The number of channels in each slot
+    size_t getNumChans(void) const
+    {
+        return _numChans;
+    }
+
+    //! The size of an element in bytes
+    size_t getElemSize(void) const
+    {
+        return _elemSize;
+    }
+
+    //! The number of elements or the error code of a held slot
+    int getRet(const size_t index) const
+    {
+        return _slots[index].ret;
+    }
+
+    //! The stream flags of a held slot
+    int getFlags(const size_t index) const
+    {
+        return _slots[index].flags;
+    }
+
+    //! The timestamp of a held slot
+    long long getTimeNs(const size_t index) const
+    {
+        return _slots[index].timeNs;
+    }
+
+    //! The buffer of one channel of a held slot
+    const char *getBuffer(const size_t index, const size_t chan) const
+    {
+        return _slots[index].buffs[chan].data();
+    }
+
+private:
+    struct Slot
+    {
+        Slot(void);
+        std::atomic<int> refs; //taps holding the slot, -1 while it is written
+        unsigned long long seq;
+        int ret;
+        int flags;
+        long long timeNs;
+        std::vector<std::vector<char>> buffs;
+    };
+
+    void publishSlot(const void * const *buffs, const size_t offset, const int ret, const int flags, const long long timeNs);
+    bool hold(const size_t index, const unsigned long long seq);
+    bool wait(const unsigned long long seq, const std::chrono::steady_clock::time_point &exitTime);
+
+    const size_t _numChans;
+    const size_t _elemSize;
+    const size_t _slotElems;
+    std::vector<Slot> _slots;
+
+    std::atomic<size_t> _numTaps;
+    std::atomic<unsigned long long> _writeSeq;
+
+    //wakeup of taps which are blocked waiting for new slots
+    std::atomic<size_t> _numWaiters;
+    std::mutex _mutex;
+    std::condition_variable _cond;
+};
+
+/*!
+ * StreamTapReader is one tap on a receive stream.
+ * It reads the shared slots of the ring, in place for acquire()
+ * and by copying into the caller's buffers for read().
+ */
+class StreamTapReader
+{
+public:
+    StreamTapReader(const std::shared_ptr<StreamTapRing> &ring);
+
+    ~StreamTapReader(void);
+
+    //! Read with the semantics of readStream()
+    int read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+
+    //! Acquire with the semantics of acquireReadBuffer()
+    int acquire(size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs);
+
+    //! Release a slot from acquire()
+    void release(const size_t handle);
+
+    //! The number of slots which were dropped
+    unsigned long long getNumDrops(void) const
+    {
+        return _numDrops;
+    }
+
+private:
+    int acquireSlot(int &index, int &flags, long long &timeNs, const long timeoutUs);
+
+    std::shared_ptr<StreamTapRing> _ring;
+    unsigned long long _readSeq;
+    std::atomic<unsigned long long> _numDrops;
+
+    //a slot held back while an overflow is reported
+    int _pending;
+
+    //slots held by the caller through acquire()
+    std::vector<size_t> _acquired;
+
+    //the slot being returned by read() in fragments
+    int _current;
+    size_t _currentOffset;
+    int _currentFlags;
+    long long _currentTimeNs;
+};
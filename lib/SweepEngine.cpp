@@ -0,0 +1,161 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "SweepEngine.hpp"
+#include <SoapySDR/Errors.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <algorithm>
+#include <cstring> //memmove
+#include <stdexcept>
+
+SweepEngine::SweepEngine(
+    SoapySDR::Device &device,
+    const int direction,
+    const size_t channel,
+    const std::string &format,
+    const std::vector<double> &frequencies,
+    const size_t dwellElems,
+    const long long settleNs,
+    const SoapySDR::Kwargs &args):
+    _device(device),
+    _frequencies(frequencies),
+    _dwellElems(dwellElems),
+    _settleNs(std::max<long long>(settleNs, 0)),
+    _elemSize(SoapySDR::formatToSize(format)),
+    _sampleRate(device.getSampleRate(direction, channel)),
+    _timed(device.hasHardwareTime("CMD")),
+    _table(nullptr),
+    _stream(nullptr),
+    _index(0),
+    _segmentNs(0),
+    _settling(true)
+{
+    if (direction != SOAPY_SDR_RX) throw std::invalid_argument("setupSweep() requires the receive direction");
+    if (frequencies.empty() or dwellElems == 0) throw std::invalid_argument("setupSweep() requires frequencies and dwell elements");
+    if (_sampleRate <= 0.0) throw std::runtime_error("setupSweep() requires a sample rate");
+
+    _table = _device.prepareFrequencies(direction, channel, frequencies);
+    try
+    {
+        _stream = _device.setupStream(direction, format, std::vector<size_t>(1, channel), args);
+        if (_stream == nullptr) throw std::runtime_error("setupSweep() failed to setup a stream");
+        _device.applyHop(_table, 0);
+        const int ret = _device.activateStream(_stream);
+        if (ret != 0) throw std::runtime_error("setupSweep() failed to activate the stream: " + std::string(SoapySDR::errToStr(ret)));
+        if (_timed) _segmentNs = _device.getHardwareTime() + _settleNs;
+    }
+    catch (...)
+    {
+        if (_stream != nullptr) _device.closeStream(_stream);
+        _device.closeHopTable(_table);
+        throw;
+    }
+}
+
+SweepEngine::~SweepEngine(void)
+{
+    _device.deactivateStream(_stream);
+    _device.closeStream(_stream);
+    _device.closeHopTable(_table);
+}
+
+int SweepEngine::read(void *buff, int &flags, double &frequency, long long &timeNs, const long timeoutUs)
+{
+    char *out = reinterpret_cast<char *>(buff);
+    const bool hop = _frequencies.size() > 1;
+    const size_t next = (_index + 1) % _frequencies.size();
+    frequency = _frequencies[_index];
+    flags = 0;
+    timeNs = 0;
+
+    int ret = 0;
+    if (_timed)
+    {
+        //issue the next retune before reading, so that it overlaps the capture,
+        //a late retune does not change samples which were already received
+        const long long endNs = _segmentNs + SoapySDR::ticksToTimeNs(_dwellElems, _sampleRate);
+        const long long retuneNs = hop?std::max(endNs, _device.getHardwareTime()):endNs;
+        if (hop) _device.applyHop(_table, next, retuneNs);
+        ret = this->capture(out, flags, timeNs, timeoutUs);
+        if (ret < 0 and hop)
+        {
+            //tune back to retry the segment, after the retune which is already queued
+            const long long backNs = std::max(retuneNs, _device.getHardwareTime());
+            _device.applyHop(_table, _index, backNs);
+            _segmentNs = backNs + _settleNs;
+        }
+        else if (ret >= 0) _segmentNs = hop?(retuneNs + _settleNs):retuneNs;
+    }
+    else
+    {
+        //retune only after the capture, since the retune takes effect at once
+        if (_settling) ret = this->discard(out, timeoutUs);
+        if (ret == 0) ret = this->capture(out, flags, timeNs, timeoutUs);
+        if (ret >= 0 and hop) _device.applyHop(_table, next);
+        if (ret >= 0) _settling = hop;
+    }
+
+    //a failed segment is captured again on the next call
+    if (ret < 0) return ret;
+    _index = next;
+    if (_index == 0) flags |= SOAPY_SDR_END_BURST;
+    return ret;
+}
+
+int SweepEngine::capture(char *buff, int &flags, long long &timeNs, const long timeoutUs)
+{
+    size_t total = 0;
+    while (total < _dwellElems)
+    {
+        void *buffs[] = {buff + total*_elemSize};
+        int rxFlags(0);
+        long long rxTimeNs(0);
+        const int ret = _device.readStream(_stream, buffs, _dwellElems - total, rxFlags, rxTimeNs, timeoutUs);
+
+        //untimed segments restart after an overflow, timed segments check the timestamps
+        if (ret == SOAPY_SDR_OVERFLOW and (total == 0 or not _timed))
+        {
+            total = 0;
+            continue;
+        }
+        if (ret < 0) return ret;
+
+        //drop the samples before the start of a timed segment
+        const bool hasTime = (rxFlags & SOAPY_SDR_HAS_TIME) != 0;
+        const size_t n = size_t(ret);
+        size_t skip = 0;
+        if (total == 0 and _timed and hasTime)
+        {
+            const long long ticks = SoapySDR::timeNsToTicks(_segmentNs - rxTimeNs, _sampleRate);
+            if (ticks < 0) return SOAPY_SDR_OVERFLOW;
+            if (ticks >= (long long)n) continue;
+            skip = size_t(ticks);
+            std::memmove(buff, buff + skip*_elemSize, (n - skip)*_elemSize);
+        }
+
+        if (total == 0 and hasTime)
+        {
+            flags |= SOAPY_SDR_HAS_TIME;
+            timeNs = rxTimeNs + SoapySDR::ticksToTimeNs(skip, _sampleRate);
+        }
+        total += n - skip;
+    }
+    return int(total);
+}
+
+int SweepEngine::discard(char *buff, const long timeoutUs)
+{
+    size_t remaining = size_t(SoapySDR::timeNsToTicks(_settleNs, _sampleRate));
+    while (remaining != 0)
+    {
+        void *buffs[] = {buff};
+        int flags(0);
+        long long timeNs(0);
+        const int ret = _device.readStream(_stream, buffs, std::min(remaining, _dwellElems), flags, timeNs, timeoutUs);
+        if (ret == SOAPY_SDR_OVERFLOW) continue;
+        if (ret < 0) return ret;
+        remaining -= std::min(remaining, size_t(ret));
+    }
+    return 0;
+}
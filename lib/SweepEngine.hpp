@@ -0,0 +1,61 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Device.hpp>
+#include <vector>
+#include <string>
+
+/*!
+ * SweepEngine implements a frequency sweep with the public device API:
+ * a continuous receive stream and a hop table of the frequencies.
+ *
+ * When the device supports command times, hasHardwareTime("CMD"),
+ * the retune to the next frequency is issued as a timed hop at the end
+ * of the current segment before its samples are read, and the samples
+ * of a segment are selected by timestamp, starting one settle time after
+ * the retune. A segment whose start was lost to an overflow is reported
+ * as SOAPY_SDR_OVERFLOW. Otherwise, the retune is made after a segment
+ * is read, and one settle time of samples is discarded before the next.
+ * A segment which fails to read is captured again by the next call.
+ */
+class SweepEngine
+{
+public:
+    SweepEngine(
+        SoapySDR::Device &device,
+        const int direction,
+        const size_t channel,
+        const std::string &format,
+        const std::vector<double> &frequencies,
+        const size_t dwellElems,
+        const long long settleNs,
+        const SoapySDR::Kwargs &args);
+
+    ~SweepEngine(void);
+
+    //! Read the next segment, same semantics as Device::readSweep()
+    int read(void *buff, int &flags, double &frequency, long long &timeNs, const long timeoutUs);
+
+private:
+    //fill the buffer with one segment, starting at _segmentNs when timed
+    int capture(char *buff, int &flags, long long &timeNs, const long timeoutUs);
+
+    //read and drop the settle samples of an untimed sweep
+    int discard(char *buff, const long timeoutUs);
+
+    SoapySDR::Device &_device;
+    const std::vector<double> _frequencies;
+    const size_t _dwellElems;
+    const long long _settleNs;
+    size_t _elemSize;
+    double _sampleRate;
+    bool _timed;
+
+    SoapySDR::HopTable *_table;
+    SoapySDR::Stream *_stream;
+
+    size_t _index; //the index of the next segment
+    long long _segmentNs; //the start time of the next segment when timed
+    bool _settling; //the next untimed segment follows a retune
+};
@@ -0,0 +1,334 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/TimeTracker.hpp>
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <SoapySDR/Constants.h>
+#include <condition_variable>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+#include <thread>
+#include <iterator>
+#include <vector>
+#include <deque>
+#include <cmath>
+#include <mutex>
+
+const size_t SoapySDR::TimeTracker::MAX_POINTS;
+const long long SoapySDR::TimeTracker::JUMP_THRESHOLD_NS;
+const long long SoapySDR::TimeTracker::STREAM_LATENCY_NS;
+
+//the assumed drift bound of a model with a single timestamp
+static const double SINGLE_POINT_DRIFT = 100e-6;
+
+SoapySDR::TimeEstimate::TimeEstimate(void):
+    valid(false),
+    timeNs(0),
+    errorNs(0),
+    driftPpm(0.0)
+{
+    return;
+}
+
+/*******************************************************************
+ * Implementation details
+ ******************************************************************/
+struct TimePoint
+{
+    long long hostNs;
+    long long hardwareNs;
+    long long uncertaintyNs;
+};
+
+/*!
+ * An error bound which grows linearly with the time since the last point.
+ */
+struct ErrorBound
+{
+    double base;
+    double rate;
+};
+
+/*!
+ * A line fit to the timestamps relative to the first one.
+ * The hardware time at host time t is
+ * hardwareRef + centerY + slope*(t - hostRef - centerX),
+ * within the smallest of the error bounds.
+ */
+struct TimeModel
+{
+    TimeModel(void):
+        valid(false),
+        hostRef(0),
+        hardwareRef(0),
+        centerX(0.0),
+        centerY(0.0),
+        slope(1.0),
+        lastHostNs(0)
+    {
+        return;
+    }
+
+    bool valid;
+    long long hostRef;
+    long long hardwareRef;
+    double centerX;
+    double centerY;
+    double slope;
+    long long lastHostNs;
+    std::vector<ErrorBound> bounds;
+};
+
+class SoapySDR::TimeTracker::Impl
+{
+public:
+    Impl(SoapySDR::Device *device, const std::string &what):
+        device(device),
+        what(what),
+        done(true)
+    {
+        return;
+    }
+
+    void add(const long long hardwareTimeNs, const long long hostTimeNs, const long long uncertaintyNs);
+    void sample(void);
+    void fit(void);
+    TimeEstimate estimate(const long long hostTimeNs) const;
+    void loop(const std::chrono::nanoseconds interval);
+
+    SoapySDR::Device *device;
+    const std::string what;
+
+    //the timestamps and the model, guarded by the model mutex
+    mutable std::mutex modelMutex;
+    std::deque<TimePoint> points;
+    TimeModel model;
+
+    //the background sampling thread
+    std::mutex mutex;
+    std::condition_variable cond;
+    bool done;
+    std::thread thread;
+};
+
+void SoapySDR::TimeTracker::Impl::add(const long long hardwareTimeNs, const long long hostTimeNs, const long long uncertaintyNs)
+{
+    std::lock_guard<std::mutex> lock(modelMutex);
+
+    //restart the model when the hardware time jumps
+    const auto predicted = this->estimate(hostTimeNs);
+    if (predicted.valid and std::llabs(hardwareTimeNs - predicted.timeNs) > predicted.errorNs + uncertaintyNs + JUMP_THRESHOLD_NS)
+    {
+        points.clear();
+    }
+
+    //keep the points in host time order for the window ends
+    TimePoint point{hostTimeNs, hardwareTimeNs, std::max(0LL, uncertaintyNs)};
+    auto it = points.end();
+    while (it != points.begin() and std::prev(it)->hostNs > hostTimeNs) --it;
+    points.insert(it, point);
+    while (points.size() > MAX_POINTS) points.pop_front();
+    this->fit();
+}
+
+void SoapySDR::TimeTracker::Impl::sample(void)
+{
+    const auto host0 = TimeTracker::getHostTimeNs();
+    const auto hardwareTimeNs = device->getHardwareTime(what);
+    const auto host1 = TimeTracker::getHostTimeNs();
+    this->add(hardwareTimeNs, host0 + (host1-host0)/2, (host1-host0)/2);
+}
+
+void SoapySDR::TimeTracker::Impl::fit(void)
+{
+    TimeModel m;
+    m.valid = not points.empty();
+    if (not m.valid)
+    {
+        model = m;
+        return;
+    }
+
+    m.hostRef = points.front().hostNs;
+    m.hardwareRef = points.front().hardwareNs;
+    m.lastHostNs = points.back().hostNs;
+
+    //least squares about the centroid weighted by the uncertainty,
+    //so that a slow read of the hardware time does not skew the line,
+    //and a single point keeps the unit slope
+    double sw(0.0);
+    for (const auto &p : points)
+    {
+        const double w = 1.0/((1.0 + p.uncertaintyNs)*(1.0 + p.uncertaintyNs));
+        sw += w;
+        m.centerX += w*(p.hostNs - m.hostRef);
+        m.centerY += w*(p.hardwareNs - m.hardwareRef);
+    }
+    m.centerX /= sw;
+    m.centerY /= sw;
+    double sxx(0.0), sxy(0.0);
+    for (const auto &p : points)
+    {
+        const double w = 1.0/((1.0 + p.uncertaintyNs)*(1.0 + p.uncertaintyNs));
+        const double dx = (p.hostNs - m.hostRef) - m.centerX;
+        const double dy = (p.hardwareNs - m.hardwareRef) - m.centerY;
+        sxx += w*dx*dx;
+        sxy += w*dx*dy;
+    }
+    if (sxx > 0.0) m.slope = sxy/sxx;
+
+    //the fit is off from the true line by at most the residual plus
+    //the uncertainty at each point, and the difference of two lines
+    //is bounded past a pair of points by extending between the pair
+    std::vector<double> errors;
+    for (const auto &p : points)
+    {
+        const double dx = (p.hostNs - m.hostRef) - m.centerX;
+        const double dy = (p.hardwareNs - m.hardwareRef) - m.centerY;
+        errors.push_back(std::abs(dy - m.slope*dx) + p.uncertaintyNs);
+    }
+    for (size_t j = 1; j < points.size(); j++)
+    {
+        for (size_t i = 0; i < j; i++)
+        {
+            const long long span = points[j].hostNs - points[i].hostNs;
+            if (span <= 0) continue;
+            ErrorBound bound;
+            bound.rate = (errors[i] + errors[j])/span;
+            bound.base = std::max(errors[i], errors[j] + bound.rate*(m.lastHostNs - points[j].hostNs));
+            m.bounds.push_back(bound);
+        }
+    }
+    if (m.bounds.empty())
+    {
+        ErrorBound bound;
+        bound.base = *std::min_element(errors.begin(), errors.end());
+        bound.rate = SINGLE_POINT_DRIFT;
+        m.bounds.push_back(bound);
+    }
+
+    //keep only the bounds which are the smallest at some time
+    std::sort(m.bounds.begin(), m.bounds.end(), [](const ErrorBound &a, const ErrorBound &b)
+    {
+        return (a.base == b.base)?(a.rate < b.rate):(a.base < b.base);
+    });
+    size_t numBounds(0);
+    for (const auto &bound : m.bounds)
+    {
+        if (numBounds == 0 or bound.rate < m.bounds[numBounds-1].rate) m.bounds[numBounds++] = bound;
+    }
+    m.bounds.resize(numBounds);
+    model = std::move(m);
+}
+
+SoapySDR::TimeEstimate SoapySDR::TimeTracker::Impl::estimate(const long long hostTimeNs) const
+{
+    TimeEstimate e;
+    if (not model.valid) return e;
+    const double dx = (hostTimeNs - model.hostRef) - model.centerX;
+    const long long age = std::max(0LL, hostTimeNs - model.lastHostNs);
+    e.valid = true;
+    e.timeNs = model.hardwareRef + std::llround(model.centerY + model.slope*dx);
+    double error = model.bounds.front().base + model.bounds.front().rate*age;
+    for (const auto &bound : model.bounds) error = std::min(error, bound.base + bound.rate*age);
+    e.errorNs = std::llround(std::ceil(error)) + 1;
+    e.driftPpm = (model.slope - 1.0)*1e6;
+    return e;
+}
+
+void SoapySDR::TimeTracker::Impl::loop(const std::chrono::nanoseconds interval)
+{
+    bool failed(false);
+    std::unique_lock<std::mutex> lock(mutex);
+    while (not done)
+    {
+        lock.unlock();
+        try
+        {
+            this->sample();
+        }
+        catch (const std::exception &ex)
+        {
+            if (not failed) SoapySDR::logf(SOAPY_SDR_WARNING, "TimeTracker failed to read the hardware time: %s", ex.what());
+            failed = true;
+        }
+        lock.lock();
+        cond.wait_for(lock, interval, [this]{return done;});
+    }
+}
+
+/*******************************************************************
+ * Time tracker
+ ******************************************************************/
+SoapySDR::TimeTracker::TimeTracker(Device *device, const std::string &what):
+    _impl(new Impl(device, what))
+{
+    return;
+}
+
+SoapySDR::TimeTracker::~TimeTracker(void)
+{
+    this->stop();
+}
+
+long long SoapySDR::TimeTracker::getHostTimeNs(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SoapySDR::TimeTracker::sample(void)
+{
+    _impl->sample();
+}
+
+void SoapySDR::TimeTracker::addTimestamp(const long long hardwareTimeNs, const long long hostTimeNs, const long long uncertaintyNs)
+{
+    _impl->add(hardwareTimeNs, hostTimeNs, uncertaintyNs);
+}
+
+void SoapySDR::TimeTracker::addStreamTime(const int flags, const long long timeNs, const size_t numElems, const double rate, const long long latencyNs)
+{
+    if ((flags & SOAPY_SDR_HAS_TIME) == 0 or rate <= 0.0) return;
+    const long long durationNs = std::llround(numElems*1e9/rate);
+    this->addTimestamp(timeNs + durationNs, getHostTimeNs(), durationNs + std::max(0LL, latencyNs));
+}
+
+void SoapySDR::TimeTracker::reset(void)
+{
+    std::lock_guard<std::mutex> lock(_impl->modelMutex);
+    _impl->points.clear();
+    _impl->fit();
+}
+
+void SoapySDR::TimeTracker::start(const long long intervalNs)
+{
+    if (_impl->thread.joinable()) return;
+    if (intervalNs <= 0) throw std::invalid_argument("TimeTracker::start() interval must be positive");
+    _impl->done = false;
+    _impl->thread = std::thread(&Impl::loop, _impl.get(), std::chrono::nanoseconds(intervalNs));
+}
+
+void SoapySDR::TimeTracker::stop(void)
+{
+    if (not _impl->thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        _impl->done = true;
+    }
+    _impl->cond.notify_one();
+    _impl->thread.join();
+}
+
+SoapySDR::TimeEstimate SoapySDR::TimeTracker::estimateHardwareTime(void) const
+{
+    return this->estimateHardwareTime(getHostTimeNs());
+}
+
+SoapySDR::TimeEstimate SoapySDR::TimeTracker::estimateHardwareTime(const long long hostTimeNs) const
+{
+    std::lock_guard<std::mutex> lock(_impl->modelMutex);
+    return _impl->estimate(hostTimeNs);
+}
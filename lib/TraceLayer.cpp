@@ -0,0 +1,1113 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TraceLayer.hpp"
+
+//time the enclosing call and record it under the method name
+#define TRACE_CALL(name) \
+    static const size_t traceIndex = CallTracer::methodIndex(name); \
+    const TraceScope traceScope(*_tracer, traceIndex, name)
+
+/*******************************************************************
+ * Trace layer
+ ******************************************************************/
+TraceLayer::TraceLayer(SoapySDR::Device *device, const SoapySDR::Kwargs &args):
+    DeviceDecorator(device)
+{
+    const auto it = args.find("trace_file");
+    try
+    {
+        _tracer.reset(new CallTracer((it == args.end())?"":it->second));
+    }
+    catch (...)
+    {
+        _device = nullptr; //the caller still owns the device when construction fails
+        throw;
+    }
+}
+
+/*******************************************************************
+ * Identification API
+ ******************************************************************/
+std::string TraceLayer::getDriverKey(void) const
+{
+    TRACE_CALL("getDriverKey");
+    return _device->getDriverKey();
+}
+
+std::string TraceLayer::getHardwareKey(void) const
+{
+    TRACE_CALL("getHardwareKey");
+    return _device->getHardwareKey();
+}
+
+SoapySDR::Kwargs TraceLayer::getHardwareInfo(void) const
+{
+    TRACE_CALL("getHardwareInfo");
+    return _device->getHardwareInfo();
+}
+
+/*******************************************************************
+ * Channels API
+ ******************************************************************/
+void TraceLayer::setFrontendMapping(const int direction, const std::string &mapping)
+{
+    TRACE_CALL("setFrontendMapping");
+    _device->setFrontendMapping(direction, mapping);
+}
+
+std::string TraceLayer::getFrontendMapping(const int direction) const
+{
+    TRACE_CALL("getFrontendMapping");
+    return _device->getFrontendMapping(direction);
+}
+
+size_t TraceLayer::getNumChannels(const int direction) const
+{
+    TRACE_CALL("getNumChannels");
+    return _device->getNumChannels(direction);
+}
+
+SoapySDR::Kwargs TraceLayer::getChannelInfo(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getChannelInfo");
+    return _device->getChannelInfo(direction, channel);
+}
+
+bool TraceLayer::getFullDuplex(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getFullDuplex");
+    return _device->getFullDuplex(direction, channel);
+}
+
+/*******************************************************************
+ * Stream API
+ ******************************************************************/
+std::vector<std::string> TraceLayer::getStreamFormats(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getStreamFormats");
+    return _device->getStreamFormats(direction, channel);
+}
+
+std::string TraceLayer::getNativeStreamFormat(const int direction, const size_t channel, double &fullScale) const
+{
+    TRACE_CALL("getNativeStreamFormat");
+    return _device->getNativeStreamFormat(direction, channel, fullScale);
+}
+
+SoapySDR::ArgInfoList TraceLayer::getStreamArgsInfo(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getStreamArgsInfo");
+    return _device->getStreamArgsInfo(direction, channel);
+}
+
+SoapySDR::Stream *TraceLayer::setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args)
+{
+    TRACE_CALL("setupStream");
+    return _device->setupStream(direction, format, channels, args);
+}
+
+void TraceLayer::closeStream(SoapySDR::Stream *stream)
+{
+    TRACE_CALL("closeStream");
+    _device->closeStream(stream);
+}
+
+size_t TraceLayer::getStreamMTU(SoapySDR::Stream *stream) const
+{
+    TRACE_CALL("getStreamMTU");
+    return _device->getStreamMTU(stream);
+}
+
+int TraceLayer::activateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs, const size_t numElems)
+{
+    TRACE_CALL("activateStream");
+    return _device->activateStream(stream, flags, timeNs, numElems);
+}
+
+int TraceLayer::deactivateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs)
+{
+    TRACE_CALL("deactivateStream");
+    return _device->deactivateStream(stream, flags, timeNs);
+}
+
+int TraceLayer::readStream(SoapySDR::Stream *stream, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    TRACE_CALL("readStream");
+    return _device->readStream(stream, buffs, numElems, flags, timeNs, timeoutUs);
+}
+
+int TraceLayer::writeStream(SoapySDR::Stream *stream, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+    TRACE_CALL("writeStream");
+    return _device->writeStream(stream, buffs, numElems, flags, timeNs, timeoutUs);
+}
+
+int TraceLayer::readStreamStatus(SoapySDR::Stream *stream, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+{
+    TRACE_CALL("readStreamStatus");
+    return _device->readStreamStatus(stream, chanMask, flags, timeNs, timeoutUs);
+}
+
+int TraceLayer::captureSamples(const int direction, const std::vector<size_t> &channels, const std::string &format, const long long timeNs, const size_t numElems, void * const *buffs, const long timeoutUs)
+{
+    TRACE_CALL("captureSamples");
+    return _device->captureSamples(direction, channels, format, timeNs, numElems, buffs, timeoutUs);
+}
+
+SoapySDR::StreamStats TraceLayer::getStreamStats(SoapySDR::Stream *stream) const
+{
+    TRACE_CALL("getStreamStats");
+    return _device->getStreamStats(stream);
+}
+
+/*******************************************************************
+ * Direct buffer access API
+ ******************************************************************/
+size_t TraceLayer::getNumDirectAccessBuffers(SoapySDR::Stream *stream)
+{
+    TRACE_CALL("getNumDirectAccessBuffers");
+    return _device->getNumDirectAccessBuffers(stream);
+}
+
+int TraceLayer::getDirectAccessBufferAddrs(SoapySDR::Stream *stream, const size_t handle, void **buffs)
+{
+    TRACE_CALL("getDirectAccessBufferAddrs");
+    return _device->getDirectAccessBufferAddrs(stream, handle, buffs);
+}
+
+int TraceLayer::acquireReadBuffer(SoapySDR::Stream *stream, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    TRACE_CALL("acquireReadBuffer");
+    return _device->acquireReadBuffer(stream, handle, buffs, flags, timeNs, timeoutUs);
+}
+
+void TraceLayer::releaseReadBuffer(SoapySDR::Stream *stream, const size_t handle)
+{
+    TRACE_CALL("releaseReadBuffer");
+    _device->releaseReadBuffer(stream, handle);
+}
+
+int TraceLayer::acquireWriteBuffer(SoapySDR::Stream *stream, size_t &handle, void **buffs, const long timeoutUs)
+{
+    TRACE_CALL("acquireWriteBuffer");
+    return _device->acquireWriteBuffer(stream, handle, buffs, timeoutUs);
+}
+
+void TraceLayer::releaseWriteBuffer(SoapySDR::Stream *stream, const size_t handle, const size_t numElems, int &flags, const long long timeNs)
+{
+    TRACE_CALL("releaseWriteBuffer");
+    _device->releaseWriteBuffer(stream, handle, numElems, flags, timeNs);
+}
+
+/*******************************************************************
+ * Stream tap API
+ ******************************************************************/
+SoapySDR::StreamTap *TraceLayer::setupStreamTap(SoapySDR::Stream *stream, const SoapySDR::Kwargs &args)
+{
+    TRACE_CALL("setupStreamTap");
+    return _device->setupStreamTap(stream, args);
+}
+
+void TraceLayer::closeStreamTap(SoapySDR::StreamTap *tap)
+{
+    TRACE_CALL("closeStreamTap");
+    _device->closeStreamTap(tap);
+}
+
+int TraceLayer::readStreamTap(SoapySDR::StreamTap *tap, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    TRACE_CALL("readStreamTap");
+    return _device->readStreamTap(tap, buffs, numElems, flags, timeNs, timeoutUs);
+}
+
+int TraceLayer::acquireTapBuffer(SoapySDR::StreamTap *tap, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    TRACE_CALL("acquireTapBuffer");
+    return _device->acquireTapBuffer(tap, handle, buffs, flags, timeNs, timeoutUs);
+}
+
+void TraceLayer::releaseTapBuffer(SoapySDR::StreamTap *tap, const size_t handle)
+{
+    TRACE_CALL("releaseTapBuffer");
+    _device->releaseTapBuffer(tap, handle);
+}
+
+unsigned long long TraceLayer::getStreamTapDrops(SoapySDR::StreamTap *tap) const
+{
+    TRACE_CALL("getStreamTapDrops");
+    return _device->getStreamTapDrops(tap);
+}
+
+/*******************************************************************
+ * Sweep API
+ ******************************************************************/
+SoapySDR::Sweep *TraceLayer::setupSweep(const int direction, const size_t channel, const std::string &format, const std::vector<double> &frequencies, const size_t dwellElems, const long long settleNs, const SoapySDR::Kwargs &args)
+{
+    TRACE_CALL("setupSweep");
+    return _device->setupSweep(direction, channel, format, frequencies, dwellElems, settleNs, args);
+}
+
+void TraceLayer::closeSweep(SoapySDR::Sweep *sweep)
+{
+    TRACE_CALL("closeSweep");
+    _device->closeSweep(sweep);
+}
+
+int TraceLayer::readSweep(SoapySDR::Sweep *sweep, void *buff, int &flags, double &frequency, long long &timeNs, const long timeoutUs)
+{
+    TRACE_CALL("readSweep");
+    return _device->readSweep(sweep, buff, flags, frequency, timeNs, timeoutUs);
+}
+
+/*******************************************************************
+ * Antenna API
+ ******************************************************************/
+std::vector<std::string> TraceLayer::listAntennas(const int direction, const size_t channel) const
+{
+    TRACE_CALL("listAntennas");
+    return _device->listAntennas(direction, channel);
+}
+
+void TraceLayer::setAntenna(const int direction, const size_t channel, const std::string &name)
+{
+    TRACE_CALL("setAntenna");
+    _device->setAntenna(direction, channel, name);
+}
+
+std::string TraceLayer::getAntenna(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getAntenna");
+    return _device->getAntenna(direction, channel);
+}
+
+/*******************************************************************
+ * Frontend corrections API
+ ******************************************************************/
+bool TraceLayer::hasDCOffsetMode(const int direction, const size_t channel) const
+{
+    TRACE_CALL("hasDCOffsetMode");
+    return _device->hasDCOffsetMode(direction, channel);
+}
+
+void TraceLayer::setDCOffsetMode(const int direction, const size_t channel, const bool automatic)
+{
+    TRACE_CALL("setDCOffsetMode");
+    _device->setDCOffsetMode(direction, channel, automatic);
+}
+
+bool TraceLayer::getDCOffsetMode(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getDCOffsetMode");
+    return _device->getDCOffsetMode(direction, channel);
+}
+
+bool TraceLayer::hasDCOffset(const int direction, const size_t channel) const
+{
+    TRACE_CALL("hasDCOffset");
+    return _device->hasDCOffset(direction, channel);
+}
+
+void TraceLayer::setDCOffset(const int direction, const size_t channel, const std::complex<double> &offset)
+{
+    TRACE_CALL("setDCOffset");
+    _device->setDCOffset(direction, channel, offset);
+}
+
+std::complex<double> TraceLayer::getDCOffset(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getDCOffset");
+    return _device->getDCOffset(direction, channel);
+}
+
+bool TraceLayer::hasIQBalance(const int direction, const size_t channel) const
+{
+    TRACE_CALL("hasIQBalance");
+    return _device->hasIQBalance(direction, channel);
+}
+
+void TraceLayer::setIQBalance(const int direction, const size_t channel, const std::complex<double> &balance)
+{
+    TRACE_CALL("setIQBalance");
+    _device->setIQBalance(direction, channel, balance);
+}
+
+std::complex<double> TraceLayer::getIQBalance(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getIQBalance");
+    return _device->getIQBalance(direction, channel);
+}
+
+bool TraceLayer::hasIQBalanceMode(const int direction, const size_t channel) const
+{
+    TRACE_CALL("hasIQBalanceMode");
+    return _device->hasIQBalanceMode(direction, channel);
+}
+
+void TraceLayer::setIQBalanceMode(const int direction, const size_t channel, const bool automatic)
+{
+    TRACE_CALL("setIQBalanceMode");
+    _device->setIQBalanceMode(direction, channel, automatic);
+}
+
+bool TraceLayer::getIQBalanceMode(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getIQBalanceMode");
+    return _device->getIQBalanceMode(direction, channel);
+}
+
+bool TraceLayer::hasFrequencyCorrection(const int direction, const size_t channel) const
+{
+    TRACE_CALL("hasFrequencyCorrection");
+    return _device->hasFrequencyCorrection(direction, channel);
+}
+
+void TraceLayer::setFrequencyCorrection(const int direction, const size_t channel, const double value)
+{
+    TRACE_CALL("setFrequencyCorrection");
+    _device->setFrequencyCorrection(direction, channel, value);
+}
+
+double TraceLayer::getFrequencyCorrection(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getFrequencyCorrection");
+    return _device->getFrequencyCorrection(direction, channel);
+}
+
+/*******************************************************************
+ * Gain API
+ ******************************************************************/
+std::vector<std::string> TraceLayer::listGains(const int direction, const size_t channel) const
+{
+    TRACE_CALL("listGains");
+    return _device->listGains(direction, channel);
+}
+
+bool TraceLayer::hasGainMode(const int direction, const size_t channel) const
+{
+    TRACE_CALL("hasGainMode");
+    return _device->hasGainMode(direction, channel);
+}
+
+void TraceLayer::setGainMode(const int direction, const size_t channel, const bool automatic)
+{
+    TRACE_CALL("setGainMode");
+    _device->setGainMode(direction, channel, automatic);
+}
+
+bool TraceLayer::getGainMode(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getGainMode");
+    return _device->getGainMode(direction, channel);
+}
+
+void TraceLayer::setGain(const int direction, const size_t channel, const double value)
+{
+    TRACE_CALL("setGain");
+    _device->setGain(direction, channel, value);
+}
+
+void TraceLayer::setGain(const int direction, const size_t channel, const std::string &name, const double value)
+{
+    TRACE_CALL("setGain");
+    _device->setGain(direction, channel, name, value);
+}
+
+double TraceLayer::getGain(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getGain");
+    return _device->getGain(direction, channel);
+}
+
+double TraceLayer::getGain(const int direction, const size_t channel, const std::string &name) const
+{
+    TRACE_CALL("getGain");
+    return _device->getGain(direction, channel, name);
+}
+
+SoapySDR::Range TraceLayer::getGainRange(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getGainRange");
+    return _device->getGainRange(direction, channel);
+}
+
+SoapySDR::Range TraceLayer::getGainRange(const int direction, const size_t channel, const std::string &name) const
+{
+    TRACE_CALL("getGainRange");
+    return _device->getGainRange(direction, channel, name);
+}
+
+SoapySDR::GainTable TraceLayer::getGainTable(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getGainTable");
+    return _device->getGainTable(direction, channel);
+}
+
+/*******************************************************************
+ * Frequency API
+ ******************************************************************/
+void TraceLayer::setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args)
+{
+    TRACE_CALL("setFrequency");
+    _device->setFrequency(direction, channel, frequency, args);
+}
+
+void TraceLayer::setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args)
+{
+    TRACE_CALL("setFrequency");
+    _device->setFrequency(direction, channel, name, frequency, args);
+}
+
+double TraceLayer::getFrequency(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getFrequency");
+    return _device->getFrequency(direction, channel);
+}
+
+double TraceLayer::getFrequency(const int direction, const size_t channel, const std::string &name) const
+{
+    TRACE_CALL("getFrequency");
+    return _device->getFrequency(direction, channel, name);
+}
+
+std::vector<std::string> TraceLayer::listFrequencies(const int direction, const size_t channel) const
+{
+    TRACE_CALL("listFrequencies");
+    return _device->listFrequencies(direction, channel);
+}
+
+SoapySDR::RangeList TraceLayer::getFrequencyRange(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getFrequencyRange");
+    return _device->getFrequencyRange(direction, channel);
+}
+
+SoapySDR::RangeList TraceLayer::getFrequencyRange(const int direction, const size_t channel, const std::string &name) const
+{
+    TRACE_CALL("getFrequencyRange");
+    return _device->getFrequencyRange(direction, channel, name);
+}
+
+SoapySDR::ArgInfoList TraceLayer::getFrequencyArgsInfo(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getFrequencyArgsInfo");
+    return _device->getFrequencyArgsInfo(direction, channel);
+}
+
+/*******************************************************************
+ * Frequency hopping API
+ ******************************************************************/
+SoapySDR::HopTable *TraceLayer::prepareFrequencies(const int direction, const size_t channel, const std::vector<double> &frequencies, const SoapySDR::Kwargs &args)
+{
+    TRACE_CALL("prepareFrequencies");
+    return _device->prepareFrequencies(direction, channel, frequencies, args);
+}
+
+void TraceLayer::applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs)
+{
+    TRACE_CALL("applyHop");
+    _device->applyHop(table, index, timeNs);
+}
+
+void TraceLayer::closeHopTable(SoapySDR::HopTable *table)
+{
+    TRACE_CALL("closeHopTable");
+    _device->closeHopTable(table);
+}
+
+/*******************************************************************
+ * Sample Rate API
+ ******************************************************************/
+void TraceLayer::setSampleRate(const int direction, const size_t channel, const double rate)
+{
+    TRACE_CALL("setSampleRate");
+    _device->setSampleRate(direction, channel, rate);
+}
+
+double TraceLayer::getSampleRate(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getSampleRate");
+    return _device->getSampleRate(direction, channel);
+}
+
+std::vector<double> TraceLayer::listSampleRates(const int direction, const size_t channel) const
+{
+    TRACE_CALL("listSampleRates");
+    return _device->listSampleRates(direction, channel);
+}
+
+SoapySDR::RangeList TraceLayer::getSampleRateRange(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getSampleRateRange");
+    return _device->getSampleRateRange(direction, channel);
+}
+
+/*******************************************************************
+ * Bandwidth API
+ ******************************************************************/
+void TraceLayer::setBandwidth(const int direction, const size_t channel, const double bw)
+{
+    TRACE_CALL("setBandwidth");
+    _device->setBandwidth(direction, channel, bw);
+}
+
+double TraceLayer::getBandwidth(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getBandwidth");
+    return _device->getBandwidth(direction, channel);
+}
+
+std::vector<double> TraceLayer::listBandwidths(const int direction, const size_t channel) const
+{
+    TRACE_CALL("listBandwidths");
+    return _device->listBandwidths(direction, channel);
+}
+
+SoapySDR::RangeList TraceLayer::getBandwidthRange(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getBandwidthRange");
+    return _device->getBandwidthRange(direction, channel);
+}
+
+/*******************************************************************
+ * Clocking API
+ ******************************************************************/
+void TraceLayer::setMasterClockRate(const double rate)
+{
+    TRACE_CALL("setMasterClockRate");
+    _device->setMasterClockRate(rate);
+}
+
+double TraceLayer::getMasterClockRate(void) const
+{
+    TRACE_CALL("getMasterClockRate");
+    return _device->getMasterClockRate();
+}
+
+SoapySDR::RangeList TraceLayer::getMasterClockRates(void) const
+{
+    TRACE_CALL("getMasterClockRates");
+    return _device->getMasterClockRates();
+}
+
+void TraceLayer::setReferenceClockRate(const double rate)
+{
+    TRACE_CALL("setReferenceClockRate");
+    _device->setReferenceClockRate(rate);
+}
+
+double TraceLayer::getReferenceClockRate(void) const
+{
+    TRACE_CALL("getReferenceClockRate");
+    return _device->getReferenceClockRate();
+}
+
+SoapySDR::RangeList TraceLayer::getReferenceClockRates(void) const
+{
+    TRACE_CALL("getReferenceClockRates");
+    return _device->getReferenceClockRates();
+}
+
+std::vector<std::string> TraceLayer::listClockSources(void) const
+{
+    TRACE_CALL("listClockSources");
+    return _device->listClockSources();
+}
+
+void TraceLayer::setClockSource(const std::string &source)
+{
+    TRACE_CALL("setClockSource");
+    _device->setClockSource(source);
+}
+
+std::string TraceLayer::getClockSource(void) const
+{
+    TRACE_CALL("getClockSource");
+    return _device->getClockSource();
+}
+
+/*******************************************************************
+ * Time API
+ ******************************************************************/
+std::vector<std::string> TraceLayer::listTimeSources(void) const
+{
+    TRACE_CALL("listTimeSources");
+    return _device->listTimeSources();
+}
+
+void TraceLayer::setTimeSource(const std::string &source)
+{
+    TRACE_CALL("setTimeSource");
+    _device->setTimeSource(source);
+}
+
+std::string TraceLayer::getTimeSource(void) const
+{
+    TRACE_CALL("getTimeSource");
+    return _device->getTimeSource();
+}
+
+bool TraceLayer::hasHardwareTime(const std::string &what) const
+{
+    TRACE_CALL("hasHardwareTime");
+    return _device->hasHardwareTime(what);
+}
+
+long long TraceLayer::getHardwareTime(const std::string &what) const
+{
+    TRACE_CALL("getHardwareTime");
+    return _device->getHardwareTime(what);
+}
+
+void TraceLayer::setHardwareTime(const long long timeNs, const std::string &what)
+{
+    TRACE_CALL("setHardwareTime");
+    _device->setHardwareTime(timeNs, what);
+}
+
+void TraceLayer::setCommandTime(const long long timeNs, const std::string &what)
+{
+    TRACE_CALL("setCommandTime");
+    _device->setCommandTime(timeNs, what);
+}
+
+/*******************************************************************
+ * Configuration transaction API
+ ******************************************************************/
+void TraceLayer::beginConfig(void)
+{
+    TRACE_CALL("beginConfig");
+    _device->beginConfig();
+}
+
+void TraceLayer::commitConfig(const long long timeNs)
+{
+    TRACE_CALL("commitConfig");
+    _device->commitConfig(timeNs);
+}
+
+void TraceLayer::cancelConfig(void)
+{
+    TRACE_CALL("cancelConfig");
+    _device->cancelConfig();
+}
+
+/*******************************************************************
+ * Timed command API
+ ******************************************************************/
+size_t TraceLayer::queueCommands(const SoapySDR::TimedCommandList &commands)
+{
+    TRACE_CALL("queueCommands");
+    return _device->queueCommands(commands);
+}
+
+void TraceLayer::clearCommands(void)
+{
+    TRACE_CALL("clearCommands");
+    _device->clearCommands();
+}
+
+SoapySDR::CommandQueueStats TraceLayer::getCommandQueueStats(void) const
+{
+    TRACE_CALL("getCommandQueueStats");
+    return _device->getCommandQueueStats();
+}
+
+/*******************************************************************
+ * Sensor API
+ ******************************************************************/
+std::vector<std::string> TraceLayer::listSensors(void) const
+{
+    TRACE_CALL("listSensors");
+    return _device->listSensors();
+}
+
+SoapySDR::ArgInfo TraceLayer::getSensorInfo(const std::string &key) const
+{
+    TRACE_CALL("getSensorInfo");
+    return _device->getSensorInfo(key);
+}
+
+std::string TraceLayer::readSensor(const std::string &key) const
+{
+    TRACE_CALL("readSensor");
+    return _device->readSensor(key);
+}
+
+bool TraceLayer::readSensorBool(const std::string &key) const
+{
+    TRACE_CALL("readSensorBool");
+    return _device->readSensorBool(key);
+}
+
+long long TraceLayer::readSensorInt(const std::string &key) const
+{
+    TRACE_CALL("readSensorInt");
+    return _device->readSensorInt(key);
+}
+
+double TraceLayer::readSensorFloat(const std::string &key) const
+{
+    TRACE_CALL("readSensorFloat");
+    return _device->readSensorFloat(key);
+}
+
+std::vector<std::string> TraceLayer::listSensors(const int direction, const size_t channel) const
+{
+    TRACE_CALL("listSensors");
+    return _device->listSensors(direction, channel);
+}
+
+SoapySDR::ArgInfo TraceLayer::getSensorInfo(const int direction, const size_t channel, const std::string &key) const
+{
+    TRACE_CALL("getSensorInfo");
+    return _device->getSensorInfo(direction, channel, key);
+}
+
+std::string TraceLayer::readSensor(const int direction, const size_t channel, const std::string &key) const
+{
+    TRACE_CALL("readSensor");
+    return _device->readSensor(direction, channel, key);
+}
+
+bool TraceLayer::readSensorBool(const int direction, const size_t channel, const std::string &key) const
+{
+    TRACE_CALL("readSensorBool");
+    return _device->readSensorBool(direction, channel, key);
+}
+
+long long TraceLayer::readSensorInt(const int direction, const size_t channel, const std::string &key) const
+{
+    TRACE_CALL("readSensorInt");
+    return _device->readSensorInt(direction, channel, key);
+}
+
+double TraceLayer::readSensorFloat(const int direction, const size_t channel, const std::string &key) const
+{
+    TRACE_CALL("readSensorFloat");
+    return _device->readSensorFloat(direction, channel, key);
+}
+
+/*******************************************************************
+ * Register API
+ ******************************************************************/
+std::vector<std::string> TraceLayer::listRegisterInterfaces(void) const
+{
+    TRACE_CALL("listRegisterInterfaces");
+    return _device->listRegisterInterfaces();
+}
+
+void TraceLayer::writeRegister(const std::string &name, const unsigned addr, const unsigned value)
+{
+    TRACE_CALL("writeRegister");
+    _device->writeRegister(name, addr, value);
+}
+
+unsigned TraceLayer::readRegister(const std::string &name, const unsigned addr) const
+{
+    TRACE_CALL("readRegister");
+    return _device->readRegister(name, addr);
+}
+
+void TraceLayer::writeRegister(const unsigned addr, const unsigned value)
+{
+    TRACE_CALL("writeRegister");
+    _device->writeRegister(addr, value);
+}
+
+unsigned TraceLayer::readRegister(const unsigned addr) const
+{
+    TRACE_CALL("readRegister");
+    return _device->readRegister(addr);
+}
+
+void TraceLayer::writeRegisters(const std::string &name, const unsigned addr, const std::vector<unsigned> &value)
+{
+    TRACE_CALL("writeRegisters");
+    _device->writeRegisters(name, addr, value);
+}
+
+std::vector<unsigned> TraceLayer::readRegisters(const std::string &name, const unsigned addr, const size_t length) const
+{
+    TRACE_CALL("readRegisters");
+    return _device->readRegisters(name, addr, length);
+}
+
+std::vector<unsigned> TraceLayer::transactRegisters(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops)
+{
+    TRACE_CALL("transactRegisters");
+    return _device->transactRegisters(name, ops);
+}
+
+std::future<std::vector<unsigned>> TraceLayer::transactRegistersAsync(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops)
+{
+    TRACE_CALL("transactRegistersAsync");
+    return _device->transactRegistersAsync(name, ops);
+}
+
+/*******************************************************************
+ * Settings API
+ ******************************************************************/
+static SoapySDR::ArgInfo traceStatsInfo(void)
+{
+    SoapySDR::ArgInfo info;
+    info.key = "trace_stats";
+    info.name = "Trace Statistics";
+    info.type = SoapySDR::ArgInfo::STRING;
+    info.description = "Read only: per-method call counts and latency percentiles as JSON.";
+    return info;
+}
+
+static SoapySDR::ArgInfo traceResetInfo(void)
+{
+    SoapySDR::ArgInfo info;
+    info.key = "trace_reset";
+    info.name = "Reset Trace Statistics";
+    info.type = SoapySDR::ArgInfo::BOOL;
+    info.description = "Write only: clear the trace statistics.";
+    return info;
+}
+
+SoapySDR::ArgInfoList TraceLayer::getSettingInfo(void) const
+{
+    SoapySDR::ArgInfoList infos;
+    {
+        TRACE_CALL("getSettingInfo");
+        infos = _device->getSettingInfo();
+    }
+    infos.push_back(traceStatsInfo());
+    infos.push_back(traceResetInfo());
+    return infos;
+}
+
+SoapySDR::ArgInfo TraceLayer::getSettingInfo(const std::string &key) const
+{
+    if (key == "trace_stats") return traceStatsInfo();
+    if (key == "trace_reset") return traceResetInfo();
+    TRACE_CALL("getSettingInfo");
+    return _device->getSettingInfo(key);
+}
+
+void TraceLayer::writeSetting(const std::string &key, const std::string &value)
+{
+    if (key == "trace_reset") return _tracer->reset();
+    TRACE_CALL("writeSetting");
+    _device->writeSetting(key, value);
+}
+
+std::string TraceLayer::readSetting(const std::string &key) const
+{
+    if (key == "trace_stats") return _tracer->toJson();
+    TRACE_CALL("readSetting");
+    return _device->readSetting(key);
+}
+
+void TraceLayer::writeSettingBool(const std::string &key, const bool value)
+{
+    if (key == "trace_reset") return _tracer->reset();
+    TRACE_CALL("writeSettingBool");
+    _device->writeSettingBool(key, value);
+}
+
+void TraceLayer::writeSettingInt(const std::string &key, const long long value)
+{
+    if (key == "trace_reset") return _tracer->reset();
+    TRACE_CALL("writeSettingInt");
+    _device->writeSettingInt(key, value);
+}
+
+void TraceLayer::writeSettingFloat(const std::string &key, const double value)
+{
+    if (key == "trace_reset") return _tracer->reset();
+    TRACE_CALL("writeSettingFloat");
+    _device->writeSettingFloat(key, value);
+}
+
+bool TraceLayer::readSettingBool(const std::string &key) const
+{
+    TRACE_CALL("readSettingBool");
+    return _device->readSettingBool(key);
+}
+
+long long TraceLayer::readSettingInt(const std::string &key) const
+{
+    TRACE_CALL("readSettingInt");
+    return _device->readSettingInt(key);
+}
+
+double TraceLayer::readSettingFloat(const std::string &key) const
+{
+    TRACE_CALL("readSettingFloat");
+    return _device->readSettingFloat(key);
+}
+
+SoapySDR::ArgInfoList TraceLayer::getSettingInfo(const int direction, const size_t channel) const
+{
+    TRACE_CALL("getSettingInfo");
+    return _device->getSettingInfo(direction, channel);
+}
+
+SoapySDR::ArgInfo TraceLayer::getSettingInfo(const int direction, const size_t channnel, const std::string &key) const
+{
+    TRACE_CALL("getSettingInfo");
+    return _device->getSettingInfo(direction, channnel, key);
+}
+
+void TraceLayer::writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value)
+{
+    TRACE_CALL("writeSetting");
+    _device->writeSetting(direction, channel, key, value);
+}
+
+std::string TraceLayer::readSetting(const int direction, const size_t channel, const std::string &key) const
+{
+    TRACE_CALL("readSetting");
+    return _device->readSetting(direction, channel, key);
+}
+
+void TraceLayer::writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value)
+{
+    TRACE_CALL("writeSettingBool");
+    _device->writeSettingBool(direction, channel, key, value);
+}
+
+void TraceLayer::writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value)
+{
+    TRACE_CALL("writeSettingInt");
+    _device->writeSettingInt(direction, channel, key, value);
+}
+
+void TraceLayer::writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value)
+{
+    TRACE_CALL("writeSettingFloat");
+    _device->writeSettingFloat(direction, channel, key, value);
+}
+
+bool TraceLayer::readSettingBool(const int direction, const size_t channel, const std::string &key) const
+{
+    TRACE_CALL("readSettingBool");
+    return _device->readSettingBool(direction, channel, key);
+}
+
+long long TraceLayer::readSettingInt(const int direction, const size_t channel, const std::string &key) const
+{
+    TRACE_CALL("readSettingInt");
+    return _device->readSettingInt(direction, channel, key);
+}
+
+double TraceLayer::readSettingFloat(const int direction, const size_t channel, const std::string &key) const
+{
+    TRACE_CALL("readSettingFloat");
+    return _device->readSettingFloat(direction, channel, key);
+}
+
+/*******************************************************************
+ * GPIO API
+ ******************************************************************/
+std::vector<std::string> TraceLayer::listGPIOBanks(void) const
+{
+    TRACE_CALL("listGPIOBanks");
+    return _device->listGPIOBanks();
+}
+
+void TraceLayer::writeGPIO(const std::string &bank, const unsigned value)
+{
+    TRACE_CALL("writeGPIO");
+    _device->writeGPIO(bank, value);
+}
+
+void TraceLayer::writeGPIO(const std::string &bank, const unsigned value, const unsigned mask)
+{
+    TRACE_CALL("writeGPIO");
+    _device->writeGPIO(bank, value, mask);
+}
+
+unsigned TraceLayer::readGPIO(const std::string &bank) const
+{
+    TRACE_CALL("readGPIO");
+    return _device->readGPIO(bank);
+}
+
+void TraceLayer::writeGPIODir(const std::string &bank, const unsigned dir)
+{
+    TRACE_CALL("writeGPIODir");
+    _device->writeGPIODir(bank, dir);
+}
+
+void TraceLayer::writeGPIODir(const std::string &bank, const unsigned dir, const unsigned mask)
+{
+    TRACE_CALL("writeGPIODir");
+    _device->writeGPIODir(bank, dir, mask);
+}
+
+unsigned TraceLayer::readGPIODir(const std::string &bank) const
+{
+    TRACE_CALL("readGPIODir");
+    return _device->readGPIODir(bank);
+}
+
+/*******************************************************************
+ * I2C API
+ ******************************************************************/
+void TraceLayer::writeI2C(const int addr, const std::string &data)
+{
+    TRACE_CALL("writeI2C");
+    _device->writeI2C(addr, data);
+}
+
+std::string TraceLayer::readI2C(const int addr, const size_t numBytes)
+{
+    TRACE_CALL("readI2C");
+    return _device->readI2C(addr, numBytes);
+}
+
+std::vector<std::string> TraceLayer::transactI2C(const std::vector<SoapySDR::I2CMessage> &messages)
+{
+    TRACE_CALL("transactI2C");
+    return _device->transactI2C(messages);
+}
+
+/*******************************************************************
+ * SPI API
+ ******************************************************************/
+unsigned TraceLayer::transactSPI(const int addr, const unsigned data, const size_t numBits)
+{
+    TRACE_CALL("transactSPI");
+    return _device->transactSPI(addr, data, numBits);
+}
+
+std::vector<unsigned> TraceLayer::transactSPIBatch(const int addr, const std::vector<unsigned> &data, const size_t numBits)
+{
+    TRACE_CALL("transactSPIBatch");
+    return _device->transactSPIBatch(addr, data, numBits);
+}
+
+/*******************************************************************
+ * UART API
+ ******************************************************************/
+std::vector<std::string> TraceLayer::listUARTs(void) const
+{
+    TRACE_CALL("listUARTs");
+    return _device->listUARTs();
+}
+
+void TraceLayer::writeUART(const std::string &which, const std::string &data)
+{
+    TRACE_CALL("writeUART");
+    _device->writeUART(which, data);
+}
+
+std::string TraceLayer::readUART(const std::string &which, const long timeoutUs) const
+{
+    TRACE_CALL("readUART");
+    return _device->readUART(which, timeoutUs);
+}
+
+/*******************************************************************
+ * Native Access API
+ ******************************************************************/
+void *TraceLayer::getNativeDeviceHandle(void) const
+{
+    TRACE_CALL("getNativeDeviceHandle");
+    return _device->getNativeDeviceHandle();
+}
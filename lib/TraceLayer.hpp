@@ -0,0 +1,292 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include "DeviceDecorator.hpp"
+#include "CallTracer.hpp"
+#include <memory>
+
+/*!
+ * TraceLayer times every call into the underlying device.
+ * The factory places it directly around the driver when trace=true,
+ * so the statistics show the latency of the driver itself.
+ *
+ * Settings handled by the layer:
+ *  - trace_stats: read per-method call counts and latency percentiles as JSON
+ *  - trace_reset: write any value to clear the statistics
+ *
+ * The trace_file make argument also writes every call
+ * to a Chrome trace-event JSON file for timeline viewing.
+ */
+class TraceLayer : public DeviceDecorator
+{
+public:
+    TraceLayer(SoapySDR::Device *device, const SoapySDR::Kwargs &args);
+
+    /*******************************************************************
+     * Identification API
+     ******************************************************************/
+    std::string getDriverKey(void) const;
+    std::string getHardwareKey(void) const;
+    SoapySDR::Kwargs getHardwareInfo(void) const;
+
+    /*******************************************************************
+     * Channels API
+     ******************************************************************/
+    void setFrontendMapping(const int direction, const std::string &mapping);
+    std::string getFrontendMapping(const int direction) const;
+    size_t getNumChannels(const int direction) const;
+    SoapySDR::Kwargs getChannelInfo(const int direction, const size_t channel) const;
+    bool getFullDuplex(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Stream API
+     ******************************************************************/
+    std::vector<std::string> getStreamFormats(const int direction, const size_t channel) const;
+    std::string getNativeStreamFormat(const int direction, const size_t channel, double &fullScale) const;
+    SoapySDR::ArgInfoList getStreamArgsInfo(const int direction, const size_t channel) const;
+    SoapySDR::Stream *setupStream(const int direction, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &args);
+    void closeStream(SoapySDR::Stream *stream);
+    size_t getStreamMTU(SoapySDR::Stream *stream) const;
+    int activateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs, const size_t numElems);
+    int deactivateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs);
+    int readStream(SoapySDR::Stream *stream, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+    int writeStream(SoapySDR::Stream *stream, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs);
+    int readStreamStatus(SoapySDR::Stream *stream, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs);
+
+    int captureSamples(const int direction, const std::vector<size_t> &channels, const std::string &format, const long long timeNs, const size_t numElems, void * const *buffs, const long timeoutUs);
+
+    SoapySDR::StreamStats getStreamStats(SoapySDR::Stream *stream) const;
+
+    /*******************************************************************
+     * Direct buffer access API
+     ******************************************************************/
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *stream);
+    int getDirectAccessBufferAddrs(SoapySDR::Stream *stream, const size_t handle, void **buffs);
+    int acquireReadBuffer(SoapySDR::Stream *stream, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs);
+    void releaseReadBuffer(SoapySDR::Stream *stream, const size_t handle);
+    int acquireWriteBuffer(SoapySDR::Stream *stream, size_t &handle, void **buffs, const long timeoutUs);
+    void releaseWriteBuffer(SoapySDR::Stream *stream, const size_t handle, const size_t numElems, int &flags, const long long timeNs);
+
+    /*******************************************************************
+     * Stream tap API
+     ******************************************************************/
+    SoapySDR::StreamTap *setupStreamTap(SoapySDR::Stream *stream, const SoapySDR::Kwargs &args);
+    void closeStreamTap(SoapySDR::StreamTap *tap);
+    int readStreamTap(SoapySDR::StreamTap *tap, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+    int acquireTapBuffer(SoapySDR::StreamTap *tap, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs);
+    void releaseTapBuffer(SoapySDR::StreamTap *tap, const size_t handle);
+    unsigned long long getStreamTapDrops(SoapySDR::StreamTap *tap) const;
+
+    /*******************************************************************
+     * Sweep API
+     ******************************************************************/
+    SoapySDR::Sweep *setupSweep(const int direction, const size_t channel, const std::string &format, const std::vector<double> &frequencies, const size_t dwellElems, const long long settleNs, const SoapySDR::Kwargs &args);
+    void closeSweep(SoapySDR::Sweep *sweep);
+    int readSweep(SoapySDR::Sweep *sweep, void *buff, int &flags, double &frequency, long long &timeNs, const long timeoutUs);
+
+    /*******************************************************************
+     * Antenna API
+     ******************************************************************/
+    std::vector<std::string> listAntennas(const int direction, const size_t channel) const;
+    void setAntenna(const int direction, const size_t channel, const std::string &name);
+    std::string getAntenna(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Frontend corrections API
+     ******************************************************************/
+    bool hasDCOffsetMode(const int direction, const size_t channel) const;
+    void setDCOffsetMode(const int direction, const size_t channel, const bool automatic);
+    bool getDCOffsetMode(const int direction, const size_t channel) const;
+    bool hasDCOffset(const int direction, const size_t channel) const;
+    void setDCOffset(const int direction, const size_t channel, const std::complex<double> &offset);
+    std::complex<double> getDCOffset(const int direction, const size_t channel) const;
+    bool hasIQBalance(const int direction, const size_t channel) const;
+    void setIQBalance(const int direction, const size_t channel, const std::complex<double> &balance);
+    std::complex<double> getIQBalance(const int direction, const size_t channel) const;
+    bool hasIQBalanceMode(const int direction, const size_t channel) const;
+    void setIQBalanceMode(const int direction, const size_t channel, const bool automatic);
+    bool getIQBalanceMode(const int direction, const size_t channel) const;
+    bool hasFrequencyCorrection(const int direction, const size_t channel) const;
+    void setFrequencyCorrection(const int direction, const size_t channel, const double value);
+    double getFrequencyCorrection(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Gain API
+     ******************************************************************/
+    std::vector<std::string> listGains(const int direction, const size_t channel) const;
+    bool hasGainMode(const int direction, const size_t channel) const;
+    void setGainMode(const int direction, const size_t channel, const bool automatic);
+    bool getGainMode(const int direction, const size_t channel) const;
+    void setGain(const int direction, const size_t channel, const double value);
+    void setGain(const int direction, const size_t channel, const std::string &name, const double value);
+    double getGain(const int direction, const size_t channel) const;
+    double getGain(const int direction, const size_t channel, const std::string &name) const;
+    SoapySDR::Range getGainRange(const int direction, const size_t channel) const;
+    SoapySDR::Range getGainRange(const int direction, const size_t channel, const std::string &name) const;
+    SoapySDR::GainTable getGainTable(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Frequency API
+     ******************************************************************/
+    void setFrequency(const int direction, const size_t channel, const double frequency, const SoapySDR::Kwargs &args);
+    void setFrequency(const int direction, const size_t channel, const std::string &name, const double frequency, const SoapySDR::Kwargs &args);
+    double getFrequency(const int direction, const size_t channel) const;
+    double getFrequency(const int direction, const size_t channel, const std::string &name) const;
+    std::vector<std::string> listFrequencies(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getFrequencyRange(const int direction, const size_t channel, const std::string &name) const;
+    SoapySDR::ArgInfoList getFrequencyArgsInfo(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Frequency hopping API
+     ******************************************************************/
+    SoapySDR::HopTable *prepareFrequencies(const int direction, const size_t channel, const std::vector<double> &frequencies, const SoapySDR::Kwargs &args);
+    void applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs);
+    void closeHopTable(SoapySDR::HopTable *table);
+
+    /*******************************************************************
+     * Sample Rate API
+     ******************************************************************/
+    void setSampleRate(const int direction, const size_t channel, const double rate);
+    double getSampleRate(const int direction, const size_t channel) const;
+    std::vector<double> listSampleRates(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getSampleRateRange(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Bandwidth API
+     ******************************************************************/
+    void setBandwidth(const int direction, const size_t channel, const double bw);
+    double getBandwidth(const int direction, const size_t channel) const;
+    std::vector<double> listBandwidths(const int direction, const size_t channel) const;
+    SoapySDR::RangeList getBandwidthRange(const int direction, const size_t channel) const;
+
+    /*******************************************************************
+     * Clocking API
+     ******************************************************************/
+    void setMasterClockRate(const double rate);
+    double getMasterClockRate(void) const;
+    SoapySDR::RangeList getMasterClockRates(void) const;
+    void setReferenceClockRate(const double rate);
+    double getReferenceClockRate(void) const;
+    SoapySDR::RangeList getReferenceClockRates(void) const;
+    std::vector<std::string> listClockSources(void) const;
+    void setClockSource(const std::string &source);
+    std::string getClockSource(void) const;
+
+    /*******************************************************************
+     * Time API
+     ******************************************************************/
+    std::vector<std::string> listTimeSources(void) const;
+    void setTimeSource(const std::string &source);
+    std::string getTimeSource(void) const;
+    bool hasHardwareTime(const std::string &what) const;
+    long long getHardwareTime(const std::string &what) const;
+    void setHardwareTime(const long long timeNs, const std::string &what);
+    void setCommandTime(const long long timeNs, const std::string &what);
+
+    /*******************************************************************
+     * Configuration transaction API
+     ******************************************************************/
+    void beginConfig(void);
+    void commitConfig(const long long timeNs);
+    void cancelConfig(void);
+
+    /*******************************************************************
+     * Timed command API
+     ******************************************************************/
+    size_t queueCommands(const SoapySDR::TimedCommandList &commands);
+    void clearCommands(void);
+    SoapySDR::CommandQueueStats getCommandQueueStats(void) const;
+
+    /*******************************************************************
+     * Sensor API
+     ******************************************************************/
+    std::vector<std::string> listSensors(void) const;
+    SoapySDR::ArgInfo getSensorInfo(const std::string &key) const;
+    std::string readSensor(const std::string &key) const;
+    bool readSensorBool(const std::string &key) const;
+    long long readSensorInt(const std::string &key) const;
+    double readSensorFloat(const std::string &key) const;
+    std::vector<std::string> listSensors(const int direction, const size_t channel) const;
+    SoapySDR::ArgInfo getSensorInfo(const int direction, const size_t channel, const std::string &key) const;
+    std::string readSensor(const int direction, const size_t channel, const std::string &key) const;
+    bool readSensorBool(const int direction, const size_t channel, const std::string &key) const;
+    long long readSensorInt(const int direction, const size_t channel, const std::string &key) const;
+    double readSensorFloat(const int direction, const size_t channel, const std::string &key) const;
+
+    /*******************************************************************
+     * Register API
+     ******************************************************************/
+    std::vector<std::string> listRegisterInterfaces(void) const;
+    void writeRegister(const std::string &name, const unsigned addr, const unsigned value);
+    unsigned readRegister(const std::string &name, const unsigned addr) const;
+    void writeRegister(const unsigned addr, const unsigned value);
+    unsigned readRegister(const unsigned addr) const;
+    void writeRegisters(const std::string &name, const unsigned addr, const std::vector<unsigned> &value);
+    std::vector<unsigned> readRegisters(const std::string &name, const unsigned addr, const size_t length) const;
+    std::vector<unsigned> transactRegisters(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops);
+    std::future<std::vector<unsigned>> transactRegistersAsync(const std::string &name, const std::vector<SoapySDR::RegisterOp> &ops);
+
+    /*******************************************************************
+     * Settings API
+     ******************************************************************/
+    SoapySDR::ArgInfoList getSettingInfo(void) const;
+    SoapySDR::ArgInfo getSettingInfo(const std::string &key) const;
+    void writeSetting(const std::string &key, const std::string &value);
+    std::string readSetting(const std::string &key) const;
+    void writeSettingBool(const std::string &key, const bool value);
+    void writeSettingInt(const std::string &key, const long long value);
+    void writeSettingFloat(const std::string &key, const double value);
+    bool readSettingBool(const std::string &key) const;
+    long long readSettingInt(const std::string &key) const;
+    double readSettingFloat(const std::string &key) const;
+    SoapySDR::ArgInfoList getSettingInfo(const int direction, const size_t channel) const;
+    SoapySDR::ArgInfo getSettingInfo(const int direction, const size_t channnel, const std::string &key) const;
+    void writeSetting(const int direction, const size_t channel, const std::string &key, const std::string &value);
+    std::string readSetting(const int direction, const size_t channel, const std::string &key) const;
+    void writeSettingBool(const int direction, const size_t channel, const std::string &key, const bool value);
+    void writeSettingInt(const int direction, const size_t channel, const std::string &key, const long long value);
+    void writeSettingFloat(const int direction, const size_t channel, const std::string &key, const double value);
+    bool readSettingBool(const int direction, const size_t channel, const std::string &key) const;
+    long long readSettingInt(const int direction, const size_t channel, const std::string &key) const;
+    double readSettingFloat(const int direction, const size_t channel, const std::string &key) const;
+
+    /*******************************************************************
+     * GPIO API
+     ******************************************************************/
+    std::vector<std::string> listGPIOBanks(void) const;
+    void writeGPIO(const std::string &bank, const unsigned value);
+    void writeGPIO(const std::string &bank, const unsigned value, const unsigned mask);
+    unsigned readGPIO(const std::string &bank) const;
+    void writeGPIODir(const std::string &bank, const unsigned dir);
+    void writeGPIODir(const std::string &bank, const unsigned dir, const unsigned mask);
+    unsigned readGPIODir(const std::string &bank) const;
+
+    /*******************************************************************
+     * I2C API
+     ******************************************************************/
+    void writeI2C(const int addr, const std::string &data);
+    std::string readI2C(const int addr, const size_t numBytes);
+    std::vector<std::string> transactI2C(const std::vector<SoapySDR::I2CMessage> &messages);
+
+    /*******************************************************************
+     * SPI API
+     ******************************************************************/
+    unsigned transactSPI(const int addr, const unsigned data, const size_t numBits);
+    std::vector<unsigned> transactSPIBatch(const int addr, const std::vector<unsigned> &data, const size_t numBits);
+
+    /*******************************************************************
+     * UART API
+     ******************************************************************/
+    std::vector<std::string> listUARTs(void) const;
+    void writeUART(const std::string &which, const std::string &data);
+    std::string readUART(const std::string &which, const long timeoutUs) const;
+
+    /*******************************************************************
+     * Native Access API
+     ******************************************************************/
+    void *getNativeDeviceHandle(void) const;
+private:
+    std::unique_ptr<CallTracer> _tracer;
+};
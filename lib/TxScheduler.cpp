@@ -0,0 +1,364 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TxScheduler.hpp"
+#include <SoapySDR/Time.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+//how often the hardware time is read, the time model estimates it in-between
+static const auto HARDWARE_TIME_RESYNC = std::chrono::milliseconds(100);
+
+//upper bound on a single idle wait so stop() and new bursts are noticed promptly
+static const auto MAX_IDLE_WAIT = std::chrono::milliseconds(10);
+
+//longest single wait on the driver status, so scheduler events are reported promptly
+static const auto STATUS_POLL_SLICE = std::chrono::milliseconds(10);
+
+//status events beyond this are dropped oldest first when nobody reads them
+static const size_t MAX_STATUS = 1024;
+
+TxScheduler::TxScheduler(
+    SoapySDR::Device *device,
+    SoapySDR::Stream *stream,
+    const size_t numChans,
+    const size_t elemSize,
+    const SoapySDR::Kwargs &args):
+    _device(device),
+    _stream(stream),
+    _numChans(numChans),
+    _elemSize(elemSize),
+    _mtu(device->getStreamMTU(stream)),
+    _continuous(false),
+    _timedWrites(device->hasHardwareTime()),
+    _leadNs(2000000),
+    _maxQueued(1 << 22),
+    _openBurst(_queue.end()),
+    _numQueued(0),
+    _running(false),
+    _sampleRate(0.0),
+    _startNs(0),
+    _cursorTicks(0),
+    _timedFirstWrite(false),
+    _tracker(device),
+    _timeFailed(false)
+{
+    if (args.count("CONTINUOUS") != 0) _continuous = SoapySDR::StringToSetting<bool>(args.at("CONTINUOUS"));
+    if (args.count("SCHEDULER_LEAD") != 0) _leadNs = SoapySDR::StringToSetting<long long>(args.at("SCHEDULER_LEAD"))*1000;
+    if (args.count("SCHEDULER_QUEUE") != 0) _maxQueued = SoapySDR::StringToSetting<size_t>(args.at("SCHEDULER_QUEUE"));
+    _maxQueued = std::max(_maxQueued, _mtu);
+    _zeros.resize(_mtu*_elemSize, 0);
+}
+
+TxScheduler::~TxScheduler(void)
+{
+    this->stop();
+}
+
+void TxScheduler::start(const double sampleRate)
+{
+    this->stop();
+    this->sampleTime();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _sampleRate = sampleRate;
+    _startNs = this->deviceTime() + _leadNs;
+    _cursorTicks = 0;
+    _timedFirstWrite = true;
+    _running = true;
+    _thread = std::thread(&TxScheduler::schedulerLoop, this);
+}
+
+void TxScheduler::stop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running = false;
+        _queue.clear();
+        _openBurst = _queue.end();
+        _numQueued = 0;
+    }
+    _cond.notify_all();
+    _spaceCond.notify_all();
+    if (_thread.joinable()) _thread.join();
+}
+
+/*******************************************************************
+ * Caller side: queue bursts and read status
+ ******************************************************************/
+int TxScheduler::write(const void * const *buffs, const size_t numElems, const int flags, const long long timeNs, const long timeoutUs)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    //wait for space in the queue to provide back-pressure,
+    //a write larger than the whole queue is taken once the queue is empty
+    const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+    while (_numQueued != 0 and _numQueued + numElems > _maxQueued)
+    {
+        if (not _running) return SOAPY_SDR_STREAM_ERROR;
+        if (_spaceCond.wait_until(lock, exitTime) == std::cv_status::timeout) return SOAPY_SDR_TIMEOUT;
+    }
+
+    const bool hasTime = (flags & SOAPY_SDR_HAS_TIME) != 0;
+    const bool endBurst = (flags & SOAPY_SDR_END_BURST) != 0;
+
+    //continuation of a burst that is still waiting in the queue
+    if (not hasTime and _openBurst != _queue.end())
+    {
+        auto &burst = _openBurst->second;
+        for (size_t i = 0; i < _numChans; i++)
+        {
+            const char *p = reinterpret_cast<const char *>(buffs[i]);
+            burst.data[i].insert(burst.data[i].end(), p, p+numElems*_elemSize);
+        }
+        burst.numElems += numElems;
+        burst.endBurst = endBurst;
+        if (endBurst) _openBurst = _queue.end();
+        _numQueued += numElems;
+        return int(numElems);
+    }
+
+    //otherwise a new burst, untimed bursts sort to the front to go out asap
+    Burst burst;
+    burst.hasTime = hasTime;
+    burst.endBurst = endBurst;
+    burst.numElems = numElems;
+    burst.data.resize(_numChans);
+    for (size_t i = 0; i < _numChans; i++)
+    {
+        const char *p = reinterpret_cast<const char *>(buffs[i]);
+        burst.data[i].assign(p, p+numElems*_elemSize);
+    }
+    auto it = _queue.insert(std::make_pair(hasTime?timeNs:LLONG_MIN, std::move(burst)));
+    _openBurst = endBurst?_queue.end():it;
+    _numQueued += numElems;
+    lock.unlock();
+    _cond.notify_one();
+    return int(numElems);
+}
+
+int TxScheduler::readStatus(size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+{
+    //wait on the scheduler events and poll the underlying stream in short slices
+    const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+    bool pollDriver = true;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_status.empty())
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= exitTime and not pollDriver) return SOAPY_SDR_TIMEOUT;
+        const auto sliceEnd = std::min<std::chrono::steady_clock::time_point>(exitTime, now + STATUS_POLL_SLICE);
+        if (pollDriver)
+        {
+            lock.unlock();
+            const long sliceUs = long(std::chrono::duration_cast<std::chrono::microseconds>(sliceEnd - now).count());
+            const int ret = _device->readStreamStatus(_stream, chanMask, flags, timeNs, std::max(sliceUs, 0L));
+            lock.lock();
+            if (ret != SOAPY_SDR_TIMEOUT and ret != SOAPY_SDR_NOT_SUPPORTED) return ret;
+            pollDriver = (ret == SOAPY_SDR_TIMEOUT);
+            if (now >= exitTime and _status.empty()) return SOAPY_SDR_TIMEOUT;
+        }
+        _statusCond.wait_until(lock, sliceEnd, [this]{return not _status.empty();});
+    }
+
+    const auto status = _status.front();
+    _status.pop_front();
+    chanMask = (_numChans >= sizeof(size_t)*8)?~size_t(0):((size_t(1) << _numChans)-1);
+    flags = status.flags;
+    timeNs = status.timeNs;
+    return status.ret;
+}
+
+/*******************************************************************
+ * Scheduler thread: release bursts just in time
+ ******************************************************************/
+void TxScheduler::schedulerLoop(void)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_running)
+    {
+        //keep the time model fresh without holding the lock over the device call
+        if (std::chrono::steady_clock::now() - _lastSample > HARDWARE_TIME_RESYNC)
+        {
+            lock.unlock();
+            this->sampleTime();
+            lock.lock();
+            continue;
+        }
+
+        const bool serviced = _continuous?this->serviceContinuous(lock):this->serviceBursts(lock);
+        if (not serviced and _running) _cond.wait_for(lock, MAX_IDLE_WAIT);
+    }
+}
+
+bool TxScheduler::serviceContinuous(std::unique_lock<std::mutex> &lock)
+{
+    const long long cursorNs = _startNs + SoapySDR::ticksToTimeNs(_cursorTicks, _sampleRate);
+    size_t numZeros = _mtu;
+
+    if (not _queue.empty())
+    {
+        auto it = _queue.begin();
+        const long long burstNs = it->second.hasTime?it->first:cursorNs;
+        const long long gapTicks = SoapySDR::timeNsToTicks(burstNs - cursorNs, _sampleRate);
+
+        //the stream has already moved past this burst, report and drop it
+        if (gapTicks < 0)
+        {
+            this->postStatus(SOAPY_SDR_TIME_ERROR, SOAPY_SDR_HAS_TIME, burstNs);
+            _numQueued -= it->second.numElems;
+            if (_openBurst == it) _openBurst = _queue.end();
+            _queue.erase(it);
+            _spaceCond.notify_all();
+            return true;
+        }
+
+        //the burst starts exactly at the cursor, write it into the stream
+        if (gapTicks == 0)
+        {
+            Burst burst(std::move(it->second));
+            if (_openBurst == it) _openBurst = _queue.end();
+            _queue.erase(it);
+            std::vector<const void *> buffs(_numChans);
+            for (size_t i = 0; i < _numChans; i++) buffs[i] = burst.data[i].data();
+            lock.unlock();
+            const int ret = this->writeElements(buffs, burst.numElems, 0, cursorNs);
+            lock.lock();
+            _numQueued -= burst.numElems;
+            _spaceCond.notify_all();
+            if (ret < 0) this->postStatus(ret, SOAPY_SDR_HAS_TIME, burstNs);
+            return true;
+        }
+
+        //otherwise pad up to the start of the burst
+        numZeros = size_t(std::min<long long>(gapTicks, _mtu));
+    }
+
+    //fill the stream with zeros to keep it continuous
+    std::vector<const void *> buffs(_numChans, _zeros.data());
+    lock.unlock();
+    const int ret = this->writeElements(buffs, numZeros, 0, cursorNs);
+    lock.lock();
+    return ret >= 0;
+}
+
+bool TxScheduler::serviceBursts(std::unique_lock<std::mutex> &lock)
+{
+    if (_queue.empty()) return false;
+    auto it = _queue.begin();
+
+    //timed writes are released within the lead time of the burst for the driver to hold,
+    //otherwise the host paces the burst and the lead time is the allowed lateness
+    const long long nowNs = this->deviceTime();
+    if (it->second.hasTime)
+    {
+        const long long waitNs = it->first - (_timedWrites?_leadNs:0) - nowNs;
+        if (waitNs > 0)
+        {
+            _cond.wait_for(lock, std::min<std::chrono::nanoseconds>(std::chrono::nanoseconds(waitNs), MAX_IDLE_WAIT));
+            return true;
+        }
+        if (nowNs > it->first + (_timedWrites?0:_leadNs))
+        {
+            this->postStatus(SOAPY_SDR_TIME_ERROR, SOAPY_SDR_HAS_TIME, it->first);
+            _numQueued -= it->second.numElems;
+            if (_openBurst == it) _openBurst = _queue.end();
+            _queue.erase(it);
+            _spaceCond.notify_all();
+            return true;
+        }
+    }
+
+    //release the burst to the underlying stream
+    const long long burstNs = it->second.hasTime?it->first:nowNs;
+    int flags = it->second.endBurst?SOAPY_SDR_END_BURST:0;
+    if (it->second.hasTime and _timedWrites) flags |= SOAPY_SDR_HAS_TIME;
+    Burst burst(std::move(it->second));
+    if (_openBurst == it) _openBurst = _queue.end();
+    _queue.erase(it);
+    std::vector<const void *> buffs(_numChans);
+    for (size_t i = 0; i < _numChans; i++) buffs[i] = burst.data[i].data();
+    lock.unlock();
+    const int ret = this->writeElements(buffs, burst.numElems, flags, burstNs);
+    lock.lock();
+    _numQueued -= burst.numElems;
+    _spaceCond.notify_all();
+    if (ret < 0) this->postStatus(ret, SOAPY_SDR_HAS_TIME, burstNs);
+    return true;
+}
+
+int TxScheduler::writeElements(const std::vector<const void *> &buffs, size_t numElems, int flags, const long long timeNs)
+{
+    std::vector<const void *> ptrs(buffs);
+    size_t total = 0;
+    while (numElems != 0)
+    {
+        if (not _running) return SOAPY_SDR_STREAM_ERROR;
+        const size_t n = std::min(numElems, _mtu);
+
+        //the time goes with the first write, the end of burst with the last
+        int writeFlags = flags & ~SOAPY_SDR_END_BURST;
+        if (n == numElems) writeFlags |= (flags & SOAPY_SDR_END_BURST);
+        if (total != 0) writeFlags &= ~SOAPY_SDR_HAS_TIME;
+
+        //the very first write in continuous mode carries the stream start time
+        if (_continuous and _timedFirstWrite) writeFlags |= SOAPY_SDR_HAS_TIME;
+        const long long writeTimeNs = ((writeFlags & SOAPY_SDR_HAS_TIME) != 0)?timeNs:0;
+
+        int ret = _device->writeStream(_stream, ptrs.data(), n, writeFlags, writeTimeNs);
+        if (ret == SOAPY_SDR_TIMEOUT) continue;
+        const bool timedWrite = (writeFlags & SOAPY_SDR_HAS_TIME) != 0;
+        if (timedWrite and (ret == SOAPY_SDR_NOT_SUPPORTED or (_continuous and ret == SOAPY_SDR_TIME_ERROR)))
+        {
+            //timed writes not supported by the driver, the host paces the bursts from now on
+            _timedFirstWrite = false;
+            _timedWrites = false;
+            flags &= ~SOAPY_SDR_HAS_TIME;
+            continue;
+        }
+        if (ret < 0)
+        {
+            //avoid spinning on a stream that keeps failing
+            if (ret != SOAPY_SDR_TIME_ERROR) std::this_thread::sleep_for(MAX_IDLE_WAIT);
+            return ret;
+        }
+        _timedFirstWrite = false;
+        for (auto &p : ptrs) p = reinterpret_cast<const char *>(p) + ret*_elemSize;
+        if (_continuous) _cursorTicks += ret;
+        numElems -= ret;
+        total += ret;
+    }
+    return int(total);
+}
+
+void TxScheduler::postStatus(const int ret, const int flags, const long long timeNs)
+{
+    Status status;
+    status.ret = ret;
+    status.flags = flags;
+    status.timeNs = timeNs;
+    if (_status.size() >= MAX_STATUS) _status.pop_front();
+    _status.push_back(status);
+    _statusCond.notify_all();
+}
+
+void TxScheduler::sampleTime(void)
+{
+    _lastSample = std::chrono::steady_clock::now();
+    try
+    {
+        _tracker.sample();
+    }
+    catch (const std::exception &ex)
+    {
+        if (not _timeFailed) SoapySDR::logf(SOAPY_SDR_WARNING, "TxScheduler failed to read the hardware time: %s", ex.what());
+        _timeFailed = true;
+    }
+}
+
+long long TxScheduler::deviceTime(void) const
+{
+    return _tracker.estimateHardwareTime().timeNs;
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/TimeTracker.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <vector>
+#include <string>
+
+/*!
+ * TxScheduler releases timestamped transmit bursts to the device just in time.
+ * Bursts are held in a time-ordered queue and written to the underlying stream
+ * by a dedicated thread once the device time approaches the burst time.
+ * Timed bursts are written with SOAPY_SDR_HAS_TIME and the burst time,
+ * the lead time ahead, so that the driver starts them on time.
+ * When the driver has no hardware time or rejects timed writes,
+ * the host releases bursts at their time instead.
+ * The device time is estimated with a TimeTracker, which the scheduler
+ * thread samples outside of the lock, so writers never wait on the device.
+ * In continuous mode, the gaps between bursts are filled with zeros
+ * so that the underlying stream never underflows.
+ * Bursts which can no longer be released in time are dropped
+ * and reported as SOAPY_SDR_TIME_ERROR through readStatus(),
+ * which keeps the most recent events when they are not read.
+ */
+class TxScheduler
+{
+public:
+    TxScheduler(
+        SoapySDR::Device *device,
+        SoapySDR::Stream *stream,
+        const size_t numChans,
+        const size_t elemSize,
+        const SoapySDR::Kwargs &args);
+
+    ~TxScheduler(void);
+
+    //! Start the scheduler thread (called on stream activation)
+    void start(const double sampleRate);
+
+    //! Stop the scheduler thread and drop pending bursts
+    void stop(void);
+
+    //! Queue elements for transmission, same semantics as writeStream(),
+    //! a write larger than the queue waits for the queue to empty
+    int write(const void * const *buffs, const size_t numElems, const int flags, const long long timeNs, const long timeoutUs);
+
+    //! Pop a scheduler event or a driver status, same semantics as readStreamStatus()
+    int readStatus(size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs);
+
+private:
+    struct Burst
+    {
+        bool hasTime;
+        bool endBurst;
+        size_t numElems;
+        std::vector<std::vector<char>> data;
+    };
+
+    struct Status
+    {
+        int ret;
+        int flags;
+        long long timeNs;
+    };
+
+    typedef std::multimap<long long, Burst> BurstQueue;
+
+    void schedulerLoop(void);
+    bool serviceContinuous(std::unique_lock<std::mutex> &lock);
+    bool serviceBursts(std::unique_lock<std::mutex> &lock);
+    int writeElements(const std::vector<const void *> &buffs, size_t numElems, int flags, const long long timeNs);
+    void postStatus(const int ret, const int flags, const long long timeNs);
+    void sampleTime(void);
+    long long deviceTime(void) const;
+
+    SoapySDR::Device *_device;
+    SoapySDR::Stream *_stream;
+    const size_t _numChans;
+    const size_t _elemSize;
+    size_t _mtu;
+
+    //configuration from stream args
+    bool _continuous;
+    bool _timedWrites;
+    long long _leadNs;
+    size_t _maxQueued;
+
+    //scheduler state protected by the mutex
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::condition_variable _spaceCond;
+    std::condition_variable _statusCond;
+    BurstQueue _queue;
+    BurstQueue::iterator _openBurst;
+    size_t _numQueued;
+    std::deque<Status> _status;
+    std::atomic<bool> _running;
+    std::thread _thread;
+
+    //stream timing state used by the scheduler thread
+    double _sampleRate;
+    long long _startNs;
+    long long _cursorTicks;
+    bool _timedFirstWrite;
+    std::vector<char> _zeros;
+
+    //device time model, sampled by the scheduler thread
+    SoapySDR::TimeTracker _tracker;
+    std::chrono::steady_clock::time_point _lastSample;
+    bool _timeFailed;
+};
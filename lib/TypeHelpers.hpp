@@ -161,6 +161,48 @@ static inline SoapySDRArgInfo *toArgInfoList(const SoapySDR::ArgInfoList &infos,
     return out;
 }
 
+static inline SoapySDRStreamStats toStreamStats(const SoapySDR::StreamStats &stats)
+{
+    SoapySDRStreamStats out;
+    std::memset(&out, 0, sizeof(out));
+    out.numElems = stats.numElems;
+    out.numCalls = stats.numCalls;
+    out.numTimeouts = stats.numTimeouts;
+    out.numOverflows = stats.numOverflows;
+    out.numUnderflows = stats.numUnderflows;
+    out.numTimeErrors = stats.numTimeErrors;
+    out.numGaps = stats.numGaps;
+    out.numGapElems = stats.numGapElems;
+    const size_t n = std::min<size_t>(stats.latencyHistogram.size(), SOAPY_SDR_STREAM_STATS_HISTOGRAM_SIZE);
+    std::copy(stats.latencyHistogram.begin(), stats.latencyHistogram.begin()+n, out.latencyHistogram);
+    return out;
+}
+
+static inline SoapySDRCommandQueueStats toCommandQueueStats(const SoapySDR::CommandQueueStats &stats)
+{
+    SoapySDRCommandQueueStats out;
+    std::memset(&out, 0, sizeof(out));
+    out.numQueued = stats.numQueued;
+    out.numOffloaded = stats.numOffloaded;
+    out.numApplied = stats.numApplied;
+    out.numLate = stats.numLate;
+    out.numFailed = stats.numFailed;
+    out.numPending = stats.numPending;
+    out.maxLateNs = stats.maxLateNs;
+    return out;
+}
+
+static inline SoapySDRGainTable toGainTable(const SoapySDR::GainTable &table)
+{
+    SoapySDRGainTable out;
+    std::memset(&out, 0, sizeof(out));
+    size_t numValues(0);
+    out.elements = toStrArray(table.elements, &out.numElements);
+    out.gains = toNumericList(table.gains, &out.numRows);
+    out.values = toNumericList(table.values, &numValues);
+    return out;
+}
+
 static inline std::vector<unsigned> toNumericVector(const unsigned *values, size_t length)
 {
     std::vector<unsigned> out (length, 0);
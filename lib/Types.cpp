@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: BSL-1.0
 
 #include <SoapySDR/Types.hpp>
+#include <SoapySDR/Constants.h>
 #include <cctype>
 
 static std::string trim(const std::string &s)
@@ -75,6 +76,150 @@ SoapySDR::Range::Range(const double minimum, const double maximum, const double
     return;
 }
 
+SoapySDR::StreamStats::StreamStats(void):
+    numElems(0),
+    numCalls(0),
+    numTimeouts(0),
+    numOverflows(0),
+    numUnderflows(0),
+    numTimeErrors(0),
+    numGaps(0),
+    numGapElems(0),
+    latencyHistogram(SOAPY_SDR_STREAM_STATS_HISTOGRAM_SIZE, 0)
+{
+    return;
+}
+
+SoapySDR::GainTable::GainTable(void)
+{
+    return;
+}
+
+SoapySDR::RegisterOp::RegisterOp(void):
+    addr(0),
+    value(0),
+    mask(~0u),
+    read(false)
+{
+    return;
+}
+
+SoapySDR::RegisterOp::RegisterOp(const unsigned addr, const unsigned value, const unsigned mask, const bool read):
+    addr(addr),
+    value(value),
+    mask(mask),
+    read(read)
+{
+    return;
+}
+
+SoapySDR::I2CMessage::I2CMessage(void):
+    addr(0),
+    read(false),
+    numBytes(0)
+{
+    return;
+}
+
+SoapySDR::I2CMessage::I2CMessage(const int addr, const std::string &data):
+    addr(addr),
+    read(false),
+    data(data),
+    numBytes(0)
+{
+    return;
+}
+
+SoapySDR::I2CMessage::I2CMessage(const int addr, const size_t numBytes):
+    addr(addr),
+    read(true),
+    numBytes(numBytes)
+{
+    return;
+}
+
+SoapySDR::TimedCommand::TimedCommand(void):
+    timeNs(0),
+    type(FREQUENCY),
+    direction(SOAPY_SDR_RX),
+    channel(0),
+    value(0.0),
+    gpioValue(0),
+    gpioMask(~0u)
+{
+    return;
+}
+
+SoapySDR::TimedCommand SoapySDR::TimedCommand::frequency(const long long timeNs, const int direction, const size_t channel, const double frequency, const Kwargs &args)
+{
+    return TimedCommand::frequency(timeNs, direction, channel, "", frequency, args);
+}
+
+SoapySDR::TimedCommand SoapySDR::TimedCommand::frequency(const long long timeNs, const int direction, const size_t channel, const std::string &name, const double frequency, const Kwargs &args)
+{
+    TimedCommand command;
+    command.timeNs = timeNs;
+    command.type = FREQUENCY;
+    command.direction = direction;
+    command.channel = channel;
+    command.name = name;
+    command.value = frequency;
+    command.args = args;
+    return command;
+}
+
+SoapySDR::TimedCommand SoapySDR::TimedCommand::gain(const long long timeNs, const int direction, const size_t channel, const double value)
+{
+    return TimedCommand::gain(timeNs, direction, channel, "", value);
+}
+
+SoapySDR::TimedCommand SoapySDR::TimedCommand::gain(const long long timeNs, const int direction, const size_t channel, const std::string &name, const double value)
+{
+    TimedCommand command;
+    command.timeNs = timeNs;
+    command.type = GAIN;
+    command.direction = direction;
+    command.channel = channel;
+    command.name = name;
+    command.value = value;
+    return command;
+}
+
+SoapySDR::TimedCommand SoapySDR::TimedCommand::gpio(const long long timeNs, const std::string &bank, const unsigned value, const unsigned mask)
+{
+    TimedCommand command;
+    command.timeNs = timeNs;
+    command.type = GPIO;
+    command.name = bank;
+    command.gpioValue = value;
+    command.gpioMask = mask;
+    return command;
+}
+
+SoapySDR::TimedCommand SoapySDR::TimedCommand::setting(const long long timeNs, const int direction, const size_t channel, const std::string &key, const std::string &value)
+{
+    TimedCommand command;
+    command.timeNs = timeNs;
+    command.type = SETTING;
+    command.direction = direction;
+    command.channel = channel;
+    command.name = key;
+    command.settingValue = value;
+    return command;
+}
+
+SoapySDR::CommandQueueStats::CommandQueueStats(void):
+    numQueued(0),
+    numOffloaded(0),
+    numApplied(0),
+    numLate(0),
+    numFailed(0),
+    numPending(0),
+    maxLateNs(0)
+{
+    return;
+}
+
 SoapySDR::ArgInfo::ArgInfo(void):
     type(SoapySDR::ArgInfo::Type::STRING)
 {
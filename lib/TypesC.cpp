@@ -137,4 +137,17 @@ void SoapySDRArgInfoList_clear(SoapySDRArgInfo *info, const size_t length)
     SoapySDR_free(info);
 }
 
+void SoapySDRGainTable_clear(SoapySDRGainTable *table)
+{
+    SoapySDRStrings_clear(&table->elements, table->numElements);
+    table->numElements = 0;
+
+    SoapySDR_free(table->gains);
+    table->gains = NULL;
+
+    SoapySDR_free(table->values);
+    table->values = NULL;
+    table->numRows = 0;
+}
+
 }
@@ -79,17 +79,39 @@ using System.Linq;"
 %ignore SoapySDR::Device::readStream;
 %ignore SoapySDR::Device::writeStream;
 %ignore SoapySDR::Device::readStreamStatus;
+%ignore SoapySDR::Device::captureSamples;
+%ignore SoapySDR::Device::getStreamStats;
+%ignore SoapySDR::Device::queueCommands;
+%ignore SoapySDR::Device::clearCommands;
+%ignore SoapySDR::Device::getCommandQueueStats;
+%ignore SoapySDR::Device::getGainTable;
+%ignore SoapySDR::Device::transactRegisters;
+%ignore SoapySDR::Device::transactRegistersAsync;
 %ignore SoapySDR::Device::getNumDirectAccessBuffers;
 %ignore SoapySDR::Device::getDirectAccessBufferAddrs;
 %ignore SoapySDR::Device::acquireReadBuffer;
 %ignore SoapySDR::Device::releaseReadBuffer;
 %ignore SoapySDR::Device::acquireWriteBuffer;
 %ignore SoapySDR::Device::releaseWriteBuffer;
+%ignore SoapySDR::Device::setupStreamTap;
+%ignore SoapySDR::Device::closeStreamTap;
+%ignore SoapySDR::Device::readStreamTap;
+%ignore SoapySDR::Device::acquireTapBuffer;
+%ignore SoapySDR::Device::releaseTapBuffer;
+%ignore SoapySDR::Device::getStreamTapDrops;
+%ignore SoapySDR::Device::prepareFrequencies;
+%ignore SoapySDR::Device::applyHop;
+%ignore SoapySDR::Device::closeHopTable;
+%ignore SoapySDR::Device::setupSweep;
+%ignore SoapySDR::Device::closeSweep;
+%ignore SoapySDR::Device::readSweep;
 
 // Ignore overloaded functions from default arguments
 %ignore SoapySDR::Device::readUART(const std::string &) const;
 
 // Don't wrap development-layer functions
+%ignore SoapySDR::Detail::TypedRead;
+%ignore SoapySDR::Detail::TypedWrite;
 %ignore SoapySDR::Device::getNativeDeviceHandle;
 
 // Per C# convention, convert trivial getters and setters to properties
@@ -308,6 +330,10 @@ using System.Linq;"
     /// <returns>The current value of the sensor</returns>
     public T ReadSensor<T>(string key)
     {
+        if (typeof(T) == typeof(bool)) return (T)(object)ReadSensorBool(key);
+        if (typeof(T) == typeof(int)) return (T)(object)checked((int)ReadSensorInt(key));
+        if (typeof(T) == typeof(long)) return (T)(object)ReadSensorInt(key);
+        if (typeof(T) == typeof(double)) return (T)(object)ReadSensorFloat(key);
         return (T)(new SoapyConvertible(ReadSensor(key)).ToType(typeof(T), null));
     }
 
@@ -321,6 +347,10 @@ using System.Linq;"
     /// <returns>The current value of the sensor</returns>
     public T ReadSensor<T>(Direction direction, uint channel, string key)
     {
+        if (typeof(T) == typeof(bool)) return (T)(object)ReadSensorBool(direction, channel, key);
+        if (typeof(T) == typeof(int)) return (T)(object)checked((int)ReadSensorInt(direction, channel, key));
+        if (typeof(T) == typeof(long)) return (T)(object)ReadSensorInt(direction, channel, key);
+        if (typeof(T) == typeof(double)) return (T)(object)ReadSensorFloat(direction, channel, key);
         return (T)(new SoapyConvertible(ReadSensor(direction, channel, key)).ToType(typeof(T), null));
     }
 
@@ -334,6 +364,10 @@ using System.Linq;"
     /// <returns>The setting value</returns>
     public T ReadSetting<T>(string key)
     {
+        if (typeof(T) == typeof(bool)) return (T)(object)ReadSettingBool(key);
+        if (typeof(T) == typeof(int)) return (T)(object)checked((int)ReadSettingInt(key));
+        if (typeof(T) == typeof(long)) return (T)(object)ReadSettingInt(key);
+        if (typeof(T) == typeof(double)) return (T)(object)ReadSettingFloat(key);
         return (T)(new SoapyConvertible(ReadSetting(key)).ToType(typeof(T), null));
     }
 
@@ -349,13 +383,18 @@ using System.Linq;"
     /// <returns>The setting value</returns>
     public T ReadSetting<T>(Direction direction, uint channel, string key)
     {
+        if (typeof(T) == typeof(bool)) return (T)(object)ReadSettingBool(direction, channel, key);
+        if (typeof(T) == typeof(int)) return (T)(object)checked((int)ReadSettingInt(direction, channel, key));
+        if (typeof(T) == typeof(long)) return (T)(object)ReadSettingInt(direction, channel, key);
+        if (typeof(T) == typeof(double)) return (T)(object)ReadSettingFloat(direction, channel, key);
         return (T)(new SoapyConvertible(ReadSetting(direction, channel, key)).ToType(typeof(T), null));
     }
 
     /// <summary>
     /// Write an arbitrary setting on the device, typecasted from the given type.
     ///
-    /// For bools and primitive numeric types, SoapySDR's internal type conversion is used.
+    /// Bools, ints, longs, and doubles are passed to the device natively.
+    /// For other primitive numeric types, SoapySDR's internal type conversion is used.
     /// Otherwise, the value of the input's ToString() will be passed in.
     /// </summary>
     /// <typeparam name="T">The type to cast the setting</typeparam>
@@ -363,13 +402,31 @@ using System.Linq;"
     /// <param name="value">The setting value</param>
     public void WriteSetting<T>(string key, T value)
     {
-        WriteSetting(key, new SoapyConvertible(value).ToString());
+        switch (value)
+        {
+            case bool boolValue:
+                WriteSettingBool(key, boolValue);
+                break;
+            case int intValue:
+                WriteSettingInt(key, intValue);
+                break;
+            case long longValue:
+                WriteSettingInt(key, longValue);
+                break;
+            case double doubleValue:
+                WriteSettingFloat(key, doubleValue);
+                break;
+            default:
+                WriteSetting(key, new SoapyConvertible(value).ToString());
+                break;
+        }
     }
 
     /// <summary>
     /// Write an arbitrary channel setting on the device, typecasted from the given type.
     ///
-    /// For bools and primitive numeric types, SoapySDR's internal type conversion is used.
+    /// Bools, ints, longs, and doubles are passed to the device natively.
+    /// For other primitive numeric types, SoapySDR's internal type conversion is used.
     /// Otherwise, the value of the input's ToString() will be passed in.
     /// </summary>
     /// <typeparam name="T">The type to cast the setting</typeparam>
@@ -379,7 +436,24 @@ using System.Linq;"
     /// <param name="value">The setting value</param>
     public void WriteSetting<T>(Direction direction, uint channel, string key, T value)
     {
-        WriteSetting(direction, channel, key, new SoapyConvertible(value).ToString());
+        switch (value)
+        {
+            case bool boolValue:
+                WriteSettingBool(direction, channel, key, boolValue);
+                break;
+            case int intValue:
+                WriteSettingInt(direction, channel, key, intValue);
+                break;
+            case long longValue:
+                WriteSettingInt(direction, channel, key, longValue);
+                break;
+            case double doubleValue:
+                WriteSettingFloat(direction, channel, key, doubleValue);
+                break;
+            default:
+                WriteSetting(direction, channel, key, new SoapyConvertible(value).ToString());
+                break;
+        }
     }
 
     //
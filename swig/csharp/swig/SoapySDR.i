@@ -81,6 +81,7 @@
 }
 
 %typemap(cstype) const std::vector<unsigned> &value "uint[]"
+%typemap(cstype) const std::vector<unsigned> &data "uint[]"
 %typemap(csin,
     pre="
         var temp$csinput = new UnsignedListInternal($csinput);
@@ -211,6 +212,7 @@ struct TypeConversionInternal
 %template(ArgInfoList) std::vector<SoapySDR::ArgInfo>;
 %template(KwargsList) std::vector<std::map<std::string, std::string>>;
 %template(RangeList) std::vector<SoapySDR::Range>;
+%template(I2CMessageList) std::vector<SoapySDR::I2CMessage>;
 
 ////////////////////////////////////////////////////////////////////////
 // Enforce C# naming conventions
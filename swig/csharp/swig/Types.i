@@ -146,4 +146,9 @@ public enum";
 %ignore SoapySDR::StringToSetting;
 %ignore SoapySDR::Detail::SettingToString;
 %ignore SoapySDR::Detail::StringToSetting;
+%ignore SoapySDR::StreamStats;
+%ignore SoapySDR::TimedCommand;
+%ignore SoapySDR::CommandQueueStats;
+%ignore SoapySDR::GainTable;
+%ignore SoapySDR::RegisterOp;
 %include <SoapySDR/Types.hpp>
\ No newline at end of file
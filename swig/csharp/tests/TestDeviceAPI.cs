@@ -149,12 +149,14 @@ public class TestDeviceAPI
 
         device.WriteI2C(0, "");
         Assert.AreEqual("", device.ReadI2C(0, 0));
+        Assert.AreEqual(2, device.TransactI2C(new Pothosware.SoapySDR.I2CMessageList { new Pothosware.SoapySDR.I2CMessage(0, ""), new Pothosware.SoapySDR.I2CMessage(0, 0) }).Count);
 
         //
         // SPI API
         //
 
         Assert.AreEqual(0, device.TransactSPI(0, 0, 0));
+        Assert.AreEqual(new uint[] { 0, 0 }, device.TransactSPIBatch(0, new uint[] { 0, 0 }, 0));
 
         //
         // UART API
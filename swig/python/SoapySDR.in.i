@@ -121,7 +121,11 @@ SoapySDR library: {2}""".format(COMPILE_ABI_VERSION, PYTHONLIB_ABI_VERSION, CORE
 %template(SoapySDRRangeList) std::vector<SoapySDR::Range>;
 %template(SoapySDRSizeList) std::vector<size_t>;
 %template(SoapySDRDoubleList) std::vector<double>;
+%template(SoapySDRULongLongList) std::vector<unsigned long long>;
 %template(SoapySDRDeviceList) std::vector<SoapySDR::Device *>;
+%template(SoapySDRRegisterOpList) std::vector<SoapySDR::RegisterOp>;
+%template(SoapySDRI2CMessageList) std::vector<SoapySDR::I2CMessage>;
+%template(SoapySDRTimedCommandList) std::vector<SoapySDR::TimedCommand>;
 
 %extend std::map<std::string, std::string>
 {
@@ -180,6 +184,34 @@ SoapySDR library: {2}""".format(COMPILE_ABI_VERSION, PYTHONLIB_ABI_VERSION, CORE
     %}
 };
 
+////////////////////////////////////////////////////////////////////////
+// Sweep result class
+// Helps us deal with sweep reads that return by reference
+////////////////////////////////////////////////////////////////////////
+%inline %{
+    struct SweepResult
+    {
+        SweepResult(void):
+            ret(0), flags(0), frequency(0.0), timeNs(0){}
+        int ret;
+        int flags;
+        double frequency;
+        long long timeNs;
+    };
+%}
+
+%extend SweepResult
+{
+    %insert("python")
+    %{
+        def __str__(self):
+            return "ret=%s, flags=%s, frequency=%s, timeNs=%s"%(self.ret, self.flags, self.frequency, self.timeNs)
+
+        def __repr__(self):
+            return self.__str__()
+    %}
+};
+
 ////////////////////////////////////////////////////////////////////////
 // Native stream format class
 // Allows proper wrapper for SoapySDR::Device::getNativeStreamFormat()
@@ -312,6 +344,9 @@ def registerLogHandler(handler):
 %ignore SoapySDR::Device::readStream;
 %ignore SoapySDR::Device::writeStream;
 %ignore SoapySDR::Device::readStreamStatus;
+%ignore SoapySDR::Device::captureSamples;
+%ignore SoapySDR::Device::readStreamTap;
+%ignore SoapySDR::Device::readSweep;
 
 // These have no meaning on this layer.
 %ignore SoapySDR::Device::getNumDirectAccessBuffers;
@@ -320,7 +355,10 @@ def registerLogHandler(handler):
 %ignore SoapySDR::Device::releaseReadBuffer;
 %ignore SoapySDR::Device::acquireWriteBuffer;
 %ignore SoapySDR::Device::releaseWriteBuffer;
+%ignore SoapySDR::Device::acquireTapBuffer;
+%ignore SoapySDR::Device::releaseTapBuffer;
 %ignore SoapySDR::Device::getNativeDeviceHandle;
+%ignore SoapySDR::Device::transactRegistersAsync;
 
 // SWIG warns that one parallel Device::make() function shadows another,
 // leading to the second being ignored. Despite this, SWIG generates both
@@ -356,16 +394,11 @@ def extractBuffPointer(buff):
 
 %extend SoapySDR::Device
 {
-    //additional overloads for writeSetting for basic types
+    //additional overloads for writeSetting for basic types,
+    //the typed reads such as readSettingInt() are wrapped directly
     %template(writeSetting) SoapySDR::Device::writeSetting<bool>;
     %template(writeSetting) SoapySDR::Device::writeSetting<double>;
     %template(writeSetting) SoapySDR::Device::writeSetting<long long>;
-    %template(readSensorBool) SoapySDR::Device::readSensor<bool>;
-    %template(readSensorInt) SoapySDR::Device::readSensor<long long>;
-    %template(readSensorFloat) SoapySDR::Device::readSensor<double>;
-    %template(readSettingBool) SoapySDR::Device::readSetting<bool>;
-    %template(readSettingInt) SoapySDR::Device::readSetting<long long>;
-    %template(readSettingFloat) SoapySDR::Device::readSetting<double>;
 
     NativeStreamFormat __getNativeStreamFormat(const int direction, const size_t channel)
     {
@@ -402,6 +435,29 @@ def extractBuffPointer(buff):
         return sr;
     }
 
+    int __captureSamples(const int direction, const std::vector<size_t> &channels, const std::string &format, const long long timeNs, const size_t numElems, const std::vector<size_t> &buffs, const long timeoutUs)
+    {
+        std::vector<void *> ptrs(buffs.size());
+        for (size_t i = 0; i < buffs.size(); i++) ptrs[i] = (void *)buffs[i];
+        return self->captureSamples(direction, channels, format, timeNs, numElems, (&ptrs[0]), timeoutUs);
+    }
+
+    StreamResult __readStreamTap(SoapySDR::StreamTap *tap, const std::vector<size_t> &buffs, const size_t numElems, const long timeoutUs)
+    {
+        StreamResult sr;
+        std::vector<void *> ptrs(buffs.size());
+        for (size_t i = 0; i < buffs.size(); i++) ptrs[i] = (void *)buffs[i];
+        sr.ret = self->readStreamTap(tap, (&ptrs[0]), numElems, sr.flags, sr.timeNs, timeoutUs);
+        return sr;
+    }
+
+    SweepResult __readSweep(SoapySDR::Sweep *sweep, const size_t buff, const long timeoutUs)
+    {
+        SweepResult sr;
+        sr.ret = self->readSweep(sweep, (void *)buff, sr.flags, sr.frequency, sr.timeNs, timeoutUs);
+        return sr;
+    }
+
     %insert("python")
     %{
         #manually unmake and flag for future calls and the deleter
@@ -479,5 +535,59 @@ def extractBuffPointer(buff):
             :returns any stream errors, plus other metadata
             """
             return self.__readStreamStatus(stream, timeoutUs)
+
+        def captureSamples(self, direction, channels, format, timeNs, numElems, buffs, timeoutUs = 100000):
+            r"""
+            Capture a finite number of samples at a given time into memory.
+            :type direction: int
+            :param direction: the channel direction (currently only RX)
+            :type channels: list
+            :param channels: a list of channels or empty for channel 0
+            :type format: str
+            :param format: the desired buffer format
+            :type timeNs: int
+            :param timeNs: the time of the first sample in nanoseconds, negative for immediately
+            :type numElems: int
+            :param numElems: the number of elements to capture per channel
+            :type buffs: numpy.ndarray
+            :param buffs: a 2D NumPy array of the buffer format type
+            :type timeoutUs: int
+            :param timeoutUs: the timeout in microseconds for each read
+            :rtype: int
+            :returns the number of elements captured or error code
+            """
+            ptrs = [extractBuffPointer(b) for b in buffs]
+            return self.__captureSamples(direction, channels, format, timeNs, numElems, ptrs, timeoutUs)
+
+        def readStreamTap(self, tap, buffs, numElems, timeoutUs = 100000):
+            r"""
+            Read elements published to a stream tap.
+            :type tap: SoapySDR.StreamTap
+            :param tap: SoapySDR stream tap handle
+            :type buffs: numpy.ndarray
+            :param buffs: a 2D NumPy array of the tapped stream type
+            :type numElems: int
+            :param numElems: the number of elements in each buffer
+            :type timeoutUs: int
+            :param timeoutUs: the timeout in microseconds
+            :rtype: SoapySDR.StreamResult
+            :returns the number of elements read per buffer, plus metadata
+            """
+            ptrs = [extractBuffPointer(b) for b in buffs]
+            return self.__readStreamTap(tap, ptrs, numElems, timeoutUs)
+
+        def readSweep(self, sweep, buff, timeoutUs = 100000):
+            r"""
+            Read the next segment of a sweep.
+            :type sweep: SoapySDR.Sweep
+            :param sweep: SoapySDR sweep handle
+            :type buff: numpy.ndarray
+            :param buff: a NumPy array of dwellElems in the sweep format
+            :type timeoutUs: int
+            :param timeoutUs: the timeout in microseconds for each stream read
+            :rtype: SoapySDR.SweepResult
+            :returns the number of elements read, plus the frequency and metadata
+            """
+            return self.__readSweep(sweep, extractBuffPointer(buff), timeoutUs)
     %}
 };
@@ -0,0 +1,210 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <string>
+#include <complex>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include <csignal>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "TestHelpers.hpp"
+
+static SoapySDR::Device *makeClient(const std::string &socket)
+{
+    //the broker process may still be starting
+    for (size_t i = 0; i < 100; i++)
+    {
+        try
+        {
+            return SoapySDR::Device::make("driver=broker,socket=" + socket);
+        }
+        catch (const std::exception &)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    }
+    return nullptr;
+}
+
+static bool testStream(SoapySDR::Device *device, const char *name)
+{
+    printf("Test shared stream in the %s...\n", name);
+    const double rate = device->getSampleRate(SOAPY_SDR_RX, 0);
+    std::vector<std::complex<float>> buff(1000);
+    void *buffs[] = {buff.data()};
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0});
+    CHECK(device->activateStream(stream) == 0);
+
+    int flags = 0;
+    long long timeNs = 0, expectedNs = 0;
+    for (size_t i = 0; i < 100; i++)
+    {
+        const int ret = device->readStream(stream, buffs, buff.size(), flags, timeNs);
+        CHECK(ret > 0);
+        CHECK((flags & SOAPY_SDR_HAS_TIME) != 0);
+        if (i != 0) CHECK(timeNs == expectedNs);
+        expectedNs = timeNs + SoapySDR::ticksToTimeNs(ret, rate);
+    }
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    return true;
+}
+
+static bool testDirectAccess(SoapySDR::Device *device)
+{
+    printf("Test a held buffer which the broker overwrites is an overflow...\n");
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CS16, {0});
+    CHECK(device->getNumDirectAccessBuffers(stream) != 0);
+    CHECK(device->activateStream(stream) == 0);
+
+    size_t handle = 0;
+    const void *buffs[1];
+    int flags = 0;
+    long long timeNs = 0;
+    CHECK(device->acquireReadBuffer(stream, handle, buffs, flags, timeNs) > 0);
+    device->releaseReadBuffer(stream, handle);
+
+    //held longer than the broker takes to wrap around the ring
+    CHECK(device->acquireReadBuffer(stream, handle, buffs, flags, timeNs) > 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    device->releaseReadBuffer(stream, handle);
+    CHECK(device->acquireReadBuffer(stream, handle, buffs, flags, timeNs) == SOAPY_SDR_OVERFLOW);
+    CHECK(device->acquireReadBuffer(stream, handle, buffs, flags, timeNs) > 0);
+    device->releaseReadBuffer(stream, handle);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    return true;
+}
+
+static bool testClient(const std::string &socket)
+{
+    auto device = makeClient(socket);
+    CHECK(device != nullptr);
+
+    printf("Test forwarded control calls...\n");
+    CHECK(device->getDriverKey() == "broker");
+    CHECK(device->getHardwareKey() == "sim");
+    device->setFrequency(SOAPY_SDR_RX, 0, 433.92e6);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 433.92e6);
+    bool threw = false;
+    try {device->setSampleRate(SOAPY_SDR_RX, 0, -1.0);}
+    catch (const std::exception &) {threw = true;}
+    CHECK(threw);
+
+    bool ok = testStream(device, "parent process");
+    ok = ok and testDirectAccess(device);
+    SoapySDR::Device::unmake(device);
+    return ok;
+}
+
+static bool testBadClient(const std::string &socket)
+{
+    printf("Test the socket is private and a client over the message limits is dropped...\n");
+    struct stat st;
+    CHECK(stat(socket.c_str(), &st) == 0);
+    CHECK((st.st_mode & (S_IRWXG | S_IRWXO)) == 0);
+
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socket.c_str(), sizeof(addr.sun_path)-1);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    CHECK(fd >= 0);
+    CHECK(connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0);
+
+    //a message with too many strings closes the connection
+    const uint32_t count = 0xffffffff;
+    CHECK(send(fd, &count, sizeof(count), 0) == ssize_t(sizeof(count)));
+    char byte(0);
+    CHECK(recv(fd, &byte, 1, 0) == 0);
+    close(fd);
+
+    //and the broker keeps serving
+    auto device = makeClient(socket);
+    CHECK(device != nullptr);
+    CHECK(device->getHardwareKey() == "sim");
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        printf("Usage: %s path/to/SoapySDRUtil\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const std::string socket = "/tmp/SoapySDRTestBroker." + std::to_string(getpid()) + ".sock";
+    const std::string brokerArg = "--broker=" + socket;
+
+    //the broker serves a simulated device in its own process
+    const pid_t broker = fork();
+    if (broker == 0)
+    {
+        execl(argv[1], argv[1], brokerArg.c_str(), "--args=driver=sim", static_cast<char *>(nullptr));
+        _exit(127);
+    }
+
+    //a second client process reads the same stream
+    const pid_t reader = fork();
+    if (reader == 0)
+    {
+        auto device = makeClient(socket);
+        const bool ok = device != nullptr and testStream(device, "child process");
+        if (device != nullptr) SoapySDR::Device::unmake(device);
+        fflush(stdout);
+        _exit(ok?EXIT_SUCCESS:EXIT_FAILURE);
+    }
+
+    bool ok = testClient(socket);
+    ok = ok and testBadClient(socket);
+
+    //a second broker does not take over the socket of a running broker
+    printf("Test a second broker on the same socket is refused...\n");
+    const pid_t second = fork();
+    if (second == 0)
+    {
+        execl(argv[1], argv[1], brokerArg.c_str(), "--args=driver=sim", static_cast<char *>(nullptr));
+        _exit(127);
+    }
+    int status = 0;
+    waitpid(second, &status, 0);
+    if (not WIFEXITED(status) or WEXITSTATUS(status) != EXIT_FAILURE)
+    {
+        printf("FAIL: second broker\n");
+        ok = false;
+    }
+
+    waitpid(reader, &status, 0);
+    if (not WIFEXITED(status) or WEXITSTATUS(status) != EXIT_SUCCESS)
+    {
+        printf("FAIL: reader process\n");
+        ok = false;
+    }
+
+    kill(broker, SIGINT);
+    waitpid(broker, &status, 0);
+    if (not WIFEXITED(status) or WEXITSTATUS(status) != EXIT_SUCCESS)
+    {
+        printf("FAIL: broker process\n");
+        ok = false;
+    }
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
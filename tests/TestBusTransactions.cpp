@@ -0,0 +1,145 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Device.h>
+#include <SoapySDR/Registry.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <string>
+#include "TestHelpers.hpp"
+
+//bus accesses made on the test driver
+static int numI2CCalls = 0;
+static int numSPICalls = 0;
+
+/*!
+ * A driver with an I2C memory, where a write sets the address pointer
+ * and stores any further bytes, and a SPI slave which reads back
+ * the inverse of the previous word. It implements only the single
+ * transaction calls, so the batched calls use the defaults.
+ */
+class BusTestDevice : public SoapySDR::Device
+{
+public:
+    BusTestDevice(void):
+        _memory(256, '\0'),
+        _pointer(0),
+        _lastWord(0)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "bustest";
+    }
+
+    void writeI2C(const int, const std::string &data)
+    {
+        numI2CCalls++;
+        if (data.empty()) return;
+        _pointer = (unsigned char)(data[0]);
+        for (size_t i = 1; i < data.size(); i++) _memory[(_pointer++) % _memory.size()] = data[i];
+    }
+
+    std::string readI2C(const int, const size_t numBytes)
+    {
+        numI2CCalls++;
+        std::string bytes;
+        for (size_t i = 0; i < numBytes; i++) bytes.push_back(_memory[(_pointer++) % _memory.size()]);
+        return bytes;
+    }
+
+    unsigned transactSPI(const int, const unsigned data, const size_t numBits)
+    {
+        numSPICalls++;
+        const unsigned readback = ~_lastWord & ((1u << numBits) - 1);
+        _lastWord = data;
+        return readback;
+    }
+
+private:
+    std::string _memory;
+    size_t _pointer;
+    unsigned _lastWord;
+};
+
+static SoapySDR::KwargsList findBusTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "bustest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeBusTest(const SoapySDR::Kwargs &)
+{
+    return new BusTestDevice();
+}
+
+static SoapySDR::Registry registerBusTest("bustest", &findBusTest, &makeBusTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testI2C(SoapySDR::Device *device)
+{
+    printf("Test an I2C write then read transaction...\n");
+    numI2CCalls = 0;
+    SoapySDR::I2CMessageList messages;
+    messages.emplace_back(0x50, std::string("\x10hello", 6));
+    messages.emplace_back(0x50, std::string("\x12", 1));
+    messages.emplace_back(0x50, size_t(3));
+    const auto results = device->transactI2C(messages);
+    CHECK(results.size() == 3);
+    CHECK(results[0].empty());
+    CHECK(results[1].empty());
+    CHECK(results[2] == "llo");
+    CHECK(numI2CCalls == 3);
+    return true;
+}
+
+static bool testSPI(SoapySDR::Device *device)
+{
+    printf("Test a batch of SPI words...\n");
+    numSPICalls = 0;
+    const auto readback = device->transactSPIBatch(0, {0x000001, 0x000002, 0x0000f0}, 24);
+    CHECK(readback.size() == 3);
+    CHECK(readback[1] == 0xfffffe);
+    CHECK(readback[2] == 0xfffffd);
+    CHECK(numSPICalls == 3);
+    return true;
+}
+
+static bool testCAPI(SoapySDR::Device *device)
+{
+    printf("Test the C API...\n");
+    auto cdevice = reinterpret_cast<SoapySDRDevice *>(device);
+
+    char writeData[] = {0x20, 'a', 'b', 'c'};
+    char setPointer[] = {0x21};
+    char readData[8] = {};
+    SoapySDRI2CMessage messages[3];
+    messages[0].addr = 0x50; messages[0].read = false; messages[0].data = writeData; messages[0].numBytes = sizeof(writeData);
+    messages[1].addr = 0x50; messages[1].read = false; messages[1].data = setPointer; messages[1].numBytes = sizeof(setPointer);
+    messages[2].addr = 0x50; messages[2].read = true; messages[2].data = readData; messages[2].numBytes = 2;
+    CHECK(SoapySDRDevice_transactI2C(cdevice, messages, 3) == 0);
+    CHECK(messages[2].numBytes == 2);
+    CHECK(std::string(readData) == "bc");
+
+    const unsigned words[] = {0x0f, 0x03};
+    unsigned readback[2] = {};
+    CHECK(SoapySDRDevice_transactSPIBatch(cdevice, 0, words, readback, 2, 8) == 0);
+    CHECK(readback[1] == 0xf0);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=bustest");
+
+    bool ok = testI2C(device);
+    ok = ok and testSPI(device);
+    ok = ok and testCAPI(device);
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
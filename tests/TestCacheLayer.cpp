@@ -0,0 +1,247 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <map>
+#include <string>
+#include "TestHelpers.hpp"
+
+/*!
+ * A driver with a hardware clock set by the test, where frequencies
+ * set with a command time or queued take effect at that time.
+ * The gain range follows the antenna and the sample rate range
+ * follows the master clock rate.
+ */
+class CacheTestDevice : public SoapySDR::Device
+{
+public:
+    CacheTestDevice(void):
+        timeNs(0),
+        _commandTimeNs(0),
+        _frequency(0.0),
+        _antenna("A"),
+        _clockRate(10e6)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "cachetest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    bool hasHardwareTime(const std::string &) const
+    {
+        return true;
+    }
+
+    long long getHardwareTime(const std::string &) const
+    {
+        return timeNs;
+    }
+
+    void setHardwareTime(const long long time, const std::string &what)
+    {
+        if (what == "CMD") _commandTimeNs = time;
+        else timeNs = time;
+    }
+
+    void setFrequency(const int, const size_t, const double frequency, const SoapySDR::Kwargs &)
+    {
+        if (_commandTimeNs == 0) _frequency = frequency;
+        else _pending.emplace(_commandTimeNs, frequency);
+    }
+
+    double getFrequency(const int, const size_t) const
+    {
+        while (not _pending.empty() and _pending.begin()->first <= timeNs)
+        {
+            _frequency = _pending.begin()->second;
+            _pending.erase(_pending.begin());
+        }
+        return _frequency;
+    }
+
+    size_t queueCommands(const SoapySDR::TimedCommandList &commands)
+    {
+        for (const auto &command : commands) _pending.emplace(command.timeNs, command.value);
+        return commands.size();
+    }
+
+    void setAntenna(const int, const size_t, const std::string &name)
+    {
+        _antenna = name;
+    }
+
+    std::string getAntenna(const int, const size_t) const
+    {
+        return _antenna;
+    }
+
+    SoapySDR::Range getGainRange(const int, const size_t) const
+    {
+        return SoapySDR::Range(0.0, (_antenna == "A")?30.0:60.0);
+    }
+
+    void setMasterClockRate(const double rate)
+    {
+        _clockRate = rate;
+    }
+
+    double getMasterClockRate(void) const
+    {
+        return _clockRate;
+    }
+
+    SoapySDR::RangeList getSampleRateRange(const int, const size_t) const
+    {
+        return {SoapySDR::Range(0.0, _clockRate)};
+    }
+
+    long long timeNs;
+
+private:
+    long long _commandTimeNs;
+    mutable double _frequency;
+    mutable std::multimap<long long, double> _pending;
+    std::string _antenna;
+    double _clockRate;
+};
+
+static CacheTestDevice *lastDevice = nullptr;
+
+static SoapySDR::KwargsList findCacheTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "cachetest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeCacheTest(const SoapySDR::Kwargs &)
+{
+    lastDevice = new CacheTestDevice();
+    return lastDevice;
+}
+
+static SoapySDR::Registry registerCacheTest("cachetest", &findCacheTest, &makeCacheTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testCapabilities(SoapySDR::Device *device)
+{
+    printf("Test capability queries are cached...\n");
+    const auto ranges = device->getFrequencyRange(SOAPY_SDR_RX, 0);
+    for (size_t i = 0; i < 99; i++) CHECK(device->getFrequencyRange(SOAPY_SDR_RX, 0).size() == ranges.size());
+    for (size_t i = 0; i < 10; i++) device->listGains(SOAPY_SDR_RX, 0);
+    CHECK(driverCalls(device, "getFrequencyRange") == 1);
+    CHECK(driverCalls(device, "listGains") == 1);
+
+    const auto stats = device->readSetting("cache_stats");
+    printf("%s\n", stats.c_str());
+    CHECK(jsonCount(stats, "getFrequencyRange", "hits") == 99);
+    CHECK(jsonCount(stats, "getFrequencyRange", "misses") == 1);
+
+    device->writeSetting("cache_invalidate", "true");
+    device->getFrequencyRange(SOAPY_SDR_RX, 0);
+    CHECK(driverCalls(device, "getFrequencyRange") == 2);
+    return true;
+}
+
+static bool testState(SoapySDR::Device *device)
+{
+    printf("Test state getters follow the setters...\n");
+    device->setFrequency(SOAPY_SDR_RX, 0, 100e6);
+    const int before = driverCalls(device, "getFrequency");
+    for (size_t i = 0; i < 10; i++) CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 100e6);
+    CHECK(driverCalls(device, "getFrequency") == before + 1);
+
+    device->setFrequency(SOAPY_SDR_RX, 0, 200e6);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 200e6);
+    CHECK(driverCalls(device, "getFrequency") == before + 2);
+
+    //a sample rate change may move the frequency and bandwidth
+    device->getBandwidth(SOAPY_SDR_RX, 0);
+    const int bandwidthCalls = driverCalls(device, "getBandwidth");
+    device->setSampleRate(SOAPY_SDR_RX, 0, 2e6);
+    CHECK(device->getSampleRate(SOAPY_SDR_RX, 0) == 2e6);
+    device->getFrequency(SOAPY_SDR_RX, 0);
+    device->getBandwidth(SOAPY_SDR_RX, 0);
+    CHECK(driverCalls(device, "getFrequency") == before + 3);
+    CHECK(driverCalls(device, "getBandwidth") == bandwidthCalls + 1);
+
+    printf("Test excluded methods are not cached...\n");
+    const int gainCalls = driverCalls(device, "getGain");
+    for (size_t i = 0; i < 5; i++) device->getGain(SOAPY_SDR_RX, 0);
+    CHECK(driverCalls(device, "getGain") == gainCalls + 5);
+    return true;
+}
+
+static bool testTimedChanges(void)
+{
+    printf("Test state is not cached while timed changes are pending...\n");
+    auto device = SoapySDR::Device::make("driver=cachetest,cache=1");
+    auto driver = lastDevice;
+    device->setFrequency(SOAPY_SDR_RX, 0, 100e6);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 100e6);
+
+    //a timed commit
+    device->beginConfig();
+    device->setFrequency(SOAPY_SDR_RX, 0, 200e6);
+    device->commitConfig(1000);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 100e6);
+    driver->timeNs = 2000;
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 200e6);
+
+    //a timed hop
+    auto table = device->prepareFrequencies(SOAPY_SDR_RX, 0, {300e6, 400e6});
+    device->applyHop(table, 1, 3000);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 200e6);
+    driver->timeNs = 4000;
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 400e6);
+    device->closeHopTable(table);
+
+    //commands queued in the driver
+    SoapySDR::TimedCommandList commands;
+    commands.push_back(SoapySDR::TimedCommand::frequency(5000, SOAPY_SDR_RX, 0, 500e6));
+    CHECK(device->queueCommands(commands) == 1);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 400e6);
+    driver->timeNs = 6000;
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 500e6);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testStateRanges(void)
+{
+    printf("Test ranges which follow the state are refreshed by its setters...\n");
+    auto device = SoapySDR::Device::make("driver=cachetest,cache=1");
+    CHECK(device->getGainRange(SOAPY_SDR_RX, 0).maximum() == 30.0);
+    device->setAntenna(SOAPY_SDR_RX, 0, "B");
+    CHECK(device->getGainRange(SOAPY_SDR_RX, 0).maximum() == 60.0);
+
+    CHECK(device->getSampleRateRange(SOAPY_SDR_RX, 0).front().maximum() == 10e6);
+    device->setMasterClockRate(20e6);
+    CHECK(device->getSampleRateRange(SOAPY_SDR_RX, 0).front().maximum() == 20e6);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=sim,clock=virtual,trace=1,cache=1,cache_exclude=getGain");
+
+    bool ok = testCapabilities(device);
+    ok = ok and testState(device);
+    SoapySDR::Device::unmake(device);
+    ok = ok and testTimedChanges();
+    ok = ok and testStateRanges();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <complex>
+#include <vector>
+#include "TestHelpers.hpp"
+
+static const size_t NUM_CHANS = 8;
+static const double CHAN_RATE = 250e3;
+static const double CENTER_FREQ = 100e6;
+
+static double power(const std::vector<std::complex<float>> &buff, const size_t num)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < num; i++) sum += std::norm(buff[i]);
+    return sum/num;
+}
+
+static bool testChannelizer(SoapySDR::Device *device, SoapySDR::Device *wideband)
+{
+    printf("Test virtual channels and tuning...\n");
+    CHECK(device != wideband);
+    CHECK(device->getNumChannels(SOAPY_SDR_RX) == NUM_CHANS);
+    device->setSampleRate(SOAPY_SDR_RX, 0, CHAN_RATE);
+    CHECK(device->getSampleRate(SOAPY_SDR_RX, 3) == CHAN_RATE);
+    CHECK(device->getBandwidth(SOAPY_SDR_RX, 3) == CHAN_RATE);
+    device->setFrequency(SOAPY_SDR_RX, 0, "RF", CENTER_FREQ);
+    device->setFrequency(SOAPY_SDR_RX, 0, CENTER_FREQ - 2*CHAN_RATE + 10e3); //snaps to the channel center
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == CENTER_FREQ - 2*CHAN_RATE);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 1) == CENTER_FREQ + CHAN_RATE);
+
+    //a tone two channels below the center, inside channel 0 only
+    device->writeSetting("noise_ampl", "0");
+    device->writeSetting("tone_freq", SoapySDR::SettingToString(-2*CHAN_RATE + 20e3));
+
+    printf("Test channel isolation and timestamps...\n");
+    std::vector<std::complex<float>> buff0(1000), buff1(1000);
+    void *buffs[] = {buff0.data(), buff1.data()};
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0, 1});
+    CHECK(device->activateStream(stream) == 0);
+
+    int flags = 0;
+    long long timeNs = 0, expectedNs = 0;
+    double power0 = 0.0, power1 = 0.0;
+    for (size_t i = 0; i < 20; i++)
+    {
+        const int ret = device->readStream(stream, buffs, buff0.size(), flags, timeNs);
+        CHECK(ret > 0);
+        CHECK((flags & SOAPY_SDR_HAS_TIME) != 0);
+        if (i != 0) CHECK(timeNs == expectedNs);
+        expectedNs = timeNs + SoapySDR::ticksToTimeNs(ret, CHAN_RATE);
+        if (i < 5) continue; //filter startup
+        power0 += power(buff0, ret);
+        power1 += power(buff1, ret);
+    }
+    printf("  channel 0 power %g, channel 1 power %g\n", power0, power1);
+    CHECK(power0 > 1000*power1);
+
+    printf("Test shared rates and tuning outside of the capture are rejected...\n");
+    bool threw = false;
+    try {device->setSampleRate(SOAPY_SDR_RX, 1, 2*CHAN_RATE);}
+    catch (const std::invalid_argument &){threw = true;}
+    CHECK(threw);
+    device->setSampleRate(SOAPY_SDR_RX, 1, CHAN_RATE);
+    CHECK(device->getSampleRate(SOAPY_SDR_RX, 0) == CHAN_RATE);
+    threw = false;
+    try {device->setFrequency(SOAPY_SDR_RX, 1, CENTER_FREQ + NUM_CHANS*CHAN_RATE);}
+    catch (const std::out_of_range &){threw = true;}
+    CHECK(threw);
+    device->setFrequency(SOAPY_SDR_RX, 1, CENTER_FREQ, {{"CH", "IGNORE"}});
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 1) == CENTER_FREQ + CHAN_RATE);
+
+    printf("Test retuning while streaming...\n");
+    device->setFrequency(SOAPY_SDR_RX, 1, "CH", -2*CHAN_RATE);
+    for (size_t i = 0; i < 5; i++) CHECK(device->readStream(stream, buffs, buff0.size(), flags, timeNs) > 0);
+    const int ret = device->readStream(stream, buffs, buff0.size(), flags, timeNs);
+    CHECK(ret > 0);
+    CHECK(buff0 == buff1);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=sim,clock=virtual,channelizer=8");
+    auto wideband = SoapySDR::Device::make("driver=sim,clock=virtual");
+
+    const bool ok = testChannelizer(device, wideband);
+    SoapySDR::Device::unmake(wideband);
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,201 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TestHelpers.hpp"
+
+//a frequency set on the test driver with the command time when it was set
+struct TimedCall
+{
+    double frequency;
+    long long commandTimeNs;
+};
+
+/*!
+ * A driver which supports command times and records
+ * the command time of each frequency which is set.
+ */
+class CommandTimeTestDevice : public SoapySDR::Device
+{
+public:
+    CommandTimeTestDevice(void):
+        clockTimeNs(0),
+        _commandTimeNs(0)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "cmdtimetest";
+    }
+
+    bool hasHardwareTime(const std::string &what) const
+    {
+        return what.empty() or what == "CMD";
+    }
+
+    void setHardwareTime(const long long timeNs, const std::string &what)
+    {
+        if (what == "CMD") _commandTimeNs = timeNs;
+        else clockTimeNs = timeNs;
+    }
+
+    void setFrequency(const int, const size_t, const double frequency, const SoapySDR::Kwargs &)
+    {
+        calls.push_back({frequency, _commandTimeNs});
+    }
+
+    long long clockTimeNs;
+    std::vector<TimedCall> calls;
+
+private:
+    long long _commandTimeNs;
+};
+
+static CommandTimeTestDevice *lastDevice = nullptr;
+
+static SoapySDR::KwargsList findCommandTimeTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "cmdtimetest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeCommandTimeTest(const SoapySDR::Kwargs &)
+{
+    lastDevice = new CommandTimeTestDevice();
+    return lastDevice;
+}
+
+static SoapySDR::Registry registerCommandTimeTest("cmdtimetest", &findCommandTimeTest, &makeCommandTimeTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testCommit(SoapySDR::Device *device)
+{
+    printf("Test queued setters are applied on commit...\n");
+    device->setFrequency(SOAPY_SDR_RX, 0, 100e6);
+    device->setGain(SOAPY_SDR_RX, 0, 10.0);
+    device->writeSetting("trace_reset", "true");
+
+    device->beginConfig();
+    device->setFrequency(SOAPY_SDR_RX, 0, 200e6);
+    device->setGain(SOAPY_SDR_RX, 0, 20.0);
+    device->setSampleRate(SOAPY_SDR_RX, 0, 2e6);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 100e6);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0) == 10.0);
+    CHECK(driverCalls(device, "setFrequency") == 0);
+
+    //the sim has no command times, so a timed commit fails and leaves the transaction open
+    const long long timeNs = 5000000000;
+    device->setHardwareTime(timeNs);
+    bool threw = false;
+    try {device->commitConfig(timeNs + 1000000000);}
+    catch (const std::runtime_error &){threw = true;}
+    CHECK(threw);
+    CHECK(driverCalls(device, "setHardwareTime") == 1);
+
+    device->commitConfig();
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 200e6);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0) == 20.0);
+    CHECK(device->getSampleRate(SOAPY_SDR_RX, 0) == 2e6);
+    CHECK(driverCalls(device, "beginConfig") == 1);
+    CHECK(driverCalls(device, "commitConfig") == 1);
+    CHECK(device->getHardwareTime() >= timeNs);
+
+    printf("Test setters outside of a transaction are immediate...\n");
+    device->setFrequency(SOAPY_SDR_RX, 0, 300e6);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 300e6);
+    return true;
+}
+
+static bool testCancel(SoapySDR::Device *device)
+{
+    printf("Test cancel discards the queued setters...\n");
+    device->beginConfig();
+    device->setFrequency(SOAPY_SDR_RX, 0, 400e6);
+    device->cancelConfig();
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 300e6);
+
+    printf("Test transaction misuse throws...\n");
+    bool threw = false;
+    try {device->commitConfig();}
+    catch (const std::exception &){threw = true;}
+    CHECK(threw);
+
+    device->beginConfig();
+    threw = false;
+    try {device->beginConfig();}
+    catch (const std::exception &){threw = true;}
+    CHECK(threw);
+    device->cancelConfig();
+    return true;
+}
+
+static bool testOtherThread(SoapySDR::Device *device)
+{
+    printf("Test setters of other threads are not queued...\n");
+    device->beginConfig();
+    device->setFrequency(SOAPY_SDR_RX, 0, 500e6);
+    std::thread([device]{device->setGain(SOAPY_SDR_RX, 0, 30.0);}).join();
+    CHECK(device->getGain(SOAPY_SDR_RX, 0) == 30.0);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 300e6);
+
+    //another thread has no transaction to commit, but can open its own
+    bool threw = false;
+    std::thread([device, &threw]
+    {
+        try {device->commitConfig();}
+        catch (const std::exception &){threw = true;}
+        device->beginConfig();
+        device->setGain(SOAPY_SDR_RX, 0, 40.0);
+        device->commitConfig();
+    }).join();
+    CHECK(threw);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0) == 40.0);
+
+    device->commitConfig();
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == 500e6);
+    return true;
+}
+
+static bool testTimedCommit(void)
+{
+    printf("Test a timed commit sets the command time around the calls...\n");
+    auto device = SoapySDR::Device::make("driver=cmdtimetest");
+    auto driver = lastDevice;
+    driver->clockTimeNs = 1000;
+    device->beginConfig();
+    device->setFrequency(SOAPY_SDR_RX, 0, 100e6);
+    device->setFrequency(SOAPY_SDR_RX, 0, 200e6);
+    device->commitConfig(5000000);
+    device->setFrequency(SOAPY_SDR_RX, 0, 300e6);
+
+    CHECK(driver->calls.size() == 3);
+    CHECK(driver->calls[0].commandTimeNs == 5000000);
+    CHECK(driver->calls[1].commandTimeNs == 5000000);
+    CHECK(driver->calls[2].commandTimeNs == 0);
+    CHECK(driver->clockTimeNs == 1000);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=sim,clock=virtual,trace=1");
+
+    bool ok = testCommit(device);
+    ok = ok and testCancel(device);
+    ok = ok and testOtherThread(device);
+    SoapySDR::Device::unmake(device);
+    ok = ok and testTimedCommit();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <complex>
+#include <vector>
+#include "TestHelpers.hpp"
+
+static const double RATE = 1e6;
+static const long long EPOCH_NS = 1767225600000000000ll; //2026-01-01T00:00:00Z
+
+static bool testRecord(void)
+{
+    printf("Test record to a sparse SigMF file...\n");
+    auto device = SoapySDR::Device::make("driver=file,tx_file=TestFileDevice.sigmf-data,pace=fast");
+    device->setSampleRate(SOAPY_SDR_TX, 0, RATE);
+    auto stream = device->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CS16);
+    CHECK(device->activateStream(stream, SOAPY_SDR_HAS_TIME, EPOCH_NS) == 0);
+
+    //two bursts with a hole of 1000 elements between them
+    std::vector<std::complex<int16_t>> buff(1000);
+    for (size_t i = 0; i < buff.size(); i++) buff[i] = std::complex<int16_t>(int16_t(i), int16_t(-int(i)));
+    const void *buffs[] = {buff.data()};
+    int flags = SOAPY_SDR_HAS_TIME;
+    CHECK(device->writeStream(stream, buffs, buff.size(), flags, EPOCH_NS) == 1000);
+    flags = SOAPY_SDR_HAS_TIME;
+    CHECK(device->writeStream(stream, buffs, buff.size(), flags, EPOCH_NS + SoapySDR::ticksToTimeNs(2000, RATE)) == 1000);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testReplay(void)
+{
+    printf("Test replay of the SigMF file...\n");
+    auto device = SoapySDR::Device::make("driver=file,file=TestFileDevice.sigmf-meta,pace=fast");
+    CHECK(device->getSampleRate(SOAPY_SDR_RX, 0) == RATE);
+    double fullScale = 0.0;
+    CHECK(device->getNativeStreamFormat(SOAPY_SDR_RX, 0, fullScale) == SOAPY_SDR_CS16);
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CS16, {0}, {{"bufflen", "500"}});
+    CHECK(device->getNumDirectAccessBuffers(stream) == 6);
+    CHECK(device->activateStream(stream) == 0);
+
+    //zero-copy buffers point into the mapping with timestamps from the metadata
+    size_t handle = 0;
+    const void *buffs[1];
+    int flags = 0;
+    long long timeNs = 0;
+    for (size_t i = 0; i < 6; i++)
+    {
+        CHECK(device->acquireReadBuffer(stream, handle, buffs, flags, timeNs) == 500);
+        CHECK(handle == i);
+        CHECK(timeNs == EPOCH_NS + SoapySDR::ticksToTimeNs(i*500, RATE));
+        void *addrs[1];
+        CHECK(device->getDirectAccessBufferAddrs(stream, handle, addrs) == 0);
+        CHECK(addrs[0] == buffs[0]);
+        const auto p = reinterpret_cast<const std::complex<int16_t> *>(buffs[0]);
+        if (i == 2 or i == 3) CHECK(p[7] == std::complex<int16_t>()); //the hole reads back zeros
+        if (i == 5) CHECK(p[7] == std::complex<int16_t>(507, -507));
+        device->releaseReadBuffer(stream, handle);
+    }
+    CHECK((flags & SOAPY_SDR_END_BURST) != 0);
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+
+    printf("Test timed replay with conversion...\n");
+    stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32);
+    CHECK(device->getNumDirectAccessBuffers(stream) == 0);
+    CHECK(device->activateStream(stream, SOAPY_SDR_HAS_TIME, EPOCH_NS + SoapySDR::ticksToTimeNs(2010, RATE)) == 0);
+    std::vector<std::complex<float>> buff(100);
+    void *outs[] = {buff.data()};
+    CHECK(device->readStream(stream, outs, buff.size(), flags, timeNs) == 100);
+    CHECK(timeNs == EPOCH_NS + SoapySDR::ticksToTimeNs(2010, RATE));
+    CHECK(std::abs(buff[0].real() - 10.0f/32768) < 1e-6f);
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = testRecord();
+    ok = ok and testReplay();
+    std::remove("TestFileDevice.sigmf-data");
+    std::remove("TestFileDevice.sigmf-meta");
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
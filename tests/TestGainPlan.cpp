@@ -0,0 +1,232 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+#include "TestHelpers.hpp"
+
+//calls made to the test driver
+static int numRangeCalls = 0;
+static int numElementWrites = 0;
+
+/*!
+ * A driver with two gain elements which uses the default overall gain
+ * algorithm, or provides a gain table when made with table=1.
+ * The VGA range is smaller on antenna B.
+ * It has two frequency bands and a hop table which does nothing.
+ */
+class GainTestDevice : public SoapySDR::Device
+{
+public:
+    GainTestDevice(const SoapySDR::Kwargs &args):
+        _table(args.count("table") != 0 and args.at("table") == "1"),
+        _antenna("A")
+    {
+        _gains["LNA"] = 0.0;
+        _gains["VGA"] = 0.0;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "gaintest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    std::vector<std::string> listAntennas(const int, const size_t) const
+    {
+        return {"A", "B"};
+    }
+
+    void setAntenna(const int, const size_t, const std::string &name)
+    {
+        _antenna = name;
+    }
+
+    std::vector<std::string> listGains(const int, const size_t) const
+    {
+        return {"LNA", "VGA"};
+    }
+
+    void setGain(const int, const size_t, const std::string &name, const double value)
+    {
+        numElementWrites++;
+        _gains[name] = value;
+    }
+
+    double getGain(const int, const size_t, const std::string &name) const
+    {
+        return _gains.at(name);
+    }
+
+    SoapySDR::Range getGainRange(const int, const size_t, const std::string &name) const
+    {
+        numRangeCalls++;
+        if (name == "LNA") return SoapySDR::Range(0.0, 30.0);
+        return SoapySDR::Range(0.0, (_antenna == "A")?40.0:20.0);
+    }
+
+    SoapySDR::RangeList getFrequencyRange(const int, const size_t) const
+    {
+        return {SoapySDR::Range(100e6, 200e6), SoapySDR::Range(400e6, 500e6)};
+    }
+
+    SoapySDR::HopTable *prepareFrequencies(const int, const size_t, const std::vector<double> &frequencies, const SoapySDR::Kwargs &)
+    {
+        return reinterpret_cast<SoapySDR::HopTable *>(new std::vector<double>(frequencies));
+    }
+
+    void applyHop(SoapySDR::HopTable *, const size_t, const long long)
+    {
+        return;
+    }
+
+    void closeHopTable(SoapySDR::HopTable *table)
+    {
+        delete reinterpret_cast<std::vector<double> *>(table);
+    }
+
+    SoapySDR::GainTable getGainTable(const int, const size_t) const
+    {
+        SoapySDR::GainTable table;
+        if (not _table) return table;
+        table.elements = {"LNA", "VGA"};
+        table.gains = {0.0, 10.0, 20.0, 30.0};
+        table.values = {0.0, 0.0, 10.0, 0.0, 10.0, 10.0, 20.0, 10.0};
+        return table;
+    }
+
+private:
+    const bool _table;
+    std::string _antenna;
+    std::map<std::string, double> _gains;
+};
+
+static SoapySDR::KwargsList findGainTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "gaintest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeGainTest(const SoapySDR::Kwargs &args)
+{
+    return new GainTestDevice(args);
+}
+
+static SoapySDR::Registry registerGainTest("gaintest", &findGainTest, &makeGainTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testPlan(void)
+{
+    printf("Test the gain plan is cached...\n");
+    auto device = SoapySDR::Device::make("driver=gaintest");
+    numRangeCalls = 0;
+    for (size_t i = 0; i < 100; i++) device->setGain(SOAPY_SDR_RX, 0, double(i % 70));
+    device->setGain(SOAPY_SDR_RX, 0, 45.0);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0, "LNA") == 30.0);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0, "VGA") == 15.0);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0) == 45.0);
+    CHECK(device->getGainRange(SOAPY_SDR_RX, 0).maximum() == 70.0);
+    CHECK(numRangeCalls == 2);
+
+    printf("Test an antenna change rebuilds the plan...\n");
+    device->setAntenna(SOAPY_SDR_RX, 0, "B");
+    device->setGain(SOAPY_SDR_RX, 0, 10.0);
+    CHECK(numRangeCalls == 4);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testHops(void)
+{
+    printf("Test only hops into another band rebuild the plan...\n");
+    auto device = SoapySDR::Device::make("driver=gaintest,id=1");
+    auto other = SoapySDR::Device::make("driver=gaintest,id=2");
+    numRangeCalls = 0;
+    device->setGain(SOAPY_SDR_RX, 0, 10.0);
+    CHECK(numRangeCalls == 2);
+
+    auto table = device->prepareFrequencies(SOAPY_SDR_RX, 0, {150e6, 160e6, 450e6});
+    device->applyHop(table, 0);
+    device->applyHop(table, 1);
+    device->setGain(SOAPY_SDR_RX, 0, 20.0);
+    CHECK(numRangeCalls == 2);
+    device->applyHop(table, 2);
+    device->setGain(SOAPY_SDR_RX, 0, 30.0);
+    CHECK(numRangeCalls == 4);
+    device->closeHopTable(table);
+
+    printf("Test a change on another device keeps the plan...\n");
+    other->setAntenna(SOAPY_SDR_RX, 0, "B");
+    device->setGain(SOAPY_SDR_RX, 0, 40.0);
+    CHECK(numRangeCalls == 4);
+    SoapySDR::Device::unmake(other);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testDirect(void)
+{
+    printf("Test changes made on the driver directly are seen by the plan...\n");
+    GainTestDevice gainTest({});
+    SoapySDR::Device &driver = gainTest;
+    driver.setGain(SOAPY_SDR_RX, 0, 70.0);
+    CHECK(driver.getGain(SOAPY_SDR_RX, 0, "VGA") == 40.0);
+    driver.setAntenna(SOAPY_SDR_RX, 0, "B");
+    driver.setGain(SOAPY_SDR_RX, 0, 70.0);
+    CHECK(driver.getGain(SOAPY_SDR_RX, 0, "VGA") == 20.0);
+    CHECK(driver.getGainRange(SOAPY_SDR_RX, 0).maximum() == 50.0);
+    return true;
+}
+
+static bool testTable(void)
+{
+    printf("Test table-driven gain writes...\n");
+    auto device = SoapySDR::Device::make("driver=gaintest,table=1");
+    CHECK(device->getGainRange(SOAPY_SDR_RX, 0).maximum() == 30.0);
+
+    numElementWrites = 0;
+    device->setGain(SOAPY_SDR_RX, 0, 20.0);
+    CHECK(numElementWrites == 2);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0, "LNA") == 10.0);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0, "VGA") == 10.0);
+
+    //one element changes between these rows
+    device->setGain(SOAPY_SDR_RX, 0, 35.0);
+    CHECK(numElementWrites == 3);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0) == 30.0);
+
+    //a request between rows selects the row below it
+    device->setGain(SOAPY_SDR_RX, 0, 25.0);
+    CHECK(numElementWrites == 4);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0) == 20.0);
+    device->setGain(SOAPY_SDR_RX, 0, 22.0);
+    CHECK(numElementWrites == 4);
+
+    //an element write makes the next overall gain write every element
+    device->setGain(SOAPY_SDR_RX, 0, "VGA", 5.0);
+    device->setGain(SOAPY_SDR_RX, 0, 20.0);
+    CHECK(numElementWrites == 7);
+    CHECK(device->getGain(SOAPY_SDR_RX, 0, "VGA") == 10.0);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = testPlan();
+    ok = ok and testHops();
+    ok = ok and testDirect();
+    ok = ok and testTable();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
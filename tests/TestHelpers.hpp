@@ -0,0 +1,29 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Device.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <string>
+
+//fail the calling test function with the condition and line
+#define CHECK(cond) \
+    if (not (cond)) {printf("FAIL: %s line %d\n", #cond, __LINE__); return false;}
+
+//a counter of a method in a statistics JSON object, or -1 when missing
+static inline int jsonCount(const std::string &json, const std::string &method, const std::string &counter)
+{
+    const auto pos = json.find("\"" + method + "\": {");
+    if (pos == std::string::npos) return -1;
+    const auto field = json.find("\"" + counter + "\": ", pos);
+    if (field == std::string::npos) return -1;
+    return std::atoi(json.c_str() + field + counter.size() + 4);
+}
+
+//the number of calls which reached the driver, counted by the trace layer
+static inline int driverCalls(SoapySDR::Device *device, const std::string &method)
+{
+    const int calls = jsonCount(device->readSetting("trace_stats"), method, "calls");
+    return (calls < 0)?0:calls;
+}
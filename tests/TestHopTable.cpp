@@ -0,0 +1,185 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "TestHelpers.hpp"
+
+//a hop applied by the test driver
+struct DriverHop
+{
+    size_t index;
+    long long timeNs;
+};
+
+/*!
+ * A driver which implements hop tables natively,
+ * recording each hop and the time it was given.
+ * It times hops itself, without command times.
+ */
+class HopTestDevice : public SoapySDR::Device
+{
+public:
+    HopTestDevice(void):
+        _frequency(0.0)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "hoptest";
+    }
+
+    bool hasHardwareTime(const std::string &what) const
+    {
+        return what.empty();
+    }
+
+    void setFrequency(const int, const size_t, const double frequency, const SoapySDR::Kwargs &)
+    {
+        _frequency = frequency;
+    }
+
+    double getFrequency(const int, const size_t) const
+    {
+        return _frequency;
+    }
+
+    SoapySDR::HopTable *prepareFrequencies(const int, const size_t, const std::vector<double> &frequencies, const SoapySDR::Kwargs &)
+    {
+        return reinterpret_cast<SoapySDR::HopTable *>(new std::vector<double>(frequencies));
+    }
+
+    void applyHop(SoapySDR::HopTable *table, const size_t index, const long long timeNs)
+    {
+        _frequency = reinterpret_cast<std::vector<double> *>(table)->at(index);
+        hops.push_back({index, timeNs});
+    }
+
+    void closeHopTable(SoapySDR::HopTable *table)
+    {
+        delete reinterpret_cast<std::vector<double> *>(table);
+    }
+
+    std::vector<DriverHop> hops;
+
+private:
+    double _frequency;
+};
+
+static HopTestDevice *lastDevice = nullptr;
+
+static SoapySDR::KwargsList findHopTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "hoptest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeHopTest(const SoapySDR::Kwargs &)
+{
+    lastDevice = new HopTestDevice();
+    return lastDevice;
+}
+
+static SoapySDR::Registry registerHopTest("hoptest", &findHopTest, &makeHopTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testHops(SoapySDR::Device *device)
+{
+    printf("Test hops tune the table frequencies...\n");
+    const std::vector<double> freqs = {100e6, 200e6, 300e6};
+    auto table = device->prepareFrequencies(SOAPY_SDR_RX, 0, freqs);
+    CHECK(table != nullptr);
+    for (size_t i = 0; i < freqs.size(); i++)
+    {
+        device->applyHop(table, i);
+        CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == freqs[i]);
+    }
+
+    printf("Test repeated hops only set changed components...\n");
+    device->writeSetting("trace_reset", "true");
+    device->applyHop(table, 0);
+    device->applyHop(table, 0);
+    device->applyHop(table, 1);
+    CHECK(driverCalls(device, "setFrequency") == 2);
+    CHECK(driverCalls(device, "listFrequencies") == 0);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == freqs[1]);
+
+    printf("Test other setters are not skipped over...\n");
+    device->setFrequency(SOAPY_SDR_RX, 0, 1e9);
+    device->applyHop(table, 1);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == freqs[1]);
+
+    printf("Test timed hops need command times...\n");
+    device->writeSetting("trace_reset", "true");
+    bool threw = false;
+    try {device->applyHop(table, 2, 1000000000);}
+    catch (const std::runtime_error &){threw = true;}
+    CHECK(threw);
+    CHECK(driverCalls(device, "setHardwareTime") == 0);
+    device->applyHop(table, 2);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == freqs[2]);
+
+    printf("Test hops are queued by transactions...\n");
+    device->beginConfig();
+    device->applyHop(table, 0);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == freqs[2]);
+    device->commitConfig();
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == freqs[0]);
+
+    threw = false;
+    try {device->applyHop(table, freqs.size());}
+    catch (const std::out_of_range &){threw = true;}
+    CHECK(threw);
+
+    device->closeHopTable(table);
+    return true;
+}
+
+static bool testDriverHops(void)
+{
+    printf("Test hops use the driver table when it has one...\n");
+    auto device = SoapySDR::Device::make("driver=hoptest");
+    auto driver = lastDevice;
+    const std::vector<double> freqs = {100e6, 200e6, 300e6};
+    auto table = device->prepareFrequencies(SOAPY_SDR_RX, 0, freqs);
+    device->applyHop(table, 2);
+    device->applyHop(table, 1);
+    CHECK(driver->hops.size() == 2);
+    CHECK(driver->hops[0].index == 2 and driver->hops[0].timeNs == -1);
+    CHECK(driver->hops[1].index == 1);
+    CHECK(device->getFrequency(SOAPY_SDR_RX, 0) == freqs[1]);
+
+    printf("Test timed hops are passed to the driver table...\n");
+    device->applyHop(table, 0, 5000000);
+    CHECK(driver->hops.size() == 3);
+    CHECK(driver->hops[2].index == 0 and driver->hops[2].timeNs == 5000000);
+
+    bool threw = false;
+    try {device->applyHop(table, freqs.size());}
+    catch (const std::out_of_range &){threw = true;}
+    CHECK(threw);
+    CHECK(driver->hops.size() == 3);
+
+    device->closeHopTable(table);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=sim,clock=virtual,trace=1");
+
+    bool ok = testHops(device);
+    SoapySDR::Device::unmake(device);
+    ok = ok and testDriverHops();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,259 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <complex>
+#include <string>
+#include <vector>
+#include "TestHelpers.hpp"
+
+static const double RATE = 1e6;
+
+/*!
+ * A transmit driver that counts the written elements,
+ * and fails activation or writes on request.
+ */
+class FailTestDevice : public SoapySDR::Device
+{
+public:
+    FailTestDevice(void):
+        _failActivate(false),
+        _failWrites(0),
+        _active(false),
+        _numWritten(0)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "failtest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &, const std::vector<size_t> &, const SoapySDR::Kwargs &)
+    {
+        return reinterpret_cast<SoapySDR::Stream *>(this);
+    }
+
+    void closeStream(SoapySDR::Stream *)
+    {
+        return;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return 100;
+    }
+
+    int activateStream(SoapySDR::Stream *, const int, const long long, const size_t)
+    {
+        if (_failActivate) return SOAPY_SDR_STREAM_ERROR;
+        _active = true;
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *, const int, const long long)
+    {
+        _active = false;
+        return 0;
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *, const size_t numElems, int &, const long long, const long)
+    {
+        if (_failWrites != 0)
+        {
+            _failWrites--;
+            return SOAPY_SDR_UNDERFLOW;
+        }
+        const size_t n = std::min<size_t>(numElems, 100);
+        _numWritten += n;
+        return int(n);
+    }
+
+    void writeSetting(const std::string &key, const std::string &value)
+    {
+        if (key == "fail_activate") _failActivate = SoapySDR::StringToSetting<bool>(value);
+        if (key == "fail_writes") _failWrites = SoapySDR::StringToSetting<size_t>(value);
+    }
+
+    std::string readSetting(const std::string &key) const
+    {
+        if (key == "active") return SoapySDR::SettingToString(_active);
+        if (key == "written") return SoapySDR::SettingToString(_numWritten);
+        return "";
+    }
+
+private:
+    bool _failActivate;
+    size_t _failWrites;
+    bool _active;
+    size_t _numWritten;
+};
+
+static SoapySDR::KwargsList findFailTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "failtest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeFailTest(const SoapySDR::Kwargs &)
+{
+    return new FailTestDevice();
+}
+
+static SoapySDR::Registry registerFailTest("failtest", &findFailTest, &makeFailTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testMulti(SoapySDR::Device *multi, SoapySDR::Device *child1)
+{
+    printf("Test channel union and tuning fan out...\n");
+    CHECK(multi->getDriverKey() == "multi");
+    CHECK(multi->getNumChannels(SOAPY_SDR_RX) == 3);
+    multi->setFrequency(SOAPY_SDR_RX, 2, 2.4e9);
+    CHECK(child1->getFrequency(SOAPY_SDR_RX, 1) == 2.4e9);
+    for (size_t ch = 0; ch < 3; ch++) multi->setSampleRate(SOAPY_SDR_RX, ch, RATE);
+
+    printf("Test timestamp alignment of children...\n");
+    multi->setHardwareTime(0);
+    child1->setHardwareTime(5000000); //the second child starts 5 ms later
+    std::vector<std::complex<float>> buff0(1000), buff1(1000), buff2(1000);
+    void *buffs[] = {buff0.data(), buff1.data(), buff2.data()};
+    auto stream = multi->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0, 1, 2});
+    CHECK(multi->activateStream(stream) == 0);
+
+    int flags = 0;
+    long long timeNs = 0, expectedNs = 0;
+    for (size_t i = 0; i < 20; i++)
+    {
+        const int ret = multi->readStream(stream, buffs, buff0.size(), flags, timeNs);
+        CHECK(ret > 0);
+        CHECK((flags & SOAPY_SDR_HAS_TIME) != 0);
+        if (i == 0) CHECK(timeNs >= 5000000);
+        if (i != 0) CHECK(timeNs == expectedNs);
+        expectedNs = timeNs + SoapySDR::ticksToTimeNs(ret, RATE);
+    }
+
+    printf("Test realignment after an overflow...\n");
+    child1->writeSetting("inject_overflow", "300");
+    bool overflow = false;
+    for (size_t i = 0; i < 50; i++)
+    {
+        const int ret = multi->readStream(stream, buffs, buff0.size(), flags, timeNs);
+        if (ret == SOAPY_SDR_OVERFLOW) overflow = true;
+        else CHECK(ret > 0);
+    }
+    CHECK(overflow);
+    for (size_t i = 0; i < 5; i++)
+    {
+        const int ret = multi->readStream(stream, buffs, buff0.size(), flags, timeNs);
+        CHECK(ret > 0);
+        if (i != 0) CHECK(timeNs == expectedNs);
+        expectedNs = timeNs + SoapySDR::ticksToTimeNs(ret, RATE);
+    }
+
+    multi->deactivateStream(stream);
+    multi->closeStream(stream);
+
+    printf("Test the stream channels set the alignment rate...\n");
+    multi->setSampleRate(SOAPY_SDR_RX, 0, 2*RATE);
+    stream = multi->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {1, 2});
+    CHECK(multi->activateStream(stream) == 0);
+    for (size_t i = 0; i < 5; i++)
+    {
+        const int ret = multi->readStream(stream, buffs, buff0.size(), flags, timeNs);
+        CHECK(ret > 0);
+        if (i != 0) CHECK(timeNs == expectedNs);
+        expectedNs = timeNs + SoapySDR::ticksToTimeNs(ret, RATE);
+    }
+    multi->deactivateStream(stream);
+    multi->closeStream(stream);
+
+    printf("Test every child writes the same number of elements...\n");
+    stream = multi->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CF32, {0, 1});
+    CHECK(multi->activateStream(stream) == 0);
+    const size_t mtu = multi->getStreamMTU(stream);
+    std::vector<std::complex<float>> tx(3*mtu);
+    const void *txBuffs[] = {tx.data(), tx.data()};
+    flags = SOAPY_SDR_END_BURST;
+    CHECK(multi->writeStream(stream, txBuffs, tx.size(), flags) == int(mtu));
+    multi->deactivateStream(stream);
+    multi->closeStream(stream);
+    return true;
+}
+
+static size_t numWritten(SoapySDR::Device *device)
+{
+    return SoapySDR::StringToSetting<size_t>(device->readSetting("written"));
+}
+
+static bool testFailures(SoapySDR::Device *multi, SoapySDR::Device *childA, SoapySDR::Device *childB)
+{
+    std::vector<std::complex<float>> tx(50);
+    const void *txBuffs[] = {tx.data(), tx.data()};
+    auto stream = multi->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CF32, {0, 1});
+
+    printf("Test a failed activation deactivates the other children...\n");
+    childB->writeSetting("fail_activate", "true");
+    CHECK(multi->activateStream(stream) == SOAPY_SDR_STREAM_ERROR);
+    CHECK(childA->readSetting("active") == "false");
+    childB->writeSetting("fail_activate", "false");
+    CHECK(multi->activateStream(stream) == 0);
+    CHECK(childA->readSetting("active") == "true");
+    CHECK(childB->readSetting("active") == "true");
+
+    printf("Test a failed write is padded by the next write...\n");
+    childB->writeSetting("fail_writes", "1");
+    int flags = 0;
+    CHECK(multi->writeStream(stream, txBuffs, tx.size(), flags) == SOAPY_SDR_UNDERFLOW);
+    CHECK(numWritten(childA) == 50);
+    CHECK(numWritten(childB) == 0);
+    flags = 0;
+    CHECK(multi->writeStream(stream, txBuffs, tx.size(), flags) == int(tx.size()));
+    CHECK(numWritten(childA) == 100);
+    CHECK(numWritten(childB) == 100);
+
+    printf("Test a timed write is not padded...\n");
+    childB->writeSetting("fail_writes", "1");
+    flags = 0;
+    CHECK(multi->writeStream(stream, txBuffs, tx.size(), flags) == SOAPY_SDR_UNDERFLOW);
+    flags = SOAPY_SDR_HAS_TIME;
+    CHECK(multi->writeStream(stream, txBuffs, tx.size(), flags, 1000000) == int(tx.size()));
+    CHECK(numWritten(childA) == 200);
+    CHECK(numWritten(childB) == 150);
+
+    multi->deactivateStream(stream);
+    multi->closeStream(stream);
+    return true;
+}
+
+int main(void)
+{
+    auto multi = SoapySDR::Device::make("driver=multi,driver[0]=sim,clock[0]=virtual,channels[0]=1,serial[0]=A,driver[1]=sim,clock[1]=virtual,serial[1]=B");
+    auto child1 = SoapySDR::Device::make("driver=sim,clock=virtual,serial=B");
+
+    bool ok = testMulti(multi, child1);
+    SoapySDR::Device::unmake(child1);
+    SoapySDR::Device::unmake(multi);
+
+    multi = SoapySDR::Device::make("driver=multi,driver[0]=failtest,serial[0]=A,driver[1]=failtest,serial[1]=B");
+    auto childA = SoapySDR::Device::make("driver=failtest,serial=A");
+    auto childB = SoapySDR::Device::make("driver=failtest,serial=B");
+    ok = ok and testFailures(multi, childA, childB);
+    SoapySDR::Device::unmake(childB);
+    SoapySDR::Device::unmake(childA);
+    SoapySDR::Device::unmake(multi);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,186 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <string>
+#include <complex>
+#include <fstream>
+#include <utility>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include "TestHelpers.hpp"
+
+//the record loop from the utility
+int SoapySDRRecord(
+    const std::string &argStr,
+    const double sampleRate,
+    const std::string &formatStr,
+    const std::string &channelStr,
+    const std::string &path,
+    const double duration,
+    const bool timestamps);
+
+static const double RATE = 1e6;
+
+/*!
+ * A receive driver where each sample holds its tick count.
+ * Every 20th read reports an overflow and skips samples,
+ * and every 7th read has no timestamp.
+ */
+class RecordTestDevice : public SoapySDR::Device
+{
+public:
+    RecordTestDevice(void):
+        _ticks(0),
+        _numReads(0)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "rectest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    double getSampleRate(const int, const size_t) const
+    {
+        return RATE;
+    }
+
+    std::vector<std::string> getStreamFormats(const int, const size_t) const
+    {
+        return {SOAPY_SDR_CF32};
+    }
+
+    std::string getNativeStreamFormat(const int, const size_t, double &fullScale) const
+    {
+        fullScale = 1.0;
+        return SOAPY_SDR_CF32;
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &, const std::vector<size_t> &, const SoapySDR::Kwargs &)
+    {
+        return reinterpret_cast<SoapySDR::Stream *>(this);
+    }
+
+    void closeStream(SoapySDR::Stream *)
+    {
+        return;
+    }
+
+    int activateStream(SoapySDR::Stream *, const int, const long long, const size_t)
+    {
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *, const int, const long long)
+    {
+        return 0;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        _numReads++;
+        if (_numReads % 20 == 0)
+        {
+            _ticks += 1000;
+            return SOAPY_SDR_OVERFLOW;
+        }
+
+        const size_t n = std::min<size_t>(numElems, 1000);
+        auto buff = reinterpret_cast<std::complex<float> *>(buffs[0]);
+        for (size_t i = 0; i < n; i++) buff[i] = std::complex<float>(float(_ticks + i), 0.0f);
+        flags = (_numReads % 7 == 0)?0:SOAPY_SDR_HAS_TIME;
+        timeNs = SoapySDR::ticksToTimeNs(_ticks, RATE);
+        _ticks += n;
+        return int(n);
+    }
+
+private:
+    long long _ticks;
+    size_t _numReads;
+};
+
+static SoapySDR::KwargsList findRecordTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "rectest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeRecordTest(const SoapySDR::Kwargs &)
+{
+    return new RecordTestDevice();
+}
+
+static SoapySDR::Registry registerRecordTest("rectest", &findRecordTest, &makeRecordTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testRecord(void)
+{
+    printf("Test recorded blocks are contiguous and their times index the file...\n");
+    const std::string path("TestRecord.dat");
+    CHECK(SoapySDRRecord("driver=rectest", 0.0, "", "", path, 0.3, true) == EXIT_SUCCESS);
+
+    std::vector<std::complex<float>> samples;
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        CHECK(file.is_open());
+        samples.resize(size_t(file.tellg())/sizeof(std::complex<float>));
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(samples.data()), samples.size()*sizeof(std::complex<float>));
+    }
+    CHECK(not samples.empty());
+
+    std::vector<std::pair<unsigned long long, long long>> entries;
+    {
+        std::ifstream timeFile(path + ".time");
+        unsigned long long first(0);
+        long long timeNs(0);
+        while (timeFile >> first >> timeNs) entries.emplace_back(first, timeNs);
+    }
+    CHECK(entries.size() > 1);
+    CHECK(entries.front().first == 0);
+
+    //each entry starts where the last one ended, and holds contiguous samples
+    size_t numTimed = 0, numUntimed = 0;
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const size_t begin = size_t(entries[i].first);
+        const size_t end = (i+1 < entries.size())?size_t(entries[i+1].first):samples.size();
+        CHECK(begin < end and end <= samples.size());
+        for (size_t k = begin; k < end; k++) CHECK(samples[k].real() == samples[begin].real() + float(k - begin));
+        if (entries[i].second < 0)
+        {
+            numUntimed++;
+            continue;
+        }
+        numTimed++;
+        CHECK(SoapySDR::timeNsToTicks(entries[i].second, RATE) == (long long)(samples[begin].real()));
+    }
+    CHECK(numTimed > 0 and numUntimed > 0);
+
+    std::remove(path.c_str());
+    std::remove((path + ".time").c_str());
+    return true;
+}
+
+int main(void)
+{
+    bool ok = testRecord();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Device.h>
+#include <SoapySDR/Registry.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <stdexcept>
+#include "TestHelpers.hpp"
+
+//register accesses made on the test driver
+static int numReads = 0;
+static int numWrites = 0;
+
+/*!
+ * A driver with a register map which implements only
+ * the single register calls, so batches use the default.
+ */
+class RegisterTestDevice : public SoapySDR::Device
+{
+public:
+    std::string getDriverKey(void) const
+    {
+        return "regtest";
+    }
+
+    std::vector<std::string> listRegisterInterfaces(void) const
+    {
+        return {"FPGA"};
+    }
+
+    void writeRegister(const std::string &name, const unsigned addr, const unsigned value)
+    {
+        if (name != "FPGA") throw std::invalid_argument("unknown register interface " + name);
+        numWrites++;
+        _regs[addr] = value;
+    }
+
+    unsigned readRegister(const std::string &name, const unsigned addr) const
+    {
+        if (name != "FPGA") throw std::invalid_argument("unknown register interface " + name);
+        numReads++;
+        const auto it = _regs.find(addr);
+        return (it == _regs.end())?0:it->second;
+    }
+
+private:
+    std::map<unsigned, unsigned> _regs;
+};
+
+static SoapySDR::KwargsList findRegisterTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "regtest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeRegisterTest(const SoapySDR::Kwargs &)
+{
+    return new RegisterTestDevice();
+}
+
+static SoapySDR::Registry registerRegisterTest("regtest", &findRegisterTest, &makeRegisterTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testBatch(SoapySDR::Device *device)
+{
+    printf("Test a batch of register operations...\n");
+    device->writeRegister("FPGA", 0x10, 0xff00);
+    numReads = numWrites = 0;
+
+    SoapySDR::RegisterOpList ops;
+    ops.emplace_back(0x20, 0x1234);
+    ops.emplace_back(0x10, 0x00a5, 0x00ff); //read-modify-write
+    ops.emplace_back(0x10, 0x0003, 0x000f); //the value is known from the last operation
+    ops.emplace_back(0x10, 0, 0x0ff0, true);
+    ops.emplace_back(0x20, 0, ~0u, true);
+    const auto results = device->transactRegisters("FPGA", ops);
+
+    CHECK(results.size() == ops.size());
+    CHECK(results[0] == 0x1234);
+    CHECK(results[1] == 0xffa5);
+    CHECK(results[2] == 0xffa3);
+    CHECK(results[3] == 0x0fa0);
+    CHECK(results[4] == 0x1234);
+    CHECK(numWrites == 3);
+    CHECK(numReads == 3);
+    CHECK(device->readRegister("FPGA", 0x10) == 0xffa3);
+    return true;
+}
+
+static bool testAsync(SoapySDR::Device *device)
+{
+    printf("Test an asynchronous batch...\n");
+    SoapySDR::RegisterOpList ops;
+    for (unsigned addr = 0; addr < 100; addr++) ops.emplace_back(0x100 + addr, addr * 2);
+    ops.emplace_back(0x100 + 50, 0, ~0u, true);
+    auto future = device->transactRegistersAsync("FPGA", ops);
+    const auto results = future.get();
+    CHECK(results.size() == ops.size());
+    CHECK(results.back() == 100);
+    CHECK(device->readRegister("FPGA", 0x100 + 99) == 198);
+
+    printf("Test errors are reported through the future...\n");
+    auto failed = device->transactRegistersAsync("DSP", ops);
+    bool threw = false;
+    try {failed.get();}
+    catch (const std::invalid_argument &) {threw = true;}
+    CHECK(threw);
+    return true;
+}
+
+static bool testCAPI(SoapySDR::Device *device)
+{
+    printf("Test the C API...\n");
+    auto cdevice = reinterpret_cast<SoapySDRDevice *>(device);
+    SoapySDRRegisterOp ops[2];
+    ops[0].addr = 0x30; ops[0].value = 0xabcd; ops[0].mask = 0xff00; ops[0].read = false;
+    ops[1].addr = 0x30; ops[1].value = 0; ops[1].mask = ~0u; ops[1].read = true;
+    CHECK(SoapySDRDevice_transactRegisters(cdevice, "FPGA", ops, 2) == 0);
+    CHECK(ops[0].value == 0xab00);
+    CHECK(ops[1].value == 0xab00);
+    CHECK(SoapySDRDevice_transactRegisters(cdevice, "DSP", ops, 2) != 0);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=regtest");
+
+    bool ok = testBatch(device);
+    ok = ok and testAsync(device);
+    ok = ok and testCAPI(device);
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <complex>
+#include <vector>
+#include <cmath>
+#include "TestHelpers.hpp"
+
+static const double PI = 3.14159265358979323846;
+static const double RATE = 300e3;
+static const double TONE = 10e3;
+
+static bool testResampler(SoapySDR::Device *device)
+{
+    printf("Test arbitrary sample rates...\n");
+    for (size_t ch = 0; ch < 2; ch++) device->setSampleRate(SOAPY_SDR_RX, ch, RATE);
+    CHECK(device->getSampleRate(SOAPY_SDR_RX, 0) == RATE);
+    device->writeSetting("noise_ampl", "0");
+    device->writeSetting("tone_freq", SoapySDR::SettingToString(TONE));
+
+    printf("Test resampled tone and timestamps...\n");
+    std::vector<std::complex<float>> buff0(1000), buff1(1000);
+    void *buffs[] = {buff0.data(), buff1.data()};
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0, 1});
+    const long long startNs = 1000000;
+    CHECK(device->activateStream(stream, SOAPY_SDR_HAS_TIME, startNs) == 0);
+
+    int flags = 0;
+    long long timeNs = 0, expectedNs = 0;
+    for (size_t i = 0; i < 50; i++)
+    {
+        const int ret = device->readStream(stream, buffs, buff0.size(), flags, timeNs);
+        CHECK(ret > 0);
+        CHECK((flags & SOAPY_SDR_HAS_TIME) != 0);
+        if (i == 0) CHECK(timeNs >= startNs and timeNs < startNs + SoapySDR::ticksToTimeNs(1, RATE));
+        if (i != 0) CHECK(std::llabs(timeNs - expectedNs) <= 1);
+        expectedNs = timeNs + SoapySDR::ticksToTimeNs(ret, RATE);
+        if (i < 5) continue;
+
+        //unity gain and the tone phase advance at the new rate
+        for (int n = 1; n < ret; n++)
+        {
+            CHECK(std::abs(std::abs(buff0[n]) - 0.5f) < 1e-3f);
+            const double phase = std::arg(buff0[n]/buff0[n-1]);
+            CHECK(std::abs(phase - 2*PI*TONE/RATE) < 1e-3);
+        }
+    }
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+
+    printf("Test captures are resampled like streams...\n");
+    std::vector<std::complex<float>> capture(2000);
+    void *captureBuffs[] = {capture.data()};
+    const long long captureNs = device->getHardwareTime() + 1000000;
+    CHECK(device->captureSamples(SOAPY_SDR_RX, {0}, SOAPY_SDR_CF32, captureNs, capture.size(), captureBuffs) == int(capture.size()));
+    for (size_t n = capture.size()/2; n < capture.size(); n++)
+    {
+        CHECK(std::abs(std::abs(capture[n]) - 0.5f) < 1e-3f);
+        CHECK(std::abs(std::arg(capture[n]/capture[n-1]) - 2*PI*TONE/RATE) < 1e-3);
+    }
+
+    printf("Test resampled transmit bursts...\n");
+    device->setSampleRate(SOAPY_SDR_TX, 0, RATE);
+    CHECK(device->getSampleRate(SOAPY_SDR_TX, 0) == RATE);
+    std::vector<std::complex<short>> tx(1000, std::complex<short>(1000, 0));
+    const void *txBuffs[] = {tx.data()};
+    stream = device->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CS16, {0});
+    CHECK(device->activateStream(stream) == 0);
+    flags = SOAPY_SDR_END_BURST;
+    size_t total = 0;
+    while (total < tx.size())
+    {
+        txBuffs[0] = tx.data() + total;
+        const int ret = device->writeStream(stream, txBuffs, tx.size() - total, flags);
+        CHECK(ret > 0);
+        total += size_t(ret);
+    }
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    return true;
+}
+
+static bool testBurstEnd(void)
+{
+    printf("Test the end of a burst reaches the device before the write returns...\n");
+    auto device = SoapySDR::Device::make("driver=sim,rate_step=1e6,resample=true");
+    device->setSampleRate(SOAPY_SDR_TX, 0, RATE);
+    const double deviceRate = device->getSampleRate(SOAPY_SDR_TX, 0);
+
+    //the device buffers less than the time until the burst,
+    //so the writes of the burst time out until close to its time
+    std::vector<std::complex<float>> tx(1000, std::complex<float>(0.5f));
+    const void *txBuffs[] = {tx.data()};
+    auto stream = device->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CF32, {0}, {{"bufflen", "4000"}, {"buffers", "4"}});
+    CHECK(device->activateStream(stream) == 0);
+    const long long burstNs = device->getHardwareTime() + 50000000;
+    int flags = SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST;
+    size_t total = 0;
+    while (total < tx.size())
+    {
+        txBuffs[0] = tx.data() + total;
+        const int ret = device->writeStream(stream, txBuffs, tx.size() - total, flags, burstNs, 1000);
+        if (ret == SOAPY_SDR_TIMEOUT) continue;
+        CHECK(ret > 0);
+        total += size_t(ret);
+        flags &= ~SOAPY_SDR_HAS_TIME;
+    }
+
+    //the burst ends after its samples and the filter tail at the device rate
+    size_t chanMask = 0;
+    long long endNs = 0;
+    CHECK(device->readStreamStatus(stream, chanMask, flags, endNs, 100000) == 0);
+    CHECK((flags & SOAPY_SDR_END_BURST) != 0);
+    const long long durationNs = SoapySDR::ticksToTimeNs(tx.size(), RATE);
+    printf("  burst of %lld ns ended after %lld ns\n", durationNs, endNs - burstNs);
+    CHECK(endNs >= burstNs + durationNs);
+    CHECK(endNs <= burstNs + durationNs + SoapySDR::ticksToTimeNs(1000, deviceRate));
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=sim,clock=virtual,rate_step=1e6,resample=true");
+
+    bool ok = testResampler(device);
+    SoapySDR::Device::unmake(device);
+    ok = ok and testBurstEnd();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <complex>
+#include <vector>
+#include "TestHelpers.hpp"
+
+static const size_t NUM_PRE = 100;
+static const size_t NUM_POST = 500;
+
+static bool testWindow(void)
+{
+    printf("Test a burst is delivered as one window...\n");
+    auto device = SoapySDR::Device::make("driver=sim,clock=virtual,stream_layer=1");
+    device->writeSetting("tone_ampl", "0.0");
+    const SoapySDR::Kwargs args{
+        {"TRIGGER", "LEVEL"},
+        {"TRIGGER_LEVEL", "-20"},
+        {"TRIGGER_PRE", std::to_string(NUM_PRE)},
+        {"TRIGGER_POST", std::to_string(NUM_POST)}};
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0}, args);
+    CHECK(device->activateStream(stream) == 0);
+
+    //only noise, which is well below the level
+    std::vector<std::complex<float>> buff(NUM_PRE+NUM_POST);
+    void *buffs[] = {buff.data()};
+    int flags = 0;
+    long long timeNs = 0;
+    CHECK(device->readStream(stream, buffs, buff.size(), flags, timeNs, 10000) == SOAPY_SDR_TIMEOUT);
+
+    //the burst starts with the next block from the device
+    device->writeSetting("tone_ampl", "0.5");
+    size_t total = 0;
+    long long startNs = 0;
+    while (total < buff.size())
+    {
+        void *chunk[] = {buff.data() + total};
+        const int ret = device->readStream(stream, chunk, 256, flags, timeNs, 100000);
+        CHECK(ret > 0);
+        CHECK((flags & SOAPY_SDR_HAS_TIME) != 0);
+        if (total == 0) startNs = timeNs;
+        CHECK(timeNs == startNs + SoapySDR::ticksToTimeNs(total, device->getSampleRate(SOAPY_SDR_RX, 0)));
+        total += size_t(ret);
+        CHECK(((flags & SOAPY_SDR_END_BURST) != 0) == (total == buff.size()));
+    }
+
+    //the history before the burst followed by the burst
+    for (size_t i = 0; i < NUM_PRE; i++) CHECK(std::abs(buff[i]) < 0.1f);
+    for (size_t i = NUM_PRE; i < buff.size(); i++) CHECK(std::abs(buff[i]) > 0.4f);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testTimeout(void)
+{
+    printf("Test the timeout covers the reads of the whole call...\n");
+    auto device = SoapySDR::Device::make("driver=sim,stream_layer=1");
+    device->writeSetting("tone_ampl", "0.0");
+
+    //each block takes 200 ms to receive
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0}, {{"TRIGGER", "LEVEL"}, {"bufflen", "200000"}});
+    CHECK(device->activateStream(stream) == 0);
+
+    std::vector<std::complex<float>> buff(1000);
+    void *buffs[] = {buff.data()};
+    int flags = 0;
+    long long timeNs = 0;
+    const auto start = std::chrono::steady_clock::now();
+    CHECK(device->readStream(stream, buffs, buff.size(), flags, timeNs, 250000) == SOAPY_SDR_TIMEOUT);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    printf("  timed out after %d ms\n", int(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()));
+    CHECK(elapsed < std::chrono::milliseconds(350));
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = testWindow();
+    ok = ok and testTimeout();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,171 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/SensorSampler.hpp>
+#include <stdexcept>
+#include <cstdlib>
+#include <cstdio>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <string>
+#include "TestHelpers.hpp"
+
+//the number of reads of each sensor made on the test driver
+static std::atomic<int> numCountReads(0);
+static std::atomic<int> numSlowReads(0);
+
+/*!
+ * A driver with a sensor of each type, a channel sensor,
+ * a sensor which counts its reads, and a sensor which fails.
+ */
+class SensorTestDevice : public SoapySDR::Device
+{
+public:
+    std::string getDriverKey(void) const
+    {
+        return "sensortest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    std::vector<std::string> listSensors(void) const
+    {
+        return {"lock", "temp", "count", "name", "slow", "broken"};
+    }
+
+    SoapySDR::ArgInfo getSensorInfo(const std::string &key) const
+    {
+        SoapySDR::ArgInfo info;
+        info.key = key;
+        if (key == "lock") info.type = SoapySDR::ArgInfo::BOOL;
+        if (key == "temp" or key == "broken") info.type = SoapySDR::ArgInfo::FLOAT;
+        if (key == "count" or key == "slow") info.type = SoapySDR::ArgInfo::INT;
+        return info;
+    }
+
+    std::string readSensor(const std::string &key) const
+    {
+        if (key == "lock") return "true";
+        if (key == "temp") return "42.5";
+        if (key == "count") return std::to_string(++numCountReads);
+        if (key == "name") return std::string(300, 'x');
+        if (key == "slow")
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            return std::to_string(++numSlowReads);
+        }
+        throw std::runtime_error("sensor not connected");
+    }
+
+    std::vector<std::string> listSensors(const int, const size_t) const
+    {
+        return {"rssi"};
+    }
+
+    SoapySDR::ArgInfo getSensorInfo(const int, const size_t, const std::string &key) const
+    {
+        SoapySDR::ArgInfo info;
+        info.key = key;
+        info.type = SoapySDR::ArgInfo::FLOAT;
+        return info;
+    }
+
+    std::string readSensor(const int direction, const size_t, const std::string &) const
+    {
+        return (direction == SOAPY_SDR_RX)?"-70":"-10";
+    }
+};
+
+static SoapySDR::KwargsList findSensorTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "sensortest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeSensorTest(const SoapySDR::Kwargs &)
+{
+    return new SensorTestDevice();
+}
+
+static SoapySDR::Registry registerSensorTest("sensortest", &findSensorTest, &makeSensorTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testTypedReadings(SoapySDR::Device *device)
+{
+    printf("Test typed readings...\n");
+    SoapySDR::SensorSampler sampler(device);
+    for (const auto &key : device->listSensors()) sampler.addSensor(key, 10000000);
+    const size_t rssi = sampler.addSensor(SOAPY_SDR_RX, 0, "rssi", 10000000);
+    CHECK(sampler.getNumSensors() == 7);
+    CHECK(not sampler.read("lock").valid);
+
+    sampler.start();
+    bool threw = false;
+    try {sampler.addSensor("temp", 1000);}
+    catch (const std::runtime_error &) {threw = true;}
+    CHECK(threw);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const auto lock = sampler.read("lock");
+    CHECK(lock.valid);
+    CHECK(lock.type == SoapySDR::ArgInfo::BOOL);
+    CHECK(lock.boolValue);
+    CHECK(sampler.read("temp").floatValue == 42.5);
+    CHECK(sampler.read("name").stringValue.size() == SoapySDR::SensorSampler::MAX_STRING_SIZE);
+    CHECK(sampler.read(rssi).floatValue == -70.0);
+    CHECK(sampler.read(SOAPY_SDR_RX, 0, "rssi").stringValue == "-70");
+
+    printf("Test failed reads are counted...\n");
+    const auto broken = sampler.read("broken");
+    CHECK(not broken.valid);
+    CHECK(broken.numErrors > 0);
+    return true;
+}
+
+static bool testSampling(SoapySDR::Device *device)
+{
+    printf("Test sensors are read at their intervals...\n");
+    SoapySDR::SensorSampler sampler(device);
+    const size_t count = sampler.addSensor("count", 5000000);
+    sampler.addSensor("slow", 1000000000);
+    const int countBefore = numCountReads;
+    const int slowBefore = numSlowReads;
+    sampler.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    //readers never wait on the device, even while it is slow
+    const auto t0 = std::chrono::steady_clock::now();
+    const auto first = sampler.read(count);
+    for (size_t i = 0; i < 1000; i++) sampler.read(count);
+    const auto elapsed = std::chrono::steady_clock::now() - t0;
+    CHECK(elapsed < std::chrono::milliseconds(20));
+    sampler.stop();
+
+    CHECK(numSlowReads - slowBefore == 1);
+    CHECK(numCountReads - countBefore > 5);
+    CHECK(first.intValue > countBefore);
+
+    //the latest readings remain after stop
+    const auto last = sampler.read(count);
+    CHECK(last.intValue == numCountReads);
+    CHECK(last.timeNs >= first.timeNs);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=sensortest");
+
+    bool ok = testTypedReadings(device);
+    ok = ok and testSampling(device);
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
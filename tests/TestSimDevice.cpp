@@ -0,0 +1,159 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <complex>
+#include <vector>
+#include "TestHelpers.hpp"
+
+static const double RATE = 1e6;
+
+static bool testReceive(SoapySDR::Device *device)
+{
+    printf("Test receive timestamps...\n");
+    std::vector<std::complex<int16_t>> buff0(1000), buff1(1000);
+    void *buffs[] = {buff0.data(), buff1.data()};
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CS16, {0, 1});
+    CHECK(device->activateStream(stream) == 0);
+
+    int flags = 0;
+    long long timeNs = 0, expectedNs = 0;
+    for (size_t i = 0; i < 10; i++)
+    {
+        const int ret = device->readStream(stream, buffs, buff0.size(), flags, timeNs);
+        CHECK(ret > 0);
+        CHECK((flags & SOAPY_SDR_HAS_TIME) != 0);
+        if (i != 0) CHECK(timeNs == expectedNs);
+        expectedNs = timeNs + SoapySDR::ticksToTimeNs(ret, RATE);
+    }
+    CHECK(buff0[10] != buff1[10]); //channels have different phases
+
+    printf("Test injected overflow...\n");
+    device->writeSetting("inject_overflow", "500");
+    CHECK(device->readStream(stream, buffs, buff0.size(), flags, timeNs) == SOAPY_SDR_OVERFLOW);
+    CHECK(device->readStream(stream, buffs, buff0.size(), flags, timeNs) > 0);
+    CHECK(timeNs == expectedNs + SoapySDR::ticksToTimeNs(500, RATE));
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    return true;
+}
+
+static bool testGapFill(SoapySDR::Device *device)
+{
+    printf("Test gap fill over an injected overflow...\n");
+    std::vector<std::complex<float>> buff(1000);
+    void *buffs[] = {buff.data()};
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0}, {{"GAP_FILL", "true"}});
+    CHECK(device->activateStream(stream) == 0);
+
+    int flags = 0;
+    long long timeNs = 0, expectedNs = 0;
+    for (size_t i = 0; i < 10; i++)
+    {
+        if (i == 5) device->writeSetting("inject_overflow", "150");
+        const int ret = device->readStream(stream, buffs, buff.size(), flags, timeNs);
+        CHECK(ret > 0);
+        if (i != 0) CHECK(timeNs == expectedNs);
+        expectedNs = timeNs + SoapySDR::ticksToTimeNs(ret, RATE);
+    }
+
+    const auto stats = device->getStreamStats(stream);
+    CHECK(stats.numGaps == 1);
+    CHECK(stats.numGapElems == 150);
+    CHECK(stats.numOverflows == 1);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    return true;
+}
+
+static bool testTransmit(SoapySDR::Device *device)
+{
+    printf("Test transmit burst status...\n");
+    std::vector<std::complex<int8_t>> buff(1000);
+    const void *buffs[] = {buff.data()};
+    auto stream = device->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CS8, {0});
+    CHECK(device->activateStream(stream) == 0);
+
+    int flags = SOAPY_SDR_END_BURST;
+    CHECK(device->writeStream(stream, buffs, buff.size(), flags, 0) == int(buff.size()));
+    size_t chanMask = 0;
+    long long timeNs = 0;
+    CHECK(device->readStreamStatus(stream, chanMask, flags, timeNs) == 0);
+    CHECK((flags & SOAPY_SDR_END_BURST) != 0);
+
+    printf("Test injected underflow...\n");
+    device->writeSetting("inject_underflow", "1");
+    flags = 0;
+    CHECK(device->writeStream(stream, buffs, buff.size(), flags, 0) == int(buff.size()));
+    CHECK(device->readStreamStatus(stream, chanMask, flags, timeNs) == SOAPY_SDR_UNDERFLOW);
+
+    printf("Test late timed transmit...\n");
+    flags = SOAPY_SDR_HAS_TIME;
+    CHECK(device->writeStream(stream, buffs, buff.size(), flags, 0) == int(buff.size()));
+    CHECK(device->readStreamStatus(stream, chanMask, flags, timeNs) == SOAPY_SDR_TIME_ERROR);
+    CHECK(device->readStreamStatus(stream, chanMask, flags, timeNs, 0) == SOAPY_SDR_TIMEOUT);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    return true;
+}
+
+static bool testDirectAccess(SoapySDR::Device *device)
+{
+    printf("Test direct buffer access...\n");
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CS16, {0}, {{"bufflen", "256"}, {"buffers", "4"}});
+    CHECK(device->getStreamMTU(stream) == 256);
+    CHECK(device->getNumDirectAccessBuffers(stream) == 4);
+    CHECK(device->activateStream(stream) == 0);
+
+    size_t handle = 0;
+    const void *buffs[1];
+    int flags = 0;
+    long long timeNs = 0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        CHECK(device->acquireReadBuffer(stream, handle, buffs, flags, timeNs) == 256);
+        CHECK(handle == i % 4);
+        device->releaseReadBuffer(stream, handle);
+    }
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    return true;
+}
+
+static bool testCapture(SoapySDR::Device *device)
+{
+    printf("Test timed capture...\n");
+    std::vector<std::complex<float>> buff(5000);
+    void *buffs[] = {buff.data()};
+    const long long timeNs = device->getHardwareTime() + 1000000;
+    CHECK(device->captureSamples(SOAPY_SDR_RX, {1}, SOAPY_SDR_CF32, timeNs, buff.size(), buffs) == int(buff.size()));
+    CHECK(std::abs(std::abs(buff.back()) - 0.5f) < 0.05f);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=sim,clock=virtual,stream_layer=1");
+    device->setSampleRate(SOAPY_SDR_RX, 0, RATE);
+    device->setSampleRate(SOAPY_SDR_TX, 0, RATE);
+
+    bool ok = device->getDriverKey() == "sim" and device->getNumChannels(SOAPY_SDR_RX) == 2;
+    ok = ok and testReceive(device);
+    ok = ok and testGapFill(device);
+    ok = ok and testTransmit(device);
+    ok = ok and testDirectAccess(device);
+    ok = ok and testCapture(device);
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
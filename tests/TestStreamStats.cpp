@@ -0,0 +1,137 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <complex>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include "TestHelpers.hpp"
+
+static const size_t NUM_ELEMS = 100;
+
+//every read waits this long, which is in the histogram bucket of [2048, 4096) us
+static const auto READ_LATENCY = std::chrono::microseconds(2500);
+static const size_t LATENCY_BUCKET = 11;
+
+/*!
+ * A receive driver with a fixed read latency.
+ * Every 4th read times out, and every 5th read overflows.
+ */
+class StatsTestDevice : public SoapySDR::Device
+{
+public:
+    StatsTestDevice(void):
+        _numReads(0)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "statstest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &, const std::vector<size_t> &, const SoapySDR::Kwargs &)
+    {
+        _numReads = 0;
+        return reinterpret_cast<SoapySDR::Stream *>(this);
+    }
+
+    void closeStream(SoapySDR::Stream *)
+    {
+        return;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *, const size_t numElems, int &flags, long long &, const long)
+    {
+        std::this_thread::sleep_for(READ_LATENCY);
+        flags = 0;
+        _numReads++;
+        if (_numReads % 4 == 0) return SOAPY_SDR_TIMEOUT;
+        if (_numReads % 5 == 0) return SOAPY_SDR_OVERFLOW;
+        return int(numElems);
+    }
+
+private:
+    size_t _numReads;
+};
+
+static SoapySDR::KwargsList findStatsTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "statstest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeStatsTest(const SoapySDR::Kwargs &)
+{
+    return new StatsTestDevice();
+}
+
+static SoapySDR::Registry registerStatsTest("statstest", &findStatsTest, &makeStatsTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testCounters(SoapySDR::Device *device)
+{
+    printf("Test the counters of a known number of reads...\n");
+    std::vector<std::complex<float>> buff(NUM_ELEMS);
+    void *buffs[] = {buff.data()};
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32);
+
+    //reads 4, 8, ... time out and reads 5, 10, 15 overflow (20 times out)
+    int flags = 0;
+    long long timeNs = 0;
+    for (size_t i = 0; i < 20; i++) device->readStream(stream, buffs, NUM_ELEMS, flags, timeNs);
+
+    const auto stats = device->getStreamStats(stream);
+    CHECK(stats.numCalls == 20);
+    CHECK(stats.numTimeouts == 5);
+    CHECK(stats.numOverflows == 3);
+    CHECK(stats.numElems == 12*NUM_ELEMS);
+    CHECK(stats.latencyHistogram.size() == SOAPY_SDR_STREAM_STATS_HISTOGRAM_SIZE);
+
+    //a read never returns early, a late wakeup may land in a higher bucket
+    unsigned long long total = 0;
+    for (size_t i = 0; i < stats.latencyHistogram.size(); i++)
+    {
+        if (i < LATENCY_BUCKET) CHECK(stats.latencyHistogram[i] == 0);
+        total += stats.latencyHistogram[i];
+    }
+    CHECK(total == 20);
+    CHECK(stats.latencyHistogram[LATENCY_BUCKET] > 0);
+
+    printf("Test a new stream starts from zero...\n");
+    device->closeStream(stream);
+    stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32);
+    const auto reset = device->getStreamStats(stream);
+    CHECK(reset.numCalls == 0);
+    CHECK(reset.numElems == 0);
+    CHECK(reset.numTimeouts == 0);
+    CHECK(reset.numOverflows == 0);
+    for (const auto count : reset.latencyHistogram) CHECK(count == 0);
+
+    device->readStream(stream, buffs, NUM_ELEMS, flags, timeNs);
+    CHECK(device->getStreamStats(stream).numCalls == 1);
+    device->closeStream(stream);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=statstest, stream_layer=1");
+    bool ok = testCounters(device);
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
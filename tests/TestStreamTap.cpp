@@ -0,0 +1,166 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <complex>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include "TestHelpers.hpp"
+
+static const size_t NUM_ELEMS = 1000;
+static const size_t TAP_SLOTS = 8;
+
+typedef std::vector<std::complex<float>> Buffer;
+
+static bool testTapData(SoapySDR::Device *device, SoapySDR::Stream *stream)
+{
+    printf("Test tapped data matches the stream...\n");
+    auto tapA = device->setupStreamTap(stream);
+    auto tapB = device->setupStreamTap(stream);
+    CHECK(tapA != nullptr);
+    CHECK(tapB != nullptr);
+
+    int flags = 0;
+    long long timeNs = 0;
+    std::vector<Buffer> primary(4, Buffer(NUM_ELEMS));
+    std::vector<long long> primaryTimes(primary.size());
+    for (size_t i = 0; i < primary.size(); i++)
+    {
+        void *buffs[] = {primary[i].data()};
+        CHECK(device->readStream(stream, buffs, NUM_ELEMS, flags, primaryTimes[i]) == int(NUM_ELEMS));
+    }
+
+    //copied out of the ring
+    Buffer buff(NUM_ELEMS);
+    void *buffs[] = {buff.data()};
+    for (size_t i = 0; i < primary.size(); i++)
+    {
+        CHECK(device->readStreamTap(tapA, buffs, NUM_ELEMS, flags, timeNs) == int(NUM_ELEMS));
+        CHECK((flags & SOAPY_SDR_HAS_TIME) != 0);
+        CHECK(timeNs == primaryTimes[i]);
+        CHECK(buff == primary[i]);
+    }
+    CHECK(device->readStreamTap(tapA, buffs, NUM_ELEMS, flags, timeNs, 1000) == SOAPY_SDR_TIMEOUT);
+
+    //shared in place
+    for (size_t i = 0; i < primary.size(); i++)
+    {
+        size_t handle = 0;
+        const void *ptrs[1];
+        CHECK(device->acquireTapBuffer(tapB, handle, ptrs, flags, timeNs) == int(NUM_ELEMS));
+        CHECK(timeNs == primaryTimes[i]);
+        CHECK(std::memcmp(ptrs[0], primary[i].data(), NUM_ELEMS*sizeof(buff[0])) == 0);
+        device->releaseTapBuffer(tapB, handle);
+    }
+
+    printf("Test fragments of a stream buffer...\n");
+    void *primaryBuffs[] = {primary[0].data()};
+    CHECK(device->readStream(stream, primaryBuffs, NUM_ELEMS, flags, primaryTimes[0]) == int(NUM_ELEMS));
+    size_t total = 0;
+    while (total < NUM_ELEMS)
+    {
+        const int ret = device->readStreamTap(tapA, buffs, 300, flags, timeNs);
+        CHECK(ret > 0);
+        CHECK(((flags & SOAPY_SDR_HAS_TIME) != 0) == (total == 0));
+        CHECK(std::memcmp(buff.data(), primary[0].data() + total, ret*sizeof(buff[0])) == 0);
+        total += ret;
+        CHECK(((flags & SOAPY_SDR_MORE_FRAGMENTS) != 0) == (total < NUM_ELEMS));
+    }
+    CHECK(total == NUM_ELEMS);
+
+    printf("Test slow taps drop buffers...\n");
+    for (size_t i = 0; i < 20; i++)
+    {
+        CHECK(device->readStream(stream, primaryBuffs, NUM_ELEMS, flags, timeNs) == int(NUM_ELEMS));
+    }
+    CHECK(device->getStreamTapDrops(tapA) == 0);
+    CHECK(device->readStreamTap(tapA, buffs, NUM_ELEMS, flags, timeNs) == SOAPY_SDR_OVERFLOW);
+    CHECK(device->getStreamTapDrops(tapA) == 20 - TAP_SLOTS);
+    for (size_t i = 0; i < TAP_SLOTS; i++)
+    {
+        CHECK(device->readStreamTap(tapA, buffs, NUM_ELEMS, flags, timeNs) == int(NUM_ELEMS));
+    }
+    CHECK(buff == primary[0]);
+    CHECK(device->readStreamTap(tapA, buffs, NUM_ELEMS, flags, timeNs, 1000) == SOAPY_SDR_TIMEOUT);
+
+    printf("Test a held buffer does not block the stream...\n");
+    size_t handle = 0;
+    const void *ptrs[1];
+    CHECK(device->acquireTapBuffer(tapB, handle, ptrs, flags, timeNs) == SOAPY_SDR_OVERFLOW);
+    CHECK(device->acquireTapBuffer(tapB, handle, ptrs, flags, timeNs) == int(NUM_ELEMS));
+    const Buffer held(reinterpret_cast<const std::complex<float> *>(ptrs[0]), reinterpret_cast<const std::complex<float> *>(ptrs[0]) + NUM_ELEMS);
+    for (size_t i = 0; i < 3*TAP_SLOTS; i++)
+    {
+        CHECK(device->readStream(stream, primaryBuffs, NUM_ELEMS, flags, timeNs) == int(NUM_ELEMS));
+    }
+    CHECK(std::memcmp(ptrs[0], held.data(), NUM_ELEMS*sizeof(buff[0])) == 0);
+    device->releaseTapBuffer(tapB, handle);
+
+    device->closeStreamTap(tapA);
+    device->closeStreamTap(tapB);
+    return true;
+}
+
+static bool testTapThread(SoapySDR::Device *device, SoapySDR::Stream *stream)
+{
+    printf("Test a tap read from another thread...\n");
+    auto tap = device->setupStreamTap(stream);
+    std::atomic<bool> done(false);
+    size_t numRead = 0;
+    std::thread reader([&]
+    {
+        Buffer buff(NUM_ELEMS);
+        void *buffs[] = {buff.data()};
+        int flags = 0;
+        long long timeNs = 0;
+        while (true)
+        {
+            const int ret = device->readStreamTap(tap, buffs, NUM_ELEMS, flags, timeNs, 10000);
+            if (ret > 0) numRead++;
+            if (ret == SOAPY_SDR_TIMEOUT and done) break;
+        }
+    });
+
+    const size_t numWritten = 1000;
+    Buffer buff(NUM_ELEMS);
+    void *buffs[] = {buff.data()};
+    int flags = 0;
+    long long timeNs = 0;
+    size_t numWrittenOk = 0;
+    while (numWrittenOk < numWritten and device->readStream(stream, buffs, NUM_ELEMS, flags, timeNs) == int(NUM_ELEMS)) numWrittenOk++;
+    done = true;
+    reader.join();
+    CHECK(numWrittenOk == numWritten);
+
+    const auto drops = device->getStreamTapDrops(tap);
+    printf("  read %d buffers, dropped %d buffers\n", int(numRead), int(drops));
+    CHECK(numRead + drops == numWritten);
+
+    //a tap may outlive its stream
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    CHECK(device->readStreamTap(tap, buffs, NUM_ELEMS, flags, timeNs, 1000) == SOAPY_SDR_TIMEOUT);
+    device->closeStreamTap(tap);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=sim,clock=virtual,stream_layer=1");
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0}, {{"TAP_SLOTS", std::to_string(TAP_SLOTS)}});
+
+    bool ok = device->activateStream(stream) == 0;
+    ok = ok and testTapData(device, stream);
+    ok = ok and testTapThread(device, stream);
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
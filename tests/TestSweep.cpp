@@ -0,0 +1,228 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <complex>
+#include <map>
+#include <vector>
+#include "TestHelpers.hpp"
+
+static const double RATE = 1e6;
+
+/*!
+ * A receive driver whose samples are the tuned frequency in MHz,
+ * with a stream clock which advances by the samples read.
+ * The cmd argument makes a driver which supports command times,
+ * so that frequencies set with a command time take effect
+ * at the first sample of that time.
+ */
+class SweepTestDevice : public SoapySDR::Device
+{
+public:
+    SweepTestDevice(const SoapySDR::Kwargs &args):
+        failNext(false),
+        _cmd(args.count("cmd") != 0),
+        _timeNs(0),
+        _commandTimeNs(0),
+        _frequency(0.0)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "sweeptest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    double getSampleRate(const int, const size_t) const
+    {
+        return RATE;
+    }
+
+    bool hasHardwareTime(const std::string &what) const
+    {
+        return what.empty() or (_cmd and what == "CMD");
+    }
+
+    long long getHardwareTime(const std::string &) const
+    {
+        return _timeNs;
+    }
+
+    void setHardwareTime(const long long timeNs, const std::string &what)
+    {
+        if (what == "CMD") _commandTimeNs = timeNs;
+        else _timeNs = timeNs;
+    }
+
+    void setFrequency(const int, const size_t, const double frequency, const SoapySDR::Kwargs &)
+    {
+        if (_commandTimeNs == 0) _frequency = frequency;
+        else _pending.emplace(_commandTimeNs, frequency);
+    }
+
+    double getFrequency(const int, const size_t) const
+    {
+        return _frequency;
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &, const std::vector<size_t> &, const SoapySDR::Kwargs &)
+    {
+        return reinterpret_cast<SoapySDR::Stream *>(this);
+    }
+
+    void closeStream(SoapySDR::Stream *)
+    {
+        return;
+    }
+
+    int activateStream(SoapySDR::Stream *, const int, const long long, const size_t)
+    {
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *, const int, const long long)
+    {
+        return 0;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long)
+    {
+        if (failNext)
+        {
+            failNext = false;
+            return SOAPY_SDR_TIMEOUT;
+        }
+        auto out = reinterpret_cast<std::complex<float> *>(buffs[0]);
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = _timeNs;
+        for (size_t i = 0; i < numElems; i++)
+        {
+            const long long sampleNs = _timeNs + SoapySDR::ticksToTimeNs(i, RATE);
+            while (not _pending.empty() and _pending.begin()->first <= sampleNs)
+            {
+                _frequency = _pending.begin()->second;
+                _pending.erase(_pending.begin());
+            }
+            out[i] = std::complex<float>(float(_frequency/1e6));
+        }
+        _timeNs += SoapySDR::ticksToTimeNs(numElems, RATE);
+        return int(numElems);
+    }
+
+    bool failNext;
+
+private:
+    const bool _cmd;
+    long long _timeNs;
+    long long _commandTimeNs;
+    double _frequency;
+    std::multimap<long long, double> _pending;
+};
+
+static SweepTestDevice *lastDevice = nullptr;
+
+static SoapySDR::KwargsList findSweepTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "sweeptest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeSweepTest(const SoapySDR::Kwargs &args)
+{
+    lastDevice = new SweepTestDevice(args);
+    return lastDevice;
+}
+
+static SoapySDR::Registry registerSweepTest("sweeptest", &findSweepTest, &makeSweepTest, SOAPY_SDR_ABI_VERSION);
+
+//every sample of the segment was received at the frequency of its label
+static bool tunedTo(const std::vector<std::complex<float>> &buff, const double frequency)
+{
+    for (const auto &sample : buff)
+    {
+        if (sample.real() != float(frequency/1e6)) return false;
+    }
+    return true;
+}
+
+static bool testSweep(const std::string &args)
+{
+    printf("Test segments cycle through the frequencies with %s...\n", args.c_str());
+    auto device = SoapySDR::Device::make(args);
+    auto driver = lastDevice;
+    const size_t dwell = 1000;
+    const long long settleNs = 200000;
+
+    const std::vector<double> freqs = {100e6, 200e6, 300e6};
+    auto sweep = device->setupSweep(SOAPY_SDR_RX, 0, SOAPY_SDR_CF32, freqs, dwell, settleNs);
+    CHECK(sweep != nullptr);
+
+    std::vector<std::complex<float>> buff(dwell);
+    long long lastTimeNs = -1;
+    for (size_t i = 0; i < 2*freqs.size(); i++)
+    {
+        int flags = 0;
+        double frequency = 0.0;
+        long long timeNs = 0;
+        CHECK(device->readSweep(sweep, buff.data(), flags, frequency, timeNs) == int(dwell));
+        printf("  segment %d: %g Hz at %lld ns\n", int(i), frequency, timeNs);
+        CHECK(frequency == freqs[i % freqs.size()]);
+        CHECK(tunedTo(buff, frequency));
+        CHECK((flags & SOAPY_SDR_HAS_TIME) != 0);
+        CHECK(((flags & SOAPY_SDR_END_BURST) != 0) == (i % freqs.size() == freqs.size()-1));
+
+        //segments are separated by the dwell and settle times
+        if (lastTimeNs >= 0) CHECK(timeNs >= lastTimeNs + SoapySDR::ticksToTimeNs(dwell, RATE) + settleNs);
+        lastTimeNs = timeNs;
+    }
+
+    printf("Test a failed segment is read again...\n");
+    int flags = 0;
+    double frequency = 0.0;
+    long long timeNs = 0;
+    driver->failNext = true;
+    CHECK(device->readSweep(sweep, buff.data(), flags, frequency, timeNs) == SOAPY_SDR_TIMEOUT);
+    CHECK(device->readSweep(sweep, buff.data(), flags, frequency, timeNs) == int(dwell));
+    CHECK(frequency == freqs[0]);
+    CHECK(tunedTo(buff, frequency));
+    CHECK(device->readSweep(sweep, buff.data(), flags, frequency, timeNs) == int(dwell));
+    CHECK(frequency == freqs[1]);
+    CHECK(tunedTo(buff, frequency));
+
+    device->closeSweep(sweep);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = testSweep("driver=sweeptest, stream_layer=1");
+    ok = ok and testSweep("driver=sweeptest, cmd=1, stream_layer=1");
+
+    //the sim driver has no command times, so its sweeps are untimed
+    auto device = SoapySDR::Device::make("driver=sim,clock=virtual,stream_layer=1");
+    auto sweep = device->setupSweep(SOAPY_SDR_RX, 0, SOAPY_SDR_CF32, {100e6, 200e6}, 1000, 200000);
+    std::vector<std::complex<float>> buff(1000);
+    int flags = 0;
+    double frequency = 0.0;
+    long long timeNs = 0;
+    ok = ok and device->readSweep(sweep, buff.data(), flags, frequency, timeNs) == 1000;
+    ok = ok and frequency == 100e6 and device->getFrequency(SOAPY_SDR_RX, 0) == 200e6;
+    device->closeSweep(sweep);
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
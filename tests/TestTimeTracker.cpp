@@ -0,0 +1,202 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/TimeTracker.hpp>
+#include <SoapySDR/Constants.h>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "TestHelpers.hpp"
+
+//the drift of the test driver clock
+static const double DRIFT_PPM = 50.0;
+
+//the number of hardware time reads made on the test driver
+static std::atomic<int> numTimeReads(0);
+
+/*!
+ * A driver with a hardware clock which runs fast of the host clock,
+ * where each read of the clock takes a slow round trip.
+ */
+class ClockTestDevice : public SoapySDR::Device
+{
+public:
+    ClockTestDevice(void):
+        _hostBase(SoapySDR::TimeTracker::getHostTimeNs()),
+        _timeBase(1000000000000LL)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "clocktest";
+    }
+
+    bool hasHardwareTime(const std::string &) const
+    {
+        return true;
+    }
+
+    long long getHardwareTime(const std::string &) const
+    {
+        numTimeReads++;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        return this->timeAt(SoapySDR::TimeTracker::getHostTimeNs());
+    }
+
+    void setHardwareTime(const long long timeNs, const std::string &)
+    {
+        _hostBase = SoapySDR::TimeTracker::getHostTimeNs();
+        _timeBase = timeNs;
+    }
+
+    long long timeAt(const long long hostTimeNs) const
+    {
+        return _timeBase + std::llround((hostTimeNs - _hostBase)*(1.0 + DRIFT_PPM*1e-6));
+    }
+
+private:
+    std::atomic<long long> _hostBase;
+    std::atomic<long long> _timeBase;
+};
+
+static SoapySDR::KwargsList findClockTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "clocktest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeClockTest(const SoapySDR::Kwargs &)
+{
+    return new ClockTestDevice();
+}
+
+static SoapySDR::Registry registerClockTest("clocktest", &findClockTest, &makeClockTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testSampling(ClockTestDevice &clock)
+{
+    printf("Test the estimate from background samples...\n");
+    SoapySDR::TimeTracker tracker(&clock);
+    CHECK(not tracker.estimateHardwareTime().valid);
+    tracker.start(5000000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    tracker.stop();
+
+    //estimates are made without reading the device
+    const int readsBefore = numTimeReads;
+    for (int i = 0; i < 5; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        const auto host = SoapySDR::TimeTracker::getHostTimeNs();
+        const auto estimate = tracker.estimateHardwareTime(host);
+        CHECK(estimate.valid);
+        CHECK(estimate.errorNs < 10000000);
+        CHECK(std::llabs(estimate.timeNs - clock.timeAt(host)) <= estimate.errorNs);
+    }
+    CHECK(numTimeReads == readsBefore);
+    CHECK(readsBefore > 5);
+    return true;
+}
+
+static bool testStreamTimes(ClockTestDevice &clock)
+{
+    printf("Test the estimate from stream timestamps...\n");
+    SoapySDR::TimeTracker tracker(&clock);
+    const double rate = 1e6;
+    const size_t numElems = 1000;
+    const long long host0 = SoapySDR::TimeTracker::getHostTimeNs();
+    for (int i = 0; i < 20; i++)
+    {
+        //the buffer ends at the host time of the call
+        const auto host = SoapySDR::TimeTracker::getHostTimeNs();
+        tracker.addStreamTime(SOAPY_SDR_HAS_TIME, clock.timeAt(host) - 1000000, numElems, rate);
+        tracker.addStreamTime(0, 0, numElems, rate);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    const auto host = SoapySDR::TimeTracker::getHostTimeNs();
+    const auto estimate = tracker.estimateHardwareTime(host);
+    CHECK(estimate.valid);
+    CHECK(estimate.errorNs < 10000000);
+
+    //the estimate lags by the time between the buffer end and the call
+    CHECK(estimate.timeNs <= clock.timeAt(host) + estimate.errorNs);
+    CHECK(estimate.timeNs >= clock.timeAt(host) - estimate.errorNs - 10000000);
+
+    printf("Test lagging stream timestamps are within the error bound...\n");
+    tracker.reset();
+    for (int i = 0; i < 20; i++)
+    {
+        const auto host = SoapySDR::TimeTracker::getHostTimeNs();
+        tracker.addStreamTime(SOAPY_SDR_HAS_TIME, clock.timeAt(host) - 6000000, numElems, rate, 6000000);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const auto lagHost = SoapySDR::TimeTracker::getHostTimeNs();
+    const auto lagged = tracker.estimateHardwareTime(lagHost);
+    CHECK(std::llabs(lagged.timeNs - clock.timeAt(lagHost)) <= lagged.errorNs);
+
+    //an accurate sample corrects the estimate and the stream lag stays in the bound
+    tracker.sample();
+    const auto sampledHost = SoapySDR::TimeTracker::getHostTimeNs();
+    const auto sampled = tracker.estimateHardwareTime(sampledHost);
+    printf("  lagging estimate error %lld ns, bound %lld ns\n", sampled.timeNs - clock.timeAt(sampledHost), sampled.errorNs);
+    CHECK(std::llabs(sampled.timeNs - clock.timeAt(sampledHost)) <= sampled.errorNs);
+    CHECK(std::llabs(sampled.timeNs - clock.timeAt(sampledHost)) < 1000000);
+
+    printf("Test the drift is fit from exact timestamps...\n");
+    tracker.reset();
+    CHECK(not tracker.estimateHardwareTime().valid);
+    for (long long t = 0; t < 1000000000; t += 100000000)
+    {
+        tracker.addTimestamp(clock.timeAt(host0 + t), host0 + t);
+    }
+    const auto exact = tracker.estimateHardwareTime(host0 + 2000000000);
+    CHECK(std::abs(exact.driftPpm - DRIFT_PPM) < 0.1);
+    CHECK(std::llabs(exact.timeNs - clock.timeAt(host0 + 2000000000)) <= exact.errorNs);
+    CHECK(exact.errorNs < 100);
+    return true;
+}
+
+static bool testTimeJump(ClockTestDevice &clock)
+{
+    printf("Test the model restarts when the time is set...\n");
+    SoapySDR::TimeTracker tracker(&clock);
+    for (int i = 0; i < 5; i++)
+    {
+        tracker.sample();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    clock.setHardwareTime(0, "");
+    tracker.sample();
+
+    const auto host = SoapySDR::TimeTracker::getHostTimeNs();
+    const auto estimate = tracker.estimateHardwareTime(host);
+    CHECK(std::llabs(estimate.timeNs - clock.timeAt(host)) <= estimate.errorNs);
+    CHECK(estimate.timeNs < 1000000000);
+    return true;
+}
+
+int main(void)
+{
+    ClockTestDevice clock;
+    bool ok = testSampling(clock);
+    ok = ok and testStreamTimes(clock);
+    ok = ok and testTimeJump(clock);
+
+    //the tracker works through the factory layers
+    auto device = SoapySDR::Device::make("driver=clocktest");
+    SoapySDR::TimeTracker tracker(device);
+    tracker.sample();
+    ok = ok and tracker.estimateHardwareTime().valid;
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,293 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Device.h>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/TimeTracker.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <string>
+#include "TestHelpers.hpp"
+
+/*!
+ * A configuration call made on the test driver,
+ * with the command time and the hardware time of the call.
+ */
+struct Call
+{
+    std::string what;
+    double value;
+    long long commandTimeNs;
+    long long callTimeNs;
+};
+
+/*!
+ * A driver with a hardware clock which records its configuration
+ * calls, and which has a hardware command FIFO of a fixed depth
+ * when made with the fifo argument. The slow argument makes
+ * setting the frequency take 100 ms.
+ */
+class CommandTestDevice : public SoapySDR::Device
+{
+public:
+    CommandTestDevice(const SoapySDR::Kwargs &args):
+        _fifoDepth(args.count("fifo")?std::stoul(args.at("fifo")):0),
+        _slow(args.count("slow") != 0),
+        _hostBase(SoapySDR::TimeTracker::getHostTimeNs()),
+        _commandTimeNs(0)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "cmdtest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    bool hasHardwareTime(const std::string &) const
+    {
+        return true;
+    }
+
+    long long getHardwareTime(const std::string &) const
+    {
+        return SoapySDR::TimeTracker::getHostTimeNs() - _hostBase;
+    }
+
+    void setHardwareTime(const long long timeNs, const std::string &what)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (what == "CMD") _commandTimeNs = timeNs;
+    }
+
+    void setFrequency(const int, const size_t, const double frequency, const SoapySDR::Kwargs &)
+    {
+        if (_slow) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        this->record("freq", frequency);
+    }
+
+    std::vector<std::string> listGains(const int, const size_t) const
+    {
+        return {"LNA", "VGA"};
+    }
+
+    void setGain(const int, const size_t, const std::string &name, const double value)
+    {
+        this->record(name, value);
+    }
+
+    double getGain(const int, const size_t, const std::string &) const
+    {
+        return 0.0;
+    }
+
+    SoapySDR::GainTable getGainTable(const int, const size_t) const
+    {
+        SoapySDR::GainTable table;
+        table.elements = {"LNA", "VGA"};
+        table.gains = {0.0, 10.0, 20.0};
+        table.values = {0.0, 0.0, 10.0, 0.0, 10.0, 10.0};
+        return table;
+    }
+
+    void writeGPIO(const std::string &bank, const unsigned value, const unsigned mask)
+    {
+        this->record(bank, double(value & mask));
+    }
+
+    size_t queueCommands(const SoapySDR::TimedCommandList &commands)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const size_t numAccepted = std::min(commands.size(), _fifoDepth - std::min(_fifoDepth, fifo.size()));
+        fifo.insert(fifo.end(), commands.begin(), commands.begin() + numAccepted);
+        return numAccepted;
+    }
+
+    std::vector<Call> getCalls(void)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _calls;
+    }
+
+    SoapySDR::TimedCommandList fifo;
+
+private:
+    void record(const std::string &what, const double value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _calls.push_back({what, value, _commandTimeNs, this->getHardwareTime("")});
+    }
+
+    const size_t _fifoDepth;
+    const bool _slow;
+    const long long _hostBase;
+    std::mutex _mutex;
+    long long _commandTimeNs;
+    std::vector<Call> _calls;
+};
+
+static CommandTestDevice *lastDevice = nullptr;
+
+static SoapySDR::KwargsList findCommandTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "cmdtest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeCommandTest(const SoapySDR::Kwargs &args)
+{
+    lastDevice = new CommandTestDevice(args);
+    return lastDevice;
+}
+
+static SoapySDR::Registry registerCommandTest("cmdtest", &findCommandTest, &makeCommandTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testScheduler(void)
+{
+    printf("Test the library applies commands just in time...\n");
+    auto device = SoapySDR::Device::make("driver=cmdtest, command_lead=20000");
+    auto driver = lastDevice;
+    const long long t0 = device->getHardwareTime() + 50000000;
+
+    //queued out of order, with a command that is already late
+    SoapySDR::TimedCommandList commands;
+    commands.push_back(SoapySDR::TimedCommand::gpio(t0 + 40000000, "MAIN", 0x3, 0x1));
+    commands.push_back(SoapySDR::TimedCommand::frequency(t0, SOAPY_SDR_RX, 0, 1e9));
+    commands.push_back(SoapySDR::TimedCommand::gain(t0 + 20000000, SOAPY_SDR_RX, 0, 15.0));
+    commands.push_back(SoapySDR::TimedCommand::frequency(t0 - 100000000, SOAPY_SDR_RX, 0, 2e9));
+    CHECK(device->queueCommands(commands) == commands.size());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    const auto calls = driver->getCalls();
+    CHECK(calls.size() == 5);
+    CHECK(calls[0].what == "freq" and calls[0].value == 2e9);
+    CHECK(calls[1].what == "freq" and calls[1].value == 1e9);
+    CHECK(calls[1].commandTimeNs == t0);
+
+    //the overall gain uses the row of the gain table
+    CHECK(calls[2].what == "LNA" and calls[2].value == 10.0);
+    CHECK(calls[3].what == "VGA" and calls[3].value == 0.0);
+    CHECK(calls[3].commandTimeNs == t0 + 20000000);
+    CHECK(calls[4].what == "MAIN" and calls[4].value == 1.0);
+    for (size_t i = 1; i < calls.size(); i++)
+    {
+        CHECK(calls[i].callTimeNs <= calls[i].commandTimeNs);
+        CHECK(calls[i].callTimeNs > calls[i].commandTimeNs - 100000000);
+    }
+
+    const auto stats = device->getCommandQueueStats();
+    CHECK(stats.numQueued == 4);
+    CHECK(stats.numOffloaded == 0);
+    CHECK(stats.numApplied == 4);
+    CHECK(stats.numLate == 1);
+    CHECK(stats.maxLateNs >= 40000000);
+    CHECK(stats.numPending == 0);
+
+    printf("Test clearing the queued commands...\n");
+    commands.clear();
+    commands.push_back(SoapySDR::TimedCommand::frequency(device->getHardwareTime() + 1000000000, SOAPY_SDR_RX, 0, 3e9));
+    device->queueCommands(commands);
+    device->clearCommands();
+    CHECK(device->getCommandQueueStats().numPending == 0);
+    CHECK(driver->getCalls().size() == 5);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testOffload(void)
+{
+    printf("Test commands go to the driver FIFO first...\n");
+    auto device = SoapySDR::Device::make("driver=cmdtest, fifo=2");
+    auto driver = lastDevice;
+    const long long t0 = device->getHardwareTime() + 20000000;
+
+    SoapySDR::TimedCommandList commands;
+    for (int i = 0; i < 3; i++) commands.push_back(SoapySDR::TimedCommand::frequency(t0 + i*1000000, SOAPY_SDR_RX, 0, 1e9 + i));
+    CHECK(device->queueCommands(commands) == 3);
+    CHECK(driver->fifo.size() == 2);
+
+    //the command which did not fit is applied by the library
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CHECK(driver->getCalls().size() == 1);
+    CHECK(driver->getCalls()[0].value == 1e9 + 2);
+
+    const auto stats = device->getCommandQueueStats();
+    CHECK(stats.numQueued == 3);
+    CHECK(stats.numOffloaded == 2);
+    CHECK(stats.numApplied == 1);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testSerialized(void)
+{
+    printf("Test setters are not applied at the time of a scheduled command...\n");
+    auto device = SoapySDR::Device::make("driver=cmdtest, slow=1");
+    auto driver = lastDevice;
+    const long long t0 = device->getHardwareTime() + 20000000;
+    SoapySDR::TimedCommandList commands;
+    commands.push_back(SoapySDR::TimedCommand::frequency(t0, SOAPY_SDR_RX, 0, 1e9));
+    device->queueCommands(commands);
+
+    //made while the scheduler is inside the slow frequency call
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    device->setGain(SOAPY_SDR_RX, 0, "VGA", 3.0);
+    const auto calls = driver->getCalls();
+    CHECK(calls.size() == 2);
+    CHECK(calls[0].what == "freq" and calls[0].commandTimeNs == t0);
+    CHECK(calls[1].what == "VGA" and calls[1].commandTimeNs == 0);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testCAPI(void)
+{
+    printf("Test the C API...\n");
+    auto device = SoapySDRDevice_makeStrArgs("driver=cmdtest");
+    auto driver = lastDevice;
+    SoapySDRTimedCommand commands[2] = {};
+    commands[0].timeNs = SoapySDRDevice_getHardwareTime(device, nullptr) + 10000000;
+    commands[0].type = SOAPY_SDR_COMMAND_GAIN;
+    commands[0].direction = SOAPY_SDR_RX;
+    commands[0].name = "VGA";
+    commands[0].value = 5.0;
+    commands[1] = commands[0];
+    commands[1].type = SOAPY_SDR_COMMAND_GPIO;
+    commands[1].name = "AUX";
+    commands[1].gpioValue = 0xf0;
+    commands[1].gpioMask = 0x30;
+    CHECK(SoapySDRDevice_queueCommands(device, commands, 2) == 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    SoapySDRCommandQueueStats stats;
+    CHECK(SoapySDRDevice_getCommandQueueStats(device, &stats) == 0);
+    CHECK(stats.numApplied == 2);
+    const auto calls = driver->getCalls();
+    CHECK(calls.size() == 2);
+    CHECK(calls[0].what == "VGA" and calls[0].value == 5.0);
+    CHECK(calls[1].what == "AUX" and calls[1].value == 0x30);
+    SoapySDRDevice_unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = testScheduler();
+    ok = ok and testOffload();
+    ok = ok and testSerialized();
+    ok = ok and testCAPI();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <complex>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "TestHelpers.hpp"
+
+static const char TRACE_FILE[] = "TestTraceLayer.json";
+
+static bool testTraceStats(SoapySDR::Device *device)
+{
+    printf("Test per-method statistics...\n");
+    device->writeSetting("trace_reset", "true");
+    CHECK(jsonCount(device->readSetting("trace_stats"), "setFrequency", "calls") == -1);
+
+    for (size_t i = 0; i < 10; i++) device->setFrequency(SOAPY_SDR_RX, 0, 100e6 + i*1e6);
+    for (size_t i = 0; i < 5; i++) device->getFrequency(SOAPY_SDR_RX, 0);
+
+    std::vector<std::complex<float>> buff(1024);
+    void *buffs[] = {buff.data()};
+    int flags = 0;
+    long long timeNs = 0;
+    auto stream = device->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32);
+    CHECK(device->activateStream(stream) == 0);
+    for (size_t i = 0; i < 20; i++) CHECK(device->readStream(stream, buffs, buff.size(), flags, timeNs) > 0);
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+
+    const auto json = device->readSetting("trace_stats");
+    printf("%s\n", json.c_str());
+    CHECK(jsonCount(json, "setFrequency", "calls") == 10);
+    CHECK(jsonCount(json, "getFrequency", "calls") >= 5);
+    CHECK(jsonCount(json, "readStream", "calls") == 20);
+    CHECK(jsonCount(json, "setupStream", "calls") == 1);
+    CHECK(json.find("\"p99_us\"") != std::string::npos);
+
+    //settings of the driver still pass through
+    CHECK(device->readSetting("noise_ampl") != "");
+    CHECK(device->getSettingInfo("trace_stats").key == "trace_stats");
+
+    device->writeSetting("trace_reset", "true");
+    CHECK(jsonCount(device->readSetting("trace_stats"), "readStream", "calls") == -1);
+    return true;
+}
+
+static bool testTraceFile(void)
+{
+    printf("Test the trace-event file...\n");
+    std::ifstream file(TRACE_FILE);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    const auto text = ss.str();
+    CHECK(text.compare(0, 1, "[") == 0);
+    CHECK(text.find("]\n", text.size()-2) != std::string::npos);
+    CHECK(text.find("\"name\":\"setFrequency\",\"cat\":\"SoapySDR\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(text.find("\"name\":\"readStream\"") != std::string::npos);
+    std::remove(TRACE_FILE);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make(std::string("driver=sim,clock=virtual,trace=1,trace_file=") + TRACE_FILE);
+
+    bool ok = testTraceStats(device);
+    SoapySDR::Device::unmake(device);
+    ok = ok and testTraceFile();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,314 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <complex>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "TestHelpers.hpp"
+
+static const double RATE = 1e6;
+static const size_t MTU = 1000;
+
+//a write made on the test driver
+struct Write
+{
+    size_t numElems;
+    int flags;
+    long long timeNs;
+    long long callTimeNs;
+    float first;
+};
+
+/*!
+ * A transmit driver which records its writes. Each write takes
+ * as long as its samples take to transmit, so continuous mode is paced.
+ * The notime argument makes a driver without a hardware clock,
+ * the status argument makes a status read which waits out its timeout.
+ */
+class TxTestDevice : public SoapySDR::Device
+{
+public:
+    TxTestDevice(const SoapySDR::Kwargs &args):
+        _hasTime(args.count("notime") == 0),
+        _hasStatus(args.count("status") != 0),
+        _epoch(std::chrono::steady_clock::now())
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "txtest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    double getSampleRate(const int, const size_t) const
+    {
+        return RATE;
+    }
+
+    bool hasHardwareTime(const std::string &what) const
+    {
+        return _hasTime and what.empty();
+    }
+
+    long long getHardwareTime(const std::string &) const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _epoch).count();
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &, const std::vector<size_t> &, const SoapySDR::Kwargs &)
+    {
+        return reinterpret_cast<SoapySDR::Stream *>(this);
+    }
+
+    void closeStream(SoapySDR::Stream *)
+    {
+        return;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return MTU;
+    }
+
+    int activateStream(SoapySDR::Stream *, const int, const long long, const size_t)
+    {
+        return 0;
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long)
+    {
+        if (not _hasTime and (flags & SOAPY_SDR_HAS_TIME) != 0) return SOAPY_SDR_NOT_SUPPORTED;
+        const auto first = reinterpret_cast<const std::complex<float> *>(buffs[0])[0].real();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _writes.push_back({numElems, flags, timeNs, this->getHardwareTime(""), first});
+        }
+        std::this_thread::sleep_for(std::chrono::nanoseconds(SoapySDR::ticksToTimeNs(numElems, RATE)));
+        return int(numElems);
+    }
+
+    int readStreamStatus(SoapySDR::Stream *, size_t &, int &, long long &, const long timeoutUs)
+    {
+        if (not _hasStatus) return SOAPY_SDR_NOT_SUPPORTED;
+        std::this_thread::sleep_for(std::chrono::microseconds(timeoutUs));
+        return SOAPY_SDR_TIMEOUT;
+    }
+
+    std::vector<Write> getWrites(void)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _writes;
+    }
+
+private:
+    const bool _hasTime;
+    const bool _hasStatus;
+    const std::chrono::steady_clock::time_point _epoch;
+    std::mutex _mutex;
+    std::vector<Write> _writes;
+};
+
+static TxTestDevice *lastDevice = nullptr;
+
+static SoapySDR::KwargsList findTxTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "txtest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeTxTest(const SoapySDR::Kwargs &args)
+{
+    lastDevice = new TxTestDevice(args);
+    return lastDevice;
+}
+
+static SoapySDR::Registry registerTxTest("txtest", &findTxTest, &makeTxTest, SOAPY_SDR_ABI_VERSION);
+
+//write a burst of ones at the given time
+static int writeBurst(SoapySDR::Device *device, SoapySDR::Stream *stream, const size_t numElems, const long long timeNs)
+{
+    std::vector<std::complex<float>> buff(numElems, std::complex<float>(1.0f));
+    const void *buffs[] = {buff.data()};
+    int flags = SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST;
+    return device->writeStream(stream, buffs, numElems, flags, timeNs);
+}
+
+static bool testTimedBursts(void)
+{
+    printf("Test scheduled bursts carry their time to the driver...\n");
+    auto device = SoapySDR::Device::make("driver=txtest, stream_layer=1");
+    auto driver = lastDevice;
+
+    //a lead time which covers the wakeup latency of a loaded host
+    auto stream = device->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CF32, {}, {{"SCHEDULER", "true"}, {"SCHEDULER_LEAD", "10000"}});
+    CHECK(device->activateStream(stream) == 0);
+
+    //queued out of order, the second burst spans two driver writes
+    const long long t0 = device->getHardwareTime() + 50000000;
+    CHECK(writeBurst(device, stream, 500, t0 + 20000000) == 500);
+    CHECK(writeBurst(device, stream, 1500, t0) == 1500);
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+
+    const auto writes = driver->getWrites();
+    CHECK(writes.size() == 3);
+    CHECK(writes[0].numElems == MTU);
+    CHECK(writes[0].flags == SOAPY_SDR_HAS_TIME);
+    CHECK(writes[0].timeNs == t0);
+    CHECK(writes[1].numElems == 500);
+    CHECK(writes[1].flags == SOAPY_SDR_END_BURST);
+    CHECK(writes[2].flags == (SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST));
+    CHECK(writes[2].timeNs == t0 + 20000000);
+
+    //released no earlier than the lead time
+    CHECK(writes[0].callTimeNs >= t0 - 10000000);
+
+    printf("Test late bursts are reported and the status queue is bounded...\n");
+    const long long late = device->getHardwareTime() - 1000000000;
+    for (size_t i = 0; i < 2000; i++) CHECK(writeBurst(device, stream, 10, late + i) == 10);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    size_t numStatus = 0;
+    size_t chanMask = 0;
+    int flags = 0;
+    long long timeNs = 0;
+    while (device->readStreamStatus(stream, chanMask, flags, timeNs, 0) == SOAPY_SDR_TIME_ERROR) numStatus++;
+    CHECK(numStatus > 0 and numStatus <= 1024);
+    CHECK(timeNs == late + 1999);
+    CHECK(driver->getWrites().size() == 3);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testHostPacing(void)
+{
+    printf("Test bursts are paced by the host without a hardware clock...\n");
+    auto device = SoapySDR::Device::make("driver=txtest, notime=1, stream_layer=1");
+    auto driver = lastDevice;
+
+    //the lead time is the allowed lateness, which covers the wakeup latency of a loaded host
+    auto stream = device->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CF32, {}, {{"SCHEDULER", "true"}, {"SCHEDULER_LEAD", "10000"}});
+    CHECK(device->activateStream(stream) == 0);
+
+    const long long t0 = driver->getHardwareTime("") + 30000000;
+    CHECK(writeBurst(device, stream, 100, t0) == 100);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const auto writes = driver->getWrites();
+    CHECK(writes.size() == 1);
+    CHECK(writes[0].flags == SOAPY_SDR_END_BURST);
+    CHECK(writes[0].callTimeNs >= t0);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testContinuous(void)
+{
+    printf("Test continuous mode places the burst at its time in the stream...\n");
+    auto device = SoapySDR::Device::make("driver=txtest, stream_layer=1");
+    auto driver = lastDevice;
+    auto stream = device->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CF32, {}, {{"SCHEDULER", "true"}, {"CONTINUOUS", "true"}});
+    CHECK(device->activateStream(stream) == 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    const auto first = driver->getWrites();
+    CHECK(not first.empty());
+    CHECK(first[0].flags == SOAPY_SDR_HAS_TIME);
+    const long long startNs = first[0].timeNs;
+    const long long burstNs = startNs + SoapySDR::ticksToTimeNs(40500, RATE);
+    CHECK(writeBurst(device, stream, 200, burstNs) == 200);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    //the burst follows exactly the zeros from the start up to its time
+    const auto writes = driver->getWrites();
+    size_t offset = 0;
+    size_t i = 0;
+    while (i < writes.size() and writes[i].first == 0.0f) offset += writes[i++].numElems;
+    CHECK(i < writes.size());
+    CHECK(offset == 40500);
+    CHECK(writes[i].numElems == 200);
+    for (size_t j = 1; j < writes.size(); j++) CHECK((writes[j].flags & SOAPY_SDR_HAS_TIME) == 0);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testStatusAndQueue(void)
+{
+    printf("Test scheduler events are reported while the driver status waits...\n");
+    auto device = SoapySDR::Device::make("driver=txtest, status=1, stream_layer=1");
+    auto driver = lastDevice;
+    auto stream = device->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CF32, {}, {{"SCHEDULER", "true"}, {"SCHEDULER_LEAD", "10000"}, {"SCHEDULER_QUEUE", "1000"}});
+    CHECK(device->activateStream(stream) == 0);
+
+    //the late burst is reported long before the status timeout
+    const long long late = device->getHardwareTime() - 1000000000;
+    const auto t0 = std::chrono::steady_clock::now();
+    CHECK(writeBurst(device, stream, 10, late) == 10);
+    size_t chanMask = 0;
+    int flags = 0;
+    long long timeNs = 0;
+    CHECK(device->readStreamStatus(stream, chanMask, flags, timeNs, 2000000) == SOAPY_SDR_TIME_ERROR);
+    CHECK(timeNs == late);
+    CHECK(std::chrono::steady_clock::now() - t0 < std::chrono::seconds(1));
+    CHECK(device->readStreamStatus(stream, chanMask, flags, timeNs, 20000) == SOAPY_SDR_TIMEOUT);
+
+    printf("Test a write larger than the queue is taken when the queue is empty...\n");
+    const long long t1 = device->getHardwareTime() + 30000000;
+    CHECK(writeBurst(device, stream, 2500, t1) == 2500);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    size_t total = 0;
+    for (const auto &w : driver->getWrites()) total += w.numElems;
+    CHECK(total == 2500);
+
+    device->deactivateStream(stream);
+    device->closeStream(stream);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+static bool testWithoutLayer(void)
+{
+    printf("Test devices made without the stream layer keep the driver streams...\n");
+    auto device = SoapySDR::Device::make("driver=txtest");
+    auto driver = lastDevice;
+    auto stream = device->setupStream(SOAPY_SDR_TX, SOAPY_SDR_CF32);
+    CHECK(stream == reinterpret_cast<SoapySDR::Stream *>(driver));
+    for (const auto &info : device->getStreamArgsInfo(SOAPY_SDR_TX, 0)) CHECK(info.key != "SCHEDULER");
+    device->closeStream(stream);
+    SoapySDR::Device::unmake(device);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = testTimedBursts();
+    ok = ok and testHostPacing();
+    ok = ok and testContinuous();
+    ok = ok and testStatusAndQueue();
+    ok = ok and testWithoutLayer();
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,200 @@
+// Copyright (c) 2026-2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Registry.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <map>
+#include <string>
+#include "TestHelpers.hpp"
+
+//string and typed calls made on the test driver
+static int numStringCalls = 0;
+static int numTypedCalls = 0;
+
+/*!
+ * A driver which stores its global settings natively and implements
+ * the typed calls for them, and which implements only the string calls
+ * for its channel settings and sensors, so those use the defaults.
+ */
+class TypedTestDevice : public SoapySDR::Device
+{
+public:
+    TypedTestDevice(void):
+        _enable(false),
+        _count(0),
+        _gain(0.0)
+    {
+        return;
+    }
+
+    std::string getDriverKey(void) const
+    {
+        return "typedtest";
+    }
+
+    size_t getNumChannels(const int) const
+    {
+        return 1;
+    }
+
+    void writeSetting(const std::string &key, const std::string &value)
+    {
+        numStringCalls++;
+        if (key == "enable") _enable = SoapySDR::StringToSetting<bool>(value);
+        if (key == "count") _count = SoapySDR::StringToSetting<long long>(value);
+        if (key == "gain") _gain = SoapySDR::StringToSetting<double>(value);
+        if (key == "name") _name = value;
+    }
+
+    std::string readSetting(const std::string &key) const
+    {
+        numStringCalls++;
+        if (key == "enable") return SoapySDR::SettingToString(_enable);
+        if (key == "count") return SoapySDR::SettingToString(_count);
+        if (key == "gain") return SoapySDR::SettingToString(_gain);
+        return _name;
+    }
+
+    void writeSettingBool(const std::string &, const bool value)
+    {
+        numTypedCalls++;
+        _enable = value;
+    }
+
+    void writeSettingInt(const std::string &, const long long value)
+    {
+        numTypedCalls++;
+        _count = value;
+    }
+
+    void writeSettingFloat(const std::string &, const double value)
+    {
+        numTypedCalls++;
+        _gain = value;
+    }
+
+    bool readSettingBool(const std::string &) const
+    {
+        numTypedCalls++;
+        return _enable;
+    }
+
+    long long readSettingInt(const std::string &) const
+    {
+        numTypedCalls++;
+        return _count;
+    }
+
+    double readSettingFloat(const std::string &) const
+    {
+        numTypedCalls++;
+        return _gain;
+    }
+
+    void writeSetting(const int, const size_t, const std::string &key, const std::string &value)
+    {
+        numStringCalls++;
+        _channelSettings[key] = value;
+    }
+
+    std::string readSetting(const int, const size_t, const std::string &key) const
+    {
+        numStringCalls++;
+        const auto it = _channelSettings.find(key);
+        return (it == _channelSettings.end())?"":it->second;
+    }
+
+    std::string readSensor(const std::string &key) const
+    {
+        numStringCalls++;
+        if (key == "lock") return "true";
+        if (key == "temp") return "42.5";
+        return "-7";
+    }
+
+private:
+    bool _enable;
+    long long _count;
+    double _gain;
+    std::string _name;
+    std::map<std::string, std::string> _channelSettings;
+};
+
+static SoapySDR::KwargsList findTypedTest(const SoapySDR::Kwargs &args)
+{
+    if (args.count("driver") == 0 or args.at("driver") != "typedtest") return {};
+    return {args};
+}
+
+static SoapySDR::Device *makeTypedTest(const SoapySDR::Kwargs &)
+{
+    return new TypedTestDevice();
+}
+
+static SoapySDR::Registry registerTypedTest("typedtest", &findTypedTest, &makeTypedTest, SOAPY_SDR_ABI_VERSION);
+
+static bool testTypedCalls(SoapySDR::Device *device)
+{
+    printf("Test the templates use the typed calls...\n");
+    numStringCalls = numTypedCalls = 0;
+    device->writeSetting("enable", true);
+    device->writeSetting("count", 1234);
+    device->writeSetting("gain", 10.5f);
+    CHECK(device->readSetting<bool>("enable"));
+    CHECK(device->readSetting<int>("count") == 1234);
+    CHECK(device->readSetting<float>("gain") == 10.5f);
+    CHECK(numTypedCalls == 6);
+    CHECK(numStringCalls == 0);
+
+    printf("Test the string calls see the typed values...\n");
+    CHECK(device->readSetting("enable") == "true");
+    CHECK(device->readSetting("count") == "1234");
+    CHECK(SoapySDR::StringToSetting<double>(device->readSetting("gain")) == 10.5);
+
+    printf("Test other types use the string calls...\n");
+    numStringCalls = numTypedCalls = 0;
+    device->writeSetting("name", "hello");
+    CHECK(device->readSetting<std::string>("name") == "hello");
+    device->writeSetting("name", 18446744073709551615ull);
+    CHECK(device->readSetting<unsigned long long>("name") == 18446744073709551615ull);
+    CHECK(numTypedCalls == 0);
+    CHECK(numStringCalls == 4);
+    return true;
+}
+
+static bool testDefaults(SoapySDR::Device *device)
+{
+    printf("Test the default typed calls use the string calls...\n");
+    numStringCalls = numTypedCalls = 0;
+    device->writeSetting(SOAPY_SDR_RX, 0, "enable", false);
+    device->writeSettingInt(SOAPY_SDR_RX, 0, "count", -5);
+    device->writeSetting(SOAPY_SDR_RX, 0, "gain", 0.25);
+    CHECK(device->readSetting(SOAPY_SDR_RX, 0, "enable") == "false");
+    CHECK(device->readSetting(SOAPY_SDR_RX, 0, "count") == "-5");
+    CHECK(not device->readSettingBool(SOAPY_SDR_RX, 0, "enable"));
+    CHECK(device->readSetting<short>(SOAPY_SDR_RX, 0, "count") == -5);
+    CHECK(device->readSettingFloat(SOAPY_SDR_RX, 0, "gain") == 0.25);
+    CHECK(numStringCalls == 8);
+
+    printf("Test the default typed sensor reads...\n");
+    CHECK(device->readSensorBool("lock"));
+    CHECK(device->readSensor<double>("temp") == 42.5);
+    CHECK(device->readSensorInt("rssi") == -7);
+    CHECK(numTypedCalls == 0);
+    return true;
+}
+
+int main(void)
+{
+    auto device = SoapySDR::Device::make("driver=typedtest");
+
+    bool ok = testTypedCalls(device);
+    ok = ok and testDefaults(device);
+    SoapySDR::Device::unmake(device);
+
+    if (not ok) return EXIT_FAILURE;
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}